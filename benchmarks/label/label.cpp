@@ -1,6 +1,8 @@
 #include "benchmark/benchmark.h"
 #include <filesystem>
+#include <random>
 #include <poutre/base/config.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/io/loader.hpp>
 #include <poutre/label/label_binary.hpp>
@@ -43,6 +45,40 @@ BENCHMARK_DEFINE_F(FixtureLabelBinary, label_binary)(benchmark::State &state)
 }
 BENCHMARK_REGISTER_F(FixtureLabelBinary, label_binary)->Unit(benchmark::kMicrosecond);
 
+class FixtureLabelBinarySparse : public ::benchmark::Fixture
+{
+public:
+  void SetUp(const ::benchmark::State &state) override
+  {
+    const auto size = static_cast<std::size_t>(state.range(0));
+    auto img = std::make_unique<poutre::details::image_t<poutre::pUINT8, 2>>(std::vector<std::size_t>{ size, size });
+    // ~5% foreground, small blobs
+    std::mt19937 gen(42);
+    for (std::size_t i = 0; i < img->size(); ++i) { (*img)[i] = (gen() % 100U) < 5U ? 255 : 0; }
+    m_img = std::move(img);
+    m_out = poutre::ConvertGeometry(*m_img, poutre::PType::PType_GrayINT64);
+  }
+  void TearDown(const ::benchmark::State & /*unused*/) override
+  {
+    m_img.reset();
+    m_out.reset();
+  }
+
+  std::unique_ptr<poutre::IInterface> m_img;
+  std::unique_ptr<poutre::IInterface> m_out;
+};
+
+// cppcheck-suppress unknownMacro
+BENCHMARK_DEFINE_F(FixtureLabelBinarySparse, label_binary_sparse)(benchmark::State &state)
+{
+  for (auto _ : state) { poutre::label::label_binary(*m_img, poutre::se::Common_NL_SE::SESquare2D, *m_out); }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK_REGISTER_F(FixtureLabelBinarySparse, label_binary_sparse)
+  ->RangeMultiplier(2)
+  ->Range(512, 4096)
+  ->Unit(benchmark::kMicrosecond);
+
 class FixtureLabelFlatZones : public ::benchmark::Fixture
 {
 public:
@@ -12,6 +12,7 @@
 
 #include "benchmark/benchmark.h"
 #include <poutre/base/types.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_static_se_t.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
@@ -76,6 +77,41 @@ BENCHMARK_DEFINE_F(EroDilFixture, DilateSquare3DStatic)(benchmark::State &state)
   state.SetItemsProcessed(state.iterations() * size);
 }
 
+// thread scaling of row strips, range(1) is the number of threads
+// cppcheck-suppress unknownMacro
+BENCHMARK_DEFINE_F(EroDilFixture, DilateSquare2DStaticThreads)(benchmark::State &state)
+{
+  const auto size = state.range(0);
+  std::ptrdiff_t sizeextent = static_cast<std::ptrdiff_t>(std::sqrt(size));
+  auto &ctx = poutre::ExecutionContext::get();
+  const auto nbthreads = ctx.GetNumThreads();
+  ctx.SetNumThreads(static_cast<std::size_t>(state.range(1)));
+  for (auto _ : state) {
+    auto view2din = poutre::details::av::array_view<const poutre::pINT32, 2>(m_vect_in, { sizeextent, sizeextent});
+    auto view2dout = poutre::details::av::array_view<poutre::pINT32, 2>(m_vect_out, { sizeextent, sizeextent });
+    poutre::llm::details::t_Dilate(view2din, poutre::se::Common_NL_SE::SESquare2D, view2dout);
+  }
+  ctx.SetNumThreads(nbthreads);
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
+// cppcheck-suppress unknownMacro
+BENCHMARK_DEFINE_F(EroDilFixture, ErodeCross2DStaticThreads)(benchmark::State &state)
+{
+  const auto size = state.range(0);
+  std::ptrdiff_t sizeextent = static_cast<std::ptrdiff_t>(std::sqrt(size));
+  auto &ctx = poutre::ExecutionContext::get();
+  const auto nbthreads = ctx.GetNumThreads();
+  ctx.SetNumThreads(static_cast<std::size_t>(state.range(1)));
+  for (auto _ : state) {
+    auto view2din = poutre::details::av::array_view<const poutre::pINT32, 2>(m_vect_in, { sizeextent, sizeextent});
+    auto view2dout = poutre::details::av::array_view<poutre::pINT32, 2>(m_vect_out, { sizeextent, sizeextent });
+    poutre::llm::details::t_Erode(view2din, poutre::se::Common_NL_SE::SECross2D, view2dout);
+  }
+  ctx.SetNumThreads(nbthreads);
+  state.SetItemsProcessed(state.iterations() * size);
+}
+
 // cppcheck-suppress unknownMacro
 BENCHMARK_DEFINE_F(EroDilFixture, DilateSquare2DRuntime)(benchmark::State &state)
 {
@@ -120,9 +156,9 @@ BENCHMARK_DEFINE_F(EroDilFixture, DilateY2D)(benchmark::State &state)
   const auto size = state.range(0);
   std::ptrdiff_t sizeextent = static_cast<std::ptrdiff_t>(std::sqrt(size));
   for (auto _ : state) {
-    poutre::details::image_t<poutre::pINT32, 2> img_in{ static_cast<std::size_t>(sizeextent), static_cast<std::size_t>(sizeextent)};
-    poutre::details::image_t<poutre::pINT32, 2> img_out{ static_cast<std::size_t>(sizeextent), static_cast<std::size_t>(sizeextent)};
-    poutre::llm::details::t_DilateY(img_in, 15, img_out);
+    auto view2din = poutre::details::av::array_view<const poutre::pINT32, 2>(m_vect_in, { sizeextent, sizeextent});
+    auto view2dout = poutre::details::av::array_view<poutre::pINT32, 2>(m_vect_out, { sizeextent, sizeextent });
+    poutre::llm::details::t_DilateY(view2din, 15, view2dout);
   }
   state.SetItemsProcessed(state.iterations() * size);
 }
@@ -136,6 +172,16 @@ BENCHMARK_REGISTER_F(EroDilFixture, DilateSquare2DStatic)
   ->Arg(512 * 512)
   ->Arg(1024 * 1024)->Unit(benchmark::kMillisecond); //-V112
 
+// cppcheck-suppress unknownMacro
+BENCHMARK_REGISTER_F(EroDilFixture, DilateSquare2DStaticThreads)
+  ->ArgsProduct({ { 1024 * 1024, 4096 * 4096, 8192 * 8192 }, { 1, 2, 4, 8 } })
+  ->UseRealTime()->Unit(benchmark::kMillisecond); //-V112
+
+// cppcheck-suppress unknownMacro
+BENCHMARK_REGISTER_F(EroDilFixture, ErodeCross2DStaticThreads)
+  ->ArgsProduct({ { 1024 * 1024, 4096 * 4096, 8192 * 8192 }, { 1, 2, 4, 8 } })
+  ->UseRealTime()->Unit(benchmark::kMillisecond); //-V112
+
 // cppcheck-suppress unknownMacro
 BENCHMARK_REGISTER_F(EroDilFixture, DilateSquare3DStatic)
   ->Arg(64 * 64 * 64 )
@@ -1,11 +1,33 @@
 # SET DEFAULT SIMD FLAGS
 if(CMAKE_SYSTEM_PROCESSOR MATCHES "(amd64.*)|(x86_64.*)|(AMD64.*)|(i686.*)|(i386.*)|(x86.*)|(AMD64)")
-  if(CMAKE_CXX_COMPILER_ID MATCHES ".*Clang")
-      add_compile_options(-mavx2)
+  if(POUTRE_SIMD_DISPATCH)
+    # portable baseline, dispatched kernels are compiled per arch (see src/base) and selected at load time.
+    # Every SIMD kernel family (transforms, compare/select, morphology lines, transpose) is dispatched, only generic
+    # functor transforms and non dispatched pixel types run at the baseline
+    if(CMAKE_CXX_COMPILER_ID MATCHES ".*Clang" OR CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+        add_compile_options(-msse4.2)
+        set(POUTRE_SIMD_FLAGS_SSE4_2 -msse4.2)
+        set(POUTRE_SIMD_FLAGS_AVX2 -mavx2)
+        set(POUTRE_SIMD_FLAGS_AVX512BW -mavx512f -mavx512cd -mavx512dq -mavx512bw)
+        set(POUTRE_SIMD_DISPATCH_ENABLED ON)
+    elseif(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC" AND MSVC_VERSION GREATER 1900)
+        set(POUTRE_SIMD_FLAGS_SSE4_2 "")
+        set(POUTRE_SIMD_FLAGS_AVX2 /arch:AVX2)
+        set(POUTRE_SIMD_FLAGS_AVX512BW /arch:AVX512)
+        set(POUTRE_SIMD_DISPATCH_ENABLED ON)
+    else()
+       MESSAGE(INFO "simd dispatch not set for '${CMAKE_CXX_COMPILER_ID}' compiler.")
+    endif()
+    if(POUTRE_SIMD_DISPATCH_ENABLED)
+        add_compile_definitions(POUTRE_SIMD_DISPATCH)
+    endif()
+  # no dispatch: portable baseline only, the binary runs on every x86-64 node
+  elseif(CMAKE_CXX_COMPILER_ID MATCHES ".*Clang")
+      add_compile_options(-msse4.2)
   elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
-      add_compile_options(-mavx2)
+      add_compile_options(-msse4.2)
   elseif(CMAKE_CXX_COMPILER_ID STREQUAL "MSVC" AND MSVC_VERSION GREATER 1900)
-      add_compile_options(/arch:AVX2)
+      # SSE2 baseline of x64 compilers, no /arch flag
   else()
      MESSAGE(INFO "simd not set for '${CMAKE_CXX_COMPILER_ID}' compiler.")
   endif()
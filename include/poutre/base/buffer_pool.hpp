@@ -0,0 +1,173 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   buffer_pool.hpp
+ * @author Thomas Retornaz
+ * @brief  Pool of image buffers recycled between operator temporaries
+ *
+ *
+ */
+
+#include <poutre/base/base.hpp>
+#include <poutre/base/config.hpp>
+#include <poutre/base/types.hpp>
+
+#include <compare>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace poutre {
+/**
+ * @addtogroup buffer_pool_group Image buffer pool
+ * @ingroup poutre_base_group
+ *@{
+ */
+
+//! Size class of pooled buffers, buffers are only recycled between images of the same geometry and types
+struct BufferPoolKey
+{
+  std::vector<std::size_t> shape;
+  CompoundType ctype = CompoundType::CompoundType_Undef;
+  PType ptype = PType::PType_Undef;
+
+  auto operator<=>(const BufferPoolKey &) const = default;
+};
+
+//! Counters of @c BufferPool since start (or last @c BufferPool::ResetStats), cached_* are current values
+struct BufferPoolStats
+{
+  std::size_t local_hits = 0;//!< acquisitions served by the calling thread cache
+  std::size_t global_hits = 0;//!< acquisitions served by the shared cache
+  std::size_t misses = 0;//!< acquisitions which allocated
+  std::size_t releases = 0;//!< buffers given back
+  std::size_t evictions = 0;//!< buffers freed because caches were full or trimmed
+  std::size_t cached_buffers = 0;//!< buffers currently held by all caches
+  std::size_t cached_bytes = 0;//!< bytes currently held by all caches
+};
+
+/**
+ * @brief Process wide pool of aligned buffers for same geometry temporaries
+ *
+ * Released buffers are kept in a cache of the releasing thread, and overflow to a shared (mutex guarded) cache,
+ * buffers beyond both capacities are freed. Acquisition looks up the calling thread cache, then the shared one and
+ * allocates on miss. Caches of exiting threads are moved to the shared cache.
+ * Pooled buffers are aligned on @c SIMD_IDEAL_MAX_ALIGN_BYTES and their content is undefined.
+ * Images get pooled storage with @c AllocationMode::Pooled (@see PooledBuffer).
+ * @note use singleton pattern with lazy construct
+ */
+class BASE_API BufferPool
+{
+private:
+  static BufferPool *m_instance;
+  static std::once_flag m_initFlag;
+
+public:
+  //! Default bytes cached per thread
+  static constexpr std::size_t default_thread_capacity = 1UL << 29UL;
+  //! Default bytes cached in the shared cache
+  static constexpr std::size_t default_global_capacity = 1UL << 30UL;
+
+  static BufferPool &get()
+  {
+    std::call_once(m_initFlag, []() { m_instance = new BufferPool(); });
+    return *m_instance;
+  }
+
+  BufferPool(const BufferPool &) = delete;
+  BufferPool &operator=(const BufferPool &) = delete;
+  BufferPool(BufferPool &&other) = delete;
+  BufferPool &operator=(BufferPool &&other) = delete;
+  ~BufferPool();
+
+  /**
+   * @brief Get a buffer of bytes (>0) for key, recycled if one is cached
+   * @throw std::bad_alloc
+   */
+  [[nodiscard]] void *Acquire(const BufferPoolKey &key, std::size_t bytes);
+
+  //! Give back a buffer obtained by Acquire(key,bytes), from any thread
+  void Release(const BufferPoolKey &key, void *buffer, std::size_t bytes) POUTRE_NOEXCEPT;
+
+  //! Free buffers cached by every thread (pool workers included) and by the shared cache
+  void Trim();
+
+  //! Set bytes cached per thread, 0 disables thread caches (already cached buffers are kept until trimmed)
+  void SetThreadCapacity(std::size_t bytes);
+  //! Get bytes cached per thread
+  [[nodiscard]] std::size_t GetThreadCapacity() const;
+
+  //! Set bytes cached in the shared cache, 0 disables it
+  void SetGlobalCapacity(std::size_t bytes);
+  //! Get bytes cached in the shared cache
+  [[nodiscard]] std::size_t GetGlobalCapacity() const;
+
+  //! Snapshot of counters
+  [[nodiscard]] BufferPoolStats GetStats() const;
+  //! Reset hits/misses/releases/evictions counters
+  void ResetStats();
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> m_impl;
+  //! Private ctor
+  BufferPool();
+};
+
+/**
+ * @brief Buffer of @c BufferPool given back on destruction
+ *
+ * Move only, a default constructed or moved from object holds nothing.
+ */
+class PooledBuffer
+{
+public:
+  PooledBuffer() = default;
+  //! Acquire bytes for key, empty if bytes == 0
+  PooledBuffer(BufferPoolKey key, std::size_t bytes) : m_key(std::move(key)), m_bytes(bytes)
+  {
+    if (m_bytes > 0) { m_data = BufferPool::get().Acquire(m_key, m_bytes); }
+  }
+  PooledBuffer(const PooledBuffer &) = delete;
+  PooledBuffer &operator=(const PooledBuffer &) = delete;
+  PooledBuffer(PooledBuffer &&other) noexcept { swap(other); }
+  PooledBuffer &operator=(PooledBuffer &&other) noexcept
+  {
+    PooledBuffer tmp(std::move(other));
+    swap(tmp);
+    return *this;
+  }
+  ~PooledBuffer()
+  {
+    if (m_data != nullptr) { BufferPool::get().Release(m_key, m_data, m_bytes); }
+  }
+
+  [[nodiscard]] void *data() const noexcept { return m_data; }
+  [[nodiscard]] std::size_t bytes() const noexcept { return m_bytes; }
+
+  void swap(PooledBuffer &rhs) noexcept
+  {
+    using std::swap;
+    swap(m_key, rhs.m_key);
+    swap(m_data, rhs.m_data);
+    swap(m_bytes, rhs.m_bytes);
+  }
+
+private:
+  BufferPoolKey m_key;
+  void *m_data = nullptr;
+  std::size_t m_bytes = 0;
+};
+
+//! @} doxygroup: buffer_pool_group
+}// namespace poutre
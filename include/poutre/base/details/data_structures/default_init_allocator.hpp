@@ -0,0 +1,69 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file default_init_allocator.hpp
+ * @author thomas.retornaz@mines-paris.org
+ * @brief Allocator adaptor default initializing elements
+ *
+ */
+
+#include <poutre/base/config.hpp>
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace poutre::details {
+/**
+ * @addtogroup image_processing_container_group
+ *@{
+ */
+
+/**
+ * @brief Allocator adaptor turning value initialization into default initialization
+ *
+ * @c std::vector::resize(n) value initializes new elements, i.e. zero fills trivial types. With this adaptor
+ * @c resize(n) leaves trivial elements uninitialized (no memset), while @c resize(n,val) and construction from
+ * arguments are forwarded to the underlying allocator as usual.
+ *
+ * @tparam T element type
+ * @tparam A underlying allocator (alignment, ...)
+ */
+template<class T, class A = std::allocator<T>> class default_init_allocator : public A
+{
+  using a_traits = std::allocator_traits<A>;
+
+public:
+  using value_type = T;
+
+  template<class U> struct rebind
+  {
+    using other = default_init_allocator<U, typename a_traits::template rebind_alloc<U>>;
+  };
+
+  using A::A;
+  default_init_allocator() = default;
+  template<class U, class B>
+  default_init_allocator(const default_init_allocator<U, B> &other) POUTRE_NOEXCEPT// NOLINT(*-explicit-*)
+    : A(static_cast<const B &>(other))
+  {}
+
+  //! default initialization, no-op for trivial types
+  template<class U> void construct(U *ptr) POUTRE_NOEXCEPT_IF(std::is_nothrow_default_constructible_v<U>)
+  { ::new (static_cast<void *>(ptr)) U; }
+
+  template<class U, class... Args> void construct(U *ptr, Args &&...args)
+  { a_traits::construct(static_cast<A &>(*this), ptr, std::forward<Args>(args)...); }
+};
+
+//! @} doxygroup: image_processing_container_group
+}// namespace poutre::details
@@ -0,0 +1,115 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file fifo.hpp
+ * @author thomas.retornaz@mines-paris.org
+ * @brief Define contiguous fifo data structures
+ *
+ */
+
+#include <poutre/base/config.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace poutre::details {
+/**
+ * @addtogroup image_processing_pqueue_group Priority queue facilities
+ * @ingroup image_processing_group
+ *@{
+ */
+
+/**
+ * @brief Growable ring buffer FIFO
+ *
+ * Contiguous storage (power of two capacity) used as circular buffer, so that push/pop are O(1) without the per
+ * chunk allocations of @c std::deque. Storage is only reallocated (doubled) when the FIFO is full.
+ * Interface follows @c std::queue (push,front,pop,empty,size).
+ *
+ * @tparam T default constructible and copyable element (typically linear offset)
+ */
+template<class T> class RingFifo
+{
+public:
+  using value_type = T;
+  using size_type = std::size_t;
+
+  explicit RingFifo(size_type SizeReserve = 0) { reserve(SizeReserve); }
+
+  RingFifo(const RingFifo &rhs) = delete;
+  RingFifo &operator=(const RingFifo &rhs) = delete;
+  RingFifo(RingFifo &&other) noexcept = default;
+  RingFifo &operator=(RingFifo &&other) noexcept = default;
+  ~RingFifo() = default;
+
+  [[nodiscard]] bool empty() const POUTRE_NOEXCEPT { return m_size == 0; }
+  [[nodiscard]] size_type size() const POUTRE_NOEXCEPT { return m_size; }
+  [[nodiscard]] size_type capacity() const POUTRE_NOEXCEPT { return m_buffer.size(); }
+
+  //! ensure capacity >= nbelements, capacity is rounded to next power of two
+  void reserve(size_type nbelements)
+  {
+    if (nbelements <= capacity()) { return; }
+    size_type new_capacity = min_capacity;
+    while (new_capacity < nbelements) { new_capacity <<= 1U; }
+    Grow(new_capacity);
+  }
+
+  void push(const T &value)
+  {
+    if (m_size == capacity()) { Grow(capacity() == 0 ? min_capacity : 2 * capacity()); }
+    m_buffer[(m_head + m_size) & m_mask] = value;
+    ++m_size;
+  }
+
+  //! oldest element, undefined if empty
+  [[nodiscard]] const T &front() const POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(!empty(), "RingFifo::front on empty fifo");
+    return m_buffer[m_head];
+  }
+
+  void pop() POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(!empty(), "RingFifo::pop on empty fifo");
+    m_head = (m_head + 1) & m_mask;
+    --m_size;
+  }
+
+  //! remove all elements, keep storage
+  void clear() POUTRE_NOEXCEPT
+  {
+    m_head = 0;
+    m_size = 0;
+  }
+
+private:
+  static constexpr size_type min_capacity = 16;
+
+  void Grow(size_type new_capacity)
+  {
+    std::vector<T> buffer(new_capacity);
+    // unroll circular storage
+    for (size_type i = 0; i < m_size; ++i) { buffer[i] = std::move(m_buffer[(m_head + i) & m_mask]); }
+    m_buffer.swap(buffer);
+    m_head = 0;
+    m_mask = new_capacity - 1;
+  }
+
+  std::vector<T> m_buffer;
+  size_type m_head = 0;
+  size_type m_size = 0;
+  size_type m_mask = 0;
+};
+
+//! @} doxygroup: image_processing_pqueue_group
+}// namespace poutre::details
@@ -0,0 +1,407 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file image_bin_t.hpp
+ * @author thomas.retornaz@mines-paris.org
+ * @brief Bit-packed binary image
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+
+#include <poutre/base/details/data_structures/image_t.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace poutre::details {
+
+/**
+ * @addtogroup image_processing_container_group
+ *@{
+ */
+
+/**
+ * @brief Bit-packed binary image, 64 pixels per pUINT64 word
+ *
+ * Pixels of a line (last dimension) are stored LSB first, each line is padded to a whole number of words so that
+ * lines start on a word boundary. Padding bits are always 0, every operation writing words has to preserve it
+ * (see tail_mask()).
+ * Values are read and written as bool, data() exposes the words.
+ */
+template<std::ptrdiff_t Rank> class image_t<pBinPack, Rank> : public IInterface
+{
+  static_assert(Rank > 0, "Rank must be >0");
+
+public:
+  using self_type = image_t<pBinPack, Rank>;
+  using parent_interface = IInterface;
+  using word_type = typename TypeTraits<pBinPack>::storage_type;
+  using aligned_allocator =
+    default_init_allocator<word_type, xs::aligned_allocator<word_type, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
+  using value_type = bool;
+  using pointer = std::add_pointer_t<word_type>;
+  using const_pointer = std::add_pointer_t<const word_type>;
+  using size_type = std::size_t;
+  using coordinate_type = av::bounds<Rank>;
+  using index_type = av::index<Rank>;
+  using storage_type = std::vector<word_type, aligned_allocator>;
+
+  static const PType m_ptype = PType::PType_BinPack;
+  static const CompoundType m_ctype = CompoundType::CompoundType_Scalar;
+  static const std::ptrdiff_t m_numdims = Rank;
+  static constexpr std::ptrdiff_t word_bits = TypeTraits<pBinPack>::word_bits;
+
+  //! Number of words needed by a line of xsize pixels
+  [[nodiscard]] static constexpr std::ptrdiff_t WordsPerLine(std::ptrdiff_t xsize) noexcept
+  { return (xsize + word_bits - 1) / word_bits; }
+
+  [[nodiscard]] CompoundType GetCType() const noexcept override { return m_ctype; }
+
+  [[nodiscard]] PType GetPType() const noexcept override { return m_ptype; }
+
+  [[nodiscard]] std::vector<std::size_t> GetShape() const override
+  {
+    std::vector<std::size_t> out(this->m_numdims);
+    for (size_t i = 0; i < this->m_numdims; ++i) { out[i] = static_cast<std::size_t>(this->m_coordinnates[i]); }
+    return out;
+  }
+
+  //! Get num of dimensions
+  [[nodiscard]] std::size_t GetRank() const override { return m_numdims; }
+
+  //! Get total number of pixels
+  [[nodiscard]] constexpr size_type size() const noexcept { return m_numelement; }
+
+  //! Number of pixels of a line
+  [[nodiscard]] constexpr std::ptrdiff_t line_size() const noexcept { return m_coordinnates[Rank - 1]; }
+
+  //! Number of lines, ie product of all dimensions but the last one
+  [[nodiscard]] constexpr std::ptrdiff_t nb_lines() const noexcept { return m_nblines; }
+
+  //! Number of words of a line (padding included)
+  [[nodiscard]] constexpr std::ptrdiff_t words_per_line() const noexcept { return m_wordsperline; }
+
+  //! Total number of words
+  [[nodiscard]] constexpr size_type nb_words() const noexcept
+  { return static_cast<size_type>(m_nblines) * static_cast<size_type>(m_wordsperline); }
+
+  //! Valid bits of the last word of each line
+  [[nodiscard]] constexpr word_type tail_mask() const noexcept
+  {
+    const auto remainder = line_size() % word_bits;
+    return remainder == 0 ? ~word_type(0) : (word_type(1) << remainder) - 1;
+  }
+
+  //! no const direct access to the words @warning padding bits must stay 0
+  // cppcheck-suppress functionConst
+  [[nodiscard]] pointer data() noexcept { return m_data; }
+
+  //! const direct access to the words
+  [[nodiscard]] const_pointer data() const noexcept { return m_data; }
+
+  //! @see IInterface::GetVoidPtr
+  [[nodiscard]] void *GetVoidPtr() noexcept override { return m_data; }
+
+  //! @see IInterface::GetVoidPtr
+  [[nodiscard]] const void *GetVoidPtr() const noexcept override { return m_data; }
+
+  //! false if the image wraps an external buffer
+  [[nodiscard]] bool IsOwner() const noexcept { return m_data == m_storage.data() || m_data == m_pooled.data(); }
+
+  //! words of line (lines are enumerated in row major order over all dimensions but the last one)
+  // cppcheck-suppress functionConst
+  [[nodiscard]] pointer GetLineWords(std::ptrdiff_t line) POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(line >= 0 && line < m_nblines, "Access out of bound");
+    return m_data + line * m_wordsperline;
+  }
+
+  [[nodiscard]] const_pointer GetLineWords(std::ptrdiff_t line) const POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(line >= 0 && line < m_nblines, "Access out of bound");
+    return m_data + line * m_wordsperline;
+  }
+
+  //! pixel x of line
+  [[nodiscard]] bool Get(std::ptrdiff_t line, std::ptrdiff_t x) const POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(x >= 0 && x < line_size(), "Access out of bound");
+    return ((GetLineWords(line)[x / word_bits] >> (x % word_bits)) & 1U) != 0;
+  }
+
+  //! set pixel x of line
+  void Set(std::ptrdiff_t line, std::ptrdiff_t x, bool value) POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(x >= 0 && x < line_size(), "Access out of bound");
+    auto &word = GetLineWords(line)[x / word_bits];
+    const word_type bit = word_type(1) << (x % word_bits);
+    word = value ? (word | bit) : (word & ~bit);
+  }
+
+  [[nodiscard]] bool GetPixel(const index_type &idx) const POUTRE_NOEXCEPTONLYNDEBUG
+  { return Get(LineOf(idx), idx[Rank - 1]); }
+
+  void SetPixel(const index_type &idx, bool value) POUTRE_NOEXCEPTONLYNDEBUG { Set(LineOf(idx), idx[Rank - 1], value); }
+
+  template<size_t R = Rank>
+  [[nodiscard]] bool GetPixel(scoord x, scoord y) const POUTRE_NOEXCEPTONLYNDEBUG
+    requires(R == 2)
+  {
+    POUTRE_ASSERTCHECK(y >= 0 && y < this->m_coordinnates[0], "Access out of bound");
+    return Get(y, x);
+  }
+
+  template<size_t R = Rank>
+  void SetPixel(scoord x, scoord y, bool value) POUTRE_NOEXCEPTONLYNDEBUG
+    requires(R == 2)
+  {
+    POUTRE_ASSERTCHECK(y >= 0 && y < this->m_coordinnates[0], "Access out of bound");
+    Set(y, x, value);
+  }
+
+  template<size_t R = Rank>
+  [[nodiscard]] constexpr scoord GetXSize() const noexcept
+    requires(R == 2)
+  { return this->m_coordinnates[1]; }
+
+  template<size_t R = Rank>
+  [[nodiscard]] constexpr scoord GetYSize() const noexcept
+    requires(R == 2)
+  { return this->m_coordinnates[0]; }
+
+  //! assign value to all pixels, padding bits are kept to 0
+  void fill(bool value)
+  {
+    if (!value) {
+      std::fill(m_data, m_data + nb_words(), word_type(0));
+      return;
+    }
+    const auto tail = tail_mask();
+    for (std::ptrdiff_t line = 0; line < m_nblines; ++line) {
+      auto *words = GetLineWords(line);
+      std::fill(words, words + m_wordsperline, ~word_type(0));
+      if (m_wordsperline > 0) { words[m_wordsperline - 1] = tail; }
+    }
+  }
+
+  //! number of pixels set to true
+  [[nodiscard]] size_type count() const noexcept
+  {
+    size_type res = 0;
+    for (size_type i = 0; i < nb_words(); ++i) { res += static_cast<size_type>(std::popcount(m_data[i])); }
+    return res;
+  }
+
+  [[nodiscard]] std::string str() const noexcept override
+  {
+    std::ostringstream out;
+    out << "Image" << '\n';
+    out << "\tCtype: " << this->GetCType() << std::endl;
+    out << "\tPtype: " << this->GetPType() << std::endl;
+    const auto &numDims = this->GetRank();
+    out << "\tNumdim: " << numDims << std::endl;
+    const auto &coords = this->GetShape();
+    out << "\tcoord: (";
+    for (size_t i = 0; i < numDims - 1; i++) { out << coords[i] << ", "; }
+    if (static_cast<ptrdiff_t>(numDims) - 1 >= 0) { out << coords[numDims - 1]; }
+    out << ")" << '\n';
+    return out.str();
+  }
+
+  constexpr explicit image_t(const std::vector<size_t> &dims) : image_t(dims, AllocationMode::Zeroed) {}
+
+  //! @see image_t::image_t(dims,mode), padding bits are always cleared
+  constexpr image_t(const std::vector<size_t> &dims, AllocationMode mode)
+    : m_storage(), m_data(nullptr), m_coordinnates(), m_numelement(0), m_nblines(0), m_wordsperline(0)
+  {
+    if (dims.size() != m_numdims) {
+      POUTRE_RUNTIME_ERROR("Invalid input initializer Mismatch between Rank and dims.size()");
+    }
+    for (size_t i = 0; i < this->m_numdims; ++i) { this->m_coordinnates[i] = static_cast<ptrdiff_t>(dims[i]); }
+    InitGeometry();
+    if (mode != AllocationMode::Zeroed) {
+      if (mode == AllocationMode::Pooled && nb_words() > 0) {
+        m_pooled = PooledBuffer(BufferPoolKey{ dims, m_ctype, m_ptype }, nb_words() * sizeof(word_type));
+        m_data = static_cast<pointer>(m_pooled.data());
+      } else {
+        m_storage.resize(nb_words());
+        m_data = m_storage.data();
+      }
+      if (m_wordsperline > 0) {
+        for (std::ptrdiff_t line = 0; line < m_nblines; ++line) { GetLineWords(line)[m_wordsperline - 1] = 0; }
+      }
+      return;
+    }
+    m_storage.resize(nb_words(), word_type(0));
+    m_data = m_storage.data();
+  }
+
+  constexpr image_t(const std::initializer_list<size_t> &dims) : image_t(std::vector<size_t>(dims)) {}
+
+  /**
+   * @brief Wrap an external buffer of words without copy
+   *
+   * @param buffer [in] external storage of at least nb_lines*WordsPerLine(xsize) words, laid out as described in the
+   * class documentation, must outlive the image
+   * @param dims [in] shape in pixels
+   * @param owner [in] optional, kept alive as long as the image (e.g. the file mapping behind buffer)
+   * @warning padding bits of buffer must be 0, copying such an image performs a deep copy in an owned storage
+   */
+  image_t(pointer buffer, const std::vector<size_t> &dims, std::shared_ptr<void> owner = nullptr)
+    : m_storage(), m_owner(std::move(owner)), m_data(buffer), m_coordinnates(), m_numelement(0), m_nblines(0),
+      m_wordsperline(0)
+  {
+    if (dims.size() != m_numdims) {
+      POUTRE_RUNTIME_ERROR("Invalid input initializer Mismatch between Rank and dims.size()");
+    }
+    if (buffer == nullptr) { POUTRE_RUNTIME_ERROR("Invalid external buffer"); }
+    for (size_t i = 0; i < this->m_numdims; ++i) { this->m_coordinnates[i] = static_cast<ptrdiff_t>(dims[i]); }
+    InitGeometry();
+  }
+
+  //! deep copy, the copy always owns its storage
+  image_t(const image_t &rhs)
+    : m_storage(rhs.m_data, rhs.m_data + rhs.nb_words()), m_data(nullptr), m_coordinnates(rhs.m_coordinnates),
+      m_numelement(rhs.m_numelement), m_nblines(rhs.m_nblines), m_wordsperline(rhs.m_wordsperline)
+  { m_data = m_storage.data(); }
+
+  //! deep copy, a buffer (owned or external) of the same shape is written in place
+  image_t &operator=(const image_t &rhs)
+  {
+    if (this == &rhs) { return *this; }
+    if (m_coordinnates == rhs.m_coordinnates) {
+      std::copy(rhs.m_data, rhs.m_data + rhs.nb_words(), m_data);
+      return *this;
+    }
+    self_type tmp(rhs);
+    this->swap(tmp);
+    return *this;
+  }
+
+  // moving a vector keeps its buffer, so m_data stays valid
+  image_t(image_t &&other) = default;
+  image_t &operator=(image_t &&other) = default;
+  ~image_t() override = default;
+
+  [[nodiscard]] constexpr coordinate_type shape() const noexcept { return m_coordinnates; }
+
+  void swap(self_type &rhs) noexcept
+  {
+    if (this != &rhs) {
+      using std::swap;
+      swap(this->m_storage, rhs.m_storage);
+      this->m_pooled.swap(rhs.m_pooled);
+      swap(this->m_owner, rhs.m_owner);
+      swap(this->m_data, rhs.m_data);
+      swap(this->m_coordinnates, rhs.m_coordinnates);
+      swap(this->m_numelement, rhs.m_numelement);
+      swap(this->m_nblines, rhs.m_nblines);
+      swap(this->m_wordsperline, rhs.m_wordsperline);
+    }
+  }
+
+private:
+  constexpr void InitGeometry()
+  {
+    m_nblines = 1;
+    for (std::ptrdiff_t i = 0; i < Rank - 1; ++i) { m_nblines *= m_coordinnates[i]; }
+    m_wordsperline = WordsPerLine(m_coordinnates[Rank - 1]);
+    m_numelement = static_cast<std::size_t>(m_nblines) * static_cast<std::size_t>(m_coordinnates[Rank - 1]);
+  }
+
+  [[nodiscard]] std::ptrdiff_t LineOf(const index_type &idx) const noexcept
+  {
+    std::ptrdiff_t line = 0;
+    for (std::ptrdiff_t i = 0; i < Rank - 1; ++i) { line = line * m_coordinnates[i] + idx[i]; }
+    return line;
+  }
+
+  storage_type m_storage;
+  //! pooled storage (AllocationMode::Pooled), empty otherwise
+  PooledBuffer m_pooled;
+  //! keeps an external buffer alive, empty otherwise
+  std::shared_ptr<void> m_owner;
+  //! either m_storage.data(), m_pooled.data() or external buffer
+  pointer m_data;
+  coordinate_type m_coordinnates;
+  size_type m_numelement;
+  std::ptrdiff_t m_nblines;
+  std::ptrdiff_t m_wordsperline;
+};
+
+/**
+ * @brief Pack i_img in o_img, non zero pixels are set to true
+ */
+template<typename T, std::ptrdiff_t Rank>
+void t_PackBinary(const image_t<T, Rank> &i_img, image_t<pBinPack, Rank> &o_img)
+{
+  POUTRE_CHECK(i_img.shape() == o_img.shape(), "t_PackBinary incompatible size");
+  using word_type = typename image_t<pBinPack, Rank>::word_type;
+  constexpr auto word_bits = image_t<pBinPack, Rank>::word_bits;
+  const auto xsize = o_img.line_size();
+  const T *ptrIn = i_img.data();
+  for (std::ptrdiff_t line = 0; line < o_img.nb_lines(); ++line, ptrIn += xsize) {
+    auto *words = o_img.GetLineWords(line);
+    for (std::ptrdiff_t w = 0; w < o_img.words_per_line(); ++w) {
+      const auto first = w * word_bits;
+      const auto nb = std::min(word_bits, xsize - first);
+      word_type word = 0;
+      for (std::ptrdiff_t bit = 0; bit < nb; ++bit) { word |= word_type(ptrIn[first + bit] != T(0)) << bit; }
+      words[w] = word;
+    }
+  }
+}
+
+/**
+ * @brief Unpack i_img in o_img, true pixels are set to true_value, false ones to 0
+ */
+template<typename T, std::ptrdiff_t Rank>
+void t_UnpackBinary(const image_t<pBinPack, Rank> &i_img, image_t<T, Rank> &o_img, T true_value = T(1))
+{
+  POUTRE_CHECK(i_img.shape() == o_img.shape(), "t_UnpackBinary incompatible size");
+  constexpr auto word_bits = image_t<pBinPack, Rank>::word_bits;
+  const auto xsize = i_img.line_size();
+  T *ptrOut = o_img.data();
+  for (std::ptrdiff_t line = 0; line < i_img.nb_lines(); ++line, ptrOut += xsize) {
+    const auto *words = i_img.GetLineWords(line);
+    for (std::ptrdiff_t x = 0; x < xsize; ++x) {
+      ptrOut[x] = ((words[x / word_bits] >> (x % word_bits)) & 1U) != 0 ? true_value : T(0);
+    }
+  }
+}
+
+//! Copy words of i_img in o_img
+template<std::ptrdiff_t Rank> void t_Copy(const image_t<pBinPack, Rank> &i_img, image_t<pBinPack, Rank> &o_img)
+{
+  POUTRE_CHECK(i_img.shape() == o_img.shape(), "t_Copy incompatible size");
+  std::copy(i_img.data(), i_img.data() + i_img.nb_words(), o_img.data());
+}
+
+#if defined(POUTRE_IS_GCC) || defined(POUTRE_IS_CLANG)
+extern template class BASE_API image_t<pBinPack, 1>;
+extern template class BASE_API image_t<pBinPack, 2>;
+extern template class BASE_API image_t<pBinPack, 3>;
+#else
+template class BASE_API image_t<pBinPack, 1>;
+template class BASE_API image_t<pBinPack, 2>;
+template class BASE_API image_t<pBinPack, 3>;
+#endif
+
+//! @} doxygroup: image_processing_container_group
+}// namespace poutre::details
@@ -0,0 +1,233 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file image_pitched_t.hpp
+ * @author thomas.retornaz@mines-paris.org
+ * @brief Image with aligned row pitch and halo
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/default_init_allocator.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/simd/simd_helpers.hpp>
+#include <poutre/base/trace.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace poutre::details {
+
+/**
+ * @addtogroup image_processing_container_group
+ *@{
+ */
+
+/**
+ * @brief Image surrounded by a halo of @c halo() pixels on every side of every axis
+ *
+ * Layout (row major):
+ * - on the last axis each row starts with @c lead() >= halo pixels and is padded to @c pitch() pixels, both multiple
+ *   of the SIMD width, so that the first valid pixel of each row is aligned
+ * - every other axis gets halo planes before and after the valid region
+ *
+ * Any neighbor at distance <= halo() of a valid pixel is addressable by a constant linear offset, kernels can thus
+ * process whole rows without bound checks once the halo holds the right value (see @c FillHalo()).
+ * @c data() points on the first valid pixel, @c view() exposes the valid region as a strided view.
+ * Storage content is left uninitialized on construction.
+ */
+template<class valuetype, std::ptrdiff_t Rank = 2> class image_pitched_t
+{
+  static_assert(Rank > 0, "Rank must be >0");
+  static_assert(std::is_trivially_copyable_v<valuetype>, "image_pitched_t needs trivially copyable pixels");
+
+public:
+  using self_type = image_pitched_t<valuetype, Rank>;
+  using value_type = valuetype;
+  using pointer = std::add_pointer_t<value_type>;
+  using const_pointer = std::add_pointer_t<const value_type>;
+  using size_type = std::size_t;
+  using coordinate_type = av::bounds<Rank>;
+  using index_type = av::index<Rank>;
+  using aligned_allocator =
+    default_init_allocator<value_type, xs::aligned_allocator<value_type, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
+  using storage_type = std::vector<value_type, aligned_allocator>;
+
+  /**
+   * @brief Allocate a pitched storage
+   *
+   * @param dims [in] shape of the valid region
+   * @param halo [in] halo width (>=0) on every axis
+   */
+  image_pitched_t(const std::vector<size_t> &dims, std::ptrdiff_t halo) : m_halo(halo)
+  {
+    if (dims.size() != static_cast<size_t>(Rank)) {
+      POUTRE_RUNTIME_ERROR("Invalid input initializer Mismatch between Rank and dims.size()");
+    }
+    if (halo < 0) { POUTRE_RUNTIME_ERROR("image_pitched_t halo must be >=0"); }
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) { m_coordinnates[i] = static_cast<ptrdiff_t>(dims[i]); }
+    constexpr auto last = static_cast<size_t>(Rank - 1);
+    m_lead = static_cast<ptrdiff_t>(poutre::simd::t_ReachNextAlignedSize<value_type>(static_cast<size_t>(halo)));
+    m_pitch = static_cast<ptrdiff_t>(
+      poutre::simd::t_ReachNextAlignedSize<value_type>(static_cast<size_t>(m_lead + m_coordinnates[last] + halo)));
+    m_stride[last] = 1;
+    m_padded[last] = m_pitch;
+    for (ptrdiff_t dim = Rank - 2; dim >= 0; --dim) {
+      const auto udim = static_cast<size_t>(dim);
+      m_padded[udim] = m_coordinnates[udim] + 2 * halo;
+      m_stride[udim] = m_stride[udim + 1] * m_padded[udim + 1];
+    }
+    m_origin = m_lead;
+    for (size_t dim = 0; dim < last; ++dim) { m_origin += halo * m_stride[dim]; }
+    m_storage.resize(static_cast<size_t>(m_stride[0] * m_padded[0]));
+  }
+
+  image_pitched_t(const image_pitched_t &) = default;
+  image_pitched_t &operator=(const image_pitched_t &) = default;
+  image_pitched_t(image_pitched_t &&) noexcept = default;
+  image_pitched_t &operator=(image_pitched_t &&) noexcept = default;
+  ~image_pitched_t() = default;
+
+  //! Get shape of the valid region
+  [[nodiscard]] std::vector<std::size_t> GetShape() const
+  {
+    std::vector<std::size_t> out(static_cast<size_t>(Rank));
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) { out[i] = static_cast<std::size_t>(m_coordinnates[i]); }
+    return out;
+  }
+
+  //! Get shape of the valid region
+  [[nodiscard]] constexpr coordinate_type shape() const noexcept { return m_coordinnates; }
+
+  //! Get number of valid pixels
+  [[nodiscard]] constexpr size_type size() const noexcept { return m_coordinnates.size(); }
+
+  //! Halo width on every axis
+  [[nodiscard]] constexpr std::ptrdiff_t halo() const noexcept { return m_halo; }
+
+  //! Offset of the first valid pixel of a row, multiple of the SIMD width and >= halo()
+  [[nodiscard]] constexpr std::ptrdiff_t lead() const noexcept { return m_lead; }
+
+  //! Number of pixels between two consecutive rows, multiple of the SIMD width
+  [[nodiscard]] constexpr std::ptrdiff_t pitch() const noexcept { return m_pitch; }
+
+  //! Strides (in pixels) of the padded storage
+  [[nodiscard]] constexpr index_type stride() const noexcept { return m_stride; }
+
+  //! Number of rows (last axis) of the valid region
+  [[nodiscard]] constexpr std::ptrdiff_t nb_rows() const noexcept
+  {
+    std::ptrdiff_t rows = 1;
+    for (size_t dim = 0; dim + 1 < static_cast<size_t>(Rank); ++dim) { rows *= m_coordinnates[dim]; }
+    return rows;
+  }
+
+  //! first valid pixel
+  // cppcheck-suppress functionConst
+  [[nodiscard]] pointer data() noexcept { return m_storage.data() + m_origin; }
+
+  //! first valid pixel
+  [[nodiscard]] const_pointer data() const noexcept { return m_storage.data() + m_origin; }
+
+  //! first valid pixel of row (rows are enumerated in row major order over all axes but the last one)
+  // cppcheck-suppress functionConst
+  [[nodiscard]] pointer GetRow(std::ptrdiff_t row) POUTRE_NOEXCEPTONLYNDEBUG { return data() + RowOffset(row); }
+
+  [[nodiscard]] const_pointer GetRow(std::ptrdiff_t row) const POUTRE_NOEXCEPTONLYNDEBUG
+  { return data() + RowOffset(row); }
+
+  //! Set every pixel outside of the valid region to val
+  void FillHalo(const value_type &val)
+  {
+    if (m_storage.empty()) { return; }
+    constexpr auto last = static_cast<size_t>(Rank - 1);
+    const ptrdiff_t xsize = m_coordinnates[last];
+    const ptrdiff_t nbpaddedrows = static_cast<ptrdiff_t>(m_storage.size()) / m_pitch;
+    for (ptrdiff_t row = 0; row < nbpaddedrows; ++row) {
+      pointer line = m_storage.data() + row * m_pitch;
+      bool inside = true;
+      for (ptrdiff_t dim = Rank - 2, remaining = row; dim >= 0; --dim) {
+        const auto udim = static_cast<size_t>(dim);
+        const auto coord = remaining % m_padded[udim] - m_halo;
+        remaining /= m_padded[udim];
+        inside = inside && coord >= 0 && coord < m_coordinnates[udim];
+      }
+      if (!inside) {
+        std::fill(line, line + m_pitch, val);
+        continue;
+      }
+      std::fill(line, line + m_lead, val);
+      std::fill(line + m_lead + xsize, line + m_pitch, val);
+    }
+  }
+
+  //! Copy the contiguous image i_img (same shape) into the valid region
+  void CopyFrom(const image_t<value_type, Rank> &i_img)
+  {
+    POUTRE_CHECK(i_img.shape() == m_coordinnates, "image_pitched_t::CopyFrom incompatible shape");
+    const ptrdiff_t xsize = m_coordinnates[static_cast<size_t>(Rank - 1)];
+    for (ptrdiff_t row = 0; row < nb_rows(); ++row) {
+      std::copy_n(i_img.data() + row * xsize, xsize, GetRow(row));
+    }
+  }
+
+  //! Copy the valid region into the contiguous image o_img (same shape)
+  void CopyTo(image_t<value_type, Rank> &o_img) const
+  {
+    POUTRE_CHECK(o_img.shape() == m_coordinnates, "image_pitched_t::CopyTo incompatible shape");
+    const ptrdiff_t xsize = m_coordinnates[static_cast<size_t>(Rank - 1)];
+    for (ptrdiff_t row = 0; row < nb_rows(); ++row) {
+      std::copy_n(GetRow(row), xsize, o_img.data() + row * xsize);
+    }
+  }
+
+private:
+  //! offset of row from data()
+  [[nodiscard]] std::ptrdiff_t RowOffset(std::ptrdiff_t row) const POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(row >= 0 && row < nb_rows(), "Access out of bound");
+    std::ptrdiff_t offset = 0;
+    for (ptrdiff_t dim = Rank - 2; dim >= 0; --dim) {
+      const auto udim = static_cast<size_t>(dim);
+      offset += (row % m_coordinnates[udim]) * m_stride[udim];
+      row /= m_coordinnates[udim];
+    }
+    return offset;
+  }
+
+  storage_type m_storage;
+  coordinate_type m_coordinnates;
+  //! extents of the padded storage
+  index_type m_padded = index_type(0);
+  index_type m_stride = index_type(0);
+  std::ptrdiff_t m_halo = 0;
+  std::ptrdiff_t m_lead = 0;
+  std::ptrdiff_t m_pitch = 0;
+  //! offset of the first valid pixel in m_storage
+  std::ptrdiff_t m_origin = 0;
+};
+
+//! strided view on the valid region
+template<class valuetype, std::ptrdiff_t Rank>
+constexpr poutre::details::av::strided_array_view<valuetype, Rank> view(image_pitched_t<valuetype, Rank> &i_img)
+{ return poutre::details::av::strided_array_view<valuetype, Rank>(i_img.data(), i_img.shape(), i_img.stride()); }
+
+//! strided view on the valid region
+template<class valuetype, std::ptrdiff_t Rank>
+constexpr poutre::details::av::strided_array_view<const valuetype, Rank> view(
+  const image_pitched_t<valuetype, Rank> &i_img)
+{ return poutre::details::av::strided_array_view<const valuetype, Rank>(i_img.data(), i_img.shape(), i_img.stride()); }
+
+//! @} doxygroup: image_processing_container_group
+}// namespace poutre::details
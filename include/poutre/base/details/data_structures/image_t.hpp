@@ -17,16 +17,22 @@
  *
  */
 
+#include <algorithm>
 #include <cstddef>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
 #include <poutre/base/base.hpp>
+#include <poutre/base/buffer_pool.hpp>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/default_init_allocator.hpp>
 #include <poutre/base/details/simd/simd_helpers.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace poutre::details {
@@ -44,8 +50,9 @@ template<class valuetype, std::ptrdiff_t Rank = 2> class /*BASE_API */ image_t :
 public:
   using self_type = image_t<valuetype, Rank>;
   using parent_interface = IInterface;
-  using aligned_allocator =
-    xs::aligned_allocator<typename poutre::TypeTraits<valuetype>::storage_type, SIMD_IDEAL_MAX_ALIGN_BYTES>;
+  //! aligned, resize(n) default initializes so that AllocationMode::Uninitialized skips the zero fill
+  using aligned_allocator = default_init_allocator<typename poutre::TypeTraits<valuetype>::storage_type,
+    xs::aligned_allocator<typename poutre::TypeTraits<valuetype>::storage_type, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
   using value_type = valuetype;// typename
                                // TypeTraits<ptype>::storage_type;
   using const_value_type = std::add_const_t<value_type>;
@@ -62,10 +69,10 @@ public:
   using coordinate_type = av::bounds<Rank>;
   using index_type = av::index<Rank>;
   using storage_type = std::vector<value_type, aligned_allocator>;
-  using iterator = typename storage_type::iterator;
-  using const_iterator = typename storage_type::const_iterator;
-  using reverse_iterator = typename storage_type::reverse_iterator;
-  using const_reverse_iterator = typename storage_type::const_reverse_iterator;
+  using iterator = pointer;
+  using const_iterator = const_pointer;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
 
   // static const std::ptrdiff_t m_numdims = NumDims;
   static const PType m_ptype = TypeTraits<value_type>::p_type;
@@ -91,29 +98,34 @@ public:
 
   //! no const direct access to underlying storage @warning
   // cppcheck-suppress functionConst
-  [[nodiscard]] pointer data() noexcept { return m_storage.data(); }
+  [[nodiscard]] pointer data() noexcept { return m_data; }
 
   //! const direct access to underlying storage
-  [[nodiscard]] const_pointer data() const noexcept { return m_storage.data(); }
+  [[nodiscard]] const_pointer data() const noexcept { return m_data; }
 
-  iterator begin() noexcept { return m_storage.begin(); }
+  //! @see IInterface::GetVoidPtr
+  [[nodiscard]] void *GetVoidPtr() noexcept override { return m_data; }
 
-  [[nodiscard]] const_iterator cbegin() const noexcept { return m_storage.cbegin(); }
+  //! @see IInterface::GetVoidPtr
+  [[nodiscard]] const void *GetVoidPtr() const noexcept override { return m_data; }
 
-  iterator end() noexcept { return m_storage.end(); }
+  //! false if the image wraps an external buffer
+  [[nodiscard]] bool IsOwner() const noexcept { return m_data == m_storage.data() || m_data == m_pooled.data(); }
 
-  [[nodiscard]] const_iterator cend() const noexcept
-  {
-    return m_storage.cend();
-    ;
-  }
+  iterator begin() noexcept { return m_data; }
+
+  [[nodiscard]] const_iterator cbegin() const noexcept { return m_data; }
+
+  iterator end() noexcept { return m_data + m_numelement; }
 
-  reverse_iterator rbegin() noexcept { return m_storage.rbegin(); }
+  [[nodiscard]] const_iterator cend() const noexcept { return m_data + m_numelement; }
 
-  [[nodiscard]] const_reverse_iterator crbegin() const noexcept { return m_storage.crbegin(); }
+  reverse_iterator rbegin() noexcept { return reverse_iterator(end()); }
+
+  [[nodiscard]] const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
 
   //! assign value to all elements
-  void fill(const value_type &val) { std::fill(m_storage.begin(), m_storage.end(), val); }
+  void fill(const value_type &val) { std::fill(begin(), end(), val); }
 
   [[nodiscard]] std::string str() const noexcept override
   {
@@ -131,7 +143,18 @@ public:
     return out.str();
   }
 
-  constexpr explicit image_t(const std::vector<size_t> &dims) : m_storage(), m_coordinnates(), m_numelement(0)
+  constexpr explicit image_t(const std::vector<size_t> &dims) : image_t(dims, AllocationMode::Zeroed) {}
+
+  /**
+   * @brief Allocate an owned storage
+   *
+   * @param dims [in] shape
+   * @param mode [in] with @c AllocationMode::Uninitialized pixels are left uninitialized (no memset), the caller has
+   * to write all of them before any read. @c AllocationMode::Pooled additionally takes the storage from
+   * @c BufferPool and gives it back on destruction
+   */
+  constexpr image_t(const std::vector<size_t> &dims, AllocationMode mode)
+    : m_storage(), m_data(nullptr), m_coordinnates(), m_numelement(0)
   {
     if (dims.size() != m_numdims) {
       POUTRE_RUNTIME_ERROR("Invalid input initializer Mismatch between Rank and dims.size()");
@@ -141,28 +164,59 @@ public:
     for (size_t i = 1; i < static_cast<std::size_t>(m_numdims); i++) {
       m_numelement *= (static_cast<std::size_t>(m_coordinnates[i]));
     }
-    m_storage.resize(m_numelement);
+    Allocate(mode);
   }
 
-  constexpr image_t(const std::initializer_list<size_t> &dims) : m_storage(), m_coordinnates(), m_numelement(0)
+  constexpr image_t(const std::initializer_list<size_t> &dims) : image_t(std::vector<size_t>(dims)) {}
+
+  /**
+   * @brief Wrap an external C-contiguous buffer (row major) without copy
+   *
+   * @param buffer [in] external storage of at least prod(dims) elements, must outlive the image
+   * @param dims [in] shape of the buffer
+   * @param owner [in] optional, kept alive as long as the image (e.g. the file mapping behind buffer)
+   * @warning the image doesn't own buffer, copying such an image performs a deep copy in an owned storage
+   */
+  image_t(pointer buffer, const std::vector<size_t> &dims, std::shared_ptr<void> owner = nullptr)
+    : m_storage(), m_owner(std::move(owner)), m_data(buffer), m_coordinnates(), m_numelement(0)
   {
     if (dims.size() != m_numdims) {
       POUTRE_RUNTIME_ERROR("Invalid input initializer Mismatch between Rank and dims.size()");
     }
-    const auto *it = dims.begin();
-    for (size_t i = 0; i < this->m_numdims; ++i, ++it) { this->m_coordinnates[i] = static_cast<std::ptrdiff_t>(*it); }
-    // compute full array size
+    if (buffer == nullptr) { POUTRE_RUNTIME_ERROR("Invalid external buffer"); }
+    for (size_t i = 0; i < this->m_numdims; ++i) { this->m_coordinnates[i] = static_cast<ptrdiff_t>(dims[i]); }
     m_numelement = static_cast<std::size_t>(m_coordinnates[0]);
     for (size_t i = 1; i < static_cast<std::size_t>(m_numdims); i++) {
       m_numelement *= (static_cast<std::size_t>(m_coordinnates[i]));
     }
-    m_storage.resize(m_numelement);
   }
 
-  // see this later
-  image_t(const image_t &rhs) = default;
-  image_t &operator=(const image_t &rhs) = default;
-  // see this later
+  //! deep copy, the copy always owns its storage
+  image_t(const image_t &rhs)
+    : m_storage(rhs.cbegin(), rhs.cend()), m_data(nullptr), m_coordinnates(rhs.m_coordinnates),
+      m_numelement(rhs.m_numelement)
+  { m_data = m_storage.data(); }
+
+  /**
+   * @brief deep copy
+   *
+   * A buffer (owned or external) of the same number of elements is written in place, so that pointers on data()
+   * stay valid and views on external buffers (numpy arrays, mapped files) receive the pixels
+   */
+  image_t &operator=(const image_t &rhs)
+  {
+    if (this == &rhs) { return *this; }
+    if (m_numelement == rhs.m_numelement) {
+      std::copy(rhs.m_data, rhs.m_data + rhs.m_numelement, m_data);
+      m_coordinnates = rhs.m_coordinnates;
+      return *this;
+    }
+    self_type tmp(rhs);
+    this->swap(tmp);
+    return *this;
+  }
+
+  // moving a vector keeps its buffer, so m_data stays valid
   image_t(image_t &&other) = default;
   image_t &operator=(image_t &&other) = default;
   ~image_t() override = default;
@@ -173,25 +227,25 @@ public:
   POUTRE_CONSTEXPR reference operator[](size_type idx) POUTRE_NOEXCEPT
   {
     POUTRE_ASSERTCHECK(idx < m_numelement, "Access out of bound");
-    return m_storage[idx];
+    return m_data[idx];
   }
 
   POUTRE_CONSTEXPR const_reference operator[](size_type idx) const POUTRE_NOEXCEPT
   {
     POUTRE_ASSERTCHECK(idx < m_numelement, "Access out of bound");
-    return m_storage[idx];
+    return m_data[idx];
   }
   // cppcheck-suppress functionConst
   POUTRE_CONSTEXPR reference at(size_type idx)
   {
     if (idx >= m_numelement) { POUTRE_RUNTIME_ERROR("Access out of bound"); }
-    return m_storage[idx];
+    return m_data[idx];
   }
 
   POUTRE_CONSTEXPR const_reference at(size_type n) const
   {
     if (n >= m_numelement) { POUTRE_RUNTIME_ERROR("Access out of bound"); }
-    return m_storage[n];
+    return m_data[n];
   }
 
   template<size_t R = Rank>
@@ -210,7 +264,7 @@ public:
   {
     POUTRE_ASSERTCHECK(y < this->m_coordinnates[0], "Access out of bound");
     POUTRE_ASSERTCHECK(y >= 0, "Access out of bound");
-    return &m_storage[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_coordinnates[0])];
+    return &m_data[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_coordinnates[1])];
   }
 
 
@@ -221,7 +275,7 @@ public:
   {
     POUTRE_ASSERTCHECK(y < this->m_coordinnates[0], "Access out of bound");
     POUTRE_ASSERTCHECK(y >= 0, "Access out of bound");
-    return &m_storage[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_coordinnates[0])];
+    return &m_data[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_coordinnates[1])];
   }
 
   template<size_t R = Rank>
@@ -232,7 +286,7 @@ public:
     POUTRE_ASSERTCHECK(x >= 0, "Access out of bound");
     POUTRE_ASSERTCHECK(y < this->m_coordinnates[0], "Access out of bound");
     POUTRE_ASSERTCHECK(y >= 0, "Access out of bound");
-    m_storage[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_coordinnates[0]) + static_cast<std::size_t>(x)] =
+    m_data[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_coordinnates[1]) + static_cast<std::size_t>(x)] =
       value;
   }
 
@@ -249,7 +303,7 @@ public:
     POUTRE_ASSERTCHECK(x >= 0, "Access out of bound");
     POUTRE_ASSERTCHECK(y < this->m_coordinnates[0], "Access out of bound");
     POUTRE_ASSERTCHECK(y >= 0, "Access out of bound");
-    return m_storage[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_coordinnates[0])
+    return m_data[static_cast<std::size_t>(y) * static_cast<std::size_t>(m_coordinnates[1])
                      + static_cast<std::size_t>(x)];
   }
 
@@ -263,6 +317,9 @@ public:
     if (this != &rhs) {
       using std::swap;
       swap(this->m_storage, rhs.m_storage);// nothrow
+      this->m_pooled.swap(rhs.m_pooled);
+      swap(this->m_owner, rhs.m_owner);
+      swap(this->m_data, rhs.m_data);
       swap(this->m_coordinnates,
         rhs.m_coordinnates);// nothrow
       swap(this->m_numelement, rhs.m_numelement);
@@ -270,7 +327,30 @@ public:
   }
 
 private:
+  void Allocate(AllocationMode mode)
+  {
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      if (mode == AllocationMode::Pooled && m_numelement > 0) {
+        m_pooled = PooledBuffer(BufferPoolKey{ GetShape(), m_ctype, m_ptype }, m_numelement * sizeof(value_type));
+        m_data = static_cast<pointer>(m_pooled.data());
+        return;
+      }
+    }
+    if (mode != AllocationMode::Zeroed) {
+      m_storage.resize(m_numelement);
+    } else {
+      m_storage.resize(m_numelement, value_type{});
+    }
+    m_data = m_storage.data();
+  }
+
   storage_type m_storage;
+  //! pooled storage (AllocationMode::Pooled), empty otherwise
+  PooledBuffer m_pooled;
+  //! keeps an external buffer alive, empty otherwise
+  std::shared_ptr<void> m_owner;
+  //! either m_storage.data(), m_pooled.data() or external buffer
+  pointer m_data;
   coordinate_type m_coordinnates;
   size_type m_numelement;
 };
@@ -285,12 +365,16 @@ constexpr poutre::details::av::array_view<const valuetype, Rank> view(const imag
 
 #if defined(POUTRE_IS_GCC) || defined(POUTRE_IS_CLANG)
 extern template class BASE_API image_t<pUINT8, 1>;
+extern template class BASE_API image_t<pUINT16, 1>;
+extern template class BASE_API image_t<pINT16, 1>;
 extern template class BASE_API image_t<pINT32, 1>;
 extern template class BASE_API image_t<pFLOAT, 1>;
 extern template class BASE_API image_t<pINT64, 1>;
 extern template class BASE_API image_t<pDOUBLE, 1>;
 
 extern template class BASE_API image_t<pUINT8, 2>;
+extern template class BASE_API image_t<pUINT16, 2>;
+extern template class BASE_API image_t<pINT16, 2>;
 extern template class BASE_API image_t<pINT32, 2>;
 extern template class BASE_API image_t<pFLOAT, 2>;
 extern template class BASE_API image_t<pINT64, 2>;
@@ -309,24 +393,32 @@ extern template class BASE_API image_t<compound_type<pINT64, 4>, 2>;
 extern template class BASE_API image_t<compound_type<pDOUBLE, 4>, 2>;
 
 extern template class BASE_API image_t<pUINT8, 3>;
+extern template class BASE_API image_t<pUINT16, 3>;
+extern template class BASE_API image_t<pINT16, 3>;
 extern template class BASE_API image_t<pINT32, 3>;
 extern template class BASE_API image_t<pFLOAT, 3>;
 extern template class BASE_API image_t<pINT64, 3>;
 extern template class BASE_API image_t<pDOUBLE, 3>;
 
 extern template class BASE_API image_t<pUINT8, 4>;
+extern template class BASE_API image_t<pUINT16, 4>;
+extern template class BASE_API image_t<pINT16, 4>;
 extern template class BASE_API image_t<pINT32, 4>;
 extern template class BASE_API image_t<pFLOAT, 4>;
 extern template class BASE_API image_t<pINT64, 4>;
 extern template class BASE_API image_t<pDOUBLE, 4>;
 #else
 template class BASE_API image_t<pUINT8, 1>;
+template class BASE_API image_t<pUINT16, 1>;
+template class BASE_API image_t<pINT16, 1>;
 template class BASE_API image_t<pINT32, 1>;
 template class BASE_API image_t<pFLOAT, 1>;
 template class BASE_API image_t<pINT64, 1>;
 template class BASE_API image_t<pDOUBLE, 1>;
 
 template class BASE_API image_t<pUINT8, 2>;
+template class BASE_API image_t<pUINT16, 2>;
+template class BASE_API image_t<pINT16, 2>;
 template class BASE_API image_t<pINT32, 2>;
 template class BASE_API image_t<pFLOAT, 2>;
 template class BASE_API image_t<pINT64, 2>;
@@ -345,12 +437,16 @@ template class BASE_API image_t<compound_type<pINT64, 4>, 2>;
 template class BASE_API image_t<compound_type<pDOUBLE, 4>, 2>;
 
 template class BASE_API image_t<pUINT8, 3>;
+template class BASE_API image_t<pUINT16, 3>;
+template class BASE_API image_t<pINT16, 3>;
 template class BASE_API image_t<pINT32, 3>;
 template class BASE_API image_t<pFLOAT, 3>;
 template class BASE_API image_t<pINT64, 3>;
 template class BASE_API image_t<pDOUBLE, 3>;
 
 template class BASE_API image_t<pUINT8, 4>;
+template class BASE_API image_t<pUINT16, 4>;
+template class BASE_API image_t<pINT16, 4>;
 template class BASE_API image_t<pINT32, 4>;
 template class BASE_API image_t<pFLOAT, 4>;
 template class BASE_API image_t<pINT64, 4>;
@@ -360,3 +456,6 @@ template class BASE_API image_t<pDOUBLE, 4>;
 
 //! @} doxygroup: image_processing_container_group
 }// namespace poutre::details
+
+// bit-packed binary specialization
+#include <poutre/base/details/data_structures/image_bin_t.hpp>
@@ -0,0 +1,382 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file image_tiled_t.hpp
+ * @author thomas.retornaz@mines-paris.org
+ * @brief Image stored as a grid of tiles (bricks)
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/default_init_allocator.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/image_interface.hpp>
+#include <poutre/base/trace.hpp>
+#include <poutre/base/types.hpp>
+#include <poutre/base/types_traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace poutre::details {
+
+/**
+ * @addtogroup image_processing_container_group
+ *@{
+ */
+
+/**
+ * @brief Image stored tile by tile
+ *
+ * The image is cut in tiles of @c tile_shape() pixels (tile_edge() on every axis), tiles are stored one after the
+ * other in row major order of the tile grid (@c grid()), each tile being a row major block of @c tile_size() pixels.
+ * Tiles on the upper borders are allocated whole, their pixels beyond @c shape() are padding.
+ * Neighbors along any axis are thus close in memory, which keeps column and slice wise passes in cache and TLB.
+ *
+ * Tiles are iterated over @c grid() (an @c av::bounds), @c view(img,tile) exposes the valid part of a tile.
+ * As an @c IInterface, @c GetVoidPtr() is the tile storage and @c GetTileEdge() is not 0 (@see CreateTiled).
+ */
+template<class valuetype, std::ptrdiff_t Rank = 2> class image_tiled_t : public IInterface
+{
+  static_assert(Rank > 0, "Rank must be >0");
+  static_assert(std::is_trivially_copyable_v<valuetype>, "image_tiled_t needs trivially copyable pixels");
+
+public:
+  using self_type = image_tiled_t<valuetype, Rank>;
+  using value_type = valuetype;
+  using pointer = std::add_pointer_t<value_type>;
+  using const_pointer = std::add_pointer_t<const value_type>;
+  using size_type = std::size_t;
+  using coordinate_type = av::bounds<Rank>;
+  using index_type = av::index<Rank>;
+  using aligned_allocator =
+    default_init_allocator<value_type, xs::aligned_allocator<value_type, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
+  using storage_type = std::vector<value_type, aligned_allocator>;
+
+  //! Default tile edge, 64x64 tiles in 2D and 32x32x32 bricks in 3D
+  static constexpr std::ptrdiff_t default_tile_edge = Rank == 1 ? 4096 : (Rank == 2 ? 64 : (Rank == 3 ? 32 : 16));
+
+  /**
+   * @brief Allocate a tiled storage
+   *
+   * @param dims [in] shape
+   * @param tile_edge [in] tile extent (>0) on every axis
+   * @param mode [in] @c AllocationMode::Zeroed fills pixels and padding with 0, otherwise they are left
+   * uninitialized (tiled images are never pooled)
+   */
+  image_tiled_t(const std::vector<size_t> &dims,
+    std::ptrdiff_t tile_edge = default_tile_edge,
+    AllocationMode mode = AllocationMode::Zeroed)
+    : m_tileedge(tile_edge)
+  {
+    if (dims.size() != static_cast<size_t>(Rank)) {
+      POUTRE_RUNTIME_ERROR("Invalid input initializer Mismatch between Rank and dims.size()");
+    }
+    if (tile_edge <= 0) { POUTRE_RUNTIME_ERROR("image_tiled_t tile_edge must be >0"); }
+    m_tilesize = 1;
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) {
+      m_coordinnates[i] = static_cast<ptrdiff_t>(dims[i]);
+      m_grid[i] = (m_coordinnates[i] + tile_edge - 1) / tile_edge;
+      m_tilesize *= tile_edge;
+    }
+    m_tilestride[static_cast<size_t>(Rank - 1)] = 1;
+    for (ptrdiff_t dim = Rank - 2; dim >= 0; --dim) {
+      const auto udim = static_cast<size_t>(dim);
+      m_tilestride[udim] = m_tilestride[udim + 1] * tile_edge;
+    }
+    const auto nbelements = static_cast<size_t>(m_tilesize) * m_grid.size();
+    if (mode == AllocationMode::Zeroed) {
+      m_storage.resize(nbelements, value_type{});
+    } else {
+      m_storage.resize(nbelements);
+    }
+  }
+
+  [[nodiscard]] CompoundType GetCType() const noexcept override { return TypeTraits<value_type>::c_type; }
+
+  [[nodiscard]] PType GetPType() const noexcept override { return TypeTraits<value_type>::p_type; }
+
+  //! Get num of dimensions
+  [[nodiscard]] std::size_t GetRank() const override { return static_cast<std::size_t>(Rank); }
+
+  //! @see IInterface::GetVoidPtr, tiles one after the other (padding included)
+  [[nodiscard]] void *GetVoidPtr() noexcept override { return m_storage.data(); }
+
+  //! @see IInterface::GetVoidPtr, tiles one after the other (padding included)
+  [[nodiscard]] const void *GetVoidPtr() const noexcept override { return m_storage.data(); }
+
+  //! @see IInterface::GetTileEdge
+  [[nodiscard]] std::ptrdiff_t GetTileEdge() const noexcept override { return m_tileedge; }
+
+  [[nodiscard]] std::string str() const override
+  {
+    std::ostringstream out;
+    out << "Tiled image" << '\n';
+    out << "\tCtype: " << this->GetCType() << '\n';
+    out << "\tPtype: " << this->GetPType() << '\n';
+    out << "\tNumdim: " << Rank << '\n';
+    out << "\tcoord: (";
+    for (size_t i = 0; i < static_cast<size_t>(Rank - 1); ++i) { out << m_coordinnates[i] << ", "; }
+    out << m_coordinnates[static_cast<size_t>(Rank - 1)] << ")" << '\n';
+    out << "\ttile edge: " << m_tileedge << '\n';
+    return out.str();
+  }
+
+  //! Get shape
+  [[nodiscard]] std::vector<std::size_t> GetShape() const override
+  {
+    std::vector<std::size_t> out(static_cast<size_t>(Rank));
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) { out[i] = static_cast<std::size_t>(m_coordinnates[i]); }
+    return out;
+  }
+
+  //! Get shape
+  [[nodiscard]] constexpr coordinate_type shape() const noexcept { return m_coordinnates; }
+
+  //! Get number of pixels (padding excluded)
+  [[nodiscard]] constexpr size_type size() const noexcept { return m_coordinnates.size(); }
+
+  //! Tile extent on every axis
+  [[nodiscard]] constexpr std::ptrdiff_t tile_edge() const noexcept { return m_tileedge; }
+
+  //! Shape of a (whole) tile
+  [[nodiscard]] coordinate_type tile_shape() const noexcept
+  {
+    coordinate_type out;
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) { out[i] = m_tileedge; }
+    return out;
+  }
+
+  //! Number of pixels of a tile, padding included
+  [[nodiscard]] constexpr std::ptrdiff_t tile_size() const noexcept { return m_tilesize; }
+
+  //! Strides of the pixels inside a tile
+  [[nodiscard]] constexpr index_type tile_stride() const noexcept { return m_tilestride; }
+
+  //! Number of tiles along each axis, iterate over it to visit the tiles
+  [[nodiscard]] constexpr coordinate_type grid() const noexcept { return m_grid; }
+
+  //! Total number of tiles
+  [[nodiscard]] constexpr size_type nb_tiles() const noexcept { return m_grid.size(); }
+
+  //! Linear index of tile (row major over grid())
+  [[nodiscard]] std::ptrdiff_t TileIndex(const index_type &tile) const POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(m_grid.contains(tile), "Access out of bound");
+    std::ptrdiff_t linear = 0;
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) { linear = linear * m_grid[i] + tile[i]; }
+    return linear;
+  }
+
+  //! Coordinates of the first pixel of tile
+  [[nodiscard]] index_type TileOrigin(const index_type &tile) const noexcept
+  {
+    index_type out;
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) { out[i] = tile[i] * m_tileedge; }
+    return out;
+  }
+
+  //! Extents of the valid part of tile (smaller than tile_shape() on the upper borders)
+  [[nodiscard]] coordinate_type TileBound(const index_type &tile) const noexcept
+  {
+    coordinate_type out;
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) {
+      out[i] = std::min(m_tileedge, m_coordinnates[i] - tile[i] * m_tileedge);
+    }
+    return out;
+  }
+
+  //! first pixel of tile, tile_size() pixels row major
+  // cppcheck-suppress functionConst
+  [[nodiscard]] pointer GetTile(const index_type &tile) POUTRE_NOEXCEPTONLYNDEBUG
+  { return m_storage.data() + TileIndex(tile) * m_tilesize; }
+
+  [[nodiscard]] const_pointer GetTile(const index_type &tile) const POUTRE_NOEXCEPTONLYNDEBUG
+  { return m_storage.data() + TileIndex(tile) * m_tilesize; }
+
+  //! pixel at coord
+  [[nodiscard]] value_type &operator[](const index_type &coord) POUTRE_NOEXCEPTONLYNDEBUG
+  { return m_storage[static_cast<size_t>(Locate(coord))]; }
+
+  [[nodiscard]] const value_type &operator[](const index_type &coord) const POUTRE_NOEXCEPTONLYNDEBUG
+  { return m_storage[static_cast<size_t>(Locate(coord))]; }
+
+  //! assign value to all pixels, padding included
+  void fill(const value_type &val) { std::fill(m_storage.begin(), m_storage.end(), val); }
+
+  /**
+   * @brief Read length pixels along the last axis starting at start into dst
+   *
+   * start may lie (partly) outside the image, pixels outside of shape() are read as outside.
+   */
+  void ReadRow(const index_type &start, std::ptrdiff_t length, pointer dst, const value_type &outside) const
+  {
+    constexpr auto last = static_cast<size_t>(Rank - 1);
+    for (size_t dim = 0; dim < last; ++dim) {
+      if (start[dim] < 0 || start[dim] >= m_coordinnates[dim]) {
+        std::fill(dst, dst + length, outside);
+        return;
+      }
+    }
+    const ptrdiff_t xsize = m_coordinnates[last];
+    index_type coord = start;
+    ptrdiff_t pos = 0;
+    const ptrdiff_t before = std::min(length, std::max<ptrdiff_t>(0, -start[last]));
+    std::fill(dst, dst + before, outside);
+    pos = before;
+    while (pos < length && start[last] + pos < xsize) {
+      coord[last] = start[last] + pos;
+      const ptrdiff_t count =
+        std::min({ length - pos, xsize - coord[last], m_tileedge - coord[last] % m_tileedge });
+      std::copy_n(m_storage.data() + Locate(coord), count, dst + pos);
+      pos += count;
+    }
+    std::fill(dst + pos, dst + length, outside);
+  }
+
+  /**
+   * @brief Gather tile and halo pixels around it into a row major block of (tile_edge()+2*halo)^Rank pixels
+   *
+   * @param dst [in] first pixel of the block, consecutive rows along the last axis
+   * @param dst_stride [in] strides of the block (last one is 1), rows may be padded
+   * @param outside [in] value read for pixels out of shape()
+   */
+  void ReadTileWithHalo(const index_type &tile,
+    std::ptrdiff_t halo,
+    pointer dst,
+    const index_type &dst_stride,
+    const value_type &outside) const
+  {
+    constexpr auto last = static_cast<size_t>(Rank - 1);
+    const ptrdiff_t width = m_tileedge + 2 * halo;
+    ptrdiff_t nbrows = 1;
+    for (size_t dim = 0; dim < last; ++dim) { nbrows *= width; }
+    const auto origin = TileOrigin(tile);
+    for (ptrdiff_t row = 0; row < nbrows; ++row) {
+      auto start = origin;
+      ptrdiff_t local = 0;
+      for (ptrdiff_t dim = Rank - 2, remaining = row; dim >= 0; --dim) {
+        const auto udim = static_cast<size_t>(dim);
+        const auto coord = remaining % width;
+        remaining /= width;
+        start[udim] += coord - halo;
+        local += coord * dst_stride[udim];
+      }
+      start[last] -= halo;
+      ReadRow(start, width, dst + local, outside);
+    }
+  }
+
+  //! Copy the row major image i_img (same shape) into the tiles
+  void CopyFrom(const image_t<value_type, Rank> &i_img)
+  {
+    POUTRE_CHECK(i_img.shape() == m_coordinnates, "image_tiled_t::CopyFrom incompatible shape");
+    ForEachRowSegment([&](const index_type &coord, std::ptrdiff_t offset, std::ptrdiff_t count) {
+      std::copy_n(i_img.data() + offset, count, m_storage.data() + Locate(coord));
+    });
+  }
+
+  //! Copy the tiles into the row major image o_img (same shape)
+  void CopyTo(image_t<value_type, Rank> &o_img) const
+  {
+    POUTRE_CHECK(o_img.shape() == m_coordinnates, "image_tiled_t::CopyTo incompatible shape");
+    ForEachRowSegment([&](const index_type &coord, std::ptrdiff_t offset, std::ptrdiff_t count) {
+      std::copy_n(m_storage.data() + Locate(coord), count, o_img.data() + offset);
+    });
+  }
+
+private:
+  //! offset of pixel coord in m_storage
+  [[nodiscard]] std::ptrdiff_t Locate(const index_type &coord) const POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(m_coordinnates.contains(coord), "Access out of bound");
+    std::ptrdiff_t tile = 0;
+    std::ptrdiff_t inside = 0;
+    for (size_t i = 0; i < static_cast<size_t>(Rank); ++i) {
+      tile = tile * m_grid[i] + coord[i] / m_tileedge;
+      inside += (coord[i] % m_tileedge) * m_tilestride[i];
+    }
+    return tile * m_tilesize + inside;
+  }
+
+  //! call func(coord, row major offset, count) for each piece of row lying in one tile
+  template<class Func> void ForEachRowSegment(Func &&func) const
+  {
+    if (size() == 0) { return; }
+    constexpr auto last = static_cast<size_t>(Rank - 1);
+    const ptrdiff_t xsize = m_coordinnates[last];
+    const auto nbrows = static_cast<ptrdiff_t>(size()) / xsize;
+    index_type coord;
+    for (ptrdiff_t row = 0; row < nbrows; ++row) {
+      for (ptrdiff_t dim = Rank - 2, remaining = row; dim >= 0; --dim) {
+        const auto udim = static_cast<size_t>(dim);
+        coord[udim] = remaining % m_coordinnates[udim];
+        remaining /= m_coordinnates[udim];
+      }
+      for (ptrdiff_t x = 0; x < xsize; x += m_tileedge) {
+        coord[last] = x;
+        func(coord, row * xsize + x, std::min(m_tileedge, xsize - x));
+      }
+    }
+  }
+
+  storage_type m_storage;
+  coordinate_type m_coordinnates;
+  //! number of tiles along each axis
+  coordinate_type m_grid;
+  index_type m_tilestride = index_type(0);
+  std::ptrdiff_t m_tileedge = 0;
+  std::ptrdiff_t m_tilesize = 0;
+};
+
+//! strided view on the valid part of tile
+template<class valuetype, std::ptrdiff_t Rank>
+poutre::details::av::strided_array_view<valuetype, Rank> view(image_tiled_t<valuetype, Rank> &i_img,
+  const av::index<Rank> &tile)
+{
+  return poutre::details::av::strided_array_view<valuetype, Rank>(
+    i_img.GetTile(tile), i_img.TileBound(tile), i_img.tile_stride());
+}
+
+//! strided view on the valid part of tile
+template<class valuetype, std::ptrdiff_t Rank>
+poutre::details::av::strided_array_view<const valuetype, Rank> view(const image_tiled_t<valuetype, Rank> &i_img,
+  const av::index<Rank> &tile)
+{
+  return poutre::details::av::strided_array_view<const valuetype, Rank>(
+    i_img.GetTile(tile), i_img.TileBound(tile), i_img.tile_stride());
+}
+
+#if defined(POUTRE_IS_GCC) || defined(POUTRE_IS_CLANG)
+extern template class BASE_API image_tiled_t<pUINT8, 2>;
+extern template class BASE_API image_tiled_t<pUINT16, 2>;
+extern template class BASE_API image_tiled_t<pINT16, 2>;
+extern template class BASE_API image_tiled_t<pINT32, 2>;
+extern template class BASE_API image_tiled_t<pFLOAT, 2>;
+extern template class BASE_API image_tiled_t<pINT64, 2>;
+extern template class BASE_API image_tiled_t<pDOUBLE, 2>;
+
+extern template class BASE_API image_tiled_t<pUINT8, 3>;
+extern template class BASE_API image_tiled_t<pUINT16, 3>;
+extern template class BASE_API image_tiled_t<pINT16, 3>;
+extern template class BASE_API image_tiled_t<pINT32, 3>;
+extern template class BASE_API image_tiled_t<pFLOAT, 3>;
+extern template class BASE_API image_tiled_t<pINT64, 3>;
+extern template class BASE_API image_tiled_t<pDOUBLE, 3>;
+#endif
+
+//! @} doxygroup: image_processing_container_group
+}// namespace poutre::details
@@ -22,7 +22,12 @@
 
 #include <poutre/base/config.hpp>
 
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <queue>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -169,8 +174,143 @@ using poutre_rpq_stable = PriorityQueueStable<key,
   std::vector<stable_element<std::pair<key, value>>>,
   std::greater<stable_element<std::pair<key, value>>>>;
 
+/**
+ * @brief Hierarchical queue (aka bucket queue) for small integral keys (8 or 16 bits)
+ *
+ * One FIFO per key level, so push is O(1) and pop is amortized O(1).
+ * Non empty levels are tracked by a two level occupancy bitmap, so that seeking the next level costs a few word scans
+ * even with the 65536 levels of 16 bits keys.
+ * Elements sharing the same key are popped in insertion order (stable).
+ * Interface follows @c PriorityQueueStable: @c top() returns the pair (key,value) of highest priority.
+ *
+ * @tparam key integral type, sizeof(key)<=2
+ * @tparam value payload (typically pixel offset or index)
+ * @tparam highest_first true: greatest key is served first (like @c poutre_pq_stable), false: lowest key first (like
+ * @c poutre_rpq_stable)
+ */
+template<class key, class value, bool highest_first = true> class HierarchicalQueue
+{
+public:
+  static_assert(std::is_integral_v<key> && sizeof(key) <= 2, "HierarchicalQueue only support integral keys <=16 bits");
+  static constexpr std::size_t nb_levels = std::size_t{ 1 } << (8 * sizeof(key));
+
+  explicit HierarchicalQueue(size_t SizeReserve = 0)
+      : m_levels(nb_levels), m_heads(nb_levels, 0), m_occupied(nb_words, 0), m_summary(nb_summary_words, 0)
+  {
+    (void)SizeReserve;// levels grow on demand
+  }
+
+  HierarchicalQueue(const HierarchicalQueue &rhs) = delete;
+  HierarchicalQueue &operator=(const HierarchicalQueue &rhs) = delete;
+  HierarchicalQueue(HierarchicalQueue &&other) = delete;
+  HierarchicalQueue &operator=(HierarchicalQueue &&other) = delete;
+  ~HierarchicalQueue() = default;
+
+  [[nodiscard]] bool empty() const POUTRE_NOEXCEPT { return m_size == 0; }
+  [[nodiscard]] std::size_t size() const POUTRE_NOEXCEPT { return m_size; }
+
+  //! pair (key,value) of highest priority, undefined if empty
+  [[nodiscard]] std::pair<key, value> top() const
+  {
+    return { ToKey(m_current), m_levels[m_current][m_heads[m_current]] };
+  }
+
+  void push(const std::pair<key, value> &elem) { emplace(elem.first, elem.second); }
+
+  void emplace(key k, const value &val)
+  {
+    const auto level = ToLevel(k);
+    m_levels[level].push_back(val);
+    m_occupied[level / word_bits] |= Bit(level);
+    m_summary[level / (word_bits * word_bits)] |= Bit(level / word_bits);
+    if (m_size == 0 || HasPriority(level, m_current)) { m_current = level; }
+    ++m_size;
+  }
+
+  void pop()
+  {
+    auto &fifo = m_levels[m_current];
+    ++m_heads[m_current];
+    --m_size;
+    if (m_heads[m_current] < fifo.size()) { return; }
+    // level exhausted, recycle storage then seek next non empty level
+    fifo.clear();
+    m_heads[m_current] = 0;
+    const auto word = m_current / word_bits;
+    m_occupied[word] &= ~Bit(m_current);
+    if (m_occupied[word] == 0) { m_summary[word / word_bits] &= ~Bit(word); }
+    if (m_size == 0) { return; }
+    // m_current was the extreme level, so the next one is the extreme set bit of the whole bitmap
+    if constexpr (highest_first) {
+      auto sword = nb_summary_words - 1;
+      while (m_summary[sword] == 0) { --sword; }
+      const auto oword = (sword * word_bits) + HighestBit(m_summary[sword]);
+      m_current = (oword * word_bits) + HighestBit(m_occupied[oword]);
+    } else {
+      std::size_t sword = 0;
+      while (m_summary[sword] == 0) { ++sword; }
+      const auto oword = (sword * word_bits) + LowestBit(m_summary[sword]);
+      m_current = (oword * word_bits) + LowestBit(m_occupied[oword]);
+    }
+  }
+
+private:
+  static constexpr std::size_t word_bits = 64;
+  static constexpr std::size_t nb_words = (nb_levels + word_bits - 1) / word_bits;
+  static constexpr std::size_t nb_summary_words = (nb_words + word_bits - 1) / word_bits;
+
+  static std::uint64_t Bit(std::size_t index) POUTRE_NOEXCEPT { return std::uint64_t{ 1 } << (index % word_bits); }
+  static std::size_t HighestBit(std::uint64_t word) POUTRE_NOEXCEPT
+  {
+    return word_bits - 1 - static_cast<std::size_t>(std::countl_zero(word));
+  }
+  static std::size_t LowestBit(std::uint64_t word) POUTRE_NOEXCEPT
+  {
+    return static_cast<std::size_t>(std::countr_zero(word));
+  }
+  static std::size_t ToLevel(key k) POUTRE_NOEXCEPT
+  {
+    return static_cast<std::size_t>(static_cast<std::ptrdiff_t>(k) - std::numeric_limits<key>::lowest());
+  }
+  static key ToKey(std::size_t level) POUTRE_NOEXCEPT
+  {
+    return static_cast<key>(static_cast<std::ptrdiff_t>(level) + std::numeric_limits<key>::lowest());
+  }
+  static bool HasPriority(std::size_t lhs, std::size_t rhs) POUTRE_NOEXCEPT
+  {
+    if constexpr (highest_first) {
+      return lhs > rhs;
+    } else {
+      return lhs < rhs;
+    }
+  }
+
+  std::vector<std::vector<value>> m_levels;
+  //! read position of each FIFO
+  std::vector<std::size_t> m_heads;
+  //! one bit per non empty level
+  std::vector<std::uint64_t> m_occupied;
+  //! one bit per non zero word of m_occupied
+  std::vector<std::uint64_t> m_summary;
+  std::size_t m_current = 0;
+  std::size_t m_size = 0;
+};
+
+//! True if key type is small enough to be handled by @c HierarchicalQueue
+template<typename key>
+inline constexpr bool is_hierarchical_queue_key_v = std::is_integral_v<key> && sizeof(key) <= 2;
 
-// TODO specialize for sizeof(T) <16bits
+//! Greatest key served first, use @c HierarchicalQueue for small integral keys else @c poutre_pq_stable
+template<typename key, typename value>
+using poutre_hpq = std::conditional_t<is_hierarchical_queue_key_v<key>,
+  HierarchicalQueue<key, value, true>,
+  poutre_pq_stable<key, value>>;
+
+//! Lowest key served first, use @c HierarchicalQueue for small integral keys else @c poutre_rpq_stable
+template<typename key, typename value>
+using poutre_rhpq = std::conditional_t<is_hierarchical_queue_key_v<key>,
+  HierarchicalQueue<key, value, false>,
+  poutre_rpq_stable<key, value>>;
 
 //! @} doxygroup: image_processing_pqueue_group
 }// namespace poutre::details
@@ -18,9 +18,15 @@
  */
 
 #include <poutre/base/config.hpp>
+#include <poutre/base/details/simd/simd_dispatch.hpp>
 #include <poutre/base/details/simd/simd_helpers.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/types_traits.hpp>
 
+#include <algorithm>
+#include <concepts>
+#include <type_traits>
+
 
 /**
  * @addtogroup simd_group SIMD facilities
@@ -28,8 +34,35 @@
  *@{
  */
 namespace poutre::simd {
+//! Block size granularity (in elements) preserving SIMD alignment of each block start
+template<typename T> constexpr std::size_t t_AlignedBlockStep() POUTRE_NOEXCEPT
+{
+  return std::max<std::size_t>(SIMD_IDEAL_MAX_ALIGN_BYTES / sizeof(T), 1);
+}
+
+/**
+ * @brief Unary ops with a static @c DispatchedUnaryKernel @c dispatched_kernel member and a @c dispatched_value()
+ * (constant operand) run the kernel compiled for the best arch of the running CPU
+ */
+template<class UnOp, typename T, typename U>
+inline constexpr bool is_dispatched_unary_op_v =
+  requires(const UnOp &op) {
+    { UnOp::dispatched_kernel } -> std::convertible_to<DispatchedUnaryKernel>;
+    { op.dispatched_value() } -> std::convertible_to<T>;
+  } && std::is_same_v<T, U> && is_dispatched_type_v<T>;
+
+//! Binary ops with a static @c dispatched_kernel member run the kernel compiled for the best arch of the running CPU
+template<class BinOp, typename T1, typename T2, typename U>
+inline constexpr bool is_dispatched_binary_op_v = requires { BinOp::dispatched_kernel; } && std::is_same_v<T1, T2>
+                                                  && std::is_same_v<T1, U> && is_dispatched_type_v<T1>;
+
+/**
+ * @name serial kernels
+ * Process the whole contiguous range with the calling thread
+ */
+/**@{*/
 template<typename T, typename U, typename UnOp>
-U *transform(const T *__restrict first, const T *__restrict last, U *__restrict out, UnOp func)
+U *transform_serial(const T *__restrict first, const T *__restrict last, U *__restrict out, UnOp func)
   POUTRE_NOEXCEPTONLYNDEBUG
 {
   POUTRE_ASSERTCHECK(first, "null ptr");
@@ -85,7 +118,7 @@ U *transform(const T *__restrict first, const T *__restrict last, U *__restrict
 }
 
 template<typename T1, typename T2, typename U, typename BinOp>
-U *transform(T1 const *__restrict first1,
+U *transform_serial(T1 const *__restrict first1,
   T1 const *__restrict last1,
   T2 const *__restrict first2,
   U *__restrict out,
@@ -149,7 +182,7 @@ U *transform(T1 const *__restrict first1,
 }
 
 template<typename T1, typename T2, typename T3, typename U, typename TerOp>
-U *transform(T1 const *__restrict first1,
+U *transform_serial(T1 const *__restrict first1,
   T1 const *__restrict last1,
   T2 const *__restrict first2,
   T3 const *__restrict first3,
@@ -221,7 +254,7 @@ U *transform(T1 const *__restrict first1,
 }
 
 template<typename T1, typename T2, typename T3, typename T4, typename U, typename QuaterOp>
-U *transform(T1 const *__restrict first1,
+U *transform_serial(T1 const *__restrict first1,
   T1 const *__restrict last1,
   T2 const *__restrict first2,
   T3 const *__restrict first3,
@@ -304,5 +337,115 @@ U *transform(T1 const *__restrict first1,
   for (; i < static_cast<size_t>(size); ++i) { *out++ = func(*first1++, *first2++, *first3++, *first4++); }
   return out;
 }
+/**@}*/
+
+/**
+ * @name block parallel kernels
+ * Split large contiguous range in aligned blocks dispatched over @c ExecutionContext, small range take the serial path
+ */
+/**@{*/
+template<typename T, typename U, typename UnOp>
+U *transform(const T *__restrict first, const T *__restrict last, U *__restrict out, UnOp func)
+  POUTRE_NOEXCEPTONLYNDEBUG
+{
+  const auto size = static_cast<std::size_t>(std::distance(first, last));
+  if constexpr (is_dispatched_unary_op_v<UnOp, T, U>) {
+    const T value = func.dispatched_value();
+    ParallelForBlocks(size, t_AlignedBlockStep<T>(), [&](std::size_t begin, std::size_t end) {
+      DispatchedUnaryTransform(UnOp::dispatched_kernel, first + begin, value, out + begin, end - begin);
+    });
+  } else {
+    ParallelForBlocks(size, t_AlignedBlockStep<T>(), [&](std::size_t begin, std::size_t end) {
+      transform_serial(first + begin, first + end, out + begin, func);
+    });
+  }
+  return out + size;
+}
+
+template<typename T1, typename T2, typename U, typename BinOp>
+U *transform(T1 const *__restrict first1,
+  T1 const *__restrict last1,
+  T2 const *__restrict first2,
+  U *__restrict out,
+  BinOp func) POUTRE_NOEXCEPTONLYNDEBUG
+{
+  const auto size = static_cast<std::size_t>(std::distance(first1, last1));
+  if constexpr (is_dispatched_binary_op_v<BinOp, T1, T2, U>) {
+    ParallelForBlocks(size, t_AlignedBlockStep<T1>(), [&](std::size_t begin, std::size_t end) {
+      DispatchedTransform(BinOp::dispatched_kernel, first1 + begin, first2 + begin, out + begin, end - begin);
+    });
+  } else {
+    ParallelForBlocks(size, t_AlignedBlockStep<T1>(), [&](std::size_t begin, std::size_t end) {
+      transform_serial(first1 + begin, first1 + end, first2 + begin, out + begin, func);
+    });
+  }
+  return out + size;
+}
+
+template<typename T1, typename T2, typename T3, typename U, typename TerOp>
+U *transform(T1 const *__restrict first1,
+  T1 const *__restrict last1,
+  T2 const *__restrict first2,
+  T3 const *__restrict first3,
+  U *__restrict out,
+  TerOp func) POUTRE_NOEXCEPTONLYNDEBUG
+{
+  const auto size = static_cast<std::size_t>(std::distance(first1, last1));
+  ParallelForBlocks(size, t_AlignedBlockStep<T1>(), [&](std::size_t begin, std::size_t end) {
+    transform_serial(first1 + begin, first1 + end, first2 + begin, first3 + begin, out + begin, func);
+  });
+  return out + size;
+}
+
+template<typename T1, typename T2, typename T3, typename T4, typename U, typename QuaterOp>
+U *transform(T1 const *__restrict first1,
+  T1 const *__restrict last1,
+  T2 const *__restrict first2,
+  T3 const *__restrict first3,
+  T4 const *__restrict first4,
+  U *__restrict out,
+  QuaterOp func) POUTRE_NOEXCEPTONLYNDEBUG
+{
+  const auto size = static_cast<std::size_t>(std::distance(first1, last1));
+  ParallelForBlocks(size, t_AlignedBlockStep<T1>(), [&](std::size_t begin, std::size_t end) {
+    transform_serial(first1 + begin, first1 + end, first2 + begin, first3 + begin, first4 + begin, out + begin, func);
+  });
+  return out + size;
+}
+/**@}*/
+
+/**
+ * @name search kernels
+ * Scan contiguous range by SIMD batches, intended to skip quickly long uniform runs (e.g. background)
+ */
+/**@{*/
+//! First element of [first,last[ not equal to value, last if none
+template<typename T> const T *find_first_not_equal(const T *first, const T *last, T value) POUTRE_NOEXCEPTONLYNDEBUG
+{
+  POUTRE_ASSERTCHECK(first, "null ptr");
+  POUTRE_ASSERTCHECK(last, "null ptr");
+  using simd_type_T = typename TypeTraits<T>::simd_type;
+  const auto simd_size = static_cast<std::ptrdiff_t>(TypeTraits<T>::simd_loop_step);
+  const simd_type_T simd_value(value);
+  for (; std::distance(first, last) >= simd_size; first += simd_size) {
+    if (xs::any(xs::load_unaligned(first) != simd_value)) { break; }
+  }
+  return std::find_if(first, last, [value](T element) { return element != value; });
+}
+
+//! First element of [first,last[ equal to value, last if none
+template<typename T> const T *find_first_equal(const T *first, const T *last, T value) POUTRE_NOEXCEPTONLYNDEBUG
+{
+  POUTRE_ASSERTCHECK(first, "null ptr");
+  POUTRE_ASSERTCHECK(last, "null ptr");
+  using simd_type_T = typename TypeTraits<T>::simd_type;
+  const auto simd_size = static_cast<std::ptrdiff_t>(TypeTraits<T>::simd_loop_step);
+  const simd_type_T simd_value(value);
+  for (; std::distance(first, last) >= simd_size; first += simd_size) {
+    if (xs::any(xs::load_unaligned(first) == simd_value)) { break; }
+  }
+  return std::find(first, last, value);
+}
+/**@}*/
 }// namespace poutre::simd
  //! @} doxygroup: simd_group
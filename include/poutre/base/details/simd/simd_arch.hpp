@@ -0,0 +1,332 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   simd_arch.hpp
+ * @author Thomas Retornaz
+ * @brief  xsimd archs targeted by the library and kernels compiled for each of them
+ *
+ * This header is included by the per arch translation units (src/base/simd_kernels_*.cpp) which are compiled with
+ * wider instruction sets than the rest of the library. Keep it free of anything that could emit code or run at load
+ * time (poutre types, images, ...), only xsimd and the plain scalar typedefs of config.hpp are allowed here.
+ */
+
+#include <cstddef>
+#include <poutre/base/config.hpp>
+
+#if defined(POUTRE_IS_GCC) || defined(POUTRE_IS_CLANG)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wold-style-cast"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#pragma GCC diagnostic ignored "-Wfloat-conversion"
+#ifdef POUTRE_IS_CLANG
+#pragma clang diagnostic ignored "-Wshorten-64-to-32"
+#pragma clang diagnostic ignored "-Wimplicit-int-conversion"
+#elifdef POUTRE_IS_GCC
+#pragma GCC diagnostic ignored "-Wuseless-cast"
+#endif
+#pragma GCC diagnostic ignored "-Wcast-align"
+#pragma GCC diagnostic ignored "-Wdouble-promotion"
+#pragma GCC diagnostic ignored "-Warray-bounds"
+#endif
+#include <xsimd/xsimd.hpp>
+#if defined(POUTRE_IS_GCC) || defined(POUTRE_IS_CLANG)
+#pragma GCC diagnostic pop
+#endif
+
+namespace xs = xsimd;
+
+namespace poutre::simd {
+/**
+ * @addtogroup simd_group SIMD facilities
+ * @ingroup poutre_base_group
+ *@{
+ */
+
+#if defined(POUTRE_SIMD_DISPATCH)
+//! Archs with a compiled set of dispatched kernels, from the best to the baseline one
+using dispatch_arch_list = xs::arch_list<xs::avx512bw, xs::avx2, xs::sse4_2>;
+#else
+//! Single arch build, the one selected by compiler flags
+using dispatch_arch_list = xs::arch_list<xs::default_arch>;
+#endif
+
+//! Binary pixel wise kernels compiled for each arch of @c dispatch_arch_list
+enum class DispatchedBinaryKernel
+{
+  Inf,
+  Sup,
+  SaturatedAdd,
+  SaturatedSub
+};
+
+/**
+ * @brief out[i] = kernel(in1[i], in2[i]) for i in [0,size[ using @c Arch instruction set
+ *
+ * Only defined in the translation unit compiled for @c Arch, see simd_kernels_impl.hpp
+ */
+template<class Arch, typename T>
+void t_BinaryLineKernel(Arch, DispatchedBinaryKernel kernel, const T *in1, const T *in2, T *out, std::size_t size);
+
+//! Explicit instantiation (PREFIX empty) or declaration (PREFIX extern) of one dispatched kernel
+#define POUTRE_SIMD_BINARY_LINE_KERNEL(PREFIX, ARCH, T)                                                                \
+  PREFIX template void t_BinaryLineKernel<ARCH, T>(                                                                    \
+    ARCH, DispatchedBinaryKernel, const T *, const T *, T *, std::size_t);
+
+//! All dispatched kernels of one arch, see @c is_dispatched_type_v
+#define POUTRE_SIMD_BINARY_LINE_KERNELS(PREFIX, ARCH)                                                                  \
+  POUTRE_SIMD_BINARY_LINE_KERNEL(PREFIX, ARCH, u8)                                                                     \
+  POUTRE_SIMD_BINARY_LINE_KERNEL(PREFIX, ARCH, u16)                                                                    \
+  POUTRE_SIMD_BINARY_LINE_KERNEL(PREFIX, ARCH, i16)                                                                    \
+  POUTRE_SIMD_BINARY_LINE_KERNEL(PREFIX, ARCH, i32)                                                                    \
+  POUTRE_SIMD_BINARY_LINE_KERNEL(PREFIX, ARCH, i64)                                                                    \
+  POUTRE_SIMD_BINARY_LINE_KERNEL(PREFIX, ARCH, f32)                                                                    \
+  POUTRE_SIMD_BINARY_LINE_KERNEL(PREFIX, ARCH, f64)
+
+//! Unary pixel wise kernels compiled for each arch of @c dispatch_arch_list, value is the constant operand if any
+enum class DispatchedUnaryKernel
+{
+  Invert,
+  SaturatedAddConstant,
+  SaturatedSubConstant
+};
+
+/**
+ * @brief out[i] = kernel(in[i], value) for i in [0,size[ using @c Arch instruction set
+ *
+ * Only defined in the translation unit compiled for @c Arch, see simd_kernels_impl.hpp
+ */
+template<class Arch, typename T>
+void t_UnaryLineKernel(Arch, DispatchedUnaryKernel kernel, const T *in, T value, T *out, std::size_t size);
+
+#define POUTRE_SIMD_UNARY_LINE_KERNEL(PREFIX, ARCH, T)                                                                 \
+  PREFIX template void t_UnaryLineKernel<ARCH, T>(ARCH, DispatchedUnaryKernel, const T *, T, T *, std::size_t);
+
+#define POUTRE_SIMD_UNARY_LINE_KERNELS(PREFIX, ARCH)                                                                   \
+  POUTRE_SIMD_UNARY_LINE_KERNEL(PREFIX, ARCH, u8)                                                                      \
+  POUTRE_SIMD_UNARY_LINE_KERNEL(PREFIX, ARCH, u16)                                                                     \
+  POUTRE_SIMD_UNARY_LINE_KERNEL(PREFIX, ARCH, i16)                                                                     \
+  POUTRE_SIMD_UNARY_LINE_KERNEL(PREFIX, ARCH, i32)                                                                     \
+  POUTRE_SIMD_UNARY_LINE_KERNEL(PREFIX, ARCH, i64)                                                                     \
+  POUTRE_SIMD_UNARY_LINE_KERNEL(PREFIX, ARCH, f32)                                                                     \
+  POUTRE_SIMD_UNARY_LINE_KERNEL(PREFIX, ARCH, f64)
+
+/**
+ * @brief van Herk/Gil-Werman along y of the columns [x_begin,x_end[ of a ysize x xsize row major image
+ *
+ * See @c van_herck_vertical, kernel must be @c DispatchedBinaryKernel::Inf or @c DispatchedBinaryKernel::Sup.
+ * neutral_row holds x_end-x_begin neutral elements, g, h_current and h_previous min(2k+1,ysize+2k)*(x_end-x_begin)
+ * elements each. Only defined in the translation unit compiled for @c Arch
+ */
+template<class Arch, typename T>
+void t_VanHerckStripKernel(Arch,
+  DispatchedBinaryKernel kernel,
+  const T *in,
+  T *out,
+  std::ptrdiff_t xsize,
+  std::ptrdiff_t ysize,
+  std::ptrdiff_t x_begin,
+  std::ptrdiff_t x_end,
+  std::ptrdiff_t size_line_segment,
+  const T *neutral_row,
+  T *g,
+  T *h_current,
+  T *h_previous);
+
+#define POUTRE_SIMD_VAN_HERCK_KERNEL(PREFIX, ARCH, T)                                                                  \
+  PREFIX template void t_VanHerckStripKernel<ARCH, T>(ARCH,                                                            \
+    DispatchedBinaryKernel,                                                                                            \
+    const T *,                                                                                                         \
+    T *,                                                                                                               \
+    std::ptrdiff_t,                                                                                                    \
+    std::ptrdiff_t,                                                                                                    \
+    std::ptrdiff_t,                                                                                                    \
+    std::ptrdiff_t,                                                                                                    \
+    std::ptrdiff_t,                                                                                                    \
+    const T *,                                                                                                         \
+    T *,                                                                                                               \
+    T *,                                                                                                               \
+    T *);
+
+#define POUTRE_SIMD_VAN_HERCK_KERNELS(PREFIX, ARCH)                                                                    \
+  POUTRE_SIMD_VAN_HERCK_KERNEL(PREFIX, ARCH, u8)                                                                       \
+  POUTRE_SIMD_VAN_HERCK_KERNEL(PREFIX, ARCH, u16)                                                                      \
+  POUTRE_SIMD_VAN_HERCK_KERNEL(PREFIX, ARCH, i16)                                                                      \
+  POUTRE_SIMD_VAN_HERCK_KERNEL(PREFIX, ARCH, i32)                                                                      \
+  POUTRE_SIMD_VAN_HERCK_KERNEL(PREFIX, ARCH, i64)                                                                      \
+  POUTRE_SIMD_VAN_HERCK_KERNEL(PREFIX, ARCH, f32)                                                                      \
+  POUTRE_SIMD_VAN_HERCK_KERNEL(PREFIX, ARCH, f64)
+
+//! Compare operators of the dispatched compare/select kernels, lhs is the input pixel
+enum class DispatchedCompare
+{
+  Equal,
+  Diff,
+  Sup,
+  SupEqual,
+  Inf,
+  InfEqual
+};
+
+//! Operand of the dispatched compare/select kernels, a contiguous buffer if ptr is not null, value otherwise
+template<typename T> struct DispatchedOperand
+{
+  const T *ptr;
+  T value;
+};
+
+/**
+ * @brief out[i] = compare(in[i], comp(i)) ? vtrue(i) : vfalse(i) for i in [begin,end[
+ *
+ * Only defined in the translation unit compiled for @c Arch
+ */
+template<class Arch, typename Tin, typename Tout>
+void t_CompareSelectKernel(Arch,
+  DispatchedCompare compare,
+  const Tin *in,
+  DispatchedOperand<Tin> comp,
+  DispatchedOperand<Tout> vtrue,
+  DispatchedOperand<Tout> vfalse,
+  Tout *out,
+  std::size_t begin,
+  std::size_t end);
+
+#define POUTRE_SIMD_COMPARE_SELECT_KERNEL(PREFIX, ARCH, TIN, TOUT)                                                     \
+  PREFIX template void t_CompareSelectKernel<ARCH, TIN, TOUT>(ARCH,                                                    \
+    DispatchedCompare,                                                                                                 \
+    const TIN *,                                                                                                       \
+    DispatchedOperand<TIN>,                                                                                            \
+    DispatchedOperand<TOUT>,                                                                                           \
+    DispatchedOperand<TOUT>,                                                                                           \
+    TOUT *,                                                                                                            \
+    std::size_t,                                                                                                       \
+    std::size_t);
+
+//! Kernels from TIN to every dispatched type
+#define POUTRE_SIMD_COMPARE_SELECT_KERNELS_FROM(PREFIX, ARCH, TIN, T1, T2, T3, T4, T5, T6)                             \
+  POUTRE_SIMD_COMPARE_SELECT_KERNEL(PREFIX, ARCH, TIN, TIN)                                                            \
+  POUTRE_SIMD_COMPARE_SELECT_KERNEL(PREFIX, ARCH, TIN, T1)                                                             \
+  POUTRE_SIMD_COMPARE_SELECT_KERNEL(PREFIX, ARCH, TIN, T2)                                                             \
+  POUTRE_SIMD_COMPARE_SELECT_KERNEL(PREFIX, ARCH, TIN, T3)                                                             \
+  POUTRE_SIMD_COMPARE_SELECT_KERNEL(PREFIX, ARCH, TIN, T4)                                                             \
+  POUTRE_SIMD_COMPARE_SELECT_KERNEL(PREFIX, ARCH, TIN, T5)                                                             \
+  POUTRE_SIMD_COMPARE_SELECT_KERNEL(PREFIX, ARCH, TIN, T6)
+
+#define POUTRE_SIMD_COMPARE_SELECT_KERNELS(PREFIX, ARCH)                                                               \
+  POUTRE_SIMD_COMPARE_SELECT_KERNELS_FROM(PREFIX, ARCH, u8, u16, i16, i32, i64, f32, f64)                              \
+  POUTRE_SIMD_COMPARE_SELECT_KERNELS_FROM(PREFIX, ARCH, u16, u8, i16, i32, i64, f32, f64)                              \
+  POUTRE_SIMD_COMPARE_SELECT_KERNELS_FROM(PREFIX, ARCH, i16, u8, u16, i32, i64, f32, f64)                              \
+  POUTRE_SIMD_COMPARE_SELECT_KERNELS_FROM(PREFIX, ARCH, i32, u8, u16, i16, i64, f32, f64)                              \
+  POUTRE_SIMD_COMPARE_SELECT_KERNELS_FROM(PREFIX, ARCH, i64, u8, u16, i16, i32, f32, f64)                              \
+  POUTRE_SIMD_COMPARE_SELECT_KERNELS_FROM(PREFIX, ARCH, f32, u8, u16, i16, i32, i64, f64)                              \
+  POUTRE_SIMD_COMPARE_SELECT_KERNELS_FROM(PREFIX, ARCH, f64, u8, u16, i16, i32, i64, f32)
+
+/**
+ * @brief lineout[x] = kernel over k of linein[x + offsets[k]] for x in [0,xsize[, see @c t_ErodeDilatePitchedLine
+ *
+ * kernel must be @c DispatchedBinaryKernel::Inf or @c DispatchedBinaryKernel::Sup, every linein[x + offsets[k]] must
+ * be addressable. Only defined in the translation unit compiled for @c Arch
+ */
+template<class Arch, typename T>
+void t_NeighborLineKernel(Arch,
+  DispatchedBinaryKernel kernel,
+  const T *linein,
+  T *lineout,
+  std::ptrdiff_t xsize,
+  const std::ptrdiff_t *offsets,
+  std::ptrdiff_t nb_neighbors);
+
+#define POUTRE_SIMD_NEIGHBOR_LINE_KERNEL(PREFIX, ARCH, T)                                                              \
+  PREFIX template void t_NeighborLineKernel<ARCH, T>(                                                                  \
+    ARCH, DispatchedBinaryKernel, const T *, T *, std::ptrdiff_t, const std::ptrdiff_t *, std::ptrdiff_t);
+
+#define POUTRE_SIMD_NEIGHBOR_LINE_KERNELS(PREFIX, ARCH)                                                                \
+  POUTRE_SIMD_NEIGHBOR_LINE_KERNEL(PREFIX, ARCH, u8)                                                                   \
+  POUTRE_SIMD_NEIGHBOR_LINE_KERNEL(PREFIX, ARCH, u16)                                                                  \
+  POUTRE_SIMD_NEIGHBOR_LINE_KERNEL(PREFIX, ARCH, i16)                                                                  \
+  POUTRE_SIMD_NEIGHBOR_LINE_KERNEL(PREFIX, ARCH, i32)                                                                  \
+  POUTRE_SIMD_NEIGHBOR_LINE_KERNEL(PREFIX, ARCH, i64)                                                                  \
+  POUTRE_SIMD_NEIGHBOR_LINE_KERNEL(PREFIX, ARCH, f32)                                                                  \
+  POUTRE_SIMD_NEIGHBOR_LINE_KERNEL(PREFIX, ARCH, f64)
+
+/**
+ * @brief io_line[i] = kernel(io_line[i], shifted(i)) for the packed words i in [begin,end[
+ *
+ * shifted(i) = i_line[i+shift_words] >> shift_bits | i_line[i+shift_words+1] << (64-shift_bits), the second word
+ * being only read if shift_bits != 0. On bit sets @c DispatchedBinaryKernel::Inf is a and, @c Sup a or.
+ * Only defined in the translation unit compiled for @c Arch
+ */
+template<class Arch>
+void t_BinPackShiftLineKernel(Arch,
+  DispatchedBinaryKernel kernel,
+  const u64 *i_line,
+  std::ptrdiff_t shift_words,
+  int shift_bits,
+  u64 *io_line,
+  std::ptrdiff_t begin,
+  std::ptrdiff_t end);
+
+#define POUTRE_SIMD_BINPACK_SHIFT_LINE_KERNEL(PREFIX, ARCH)                                                            \
+  PREFIX template void t_BinPackShiftLineKernel<ARCH>(                                                                 \
+    ARCH, DispatchedBinaryKernel, const u64 *, std::ptrdiff_t, int, u64 *, std::ptrdiff_t, std::ptrdiff_t);
+
+/**
+ * @brief Cache blocked transpose of rows [row_begin,row_end[ of a src_rows x src_cols row major matrix
+ *
+ * See @c t_TransposeBlocked (simd_transpose.hpp). Only defined in the translation unit compiled for @c Arch
+ */
+template<class Arch, typename T>
+void t_TransposeBlockedKernel(Arch,
+  const T *src,
+  std::ptrdiff_t src_rows,
+  std::ptrdiff_t src_cols,
+  T *dst,
+  std::ptrdiff_t row_begin,
+  std::ptrdiff_t row_end);
+
+#define POUTRE_SIMD_TRANSPOSE_KERNEL(PREFIX, ARCH, T)                                                                  \
+  PREFIX template void t_TransposeBlockedKernel<ARCH, T>(                                                              \
+    ARCH, const T *, std::ptrdiff_t, std::ptrdiff_t, T *, std::ptrdiff_t, std::ptrdiff_t);
+
+#define POUTRE_SIMD_TRANSPOSE_KERNELS(PREFIX, ARCH)                                                                    \
+  POUTRE_SIMD_TRANSPOSE_KERNEL(PREFIX, ARCH, u8)                                                                       \
+  POUTRE_SIMD_TRANSPOSE_KERNEL(PREFIX, ARCH, u16)                                                                      \
+  POUTRE_SIMD_TRANSPOSE_KERNEL(PREFIX, ARCH, i16)                                                                      \
+  POUTRE_SIMD_TRANSPOSE_KERNEL(PREFIX, ARCH, i32)                                                                      \
+  POUTRE_SIMD_TRANSPOSE_KERNEL(PREFIX, ARCH, i64)                                                                      \
+  POUTRE_SIMD_TRANSPOSE_KERNEL(PREFIX, ARCH, f32)                                                                      \
+  POUTRE_SIMD_TRANSPOSE_KERNEL(PREFIX, ARCH, f64)
+
+//! Every dispatched kernel of one arch
+#define POUTRE_SIMD_KERNELS(PREFIX, ARCH)                                                                              \
+  POUTRE_SIMD_BINARY_LINE_KERNELS(PREFIX, ARCH)                                                                        \
+  POUTRE_SIMD_UNARY_LINE_KERNELS(PREFIX, ARCH)                                                                         \
+  POUTRE_SIMD_VAN_HERCK_KERNELS(PREFIX, ARCH)                                                                          \
+  POUTRE_SIMD_COMPARE_SELECT_KERNELS(PREFIX, ARCH)                                                                     \
+  POUTRE_SIMD_NEIGHBOR_LINE_KERNELS(PREFIX, ARCH)                                                                      \
+  POUTRE_SIMD_BINPACK_SHIFT_LINE_KERNEL(PREFIX, ARCH)                                                                  \
+  POUTRE_SIMD_TRANSPOSE_KERNELS(PREFIX, ARCH)
+
+#if defined(POUTRE_SIMD_DISPATCH)
+POUTRE_SIMD_KERNELS(extern, xs::avx512bw)
+POUTRE_SIMD_KERNELS(extern, xs::avx2)
+POUTRE_SIMD_KERNELS(extern, xs::sse4_2)
+#else
+POUTRE_SIMD_KERNELS(extern, xs::default_arch)
+#endif
+
+//! @} doxygroup: simd_group
+}// namespace poutre::simd
+
+//! Buffers are aligned for the widest arch that may be selected at runtime
+const POUTRE_CONSTEXPR size_t SIMD_IDEAL_MAX_ALIGN_BYTES =
+  poutre::simd::dispatch_arch_list::alignment() > xsimd::default_arch::alignment()
+    ? poutre::simd::dispatch_arch_list::alignment()
+    : xsimd::default_arch::alignment();
@@ -0,0 +1,219 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   simd_dispatch.hpp
+ * @author Thomas Retornaz
+ * @brief  Kernels compiled for several archs, the best one available on the running CPU is selected once
+ *
+ *
+ */
+
+#include <poutre/base/base.hpp>
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/simd/simd_arch.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+namespace poutre::simd {
+/**
+ * @addtogroup simd_group SIMD facilities
+ * @ingroup poutre_base_group
+ *@{
+ */
+
+//! True if @c T has dispatched kernels
+template<typename T>
+inline constexpr bool is_dispatched_type_v =
+  std::is_same_v<T, u8> || std::is_same_v<T, u16> || std::is_same_v<T, i16> || std::is_same_v<T, i32>
+  || std::is_same_v<T, i64> || std::is_same_v<T, f32> || std::is_same_v<T, f64>;
+
+/**
+ * @name dispatched kernels
+ * out[i] = kernel(in1[i], in2[i]) for i in [0,size[, serial, with the best arch of @c dispatch_arch_list supported by
+ * the running CPU
+ */
+/**@{*/
+BASE_API void
+  DispatchedTransform(DispatchedBinaryKernel kernel, const u8 *in1, const u8 *in2, u8 *out, std::size_t size);
+BASE_API void
+  DispatchedTransform(DispatchedBinaryKernel kernel, const u16 *in1, const u16 *in2, u16 *out, std::size_t size);
+BASE_API void
+  DispatchedTransform(DispatchedBinaryKernel kernel, const i16 *in1, const i16 *in2, i16 *out, std::size_t size);
+BASE_API void
+  DispatchedTransform(DispatchedBinaryKernel kernel, const i32 *in1, const i32 *in2, i32 *out, std::size_t size);
+BASE_API void
+  DispatchedTransform(DispatchedBinaryKernel kernel, const i64 *in1, const i64 *in2, i64 *out, std::size_t size);
+BASE_API void
+  DispatchedTransform(DispatchedBinaryKernel kernel, const f32 *in1, const f32 *in2, f32 *out, std::size_t size);
+BASE_API void
+  DispatchedTransform(DispatchedBinaryKernel kernel, const f64 *in1, const f64 *in2, f64 *out, std::size_t size);
+/**@}*/
+
+/**
+ * @brief out[i] = kernel(in[i], value) for i in [0,size[ with the best arch of the running CPU, see
+ * @c t_UnaryLineKernel
+ *
+ * Defined for the types of @c is_dispatched_type_v
+ */
+template<typename T>
+void DispatchedUnaryTransform(DispatchedUnaryKernel kernel, const T *in, T value, T *out, std::size_t size);
+
+/**
+ * @brief van Herk along y of a column strip with the best arch of the running CPU, see @c t_VanHerckStripKernel
+ *
+ * Defined for the types of @c is_dispatched_type_v
+ */
+template<typename T>
+void DispatchedVanHerckStrip(DispatchedBinaryKernel kernel,
+  const T *in,
+  T *out,
+  std::ptrdiff_t xsize,
+  std::ptrdiff_t ysize,
+  std::ptrdiff_t x_begin,
+  std::ptrdiff_t x_end,
+  std::ptrdiff_t size_line_segment,
+  const T *neutral_row,
+  T *g,
+  T *h_current,
+  T *h_previous);
+
+/**
+ * @brief Compare/select with the best arch of the running CPU, see @c t_CompareSelectKernel
+ *
+ * Defined for every pair of types of @c is_dispatched_type_v
+ */
+template<typename Tin, typename Tout>
+void DispatchedCompareSelect(DispatchedCompare compare,
+  const Tin *in,
+  DispatchedOperand<Tin> comp,
+  DispatchedOperand<Tout> vtrue,
+  DispatchedOperand<Tout> vfalse,
+  Tout *out,
+  std::size_t begin,
+  std::size_t end);
+
+/**
+ * @brief Erode (Inf) or dilate (Sup) one line against linear offsets with the best arch of the running CPU, see
+ * @c t_NeighborLineKernel
+ *
+ * Defined for the types of @c is_dispatched_type_v
+ */
+template<typename T>
+void DispatchedNeighborLine(DispatchedBinaryKernel kernel,
+  const T *linein,
+  T *lineout,
+  std::ptrdiff_t xsize,
+  const std::ptrdiff_t *offsets,
+  std::ptrdiff_t nb_neighbors);
+
+//! Combine a shifted packed line with the best arch of the running CPU, see @c t_BinPackShiftLineKernel
+BASE_API void DispatchedBinPackShiftLine(DispatchedBinaryKernel kernel,
+  const u64 *i_line,
+  std::ptrdiff_t shift_words,
+  int shift_bits,
+  u64 *io_line,
+  std::ptrdiff_t begin,
+  std::ptrdiff_t end);
+
+/**
+ * @brief Cache blocked transpose with the best arch of the running CPU, see @c t_TransposeBlocked
+ *
+ * Defined for the types of @c is_dispatched_type_v
+ */
+template<typename T>
+void DispatchedTransposeBlocked(const T *src,
+  std::ptrdiff_t src_rows,
+  std::ptrdiff_t src_cols,
+  T *dst,
+  std::ptrdiff_t row_begin,
+  std::ptrdiff_t row_end);
+
+//! Explicit instantiation (PREFIX empty) or declaration (PREFIX extern) of @c DispatchedUnaryTransform
+#define POUTRE_DISPATCHED_UNARY_TRANSFORM(PREFIX, T)                                                                   \
+  PREFIX template BASE_API void DispatchedUnaryTransform<T>(DispatchedUnaryKernel, const T *, T, T *, std::size_t);
+
+//! Explicit instantiation (PREFIX empty) or declaration (PREFIX extern) of @c DispatchedVanHerckStrip
+#define POUTRE_DISPATCHED_VAN_HERCK(PREFIX, T)                                                                         \
+  PREFIX template BASE_API void DispatchedVanHerckStrip<T>(DispatchedBinaryKernel,                                     \
+    const T *,                                                                                                         \
+    T *,                                                                                                               \
+    std::ptrdiff_t,                                                                                                    \
+    std::ptrdiff_t,                                                                                                    \
+    std::ptrdiff_t,                                                                                                    \
+    std::ptrdiff_t,                                                                                                    \
+    std::ptrdiff_t,                                                                                                    \
+    const T *,                                                                                                         \
+    T *,                                                                                                               \
+    T *,                                                                                                               \
+    T *);
+
+//! Explicit instantiation (PREFIX empty) or declaration (PREFIX extern) of @c DispatchedCompareSelect
+#define POUTRE_DISPATCHED_COMPARE_SELECT(PREFIX, TIN, TOUT)                                                            \
+  PREFIX template BASE_API void DispatchedCompareSelect<TIN, TOUT>(DispatchedCompare,                                  \
+    const TIN *,                                                                                                       \
+    DispatchedOperand<TIN>,                                                                                            \
+    DispatchedOperand<TOUT>,                                                                                           \
+    DispatchedOperand<TOUT>,                                                                                           \
+    TOUT *,                                                                                                            \
+    std::size_t,                                                                                                       \
+    std::size_t);
+
+#define POUTRE_DISPATCHED_COMPARE_SELECT_FROM(PREFIX, TIN, T1, T2, T3, T4, T5, T6)                                     \
+  POUTRE_DISPATCHED_COMPARE_SELECT(PREFIX, TIN, TIN)                                                                   \
+  POUTRE_DISPATCHED_COMPARE_SELECT(PREFIX, TIN, T1)                                                                    \
+  POUTRE_DISPATCHED_COMPARE_SELECT(PREFIX, TIN, T2)                                                                    \
+  POUTRE_DISPATCHED_COMPARE_SELECT(PREFIX, TIN, T3)                                                                    \
+  POUTRE_DISPATCHED_COMPARE_SELECT(PREFIX, TIN, T4)                                                                    \
+  POUTRE_DISPATCHED_COMPARE_SELECT(PREFIX, TIN, T5)                                                                    \
+  POUTRE_DISPATCHED_COMPARE_SELECT(PREFIX, TIN, T6)
+
+//! Explicit instantiation (PREFIX empty) or declaration (PREFIX extern) of @c DispatchedNeighborLine
+#define POUTRE_DISPATCHED_NEIGHBOR_LINE(PREFIX, T)                                                                     \
+  PREFIX template BASE_API void DispatchedNeighborLine<T>(                                                             \
+    DispatchedBinaryKernel, const T *, T *, std::ptrdiff_t, const std::ptrdiff_t *, std::ptrdiff_t);
+
+//! Explicit instantiation (PREFIX empty) or declaration (PREFIX extern) of @c DispatchedTransposeBlocked
+#define POUTRE_DISPATCHED_TRANSPOSE(PREFIX, T)                                                                         \
+  PREFIX template BASE_API void DispatchedTransposeBlocked<T>(                                                         \
+    const T *, std::ptrdiff_t, std::ptrdiff_t, T *, std::ptrdiff_t, std::ptrdiff_t);
+
+//! Every dispatched function template of one type
+#define POUTRE_DISPATCHED_TEMPLATES_OF(PREFIX, T)                                                                      \
+  POUTRE_DISPATCHED_UNARY_TRANSFORM(PREFIX, T)                                                                         \
+  POUTRE_DISPATCHED_VAN_HERCK(PREFIX, T)                                                                               \
+  POUTRE_DISPATCHED_NEIGHBOR_LINE(PREFIX, T)                                                                           \
+  POUTRE_DISPATCHED_TRANSPOSE(PREFIX, T)
+
+//! Every dispatched function template
+#define POUTRE_DISPATCHED_TEMPLATES(PREFIX)                                                                            \
+  POUTRE_DISPATCHED_TEMPLATES_OF(PREFIX, u8)                                                                           \
+  POUTRE_DISPATCHED_TEMPLATES_OF(PREFIX, u16)                                                                          \
+  POUTRE_DISPATCHED_TEMPLATES_OF(PREFIX, i16)                                                                          \
+  POUTRE_DISPATCHED_TEMPLATES_OF(PREFIX, i32)                                                                          \
+  POUTRE_DISPATCHED_TEMPLATES_OF(PREFIX, i64)                                                                          \
+  POUTRE_DISPATCHED_TEMPLATES_OF(PREFIX, f32)                                                                          \
+  POUTRE_DISPATCHED_TEMPLATES_OF(PREFIX, f64)                                                                          \
+  POUTRE_DISPATCHED_COMPARE_SELECT_FROM(PREFIX, u8, u16, i16, i32, i64, f32, f64)                                      \
+  POUTRE_DISPATCHED_COMPARE_SELECT_FROM(PREFIX, u16, u8, i16, i32, i64, f32, f64)                                      \
+  POUTRE_DISPATCHED_COMPARE_SELECT_FROM(PREFIX, i16, u8, u16, i32, i64, f32, f64)                                      \
+  POUTRE_DISPATCHED_COMPARE_SELECT_FROM(PREFIX, i32, u8, u16, i16, i64, f32, f64)                                      \
+  POUTRE_DISPATCHED_COMPARE_SELECT_FROM(PREFIX, i64, u8, u16, i16, i32, f32, f64)                                      \
+  POUTRE_DISPATCHED_COMPARE_SELECT_FROM(PREFIX, f32, u8, u16, i16, i32, i64, f64)                                      \
+  POUTRE_DISPATCHED_COMPARE_SELECT_FROM(PREFIX, f64, u8, u16, i16, i32, i64, f32)
+
+POUTRE_DISPATCHED_TEMPLATES(extern)
+
+//! Name of the arch used by dispatched kernels on this CPU (e.g "avx2")
+BASE_API const char *DispatchedArchName() POUTRE_NOEXCEPT;
+
+//! @} doxygroup: simd_group
+}// namespace poutre::simd
@@ -19,33 +19,10 @@
 
 #include <cstddef>
 #include <poutre/base/config.hpp>
+#include <poutre/base/details/simd/simd_arch.hpp>
 #include <poutre/base/types.hpp>
 #include <vector>
 
-#if defined(POUTRE_IS_GCC) || defined(POUTRE_IS_CLANG)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wold-style-cast"
-#pragma GCC diagnostic ignored "-Wsign-conversion"
-#pragma GCC diagnostic ignored "-Wfloat-conversion"
-#ifdef POUTRE_IS_CLANG
-#pragma clang diagnostic ignored "-Wshorten-64-to-32"
-#pragma clang diagnostic ignored "-Wimplicit-int-conversion"
-#elifdef POUTRE_IS_GCC
-#pragma GCC diagnostic ignored "-Wuseless-cast"
-#endif
-#pragma GCC diagnostic ignored "-Wcast-align"
-#pragma GCC diagnostic ignored "-Wdouble-promotion"
-#pragma GCC diagnostic ignored "-Warray-bounds"
-#endif
-#include <xsimd/xsimd.hpp>
-#if defined(POUTRE_IS_GCC) || defined(POUTRE_IS_CLANG)
-#pragma GCC diagnostic pop
-#endif
-
-namespace xs = xsimd;
-
-const POUTRE_CONSTEXPR size_t SIMD_IDEAL_MAX_ALIGN_BYTES = xsimd::default_arch::alignment();
-
 namespace poutre::simd {
 /**
  * @addtogroup simd_group SIMD facilities
@@ -117,9 +94,5 @@ std::pair<ptrdiff_t, ptrdiff_t> POUTRE_ALWAYS_INLINE t_SIMDInputRange(const T *f
   return std::make_pair(size_prologue_loop, size_simd_loop);
 }
 
-template<typename T> decltype(auto) t_ExpandAligned(scoord ySize, scoord xSize) POUTRE_NOEXCEPT
-{
-  return std::vector<T, xs::aligned_allocator<T, SIMD_IDEAL_MAX_ALIGN_BYTES>>(ySize * t_ReachNextAlignedSize<T>(xSize));
-}
 //! @} doxygroup: simd_group
 }// namespace poutre::simd
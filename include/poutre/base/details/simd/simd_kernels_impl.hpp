@@ -0,0 +1,432 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   simd_kernels_impl.hpp
+ * @author Thomas Retornaz
+ * @brief  Definition of the dispatched kernels, only to be included by src/base/simd_kernels_*.cpp
+ *
+ *
+ */
+
+#include <poutre/base/details/simd/simd_arch.hpp>
+#include <poutre/base/details/simd/simd_transpose.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace poutre::simd {
+/**
+ * @addtogroup simd_group SIMD facilities
+ * @ingroup poutre_base_group
+ *@{
+ */
+// every helper is templated on Arch, so that copies compiled with different instruction sets never share a symbol
+namespace kernels {
+  template<class Arch, typename T> T ScalarSaturatedAdd(T lhs, T rhs)
+  {
+    if constexpr (std::is_integral_v<T>) {
+      if (rhs > 0 && lhs > std::numeric_limits<T>::max() - rhs) { return std::numeric_limits<T>::max(); }
+      if (rhs < 0 && lhs < std::numeric_limits<T>::lowest() - rhs) { return std::numeric_limits<T>::lowest(); }
+    }
+    return static_cast<T>(lhs + rhs);
+  }
+
+  template<class Arch, typename T> T ScalarSaturatedSub(T lhs, T rhs)
+  {
+    if constexpr (std::is_integral_v<T>) {
+      if (rhs < 0 && lhs > std::numeric_limits<T>::max() + rhs) { return std::numeric_limits<T>::max(); }
+      if (rhs > 0 && lhs < std::numeric_limits<T>::lowest() + rhs) { return std::numeric_limits<T>::lowest(); }
+    }
+    return static_cast<T>(lhs - rhs);
+  }
+
+  template<class Arch, typename T, class SimdOp, class ScalarOp>
+  void BinaryLoop(const T *in1, const T *in2, T *out, std::size_t size, SimdOp simd_op, ScalarOp scalar_op)
+  {
+    using batch = xs::batch<T, Arch>;
+    constexpr std::size_t step = batch::size;
+    std::size_t i = 0;
+    for (; i + step <= size; i += step) {
+      const auto lhs = batch::load_unaligned(in1 + i);
+      const auto rhs = batch::load_unaligned(in2 + i);
+      simd_op(lhs, rhs).store_unaligned(out + i);
+    }
+    for (; i < size; ++i) { out[i] = scalar_op(in1[i], in2[i]); }
+  }
+}// namespace kernels
+
+template<class Arch, typename T>
+void t_BinaryLineKernel(Arch, DispatchedBinaryKernel kernel, const T *in1, const T *in2, T *out, std::size_t size)
+{
+  using batch = xs::batch<T, Arch>;
+  switch (kernel) {
+  case DispatchedBinaryKernel::Inf: {
+    kernels::BinaryLoop<Arch>(
+      in1, in2, out, size, [](const batch &lhs, const batch &rhs) { return xs::min(lhs, rhs); }, [](T lhs, T rhs) {
+        return lhs < rhs ? lhs : rhs;
+      });
+  } break;
+  case DispatchedBinaryKernel::Sup: {
+    kernels::BinaryLoop<Arch>(
+      in1, in2, out, size, [](const batch &lhs, const batch &rhs) { return xs::max(lhs, rhs); }, [](T lhs, T rhs) {
+        return lhs > rhs ? lhs : rhs;
+      });
+  } break;
+  case DispatchedBinaryKernel::SaturatedAdd: {
+    kernels::BinaryLoop<Arch>(in1,
+      in2,
+      out,
+      size,
+      [](const batch &lhs, const batch &rhs) { return xs::sadd(lhs, rhs); },
+      kernels::ScalarSaturatedAdd<Arch, T>);
+  } break;
+  case DispatchedBinaryKernel::SaturatedSub: {
+    kernels::BinaryLoop<Arch>(in1,
+      in2,
+      out,
+      size,
+      [](const batch &lhs, const batch &rhs) { return xs::ssub(lhs, rhs); },
+      kernels::ScalarSaturatedSub<Arch, T>);
+  } break;
+  }
+}
+
+namespace kernels {
+  template<class Arch, typename T, class SimdOp, class ScalarOp>
+  void UnaryLoop(const T *in, T *out, std::size_t size, SimdOp simd_op, ScalarOp scalar_op)
+  {
+    using batch = xs::batch<T, Arch>;
+    constexpr std::size_t step = batch::size;
+    std::size_t i = 0;
+    for (; i + step <= size; i += step) { simd_op(batch::load_unaligned(in + i)).store_unaligned(out + i); }
+    for (; i < size; ++i) { out[i] = scalar_op(in[i]); }
+  }
+}// namespace kernels
+
+template<class Arch, typename T>
+void t_UnaryLineKernel(Arch, DispatchedUnaryKernel kernel, const T *in, T value, T *out, std::size_t size)
+{
+  using batch = xs::batch<T, Arch>;
+  const batch value_pack(value);
+  switch (kernel) {
+  case DispatchedUnaryKernel::Invert: {
+    kernels::UnaryLoop<Arch>(
+      in, out, size, [](const batch &val) { return -val; }, [](T val) { return static_cast<T>(-val); });
+  } break;
+  case DispatchedUnaryKernel::SaturatedAddConstant: {
+    kernels::UnaryLoop<Arch>(
+      in, out, size, [&](const batch &val) { return xs::sadd(val, value_pack); }, [&](T val) {
+        return kernels::ScalarSaturatedAdd<Arch, T>(val, value);
+      });
+  } break;
+  case DispatchedUnaryKernel::SaturatedSubConstant: {
+    kernels::UnaryLoop<Arch>(
+      in, out, size, [&](const batch &val) { return xs::ssub(val, value_pack); }, [&](T val) {
+        return kernels::ScalarSaturatedSub<Arch, T>(val, value);
+      });
+  } break;
+  }
+}
+
+namespace kernels {
+  //! same recurrence as van_herck_vertical (ero_dil_line_se_t.hpp), rows through BinaryLoop
+  template<class Arch, typename T, class SimdOp, class ScalarOp>
+  void VanHerckStrip(const T *in,
+    T *out,
+    std::ptrdiff_t xsize,
+    std::ptrdiff_t ysize,
+    std::ptrdiff_t x_begin,
+    std::ptrdiff_t x_end,
+    std::ptrdiff_t size_line_segment,
+    const T *neutral_row,
+    T *g,
+    T *h_current,
+    T *h_previous,
+    SimdOp simd_op,
+    ScalarOp scalar_op)
+  {
+    const std::ptrdiff_t width = x_end - x_begin;
+    if (width <= 0 || ysize == 0) { return; }
+    const std::ptrdiff_t alpha = 2 * size_line_segment + 1;
+    const std::ptrdiff_t row_end = ysize + size_line_segment;
+    const auto uwidth = static_cast<std::size_t>(width);
+    const auto row_bytes = uwidth * sizeof(T);
+    auto f = [&](std::ptrdiff_t r) -> const T * {
+      return (r < 0 || r >= ysize) ? neutral_row : in + r * xsize + x_begin;
+    };
+    auto row_op = [&](const T *a, const T *b, T *row_out) {
+      BinaryLoop<Arch>(a, b, row_out, uwidth, simd_op, scalar_op);
+    };
+
+    for (std::ptrdiff_t chunk_start = -size_line_segment; chunk_start < row_end; chunk_start += alpha) {
+      const std::ptrdiff_t chunk_size = std::min(alpha, row_end - chunk_start);
+      // Forward pass
+      std::memcpy(g, f(chunk_start), row_bytes);
+      for (std::ptrdiff_t r = 1; r < chunk_size; ++r) {
+        row_op(g + (r - 1) * width, f(chunk_start + r), g + r * width);
+      }
+      // Backward pass
+      std::memcpy(h_current + (chunk_size - 1) * width, f(chunk_start + chunk_size - 1), row_bytes);
+      for (std::ptrdiff_t r = chunk_size - 2; r >= 0; --r) {
+        row_op(h_current + (r + 1) * width, f(chunk_start + r), h_current + r * width);
+      }
+      // rows y such that y + k falls in the current chunk
+      const std::ptrdiff_t y_begin = std::max<std::ptrdiff_t>(chunk_start - size_line_segment, 0);
+      const std::ptrdiff_t y_end = std::min(chunk_start - size_line_segment + chunk_size, ysize);
+      for (std::ptrdiff_t y = y_begin; y < y_end; ++y) {
+        const std::ptrdiff_t rh = y - size_line_segment - chunk_start;
+        const T *hrow = rh >= 0 ? h_current + rh * width : h_previous + (rh + alpha) * width;
+        row_op(hrow, g + (y + size_line_segment - chunk_start) * width, out + y * xsize + x_begin);
+      }
+      std::swap(h_current, h_previous);
+    }
+  }
+
+  //! operand i as a batch of Arch
+  template<class Arch, typename T> struct OperandLoader
+  {
+    using batch = xs::batch<T, Arch>;
+    DispatchedOperand<T> operand;
+    batch value_pack;
+    explicit OperandLoader(const DispatchedOperand<T> &op) : operand(op), value_pack(op.value) {}
+    [[nodiscard]] batch load(std::size_t i) const
+    {
+      return operand.ptr != nullptr ? batch::load_unaligned(operand.ptr + i) : value_pack;
+    }
+    [[nodiscard]] T operator()(std::size_t i) const { return operand.ptr != nullptr ? operand.ptr[i] : operand.value; }
+  };
+
+  //! masks computed with Tin batches, gathered as bits, then rebuilt as Tout masks to blend true/false operands, unless
+  //! Tin == Tout
+  template<class Arch, typename Tin, typename Tout, class SimdCompare, class ScalarCompare>
+  void CompareSelect(const Tin *in,
+    const DispatchedOperand<Tin> &comp,
+    const DispatchedOperand<Tout> &vtrue,
+    const DispatchedOperand<Tout> &vfalse,
+    Tout *out,
+    std::size_t begin,
+    std::size_t end,
+    SimdCompare simd_compare,
+    ScalarCompare scalar_compare)
+  {
+    using batch_in = xs::batch<Tin, Arch>;
+    using mask_out = xs::batch_bool<Tout, Arch>;
+    constexpr std::size_t lanes_in = batch_in::size;
+    constexpr std::size_t lanes_out = mask_out::size;
+    constexpr std::size_t lanes = std::max(lanes_in, lanes_out);
+    static_assert(lanes <= 64, "compare select lanes must fit in 64 bits");
+    constexpr std::uint64_t out_bits = lanes_out >= 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << lanes_out) - 1;
+    const OperandLoader<Arch, Tin> comp_loader(comp);
+    const OperandLoader<Arch, Tout> true_loader(vtrue);
+    const OperandLoader<Arch, Tout> false_loader(vfalse);
+
+    std::size_t i = begin;
+    if constexpr (std::is_same_v<Tin, Tout>) {
+      // same lanes, the mask feeds select as is
+      for (; i + lanes <= end; i += lanes) {
+        const auto mask = simd_compare(batch_in::load_unaligned(in + i), comp_loader.load(i));
+        xs::select(mask, true_loader.load(i), false_loader.load(i)).store_unaligned(out + i);
+      }
+    } else {
+      for (; i + lanes <= end; i += lanes) {
+        std::uint64_t bits = 0;
+        for (std::size_t k = 0; k < lanes; k += lanes_in) {
+          const auto mask = simd_compare(batch_in::load_unaligned(in + i + k), comp_loader.load(i + k));
+          bits |= static_cast<std::uint64_t>(mask.mask()) << k;
+        }
+        for (std::size_t k = 0; k < lanes; k += lanes_out) {
+          const auto sel = mask_out::from_mask((bits >> k) & out_bits);
+          xs::select(sel, true_loader.load(i + k), false_loader.load(i + k)).store_unaligned(out + i + k);
+        }
+      }
+    }
+    for (; i < end; ++i) { out[i] = scalar_compare(in[i], comp_loader(i)) ? true_loader(i) : false_loader(i); }
+  }
+}// namespace kernels
+
+template<class Arch, typename T>
+void t_VanHerckStripKernel(Arch,
+  DispatchedBinaryKernel kernel,
+  const T *in,
+  T *out,
+  std::ptrdiff_t xsize,
+  std::ptrdiff_t ysize,
+  std::ptrdiff_t x_begin,
+  std::ptrdiff_t x_end,
+  std::ptrdiff_t size_line_segment,
+  const T *neutral_row,
+  T *g,
+  T *h_current,
+  T *h_previous)
+{
+  using batch = xs::batch<T, Arch>;
+  if (kernel == DispatchedBinaryKernel::Inf) {
+    kernels::VanHerckStrip<Arch>(in,
+      out,
+      xsize,
+      ysize,
+      x_begin,
+      x_end,
+      size_line_segment,
+      neutral_row,
+      g,
+      h_current,
+      h_previous,
+      [](const batch &lhs, const batch &rhs) { return xs::min(lhs, rhs); },
+      [](T lhs, T rhs) { return lhs < rhs ? lhs : rhs; });
+  } else {
+    kernels::VanHerckStrip<Arch>(in,
+      out,
+      xsize,
+      ysize,
+      x_begin,
+      x_end,
+      size_line_segment,
+      neutral_row,
+      g,
+      h_current,
+      h_previous,
+      [](const batch &lhs, const batch &rhs) { return xs::max(lhs, rhs); },
+      [](T lhs, T rhs) { return lhs > rhs ? lhs : rhs; });
+  }
+}
+
+template<class Arch, typename Tin, typename Tout>
+void t_CompareSelectKernel(Arch,
+  DispatchedCompare compare,
+  const Tin *in,
+  DispatchedOperand<Tin> comp,
+  DispatchedOperand<Tout> vtrue,
+  DispatchedOperand<Tout> vfalse,
+  Tout *out,
+  std::size_t begin,
+  std::size_t end)
+{
+  using batch = xs::batch<Tin, Arch>;
+  auto run = [&](auto simd_compare, auto scalar_compare) {
+    kernels::CompareSelect<Arch>(in, comp, vtrue, vfalse, out, begin, end, simd_compare, scalar_compare);
+  };
+  switch (compare) {
+  case DispatchedCompare::Equal:
+    run([](const batch &lhs, const batch &rhs) { return lhs == rhs; }, [](Tin lhs, Tin rhs) { return lhs == rhs; });
+    break;
+  case DispatchedCompare::Diff:
+    run([](const batch &lhs, const batch &rhs) { return lhs != rhs; }, [](Tin lhs, Tin rhs) { return lhs != rhs; });
+    break;
+  case DispatchedCompare::Sup:
+    run([](const batch &lhs, const batch &rhs) { return lhs > rhs; }, [](Tin lhs, Tin rhs) { return lhs > rhs; });
+    break;
+  case DispatchedCompare::SupEqual:
+    run([](const batch &lhs, const batch &rhs) { return lhs >= rhs; }, [](Tin lhs, Tin rhs) { return lhs >= rhs; });
+    break;
+  case DispatchedCompare::Inf:
+    run([](const batch &lhs, const batch &rhs) { return lhs < rhs; }, [](Tin lhs, Tin rhs) { return lhs < rhs; });
+    break;
+  case DispatchedCompare::InfEqual:
+    run([](const batch &lhs, const batch &rhs) { return lhs <= rhs; }, [](Tin lhs, Tin rhs) { return lhs <= rhs; });
+    break;
+  }
+}
+
+template<class Arch, typename T>
+void t_NeighborLineKernel(Arch,
+  DispatchedBinaryKernel kernel,
+  const T *linein,
+  T *lineout,
+  std::ptrdiff_t xsize,
+  const std::ptrdiff_t *offsets,
+  std::ptrdiff_t nb_neighbors)
+{
+  using batch = xs::batch<T, Arch>;
+  auto run = [&](T neutral, auto simd_op, auto scalar_op) {
+    constexpr auto step = static_cast<std::ptrdiff_t>(batch::size);
+    std::ptrdiff_t x = 0;
+    for (; x + step <= xsize; x += step) {
+      batch val(neutral);
+      for (std::ptrdiff_t k = 0; k < nb_neighbors; ++k) {
+        val = simd_op(val, batch::load_unaligned(linein + x + offsets[k]));
+      }
+      val.store_unaligned(lineout + x);
+    }
+    for (; x < xsize; ++x) {
+      T val = neutral;
+      for (std::ptrdiff_t k = 0; k < nb_neighbors; ++k) { val = scalar_op(val, linein[x + offsets[k]]); }
+      lineout[x] = val;
+    }
+  };
+  if (kernel == DispatchedBinaryKernel::Inf) {
+    run(
+      std::numeric_limits<T>::max(),
+      [](const batch &lhs, const batch &rhs) { return xs::min(lhs, rhs); },
+      [](T lhs, T rhs) { return lhs < rhs ? lhs : rhs; });
+  } else {
+    run(
+      std::numeric_limits<T>::lowest(),
+      [](const batch &lhs, const batch &rhs) { return xs::max(lhs, rhs); },
+      [](T lhs, T rhs) { return lhs > rhs ? lhs : rhs; });
+  }
+}
+
+template<class Arch>
+void t_BinPackShiftLineKernel(Arch,
+  DispatchedBinaryKernel kernel,
+  const u64 *i_line,
+  std::ptrdiff_t shift_words,
+  int shift_bits,
+  u64 *io_line,
+  std::ptrdiff_t begin,
+  std::ptrdiff_t end)
+{
+  using batch = xs::batch<u64, Arch>;
+  constexpr int word_bits = 64;
+  auto run = [&](auto op) {
+    constexpr auto step = static_cast<std::ptrdiff_t>(batch::size);
+    std::ptrdiff_t i = begin;
+    for (; i + step <= end; i += step) {
+      const u64 *src = i_line + i + shift_words;
+      batch value = batch::load_unaligned(src);
+      if (shift_bits != 0) {
+        value = (value >> shift_bits) | (batch::load_unaligned(src + 1) << (word_bits - shift_bits));
+      }
+      op(batch::load_unaligned(io_line + i), value).store_unaligned(io_line + i);
+    }
+    for (; i < end; ++i) {
+      const u64 *src = i_line + i + shift_words;
+      const u64 value = shift_bits != 0 ? (src[0] >> shift_bits) | (src[1] << (word_bits - shift_bits)) : src[0];
+      io_line[i] = op(io_line[i], value);
+    }
+  };
+  if (kernel == DispatchedBinaryKernel::Inf) {
+    run([](const auto &lhs, const auto &rhs) { return lhs & rhs; });
+  } else {
+    run([](const auto &lhs, const auto &rhs) { return lhs | rhs; });
+  }
+}
+
+template<class Arch, typename T>
+void t_TransposeBlockedKernel(Arch,
+  const T *src,
+  std::ptrdiff_t src_rows,
+  std::ptrdiff_t src_cols,
+  T *dst,
+  std::ptrdiff_t row_begin,
+  std::ptrdiff_t row_end)
+{
+  t_TransposeBlocked<Arch>(src, src_rows, src_cols, dst, row_begin, row_end);
+}
+
+//! @} doxygroup: simd_group
+}// namespace poutre::simd
@@ -0,0 +1,144 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   simd_transpose.hpp
+ * @author Thomas Retornaz
+ * @brief  Cache blocked, register blocked transpose of row major matrices for one xsimd arch
+ *
+ * Included by the per arch translation units (see simd_kernels_impl.hpp), same restrictions as simd_arch.hpp.
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/simd/simd_arch.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+namespace poutre::simd {
+/**
+ * @addtogroup simd_group SIMD facilities
+ * @ingroup poutre_base_group
+ *@{
+ */
+
+/**
+ * @brief Register block edge (in elements) of the simd micro-kernel, one @c Arch register per row
+ *
+ * 1 for non arithmetic pixels, which are transposed element by element.
+ */
+template<typename T, class Arch> constexpr std::ptrdiff_t t_TransposeRegisterBlock() POUTRE_NOEXCEPT
+{
+  if constexpr (std::is_arithmetic_v<T>) {
+    return static_cast<std::ptrdiff_t>(xs::batch<T, Arch>::size);
+  } else {
+    return 1;
+  }
+}
+
+/**
+ * @brief Micro-kernel edge (in elements), 16x16 for narrow types and 8x8 for 64 bits types,
+ * widened to a register block when simd registers hold more lanes
+ */
+template<typename T, class Arch> constexpr std::ptrdiff_t t_TransposeMicroTile() POUTRE_NOEXCEPT
+{
+  return std::max<std::ptrdiff_t>(sizeof(T) >= 8 ? 8 : 16, t_TransposeRegisterBlock<T, Arch>());
+}
+
+//! Cache tile edge (in elements), source and destination tiles fit together in L1
+template<typename T, class Arch> constexpr std::ptrdiff_t t_TransposeCacheTile() POUTRE_NOEXCEPT
+{
+  return 4 * t_TransposeMicroTile<T, Arch>();
+}
+
+//! Rows per parallel block of a transpose, a multiple of the cache tile of every arch that may be selected at runtime
+template<typename T> constexpr std::ptrdiff_t t_TransposeRowBlock() POUTRE_NOEXCEPT
+{
+  constexpr auto widest_lanes = static_cast<std::ptrdiff_t>(SIMD_IDEAL_MAX_ALIGN_BYTES / sizeof(T));
+  return 4 * std::max<std::ptrdiff_t>(sizeof(T) >= 8 ? 8 : 16, widest_lanes);
+}
+
+/**
+ * @brief Transpose a N x N block, src row stride is @c src_stride and dst row stride is @c dst_stride
+ *
+ * Arithmetic pixels: the block is cut in S x S register blocks (S lanes of @c Arch), the S rows of a register block
+ * are loaded in S simd registers, transposed in registers with @c xs::transpose then stored as S rows of dst.
+ * Other pixels go through a local tile, each memory access being contiguous.
+ */
+template<class Arch, typename T, std::ptrdiff_t N>
+void t_TransposeMicroKernel(const T *__restrict src,
+  std::ptrdiff_t src_stride,
+  T *__restrict dst,
+  std::ptrdiff_t dst_stride) POUTRE_NOEXCEPT
+{
+  constexpr auto S = t_TransposeRegisterBlock<T, Arch>();
+  if constexpr (S > 1) {
+    static_assert(N % S == 0, "micro tile must be a multiple of the register block");
+    using simd_t = xs::batch<T, Arch>;
+    std::array<simd_t, S> rows;
+    for (std::ptrdiff_t bi = 0; bi < N; bi += S) {
+      for (std::ptrdiff_t bj = 0; bj < N; bj += S) {
+        for (std::ptrdiff_t k = 0; k < S; ++k) { rows[k] = simd_t::load_unaligned(src + (bi + k) * src_stride + bj); }
+        xs::transpose(rows.data(), rows.data() + S);
+        for (std::ptrdiff_t k = 0; k < S; ++k) { rows[k].store_unaligned(dst + (bj + k) * dst_stride + bi); }
+      }
+    }
+  } else {
+    alignas(SIMD_IDEAL_MAX_ALIGN_BYTES) T tile[N * N];
+    for (std::ptrdiff_t r = 0; r < N; ++r) {
+      for (std::ptrdiff_t c = 0; c < N; ++c) { tile[c * N + r] = src[r * src_stride + c]; }
+    }
+    for (std::ptrdiff_t c = 0; c < N; ++c) {
+      for (std::ptrdiff_t r = 0; r < N; ++r) { dst[c * dst_stride + r] = tile[c * N + r]; }
+    }
+  }
+}
+
+/**
+ * @brief Cache blocked transpose of rows [row_begin,row_end[ of a src_rows x src_cols row major matrix
+ *
+ * dst is the src_cols x src_rows row major matrix, dst[c*src_rows+r]=src[r*src_cols+c].
+ * Full micro tiles go through the simd @c t_TransposeMicroKernel, only the edge tiles use a plain scalar loop.
+ */
+template<class Arch, typename T>
+void t_TransposeBlocked(const T *__restrict src,
+  std::ptrdiff_t src_rows,
+  std::ptrdiff_t src_cols,
+  T *__restrict dst,
+  std::ptrdiff_t row_begin,
+  std::ptrdiff_t row_end) POUTRE_NOEXCEPT
+{
+  constexpr auto micro = t_TransposeMicroTile<T, Arch>();
+  constexpr auto tile = t_TransposeCacheTile<T, Arch>();
+  for (std::ptrdiff_t r0 = row_begin; r0 < row_end; r0 += tile) {
+    const auto r1 = std::min(r0 + tile, row_end);
+    for (std::ptrdiff_t c0 = 0; c0 < src_cols; c0 += tile) {
+      const auto c1 = std::min(c0 + tile, src_cols);
+      std::ptrdiff_t r = r0;
+      for (; r + micro <= r1; r += micro) {
+        std::ptrdiff_t c = c0;
+        for (; c + micro <= c1; c += micro) {
+          t_TransposeMicroKernel<Arch, T, micro>(src + r * src_cols + c, src_cols, dst + c * src_rows + r, src_rows);
+        }
+        for (; c < c1; ++c) {
+          for (std::ptrdiff_t rr = r; rr < r + micro; ++rr) { dst[c * src_rows + rr] = src[rr * src_cols + c]; }
+        }
+      }
+      for (; r < r1; ++r) {
+        for (std::ptrdiff_t c = c0; c < c1; ++c) { dst[c * src_rows + r] = src[r * src_cols + c]; }
+      }
+    }
+  }
+}
+
+//! @} doxygroup: simd_group
+}// namespace poutre::simd
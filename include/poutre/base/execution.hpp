@@ -0,0 +1,136 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   execution.hpp
+ * @author Thomas Retornaz
+ * @brief  Process wide execution context (thread pool) used by parallel kernels
+ *
+ *
+ */
+
+#include <poutre/base/base.hpp>
+#include <poutre/base/config.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace poutre {
+/**
+ * @addtogroup execution_group Execution context facilities
+ * @ingroup poutre_base_group
+ *@{
+ */
+
+/**
+ * @brief Process wide execution context
+ *
+ * Own the thread pool shared by all parallel kernels (pixel-wise dispatchers, @c simd::transform ...)
+ * - NumThreads: number of worker threads, 1 means serial execution
+ * - GrainSize: minimum number of elements processed by one block, smaller ranges take the serial path
+ * - Pinning: pin each worker on one core (only supported on Linux and Windows)
+ *
+ * The pool is lazily (re)created on first parallel call after a configuration change.
+ * Parallel calls issued from a worker thread are executed serially to avoid nested submission.
+ * @note use singleton pattern with lazy construct
+ */
+class BASE_API ExecutionContext
+{
+private:
+  static ExecutionContext *m_instance;
+  static std::once_flag m_initFlag;
+
+public:
+  //! Default minimum number of elements per block
+  static constexpr std::size_t default_grain_size = 1UL << 16UL;
+  //! Number of blocks per thread, allow some load balancing between workers
+  static constexpr std::size_t blocks_per_thread = 4;
+
+  static ExecutionContext &get()
+  {
+    std::call_once(m_initFlag, []() { m_instance = new ExecutionContext(); });
+    return *m_instance;
+  }
+
+  ExecutionContext(const ExecutionContext &) = delete;
+  ExecutionContext &operator=(const ExecutionContext &) = delete;
+  ExecutionContext(ExecutionContext &&other) = delete;
+  ExecutionContext &operator=(ExecutionContext &&other) = delete;
+  ~ExecutionContext();
+
+  //! Set number of threads, 0 means std::thread::hardware_concurrency()
+  void SetNumThreads(std::size_t nbthreads);
+  //! Get number of threads
+  [[nodiscard]] std::size_t GetNumThreads() const;
+
+  //! Set minimum number of elements per block, must be >0
+  void SetGrainSize(std::size_t grain);
+  //! Get minimum number of elements per block
+  [[nodiscard]] std::size_t GetGrainSize() const;
+
+  //! Enable/Disable pinning of worker threads
+  void SetPinning(bool pinning);
+  //! Get pinning status
+  [[nodiscard]] bool GetPinning() const;
+
+  //! True if current thread is processing a block (pool worker or calling thread inside ParallelFor)
+  [[nodiscard]] static bool IsWorkerThread() POUTRE_NOEXCEPT;
+
+  /**
+   * @brief Compute the block size used to split [0,length[
+   *
+   * @param length number of elements
+   * @param step block size must be a multiple of step (typically simd step to preserve alignment)
+   * @return block size, equals length if the range should be processed serially
+   */
+  [[nodiscard]] std::size_t ComputeBlockSize(std::size_t length, std::size_t step = 1) const;
+
+  /**
+   * @brief Run task(i) for i in [0,nbblocks[ over the pool, last block is processed by the calling thread
+   * @throw rethrow the first exception raised by a task
+   */
+  void ParallelFor(std::size_t nbblocks, const std::function<void(std::size_t)> &task);
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> m_impl;
+  //! Private ctor
+  ExecutionContext();
+};
+
+/**
+ * @brief Split contiguous range [0,length[ in blocks and run func(begin,end) on each block through @c ExecutionContext
+ *
+ * @param length number of elements
+ * @param step block boundaries are multiple of step
+ * @param func callable with signature void(std::size_t begin, std::size_t end)
+ */
+template<class Func> void ParallelForBlocks(std::size_t length, std::size_t step, Func &&func)
+{
+  if (length == 0) { return; }
+  auto &ctx = ExecutionContext::get();
+  const auto block_size = ctx.ComputeBlockSize(length, step);
+  if (block_size >= length) {
+    func(std::size_t{ 0 }, length);
+    return;
+  }
+  const auto nbblocks = (length + block_size - 1) / block_size;
+  ctx.ParallelFor(nbblocks, [&](std::size_t block) {
+    const auto begin = block * block_size;
+    const auto end = std::min(length, begin + block_size);
+    func(begin, end);
+  });
+}
+
+// !@} doxygroup: execution_group
+}// namespace poutre
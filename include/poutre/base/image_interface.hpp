@@ -20,6 +20,7 @@
 #include <poutre/base/config.hpp>
 #include <poutre/base/types.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -31,6 +32,15 @@ namespace poutre {
  *@{
  */
 
+/**
+ * @brief Initialization of the storage of newly allocated images
+ */
+enum class AllocationMode {
+  Zeroed,//!< every pixel is value initialized (zero), default
+  Uninitialized,//!< pixels are left uninitialized, reserved to outputs which are fully written before being read
+  Pooled//!< as Uninitialized, storage is recycled through @c BufferPool, intended for operator temporaries
+};
+
 /**
  * @brief Pure interface class for all "Image" object
  */
@@ -49,6 +59,12 @@ public:
                                                        // change this
   //! Get num of dimensions
   [[nodiscard]] virtual std::size_t GetRank() const = 0;
+  //! Raw pointer on contiguous (row major, tile by tile if @c GetTileEdge() != 0) pixel buffer, no copy
+  [[nodiscard]] virtual void *GetVoidPtr() = 0;
+  //! Raw pointer on contiguous (row major, tile by tile if @c GetTileEdge() != 0) pixel buffer, no copy
+  [[nodiscard]] virtual const void *GetVoidPtr() const = 0;
+  //! Edge of the tiles of a tiled storage (@see CreateTiled), 0 for row major images
+  [[nodiscard]] virtual std::ptrdiff_t GetTileEdge() const { return 0; }
   //! Dtor
   virtual ~IInterface() = default;
   //! Stringification
@@ -101,9 +117,58 @@ BASE_API void AssertAsTypesCompatible(const IInterface &i_img1, const IInterface
 //! @throw runtime_error if input images are the same object @see @c AreImagesDifferent
 BASE_API void AssertImagesAreDifferent(const IInterface &i_img1, const IInterface &i_img2, const std::string &i_msg);
 
+//! @throw runtime_error if one image is tiled and not the other, or tiles differ @see @c IInterface::GetTileEdge
+BASE_API void AssertLayoutsCompatible(const IInterface &i_img1, const IInterface &i_img2, const std::string &i_msg);
+
+
+/**
+ * @brief Factory to build contiguous dense image
+ *
+ * @param dims [in] shape
+ * @param ctype [in] compound type of elements
+ * @param ptype [in] scalar type of elements
+ * @param mode [in] zero filled by default, @c AllocationMode::Uninitialized skips the fill for outputs which are
+ * fully overwritten
+ */
+BASE_API std::unique_ptr<IInterface> Create(const std::vector<std::size_t> &dims,
+  CompoundType ctype,
+  PType ptype,
+  AllocationMode mode = AllocationMode::Zeroed);
 
-//! Factory to build contiguous dense image
-BASE_API std::unique_ptr<IInterface> Create(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype);
+/**
+ * @brief Factory to build an image stored tile by tile (@see details::image_tiled_t)
+ *
+ * Column and slice wise passes of static SE erosion/dilation and reconstruction stay in cache on such images.
+ * Convert from/to row major images with @c ConvertInto (same types).
+ *
+ * @param dims [in] shape, rank 2 or 3
+ * @param ctype [in] compound type of elements, scalar only
+ * @param ptype [in] scalar type of elements, @c PType_BinPack excepted
+ * @param tile_edge [in] tile extent on every axis, 0 for the default of the rank (64x64, 32x32x32)
+ * @param mode [in] zero filled by default, @c AllocationMode::Pooled is read as @c AllocationMode::Uninitialized
+ */
+BASE_API std::unique_ptr<IInterface> CreateTiled(const std::vector<std::size_t> &dims,
+  CompoundType ctype,
+  PType ptype,
+  std::ptrdiff_t tile_edge = 0,
+  AllocationMode mode = AllocationMode::Zeroed);
+
+/**
+ * @brief Factory to build an image wrapping an external contiguous (row major) buffer, no copy
+ *
+ * @param buffer [in] external storage, must outlive the returned image unless owned by owner
+ * @param dims [in] shape
+ * @param ctype [in] compound type of elements of buffer
+ * @param ptype [in] scalar type of elements of buffer
+ * @param owner [in] optional, kept alive as long as the returned image (e.g. the file mapping behind buffer)
+ * @return image which doesn't own buffer
+ * @note for PType_BinPack buffer holds pUINT64 words, each line padded to a whole word (@see image_t<pBinPack,Rank>)
+ */
+BASE_API std::unique_ptr<IInterface> CreateView(void *buffer,
+  const std::vector<std::size_t> &dims,
+  CompoundType ctype,
+  PType ptype,
+  std::shared_ptr<void> owner = nullptr);
 
 /**
 * @brief Convert IInterface to human readable string
@@ -0,0 +1,164 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   mapped_file.hpp
+ * @author Thomas Retornaz
+ * @brief  Memory mapped files and images backed by them
+ *
+ *
+ */
+
+#include <poutre/base/base.hpp>
+#include <poutre/base/config.hpp>
+#include <poutre/base/image_interface.hpp>
+#include <poutre/base/types.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace poutre {
+/**
+ * @addtogroup mapped_file_group Memory mapped images
+ * @ingroup poutre_base_group
+ *@{
+ */
+
+//! Access to a mapped file
+enum class MapAccess {
+  ReadOnly,//!< pixels are only read (read only mapping, nothing is committed so files larger than memory map fine)
+  ReadWrite,//!< writes go to the file (shared mapping)
+  CopyOnWrite,//!< file is never modified, pixels may be written in memory (private mapping, only written pages are
+              //!< committed on POSIX, the whole view is commit charged on Windows)
+};
+
+//! Expected access pattern of a range of memory, hint for the OS paging
+enum class AccessAdvice {
+  Normal,//!< default read ahead
+  Sequential,//!< read once in increasing address order, aggressive read ahead, pages freed early
+  Random,//!< no read ahead
+  WillNeed,//!< prefetch the range now
+  DontNeed,//!< the range won't be accessed soon, pages can be reclaimed first (content is kept)
+};
+
+/**
+ * @brief Whole file mapped in memory
+ *
+ * The mapping is registered so that @c AdviseAccess can find it from any pointer inside it.
+ * Move only.
+ */
+class BASE_API MappedFile
+{
+public:
+  /**
+   * @brief Map an existing file
+   * @throw std::runtime_error if the file can't be opened or mapped
+   */
+  MappedFile(const std::string &path, MapAccess access);
+
+  /**
+   * @brief Create (or truncate) a file of bytes (>0) zero filled, mapped with @c MapAccess::ReadWrite
+   * @throw std::runtime_error if the file can't be created or mapped
+   */
+  [[nodiscard]] static MappedFile Create(const std::string &path, std::size_t bytes);
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+  ~MappedFile();
+
+  //! first byte, page aligned
+  [[nodiscard]] std::byte *data() const noexcept;
+  //! mapped bytes
+  [[nodiscard]] std::size_t size() const noexcept;
+  [[nodiscard]] MapAccess access() const noexcept;
+
+  //! Write modified pages back to the file (no-op unless @c MapAccess::ReadWrite)
+  void Flush() const;
+
+  //! Hint the OS about the access pattern of [offset, offset+bytes[ (clamped to the mapping)
+  void Advise(std::size_t offset, std::size_t bytes, AccessAdvice advice) const POUTRE_NOEXCEPT;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> m_impl;
+  explicit MappedFile(std::unique_ptr<Impl> impl);
+};
+
+/**
+ * @brief Hint the OS about the access pattern of [ptr, ptr+bytes[ if it lies in a @c MappedFile, no-op otherwise
+ *
+ * Cheap enough to be called by operators on each of their images.
+ */
+BASE_API void AdviseAccess(const void *ptr, std::size_t bytes, AccessAdvice advice) POUTRE_NOEXCEPT;
+
+//! @c AdviseAccess on the pixels of img
+BASE_API void AdviseAccess(const IInterface &img, AccessAdvice advice) POUTRE_NOEXCEPT;
+
+/**
+ * @brief Advise the access pattern of the pixels of an image for the lifetime of the guard
+ *
+ * Restores @c AccessAdvice::Normal on destruction, so that a hint given by an operator does not outlive it.
+ * No-op for images which are not mapped. Non copyable, non movable.
+ */
+class BASE_API ScopedAccessAdvice
+{
+public:
+  ScopedAccessAdvice(const IInterface &img, AccessAdvice advice) POUTRE_NOEXCEPT;
+  ScopedAccessAdvice(const ScopedAccessAdvice &) = delete;
+  ScopedAccessAdvice &operator=(const ScopedAccessAdvice &) = delete;
+  ScopedAccessAdvice(ScopedAccessAdvice &&) = delete;
+  ScopedAccessAdvice &operator=(ScopedAccessAdvice &&) = delete;
+  ~ScopedAccessAdvice();
+
+private:
+  const void *m_ptr = nullptr;
+  std::size_t m_bytes = 0;
+};
+
+//! Number of bytes of the pixels of an image (row major, @c PType_BinPack lines padded to whole words)
+BASE_API std::size_t ImageBytes(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype);
+
+/**
+ * @brief Map a raw file of pixels (row major, native endianness) as an image
+ *
+ * @param path [in] file holding at least offset + ImageBytes(dims,ctype,ptype) bytes
+ * @param dims [in] shape
+ * @param ctype [in] compound type of pixels
+ * @param ptype [in] scalar type of pixels
+ * @param access [in] @c MapAccess::ReadWrite to write results back to the file
+ * @param offset [in] first pixel in the file, multiple of @c SIMD_IDEAL_MAX_ALIGN_BYTES
+ * @return image wrapping the mapping, which lives as long as the image
+ */
+BASE_API std::unique_ptr<IInterface> MapRawImage(const std::string &path,
+  const std::vector<std::size_t> &dims,
+  CompoundType ctype,
+  PType ptype,
+  MapAccess access,
+  std::size_t offset = 0);
+
+/**
+ * @brief Map an image file written by @c CreateMappedImage
+ *
+ * Format: a header (magic "POUTREMM", version, ctype, ptype, rank, payload offset, then the rank extents as uint64),
+ * followed by the raw pixels at a page aligned payload offset. Native endianness.
+ * @throw std::runtime_error on unknown or truncated files
+ */
+BASE_API std::unique_ptr<IInterface> MapImage(const std::string &path, MapAccess access);
+
+//! Create (or truncate) an image file of the given geometry, zero filled, and map it with @c MapAccess::ReadWrite
+BASE_API std::unique_ptr<IInterface>
+  CreateMappedImage(const std::string &path, const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype);
+
+//! @} doxygroup: mapped_file_group
+}// namespace poutre
@@ -20,6 +20,7 @@
 #include <poutre/base/base.hpp>
 
 #include <functional>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
@@ -31,7 +32,7 @@ namespace poutre {
  */
 /**
  * @brief Allow to register a set of factories regarding provided type
- * @note use singleton pattern with lazy construct
+ * @note use singleton pattern with lazy construct, registration is thread safe
  */
 template<class Interface> class Registrar
 {
@@ -68,6 +69,7 @@ private:
   /**@}*/
 
   KeyFactoryMap m_keyfactory_map;//! container which store factories
+  std::mutex m_mutex;//! guard m_keyfactory_map
 public:
   // void Register(const std::string& key,
   // std::function<std::unique_ptr<Interface>(void)>
@@ -82,6 +84,7 @@ public:
    */
   void Register(const std::string &key, std::function<Interface *(void)> ImplFactoryFunction)
   {
+    const std::scoped_lock lock(m_mutex);
     auto iter = m_keyfactory_map.find(key);
     if (iter != m_keyfactory_map.end()) { POUTRE_RUNTIME_ERROR("Registrar::Add key already used"); }
     m_keyfactory_map[key] = ImplFactoryFunction;
@@ -42,6 +42,8 @@ namespace poutre {
 using pbool = bool;//! boolean type
 using pUINT8 = u8;//! UINT8 type
 // using  pINT8 = signed char; //!INT8 type
+using pUINT16 = u16;//! UINT16 type
+using pINT16 = i16;//! INT16 type
 using pUINT32 = u32;//! UINT32 type
 using pINT32 = i32;//! INT32 type
 using pFLOAT = f32;//! Float/Real type (default real type)
@@ -49,6 +51,16 @@ using pDOUBLE = f64;//! Float/Real type
 using pINT64 = i64;//! INT64 type
 using pUINT64 = u64;//! UINT64 type
 
+/**
+ * @brief Tag of bit-packed binary pixels
+ *
+ * Pixels are stored LSB first in pUINT64 words, each line of the image starts on a new word.
+ * @see poutre::details::image_t<pBinPack,Rank>
+ */
+struct pBinPack
+{
+};
+
 using scoord = std::ptrdiff_t;//! scalar coordinate
 using rcoord = pFLOAT;//! real coordinate
 
@@ -517,23 +529,34 @@ BASE_API std::istream &operator>>(std::istream &, CompoundType &);
 enum class PType {
   PType_Undef = 0,//!< Undefined type
   // PType_Bin = 1 << 0,    //!< data {0,1} encode in  [0,255]
-  // PType_BinPack  =  1 << 1,  //!< data {0,1} binary packed
+  PType_BinPack = 1 << 1,//!< data {0,1} binary packed, 64 pixels per word
   PType_GrayUINT8 = 1 << 2,//!< 8 bits per pixel, unsigned, grayscale data in [0,255]
   PType_GrayINT32 = 1 << 3,//!< 32 bits per pixel, signed, grayscale data in ]-2^31,+2^31[
   PType_F32 = 1 << 4,//!< Floating-point pixel, single precision (float)
   PType_GrayINT64 = 1 << 5,//!< Int64 pixel, think about integrale image
   PType_D64 = 1 << 6,//!< Floating-point pixel, double precision (long double)
-  _PixelType_Max = 1 << 6// keep sync with the max value
+  PType_GrayUINT16 = 1 << 7,//!< 16 bits per pixel, unsigned, grayscale data in [0,65535]
+  PType_GrayINT16 = 1 << 8,//!< 16 bits per pixel, signed, grayscale data in [-32768,32767]
+  _PixelType_Max = 1 << 8// keep sync with the max value
 };
 
-using ScalarTypeVariant = std::variant<pUINT8, pINT32, pINT64, pFLOAT, pDOUBLE>;
+using ScalarTypeVariant = std::variant<pUINT8, pINT32, pINT64, pFLOAT, pDOUBLE, pUINT16, pINT16>;
 
 template<typename T> ScalarTypeVariant CreatePixelValue(T value, const PType ptype)
 {
   switch (ptype) {
+  case PType::PType_BinPack: {// binary values are carried as pUINT8 {0,1}
+    return static_cast<pUINT8>(value != T(0));
+  }
   case PType::PType_GrayUINT8: {
     return static_cast<pUINT8>(value);
   }
+  case PType::PType_GrayUINT16: {
+    return static_cast<pUINT16>(value);
+  }
+  case PType::PType_GrayINT16: {
+    return static_cast<pINT16>(value);
+  }
   case PType::PType_GrayINT32: {
     return static_cast<pINT32>(value);
   }
@@ -554,9 +577,18 @@ template<typename T> ScalarTypeVariant CreatePixelValue(T value, const PType pty
 inline ScalarTypeVariant get_lowest(const PType ptype)
 {
   switch (ptype) {
+  case PType::PType_BinPack: {
+    return static_cast<pUINT8>(0);
+  }
   case PType::PType_GrayUINT8: {
     return std::numeric_limits<pUINT8>::lowest();
   }
+  case PType::PType_GrayUINT16: {
+    return std::numeric_limits<pUINT16>::lowest();
+  }
+  case PType::PType_GrayINT16: {
+    return std::numeric_limits<pINT16>::lowest();
+  }
   case PType::PType_GrayINT32: {
     return std::numeric_limits<pINT32>::lowest();
   }
@@ -577,9 +609,18 @@ inline ScalarTypeVariant get_lowest(const PType ptype)
 inline ScalarTypeVariant get_highest(const PType ptype)
 {
   switch (ptype) {
+  case PType::PType_BinPack: {
+    return static_cast<pUINT8>(1);
+  }
   case PType::PType_GrayUINT8: {
     return std::numeric_limits<pUINT8>::max();
   }
+  case PType::PType_GrayUINT16: {
+    return std::numeric_limits<pUINT16>::max();
+  }
+  case PType::PType_GrayINT16: {
+    return std::numeric_limits<pINT16>::max();
+  }
   case PType::PType_GrayINT32: {
     return std::numeric_limits<pINT32>::max();
   }
@@ -686,8 +727,14 @@ template<> struct formatter<poutre::PType> : std::formatter<const char *>
   template<typename Context> auto format(const poutre::PType state, Context &context) const
   {
     switch (state) {
+    case poutre::PType::PType_BinPack:
+      return formatter<const char *>::format("BinPack", context);
     case poutre::PType::PType_GrayUINT8:
       return formatter<const char *>::format("GUINT8", context);
+    case poutre::PType::PType_GrayUINT16:
+      return formatter<const char *>::format("GUINT16", context);
+    case poutre::PType::PType_GrayINT16:
+      return formatter<const char *>::format("GINT16", context);
     case poutre::PType::PType_GrayINT32:
       return formatter<const char *>::format("GINT32", context);
     case poutre::PType::PType_F32:
@@ -31,11 +31,26 @@ template<CompoundType compound, PType ptype> struct enum_to_type
 {
 };
 
+template<> struct enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_BinPack>
+{
+  using type = pBinPack;
+};
+
 template<> struct enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_GrayUINT8>
 {
   using type = pUINT8;
 };
 
+template<> struct enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_GrayUINT16>
+{
+  using type = pUINT16;
+};
+
+template<> struct enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_GrayINT16>
+{
+  using type = pINT16;
+};
+
 template<> struct enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_GrayINT32>
 {
   using type = pINT32;
@@ -140,6 +155,96 @@ template<> struct TypeTraits<const pUINT8> : public TypeTraits<pUINT8>
 {
 };
 
+//! TypeTraits pUINT16
+template<> struct TypeTraits<pUINT16>
+{
+  using storage_type = pUINT16;
+  using safe_signed_type = pINT32;
+  using str_type = pUINT32;
+  using accu_type = pINT64;
+  POUTRE_STATIC_CONSTEXPR auto p_type = PType::PType_GrayUINT16;
+  POUTRE_STATIC_CONSTEXPR auto c_type = CompoundType::CompoundType_Scalar;
+
+  POUTRE_STATIC_CONSTEXPR size_t alignment = SIMD_IDEAL_MAX_ALIGN_BYTES;
+  POUTRE_STATIC_CONSTEXPR size_t simd_loop_step = xsimd::batch<storage_type, xsimd::default_arch>::size;
+  using simd_type = typename xs::batch<storage_type>;
+  using simd_mask_type = typename xs::batch_bool<storage_type>;
+  POUTRE_STATIC_CONSTEXPR size_t quant = sizeof(storage_type) * 8;
+
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type lowest() POUTRE_NOEXCEPT
+  { return std::numeric_limits<storage_type>::lowest(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type min() POUTRE_NOEXCEPT
+  { return std::numeric_limits<storage_type>::min(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type max() POUTRE_NOEXCEPT
+  { return std::numeric_limits<storage_type>::max(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type inf() { return min(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type sup() { return max(); }
+};
+
+template<> struct TypeTraits<const pUINT16> : public TypeTraits<pUINT16>
+{
+};
+
+//! TypeTraits pINT16
+template<> struct TypeTraits<pINT16>
+{
+  using storage_type = pINT16;
+  using safe_signed_type = pINT32;
+  using str_type = pINT32;
+  using accu_type = pINT64;
+  POUTRE_STATIC_CONSTEXPR auto p_type = PType::PType_GrayINT16;
+  POUTRE_STATIC_CONSTEXPR auto c_type = CompoundType::CompoundType_Scalar;
+
+  POUTRE_STATIC_CONSTEXPR size_t alignment = SIMD_IDEAL_MAX_ALIGN_BYTES;
+  POUTRE_STATIC_CONSTEXPR size_t simd_loop_step = xsimd::batch<storage_type, xsimd::default_arch>::size;
+  using simd_type = typename xs::batch<storage_type>;
+  using simd_mask_type = typename xs::batch_bool<storage_type>;
+  POUTRE_STATIC_CONSTEXPR size_t quant = sizeof(storage_type) * 8;
+
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type lowest() POUTRE_NOEXCEPT
+  { return std::numeric_limits<storage_type>::lowest(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type min() POUTRE_NOEXCEPT
+  { return std::numeric_limits<storage_type>::min(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type max() POUTRE_NOEXCEPT
+  { return std::numeric_limits<storage_type>::max(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type inf() { return min(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR storage_type sup() { return max(); }
+};
+
+template<> struct TypeTraits<const pINT16> : public TypeTraits<pINT16>
+{
+};
+
+//! TypeTraits pBinPack, storage_type is the word holding 64 pixels
+template<> struct TypeTraits<pBinPack>
+{
+  using storage_type = pUINT64;
+  using safe_signed_type = pINT32;
+  using str_type = pUINT32;
+  using accu_type = pINT64;
+  POUTRE_STATIC_CONSTEXPR auto p_type = PType::PType_BinPack;
+  POUTRE_STATIC_CONSTEXPR auto c_type = CompoundType::CompoundType_Scalar;
+
+  POUTRE_STATIC_CONSTEXPR size_t alignment = SIMD_IDEAL_MAX_ALIGN_BYTES;
+  POUTRE_STATIC_CONSTEXPR size_t simd_loop_step = xsimd::batch<storage_type, xsimd::default_arch>::size;
+  using simd_type = typename xs::batch<storage_type>;
+  using simd_mask_type = typename xs::batch_bool<storage_type>;
+  //! bits per pixel
+  POUTRE_STATIC_CONSTEXPR size_t quant = 1;
+  //! pixels per word
+  POUTRE_STATIC_CONSTEXPR std::ptrdiff_t word_bits = sizeof(storage_type) * 8;
+
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR bool lowest() POUTRE_NOEXCEPT { return false; }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR bool min() POUTRE_NOEXCEPT { return false; }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR bool max() POUTRE_NOEXCEPT { return true; }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR bool inf() { return min(); }
+  POUTRE_ALWAYS_INLINE POUTRE_STATIC_CONSTEXPR bool sup() { return max(); }
+};
+
+template<> struct TypeTraits<const pBinPack> : public TypeTraits<pBinPack>
+{
+};
+
 //! TypeTraits pINT32
 template<> struct TypeTraits<pINT32>
 {
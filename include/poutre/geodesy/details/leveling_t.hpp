@@ -70,7 +70,9 @@ struct t_low_levelingHelper
     poutre::details::t_Copy(i_vmarker,o_vout);
 
     constexpr auto nl_coord     = poutre::se::details::static_se_traits<nl_static>::coordinates_no_center;
-    poutre::details::poutre_pq<poutre::details::av::index<Rank>, Tout> pqueue;
+    // values only increase, process greatest first
+    // hierarchical queue for small integral types (O(1) push/pop)
+    poutre::details::poutre_hpq<Tout, poutre::details::av::index<Rank>> pqueue;
 
     // forward scan
     {
@@ -88,7 +90,7 @@ struct t_low_levelingHelper
           }
           if (curr_max != o_vout[*beg1]) {
             o_vout[*beg1] = std::min(i_vref[*beg1], curr_max);
-            pqueue.emplace(*beg1,o_vout[*beg1]);
+            pqueue.emplace(o_vout[*beg1], *beg1);
           }
         }
       }
@@ -96,7 +98,7 @@ struct t_low_levelingHelper
 
     // Loop until all pixel have been examined
     while (!pqueue.empty()) {
-      auto [idx,_] = pqueue.top();
+      const auto idx = pqueue.top().second;
       pqueue.pop();
       for( const auto &idx_nl : nl_coord ) {
         const auto delta_nl_idx = idx + idx_nl;
@@ -105,7 +107,7 @@ struct t_low_levelingHelper
           auto new_value = std::min(i_vref[delta_nl_idx], o_vout[idx]);
           if (o_vout[delta_nl_idx]!= new_value) {
             o_vout[delta_nl_idx] = new_value;
-            pqueue.emplace(delta_nl_idx, new_value);
+            pqueue.emplace(new_value, delta_nl_idx);
           }
         }
       }
@@ -155,7 +157,9 @@ struct t_high_levelingHelper
     poutre::details::t_Copy(i_vmarker,o_vout);
 
     constexpr auto nl_coord     = poutre::se::details::static_se_traits<nl_static>::coordinates_no_center;
-    poutre::details::poutre_pq<poutre::details::av::index<Rank>, Tout> pqueue;
+    // values only decrease, process lowest first
+    // hierarchical queue for small integral types (O(1) push/pop)
+    poutre::details::poutre_rhpq<Tout, poutre::details::av::index<Rank>> pqueue;
 
     // forward scan
     {
@@ -173,7 +177,7 @@ struct t_high_levelingHelper
           }
           if (curr_min != o_vout[*beg1]) {
             o_vout[*beg1] = std::max(i_vref[*beg1], curr_min);
-            pqueue.emplace(*beg1,o_vout[*beg1]);
+            pqueue.emplace(o_vout[*beg1], *beg1);
           }
         }
       }
@@ -181,7 +185,7 @@ struct t_high_levelingHelper
 
     // Loop until all pixel have been examined
     while (!pqueue.empty()) {
-      auto [idx,_] = pqueue.top();
+      const auto idx = pqueue.top().second;
       pqueue.pop();
       for( const auto &idx_nl : nl_coord ) {
         const auto delta_nl_idx = idx + idx_nl;
@@ -190,7 +194,7 @@ struct t_high_levelingHelper
           auto new_value = std::max(i_vref[delta_nl_idx], o_vout[idx]);
           if (o_vout[delta_nl_idx]!= new_value) {
             o_vout[delta_nl_idx] = new_value;
-            pqueue.emplace(delta_nl_idx, new_value);
+            pqueue.emplace(new_value, delta_nl_idx);
           }
         }
       }
@@ -18,17 +18,16 @@
  */
 
 #include <algorithm>
-#include <deque>
 #include <filesystem>
 #include <numeric>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/fifo.hpp>
 #include <poutre/geodesy/mreconstruct.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_static_se_t.hpp>
 #include <poutre/pixel_processing/details/arith_op_t.hpp>
 #include <poutre/structuring_element/details/neighbor_list_static_se_t.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
-#include <queue>
 
 namespace poutre::geo::details {
 /**
@@ -106,7 +105,7 @@ struct t_ReconstructionViewDispatcher
 
     constexpr auto nl_coord = poutre::se::details::static_se_traits<nl_static>::coordinates_no_center;
     auto [nl_upper, nl_lower] = poutre::se::details::static_se_traits<nl_static>::split_coordinates_upper_lower();
-    std::queue<poutre::details::av::index<Rank>> queue;
+    poutre::details::RingFifo<poutre::details::av::index<Rank>> queue;
 
     HelperOp::select_marker(i_vmarker, i_vmask, o_vout);
 
@@ -194,182 +193,145 @@ struct t_ReconstructionViewDispatcher
   }
 };
 
-/*
-// specialisation array_view 2D
-template< poutre::se::Common_NL_SE nl_static,
-          typename Tmarker,
-          typename Tmask,
-          typename Tout,
-          class HelperOp>
-struct t_ReconstructionViewDispatcher<nl_static,Tmarker,Tmask,Tout,2, poutre::details::av::array_view,
-poutre::details::av::array_view, poutre::details::av::array_view, HelperOp>
+// specialisation array_view (contiguous) any Rank
+// work on linear offsets, neighbors of interior pixels are reached through precomputed offset deltas
+template<poutre::se::Common_NL_SE nl_static, typename Tmarker, typename Tmask, typename Tout, ptrdiff_t Rank, class HelperOp>
+struct t_ReconstructionViewDispatcher<nl_static,
+  Tmarker,
+  Tmask,
+  Tout,
+  Rank,
+  poutre::details::av::array_view,
+  poutre::details::av::array_view,
+  poutre::details::av::array_view,
+  HelperOp>
 {
-  static_assert(2 == poutre::se::details::static_se_traits<nl_static>::rank, "SE and view have not the same Rank");
-  void operator()(const poutre::details::av::array_view<const Tmarker, 2> &i_vmarker,
-                  const poutre::details::av::array_view<const Tmask, 2> &i_vmask,
-                  poutre::details::av::array_view<Tout, 2> &o_vout) const
+  static_assert(Rank == poutre::se::details::static_se_traits<nl_static>::rank, "SE and view have not the same Rank");
+  void operator()(const poutre::details::av::array_view<const Tmarker, Rank> &i_vmarker,
+    const poutre::details::av::array_view<const Tmask, Rank> &i_vmask,
+    poutre::details::av::array_view<Tout, Rank> &o_vout) const
   {
     POUTRE_CHECK(i_vmarker.size() == i_vmask.size(), "Incompatible views size");
     POUTRE_CHECK(i_vmask.size() == o_vout.size(), "Incompatible views size");
 
     // More check
-    auto vMarkerbound   = i_vmarker.bound();
-    auto vMaskbound   = i_vmask.bound();
-    auto vOutbound  = o_vout.bound();
-    auto stridevMarker  = i_vmarker.stride();
-    auto stridevMask  = i_vmask.stride();
+    auto vMarkerbound = i_vmarker.bound();
+    auto vMaskbound = i_vmask.bound();
+    auto vOutbound = o_vout.bound();
+    auto stridevMarker = i_vmarker.stride();
+    auto stridevMask = i_vmask.stride();
     auto stridevOut = o_vout.stride();
-    POUTRE_CHECK(vMarkerbound==vMaskbound, "Incompatible bound");
-    POUTRE_CHECK(vOutbound==vMaskbound, "Incompatible bound");
-
-    POUTRE_CHECK(stridevMarker==stridevMask, "Incompatible stride");
-    POUTRE_CHECK(stridevMask==stridevOut, "Incompatible stride");
+    POUTRE_CHECK(vMarkerbound == vMaskbound, "Incompatible bound");
+    POUTRE_CHECK(vOutbound == vMaskbound, "Incompatible bound");
 
-    scoord ysize   = vMarkerbound[0];
-    scoord xsize   = vMarkerbound[1];
+    POUTRE_CHECK(stridevMarker == stridevMask, "Incompatible stride");
+    POUTRE_CHECK(stridevMask == stridevOut, "Incompatible stride");
 
-    //auto      ptrMarkerbeg  = i_vmarker.data();
-    auto      ptrMaskbeg      = i_vmask.data();
-    auto      ptrOutbeg             = o_vout.data();
+    using traits = poutre::se::details::static_se_traits<nl_static>;
+    constexpr auto nl_coord = traits::coordinates_no_center;
+    auto [nl_upper, nl_lower] = traits::split_coordinates_upper_lower();
+    const auto nl_offsets = poutre::se::details::t_LinearOffsets(nl_coord, stridevOut);
+    const auto nl_upper_offsets = poutre::se::details::t_LinearOffsets(nl_upper, stridevOut);
+    const auto nl_lower_offsets = poutre::se::details::t_LinearOffsets(nl_lower, stridevOut);
+    const ptrdiff_t extension = traits::maximum_extension();
+
+    // all neighbors are inside image, no need to check bounds
+    const auto is_interior = [&vOutbound, extension](const poutre::details::av::index<Rank> &idx) {
+      for (std::size_t dim = 0; dim < static_cast<std::size_t>(Rank); ++dim) {
+        if (idx[dim] < extension || idx[dim] >= vOutbound[dim] - extension) { return false; }
+      }
+      return true;
+    };
+    const auto to_index = [&stridevOut](ptrdiff_t offset) {
+      poutre::details::av::index<Rank> idx;
+      for (std::size_t dim = 0; dim < static_cast<std::size_t>(Rank); ++dim) {
+        idx[dim] = offset / stridevOut[dim];
+        offset -= idx[dim] * stridevOut[dim];
+      }
+      return idx;
+    };
 
-    // constexpr auto nl_coord     = poutre::se::details::static_se_traits<nl_static>::coordinates;
-    auto [nl_upper, nl_lower]   = poutre::se::details::static_se_traits<nl_static>::split_coordinates_upper_lower();
-    std::queue<poutre::details::av::index<2>> queue;
+    const Tmask *ptrMask = i_vmask.data();
+    Tout *ptrOut = o_vout.data();
+    const auto nbpixels = static_cast<ptrdiff_t>(vOutbound.size());
+    poutre::details::RingFifo<ptrdiff_t> queue;
 
     HelperOp::select_marker(i_vmarker, i_vmask, o_vout);
 
-    // temp display
-    {
-      std::cout<<"After clamp \n";
-      auto begit = begin(vMarkerbound);
-      auto endit = end(vMarkerbound);
-      for( ; begit != endit; ++begit ) {
-        std::cout << static_cast<int>(o_vout[*begit]) << " ";
-      }
-      std::cout<<"\n";
-    }
     // forward scan
-    for( ptrdiff_t y = 0; y < ysize; ++y ) {
-      for( ptrdiff_t x = 0; x < xsize ; ++x ) {
-        scoord const centerx = x;
-        scoord const centery = y;
-        auto curr_val = ptrOutbeg[(xsize * centery) + centerx];
-        const poutre::details::av::idx2d center{y, x};
-        for( const auto &idx_nl_upper : nl_upper ) {
-          scoord const currentx = center[1] + idx_nl_upper[1];
-          scoord const currenty = center[0] + idx_nl_upper[0];
-          if (currentx<0 || currentx>=xsize || currenty<0 || currenty>=ysize) {continue;}
-          std::cout<<"Forward loop curval"<< static_cast<int>(curr_val)<< " " <<static_cast<int>(ptrOutbeg[(xsize *
-currenty) + currentx])<<"\n" ; curr_val = HelperOp::select_se(curr_val, ptrOutbeg[(xsize * currenty) + currentx]);
-        }
-        std::cout<<"Forward loop out "<< static_cast<int>(curr_val)<< " " <<static_cast<int>(ptrMaskbeg[(xsize *
-centery) + centerx])<<"\n" ; ptrOutbeg[(xsize * centery) + centerx] = HelperOp::select_marker(curr_val,
-ptrMaskbeg[(xsize * centery) + centerx]);
-
-        {
-          std::cout<<"Forward loop \n";
-          auto begit = begin(vMarkerbound);
-          auto endit = end(vMarkerbound);
-          for( ; begit != endit; ++begit ) {
-            std::cout << static_cast<int>(o_vout[*begit]) << " ";
+    {
+      auto beg1 = begin(vOutbound);
+      auto end1 = end(vOutbound);
+      for (ptrdiff_t offset = 0; beg1 != end1; ++beg1, ++offset) {
+        auto curr_val = ptrOut[offset];
+        if (is_interior(*beg1)) {
+          for (const auto delta : nl_upper_offsets) { curr_val = HelperOp::select_se(curr_val, ptrOut[offset + delta]); }
+        } else {
+          for (std::size_t i = 0; i < nl_upper.size(); ++i) {
+            if (!vOutbound.contains(*beg1 + nl_upper[i])) { continue; }
+            curr_val = HelperOp::select_se(curr_val, ptrOut[offset + nl_upper_offsets[i]]);
           }
-          std::cout<<"\n";
         }
+        ptrOut[offset] = HelperOp::select_marker(curr_val, ptrMask[offset]);
       }
     }
-    //backward scan
-    for( ptrdiff_t y = ysize-1; y >= 0; --y ) {
-      for( ptrdiff_t x = xsize-1; x >= 0 ; --x ) {
-        scoord const centerx = x;
-        scoord const centery = y;
-        auto curr_val = ptrOutbeg[(xsize * centery) + centerx];
-        const poutre::details::av::idx2d center{y, x};
-        for( const auto &idx_nl_lower : nl_lower )
-        {
-          scoord const currentx = center[1] + idx_nl_lower[1];
-          scoord const currenty = center[0] + idx_nl_lower[0];
-          if (currentx<0 || currentx>=xsize || currenty<0 || currenty>=ysize) {continue;}
-          curr_val = HelperOp::select_se(curr_val, ptrOutbeg[(xsize * currenty) + currentx]);
+
+    // backward scan
+    {
+      const auto should_seed = [&](ptrdiff_t offset, ptrdiff_t delta) {
+        return HelperOp::should_enqueue(ptrOut[offset + delta], ptrOut[offset])
+               && HelperOp::should_enqueue(ptrOut[offset + delta], ptrMask[offset + delta]);
+      };
+      auto rbeg1 = rbegin(vOutbound);
+      auto rend1 = rend(vOutbound);
+      for (ptrdiff_t offset = nbpixels - 1; rbeg1 != rend1; ++rbeg1, --offset) {
+        const auto idx = *rbeg1;
+        const bool interior = is_interior(idx);
+        auto curr_val = ptrOut[offset];
+        if (interior) {
+          for (const auto delta : nl_lower_offsets) { curr_val = HelperOp::select_se(curr_val, ptrOut[offset + delta]); }
+        } else {
+          for (std::size_t i = 0; i < nl_lower.size(); ++i) {
+            if (!vOutbound.contains(idx + nl_lower[i])) { continue; }
+            curr_val = HelperOp::select_se(curr_val, ptrOut[offset + nl_lower_offsets[i]]);
+          }
         }
-        ptrOutbeg[(xsize * centery) + centerx] = HelperOp::select_marker(curr_val, ptrMaskbeg[(xsize * centery) +
-centerx]); for( const auto &idx_nl_lower : nl_lower )
-        {
-          scoord const currentx = center[1] + idx_nl_lower[1];
-          scoord const currenty = center[0] + idx_nl_lower[0];
-          if (currentx<0 || currentx>=xsize || currenty<0 || currenty>=ysize) {continue;}
-          if (
-          HelperOp::should_enqueue(ptrOutbeg[(xsize * currenty) + currentx], ptrOutbeg[(xsize * centery) + centerx])
-          && HelperOp::should_enqueue(ptrOutbeg[(xsize * currenty) + currentx], ptrMaskbeg[(xsize * currenty) +
-currentx])) { queue.push(center);
+        ptrOut[offset] = HelperOp::select_marker(curr_val, ptrMask[offset]);
+
+        // enqueue once if it can still propagate to one of its lower neighbors
+        for (std::size_t i = 0; i < nl_lower.size(); ++i) {
+          if (!interior && !vOutbound.contains(idx + nl_lower[i])) { continue; }
+          if (should_seed(offset, nl_lower_offsets[i])) {
+            queue.push(offset);
+            break;
           }
         }
       }
     }
 
-    auto beg1 = begin(vMarkerbound);
-    auto end1 = end(vMarkerbound);
-    for( ; beg1 != end1; ++beg1 )
-    {
-      auto curr_val = o_vout[*beg1];
-      for( const auto &idx_nl_upper : nl_upper )
-      {
-        const auto delta_nl_idx = *beg1 + idx_nl_upper;
-        if( !vMarkerbound.contains(delta_nl_idx) ) {continue;}
-        curr_val = HelperOp::select_se(curr_val, o_vout[delta_nl_idx]);
-      }
-      o_vout[*beg1] = HelperOp::select_marker(curr_val, i_vmask[*beg1]);
-    }
-
-    //backward scan
-    auto rbeg1 = rbegin(vMarkerbound);
-    auto rend1 = rend(vMarkerbound);
-    for( ; rbeg1 != rend1; ++rbeg1 ) {
-      auto curr_val = o_vout[*rbeg1];
-      for( const auto &idx_nl_lower : nl_lower ) {
-        auto delta_nl_idx = *rbeg1 + idx_nl_lower;
-        if( !vMarkerbound.contains(delta_nl_idx) ) {continue;}
-        curr_val = HelperOp::select_se(curr_val, o_vout[delta_nl_idx]);
+    // seeds count from raster scans is a good hint of the propagation front size
+    queue.reserve(2 * queue.size());
+    const auto propagate = [&](ptrdiff_t offset, ptrdiff_t offset_nl) {
+      if (ptrMask[offset_nl] != ptrOut[offset_nl] && HelperOp::should_enqueue(ptrOut[offset_nl], ptrOut[offset])) {
+        ptrOut[offset_nl] = HelperOp::select_marker(ptrOut[offset], ptrMask[offset_nl]);
+        queue.push(offset_nl);
       }
-      o_vout[*rbeg1] = HelperOp::select_marker(curr_val, i_vmask[*rbeg1]);
-
-      // temp display
-      {
-        std::cout<<"Backward loop \n";
-        auto begit = begin(vMarkerbound);
-        auto endit = end(vMarkerbound);
-        for( ; begit != endit; ++begit ) {
-          std::cout << static_cast<int>(o_vout[*begit]) << " ";
-        }
-        std::cout<<"\n";
-      }
-
-      for( const auto &idx_nl_lower : nl_lower ) {
-        auto delta_nl_idx = *rbeg1 + idx_nl_lower;
-        if( !vMarkerbound.contains(delta_nl_idx) ) {continue;}
-        if (
-          HelperOp::should_enqueue(o_vout[delta_nl_idx], o_vout[*rbeg1])
-          && HelperOp::should_enqueue(o_vout[delta_nl_idx], i_vmask[delta_nl_idx])) {
-          queue.push(*rbeg1);
+    };
+    while (!queue.empty()) {
+      const auto offset = queue.front();
+      queue.pop();
+      const auto idx = to_index(offset);
+      if (is_interior(idx)) {
+        for (const auto delta : nl_offsets) { propagate(offset, offset + delta); }
+      } else {
+        for (std::size_t i = 0; i < nl_coord.size(); ++i) {
+          if (!vOutbound.contains(idx + nl_coord[i])) { continue; }
+          propagate(offset, offset + nl_offsets[i]);
         }
-    }
-  }
-  while( !queue.empty() ) {
-    auto idx = queue.front();
-    queue.pop();
-    for( const auto &idx_nl : nl_coord ) {
-      auto delta_nl_idx = idx + idx_nl;
-      if( !vMarkerbound.contains(delta_nl_idx) ) {continue;}
-      if (
-        HelperOp::should_enqueue(o_vout[delta_nl_idx],o_vout[idx]
-          && i_vmask[delta_nl_idx] != o_vout[delta_nl_idx])) {
-        o_vout[delta_nl_idx] = HelperOp::select_marker(o_vout[idx], i_vmask[delta_nl_idx]);
-        queue.push(delta_nl_idx);
       }
     }
   }
-  }
 };
-*/
 
 template<poutre::se::Common_NL_SE nl_static,
   typename Tmarker,
@@ -0,0 +1,168 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   mreconstruct_tiled_t.hpp
+ * @author Thomas Retornaz
+ * @brief  Reconstruction operator on tiled images, tile by tile
+ *
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/data_structures/image_tiled_t.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/trace.hpp>
+#include <poutre/geodesy/details/mreconstruct_t.hpp>
+#include <poutre/geodesy/mreconstruct.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace poutre::geo::details {
+/**
+ * @addtogroup poutre_geodesy_group
+ *@{
+ */
+
+/**
+ * @brief Reconstruction of i_marker under/over i_mask regarding nl_static, all images tiled with the same tile edge
+ *
+ * Each tile is gathered with a one pixel halo (the extension of every SE supported by @c t_ReconstructionDispatch)
+ * into a row major scratch and reconstructed there, pixels out of the image read as a value which never propagates.
+ * Tiles whose border changed mark their neighbors for another pass, until no tile changes. Tiles of the same parity
+ * along every axis never read each other pixels, so each parity class is processed in parallel.
+ */
+template<typename T, ptrdiff_t Rank>
+void t_Reconstruct(reconstruction_type rect_type,
+  const poutre::details::image_tiled_t<T, Rank> &i_marker,
+  const poutre::details::image_tiled_t<T, Rank> &i_mask,
+  poutre::se::Common_NL_SE nl_static,
+  poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Reconstruct tiled");
+  POUTRE_CHECK(i_marker.shape() == o_img.shape(), "t_Reconstruct tiled incompatible size");
+  POUTRE_CHECK(i_mask.shape() == o_img.shape(), "t_Reconstruct tiled incompatible size");
+  POUTRE_CHECK(i_marker.tile_edge() == o_img.tile_edge(), "t_Reconstruct tiled incompatible tiles");
+  POUTRE_CHECK(i_mask.tile_edge() == o_img.tile_edge(), "t_Reconstruct tiled incompatible tiles");
+  POUTRE_CHECK(&i_marker != &o_img, "t_Reconstruct tiled output must be != than input images");
+  POUTRE_CHECK(&i_mask != &o_img, "t_Reconstruct tiled output must be != than input images");
+  if (o_img.size() == 0) { return; }
+
+  using index_type = poutre::details::av::index<Rank>;
+  constexpr ptrdiff_t halo = 1;
+  const T outside =
+    rect_type == reconstruction_type::dilate ? std::numeric_limits<T>::lowest() : std::numeric_limits<T>::max();
+  const ptrdiff_t edge = o_img.tile_edge();
+  const auto scratch_dims =
+    std::vector<std::size_t>(static_cast<std::size_t>(Rank), static_cast<std::size_t>(edge + 2 * halo));
+
+  // marker values are clamped by the mask when their tile is first reconstructed
+  o_img = i_marker;
+
+  // indexed as TileIndex
+  std::vector<index_type> tiles(o_img.nb_tiles());
+  for (const auto &tile : o_img.grid()) { tiles[static_cast<std::size_t>(o_img.TileIndex(tile))] = tile; }
+  const auto parity = [](const index_type &tile) {
+    std::size_t color = 0;
+    for (std::size_t dim = 0; dim < static_cast<std::size_t>(Rank); ++dim) {
+      color |= static_cast<std::size_t>(tile[dim] % 2) << dim;
+    }
+    return color;
+  };
+  std::vector<char> dirty(tiles.size(), 1);
+  std::vector<char> border_changed(tiles.size(), 0);
+
+  const auto reconstruct_tile = [&](const index_type &tile,
+                                  poutre::details::image_t<T, Rank> &marker,
+                                  poutre::details::image_t<T, Rank> &mask,
+                                  poutre::details::image_t<T, Rank> &out) {
+    const auto vmarker = view(std::as_const(marker));
+    const auto vmask = view(std::as_const(mask));
+    auto vout = view(out);
+    const auto stride = vout.stride();
+    o_img.ReadTileWithHalo(tile, halo, marker.data(), stride, outside);
+    i_mask.ReadTileWithHalo(tile, halo, mask.data(), stride, outside);
+    t_ReconstructionDispatch(rect_type, vmarker, vmask, nl_static, vout);
+
+    // write back the valid part of the tile, a change on its outer layer may propagate to the neighbors
+    const auto bound = o_img.TileBound(tile);
+    const auto tile_stride = o_img.tile_stride();
+    T *ptr_tile = o_img.GetTile(tile);
+    bool changed = false;
+    for (const auto &idx : bound) {
+      ptrdiff_t offset = 0;
+      ptrdiff_t local = 0;
+      bool on_border = false;
+      for (std::size_t dim = 0; dim < static_cast<std::size_t>(Rank); ++dim) {
+        offset += idx[dim] * tile_stride[dim];
+        local += (idx[dim] + halo) * stride[dim];
+        on_border = on_border || idx[dim] < halo || idx[dim] >= bound[dim] - halo;
+      }
+      if (ptr_tile[offset] != out.data()[local]) {
+        ptr_tile[offset] = out.data()[local];
+        changed = changed || on_border;
+      }
+    }
+    return changed;
+  };
+
+  const auto tilesize = static_cast<std::size_t>(o_img.tile_size());
+  std::size_t nb_around = 1;
+  for (std::size_t dim = 0; dim < static_cast<std::size_t>(Rank); ++dim) { nb_around *= 3; }
+  std::vector<std::size_t> todo;
+  todo.reserve(tiles.size());
+  for (bool stable = false; !stable;) {
+    stable = true;
+    for (std::size_t color = 0; color < (std::size_t{ 1 } << static_cast<std::size_t>(Rank)); ++color) {
+      todo.clear();
+      for (std::size_t itile = 0; itile < tiles.size(); ++itile) {
+        if (dirty[itile] != 0 && parity(tiles[itile]) == color) {
+          todo.push_back(itile);
+          dirty[itile] = 0;
+        }
+      }
+      if (todo.empty()) { continue; }
+      stable = false;
+      // blocks of whole tiles
+      poutre::ParallelForBlocks(todo.size() * tilesize, tilesize, [&, tilesize](std::size_t begin, std::size_t end) {
+        poutre::details::image_t<T, Rank> marker(scratch_dims, poutre::AllocationMode::Pooled);
+        poutre::details::image_t<T, Rank> mask(scratch_dims, poutre::AllocationMode::Pooled);
+        poutre::details::image_t<T, Rank> out(scratch_dims, poutre::AllocationMode::Pooled);
+        for (auto i = begin / tilesize; i < end / tilesize; ++i) {
+          border_changed[todo[i]] = reconstruct_tile(tiles[todo[i]], marker, mask, out) ? 1 : 0;
+        }
+      });
+      // neighbors of changed tiles, itself excluded (already stable with respect to its halo)
+      const auto grid = o_img.grid();
+      for (const auto itile : todo) {
+        if (border_changed[itile] == 0) { continue; }
+        for (std::size_t around = 0; around < nb_around; ++around) {
+          auto neighbor = tiles[itile];
+          bool inside = true;
+          for (std::size_t dim = 0, remaining = around; dim < static_cast<std::size_t>(Rank); ++dim, remaining /= 3) {
+            neighbor[dim] += static_cast<ptrdiff_t>(remaining % 3) - 1;
+            inside = inside && neighbor[dim] >= 0 && neighbor[dim] < grid[dim];
+          }
+          if (inside && neighbor != tiles[itile]) { dirty[static_cast<std::size_t>(o_img.TileIndex(neighbor))] = 1; }
+        }
+      }
+    }
+  }
+}
+
+//! @} doxygroup: poutre_geodesy_group
+}// namespace poutre::geo::details
@@ -55,10 +55,13 @@ const H5std_string IMAGE4Planes("4Planes");
 
 // ptype
 const H5std_string PUINT8("pUINT8");
+const H5std_string PUINT16("pUINT16");
+const H5std_string PINT16("pINT16");
 const H5std_string PINT32("pINT32");
 const H5std_string PINT64("pINT64");
 const H5std_string PFLOAT("pF32");
 const H5std_string PDOUBLE("pD64");
+const H5std_string PBINPACK("pBinPack");
 
 inline void CreateAttribute(H5::DataSet &dataSet,
   const std::string &key,
@@ -87,6 +90,14 @@ template<> struct nativeTypeToAttrStr<uint8_t>
 {
   H5std_string str{ PUINT8 };
 };
+template<> struct nativeTypeToAttrStr<uint16_t>
+{
+  H5std_string str{ PUINT16 };
+};
+template<> struct nativeTypeToAttrStr<int16_t>
+{
+  H5std_string str{ PINT16 };
+};
 
 template<> struct nativeTypeToAttrStr<int32_t>
 {
@@ -112,6 +123,14 @@ template<> struct nativeTypeToH5DataType<uint8_t>
 {
   H5::IntType type{ H5::PredType::NATIVE_UINT8 };
 };
+template<> struct nativeTypeToH5DataType<uint16_t>
+{
+  H5::IntType type{ H5::PredType::NATIVE_UINT16 };
+};
+template<> struct nativeTypeToH5DataType<int16_t>
+{
+  H5::IntType type{ H5::PredType::NATIVE_INT16 };
+};
 template<> struct nativeTypeToH5DataType<int32_t>
 {
   H5::IntType type{ H5::PredType::NATIVE_INT32 };
@@ -168,6 +187,39 @@ void StoreWithHDF5_helper(const IInterface &iimage,
   }
 }
 
+/**
+ * @brief Store packed binary image
+ *
+ * Data is written unpacked as uint8 {0,1}, so that any HDF5 reader can use it, IMAGE_P_TYPE records the packing.
+ */
+template<ptrdiff_t rank>
+void StoreWithHDF5BinPack_helper(const IInterface &iimage,
+  const std::string &file_name,// NOLINT
+  const std::string &data_set_name)
+{
+  const auto *im_t = dynamic_cast<const poutre::details::image_t<pBinPack, rank> *>(&iimage);
+  if (!im_t) { POUTRE_RUNTIME_ERROR("StoreWithHDF5BinPack_helper Dynamic cast fail"); }
+  poutre::details::image_t<pUINT8, rank> unpacked(im_t->GetShape());
+  poutre::details::t_UnpackBinary(*im_t, unpacked);
+  const auto file = H5::H5File(file_name, H5F_ACC_TRUNC);
+  const auto &dimensions = ImageCoordToHDF5Dim(unpacked.GetShape());
+
+  try {
+    nativeTypeToH5DataType<pUINT8> hdf5_type;
+    hdf5_type.type.setOrder(H5T_ORDER_LE);
+    const H5::DataSpace dataspace(static_cast<int>(dimensions.size()), dimensions.data());
+    H5::DataSet dataset = file.createDataSet(data_set_name, hdf5_type.type, dataspace);
+
+    CreateAttribute(dataset, "CLASS", "IMAGE");
+    CreateAttribute(dataset, "IMAGE_COMP_TYPE", IMAGEScalar);
+    CreateAttribute(dataset, "IMAGE_P_TYPE", PBINPACK);
+
+    dataset.write(unpacked.data(), hdf5_type.type);
+  } catch (const H5::Exception &e) {
+    POUTRE_RUNTIME_ERROR(std::format("StoreWithHDF5BinPack_helper: HDF5 fail : {}", e.getDetailMsg()));
+  }
+}
+
 template<typename T, ptrdiff_t rank>
 void StoreWithHDF53Planes_helper(const IInterface &iimage,
   const std::string &file_name,// NOLINT
@@ -250,6 +302,21 @@ template<typename T, ptrdiff_t rank> void LoadFromHDF5_helper(IInterface &iimage
   }
 }
 
+//! Load uint8 {0,1} data set in packed binary image, non zero values are true
+template<ptrdiff_t rank> void LoadFromHDF5BinPack_helper(IInterface &iimage, const H5::DataSet &data_set)
+{
+  auto *im_t = dynamic_cast<poutre::details::image_t<pBinPack, rank> *>(&iimage);
+  if (!im_t) { POUTRE_RUNTIME_ERROR("LoadFromHDF5BinPack_helper Dynamic cast fail"); }
+  poutre::details::image_t<pUINT8, rank> unpacked(im_t->GetShape());
+  try {
+    nativeTypeToH5DataType<pUINT8> hdf5_type;
+    data_set.read(unpacked.data(), hdf5_type.type);
+  } catch (const H5::Exception &e) {
+    POUTRE_RUNTIME_ERROR((std::format("LoadFromHDF5BinPack_helper: HDF5 fail : {}", e.getDetailMsg())));
+  }
+  poutre::details::t_PackBinary(unpacked, *im_t);
+}
+
 template<typename T, ptrdiff_t rank> void LoadFromHDF53Planes_helper(IInterface &iimage, const H5::DataSet &data_set)
 {
   auto *im_t = dynamic_cast<poutre::details::image_t<compound_type<T, 3>, rank> *>(&iimage);
@@ -18,11 +18,18 @@
  */
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
 #include <deque>
 #include <filesystem>
 #include <numeric>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/image_bin_t.hpp>
+#include <poutre/base/details/simd/simd_algorithm.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/label/label_statistics.hpp>
 #include <poutre/structuring_element/details/neighbor_list_static_se_t.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 #include <type_traits>
@@ -87,6 +94,13 @@ template<typename T> struct label_flat_zones_neighbor_relation
   using type = std::equal_to<T>;
 };
 
+/**
+ * @brief Union-find of provisional labels, union by min
+ *
+ * Root of each set is its smallest vertex, i.e. first provisional label met in raster order. Vertices are added on
+ * demand through get_new_label, storage grows according to the observed density of provisional labels.
+ * Once all unions are done, flatten replaces parents in place by consecutive labels.
+ */
 template<typename IdxT = std::size_t> struct disjoint_min_sets
 {
   static_assert(std::is_unsigned_v<IdxT>, "IdxT should be an unsigned type");
@@ -95,51 +109,176 @@ template<typename IdxT = std::size_t> struct disjoint_min_sets
 public:
   using IndexType = IdxT;
   std::vector<IndexType> parents;
-  // std::vector<IndexType> sizes;
-  explicit disjoint_min_sets(std::size_t size) noexcept : parents()//, sizes(size, 1)
-  { parents.reserve(size); }
-  IndexType get_new_label()
+
+  //! @param size number of scanned elements (upper bound of provisional labels)
+  explicit disjoint_min_sets(std::size_t size) : parents(), m_max_size(size)
+  { parents.reserve(static_cast<std::size_t>(std::sqrt(static_cast<double>(size)))); }
+
+  /**
+   * @brief Add a singleton
+   * @param nb_scanned number of elements scanned so far, used to extrapolate storage when growing
+   */
+  IndexType get_new_label(std::size_t nb_scanned = 0)
   {
     const auto new_vertex = static_cast<IndexType>(parents.size());
-    POUTRE_ASSERTCHECK(
-      new_vertex <= std::numeric_limits<IndexType>::max(), "labels exhausted, use larger type in disjoint_min_sets");
+    POUTRE_ASSERTCHECK(parents.size() < static_cast<std::size_t>(std::numeric_limits<IndexType>::max()),
+      "labels exhausted, use larger type in disjoint_min_sets");
+    if (parents.size() == parents.capacity()) { Grow(nb_scanned); }
     parents.push_back(new_vertex);
     return new_vertex;
   }
 
-  IndexType find_root(const IndexType vertex) noexcept
+  //! iterative find with path halving
+  IndexType find_root(IndexType vertex) noexcept
   {
-    IndexType parent = parents[vertex];
-    if (parents[parent] != parent) { parents[vertex] = parent = find_root(parent); }
-    return parent;
+    while (parents[vertex] != vertex) {
+      parents[vertex] = parents[parents[vertex]];
+      vertex = parents[vertex];
+    }
+    return vertex;
   }
 
   IndexType union_sets(const IndexType vertex1, const IndexType vertex2) noexcept
   {
-    auto vertex1_parent = find_root(vertex1);
-    auto vertex2_parent = find_root(vertex2);
+    const auto vertex1_parent = find_root(vertex1);
+    const auto vertex2_parent = find_root(vertex2);
     if (vertex1_parent < vertex2_parent) {
       parents[vertex2_parent] = vertex1_parent;
       return vertex1_parent;
-    } else if (vertex2_parent < vertex1_parent) {
-      parents[vertex1_parent] = vertex2_parent;
-      return vertex2_parent;
     }
-    return vertex1_parent;
+    parents[vertex1_parent] = vertex2_parent;
+    return vertex2_parent;
   }
 
-  std::pair<std::vector<IndexType>, size_t> min_label() noexcept
+  /**
+   * @brief Replace in place parents[i] by the consecutive label (1 based) of the set of i, roots are numbered in
+   * increasing order
+   * @warning sets can't be modified afterwards, use label() to read labels
+   * @return number of sets
+   */
+  std::size_t flatten() noexcept
   {
-    std::vector<IndexType> out(parents.size());
+    // parents[i] <= i, so parents[parents[i]] already holds the final label
     std::size_t count = 0;
-    for (size_t i = 0; i < parents.size(); ++i) {
-      if (parents[i] == i) { count += 1; }
-      out[i] = static_cast<IndexType>(count);
+    for (std::size_t i = 0; i < parents.size(); ++i) {
+      if (parents[i] == i) {
+        parents[i] = static_cast<IndexType>(++count);
+      } else {
+        parents[i] = parents[parents[i]];
+      }
     }
-    return std::make_pair(out, count);
+    return count;
   }
+
+  //! label of vertex, valid after flatten
+  [[nodiscard]] IndexType label(const IndexType vertex) const noexcept { return parents[vertex]; }
+
+private:
+  void Grow(std::size_t nb_scanned)
+  {
+    auto new_capacity = std::max<std::size_t>(2 * parents.capacity(), min_capacity);
+    if (nb_scanned > 0 && nb_scanned < m_max_size) {
+      // extrapolate current density of provisional labels to the remaining elements, with 25% margin
+      const auto extrapolated = static_cast<std::size_t>(
+        1.25 * static_cast<double>(parents.size()) * static_cast<double>(m_max_size) / static_cast<double>(nb_scanned));
+      new_capacity = std::max(new_capacity, extrapolated);
+    }
+    parents.reserve(std::max(std::min(new_capacity, m_max_size), parents.size() + 1));
+  }
+
+  static constexpr std::size_t min_capacity = 16;
+  std::size_t m_max_size;
 };
 
+/**
+ * @brief Thread safe union-find over a fixed number of vertices, union by min
+ *
+ * Used to merge provisional labels of independently labelled blocks. Invariant parent <= vertex is kept by every
+ * write, so concurrent path halving is benign and the root of each set is its smallest vertex.
+ */
+template<typename IdxT = std::size_t> struct concurrent_disjoint_min_sets
+{
+  static_assert(std::is_unsigned_v<IdxT>, "IdxT should be an unsigned type");
+  static_assert(std::is_integral_v<IdxT>, "IdxT should be an integral type");
+
+public:
+  using IndexType = IdxT;
+  std::vector<std::atomic<IndexType>> parents;
+
+  explicit concurrent_disjoint_min_sets(std::size_t size) : parents(size)
+  {
+    for (std::size_t i = 0; i < size; ++i) { parents[i].store(static_cast<IndexType>(i), std::memory_order_relaxed); }
+  }
+
+  IndexType find_root(IndexType vertex) noexcept
+  {
+    while (true) {
+      IndexType parent = parents[vertex].load(std::memory_order_acquire);
+      if (parent == vertex) { return vertex; }
+      const IndexType grand_parent = parents[parent].load(std::memory_order_acquire);
+      // path halving, may fail if another thread already moved vertex closer to root
+      if (grand_parent != parent) {
+        parents[vertex].compare_exchange_weak(parent, grand_parent, std::memory_order_acq_rel);
+      }
+      vertex = grand_parent;
+    }
+  }
+
+  IndexType union_sets(IndexType vertex1, IndexType vertex2) noexcept
+  {
+    while (true) {
+      auto vertex1_parent = find_root(vertex1);
+      auto vertex2_parent = find_root(vertex2);
+      if (vertex1_parent == vertex2_parent) { return vertex1_parent; }
+      if (vertex1_parent < vertex2_parent) { std::swap(vertex1_parent, vertex2_parent); }
+      // only a root may be linked, retry if vertex1_parent has been linked meanwhile
+      IndexType expected = vertex1_parent;
+      if (parents[vertex1_parent].compare_exchange_strong(expected, vertex2_parent, std::memory_order_acq_rel)) {
+        return vertex2_parent;
+      }
+      vertex1 = vertex1_parent;
+      vertex2 = vertex2_parent;
+    }
+  }
+
+  //! same as disjoint_min_sets::flatten, not thread safe, call once all unions are done
+  std::size_t flatten() noexcept
+  {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < parents.size(); ++i) {
+      const auto parent = parents[i].load(std::memory_order_relaxed);
+      const auto label =
+        (parent == i) ? static_cast<IndexType>(++count) : parents[parent].load(std::memory_order_relaxed);
+      parents[i].store(label, std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+  //! label of vertex, valid after flatten
+  [[nodiscard]] IndexType label(const IndexType vertex) const noexcept
+  { return parents[vertex].load(std::memory_order_relaxed); }
+};
+
+/**
+ * @brief Gather statistics of slabs (indexed by local labels) in o_stats (indexed by final labels)
+ * @param slabs ordered along first dimension, expose offset, nb_labels and stats members
+ */
+template<class SlabLabels, class Merger>
+void MergeSlabStatistics(const std::vector<SlabLabels> &slabs,
+  const Merger &merger,
+  std::size_t nb_labels,
+  LabelStatistics &o_stats)
+{
+  o_stats.reset(slabs.empty() ? 0 : slabs.front().stats.rank, nb_labels);
+  // slabs and local labels are visited in raster order, so first pixels are kept
+  for (const auto &slab : slabs) {
+    for (std::size_t local = 1; local <= slab.nb_labels; ++local) {
+      o_stats.merge(merger.label(slab.offset + local - 1), slab.stats, local);
+    }
+  }
+  o_stats.finalize();
+}
+
 template<poutre::se::Common_NL_SE nl_static,
   typename Tin,
   typename Tout,
@@ -151,7 +290,10 @@ template<poutre::se::Common_NL_SE nl_static,
 struct t_label_helper
 {
   static_assert(Rank == poutre::se::details::static_se_traits<nl_static>::rank, "SE and view have not the same Rank");
-  std::size_t operator()(const ViewIn<const Tin, Rank> &i_vin, const ViewOut<Tout, Rank> &o_vout) const
+  //! @param o_stats if not null, filled with statistics of each label during relabel pass
+  std::size_t operator()(const ViewIn<const Tin, Rank> &i_vin,
+    const ViewOut<Tout, Rank> &o_vout,
+    LabelStatistics *o_stats = nullptr) const
   {
     POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
 
@@ -166,81 +308,470 @@ struct t_label_helper
     // init output
     std::fill(o_vout.data(), o_vout.data() + o_vout.size(), static_cast<Tout>(0));
 
-    auto [nl_upper, _] = poutre::se::details::static_se_traits<nl_static>::split_coordinates_upper_lower();
+    // contiguous views are split along first dimension in slabs labelled in parallel
+    if constexpr (Rank >= 2 && std::is_same_v<ViewIn<const Tin, Rank>, poutre::details::av::array_view<const Tin, Rank>>
+                  && std::is_same_v<ViewOut<Tout, Rank>, poutre::details::av::array_view<Tout, Rank>>) {
+      const auto nbpixels = static_cast<std::size_t>(vInbound.size());
+      if (nbpixels > 0) {
+        const auto slice_size = nbpixels / static_cast<std::size_t>(vInbound[0]);
+        const auto block_size = ExecutionContext::get().ComputeBlockSize(nbpixels, slice_size);
+        if (block_size < nbpixels) {
+          return LabelSlabs(i_vin, o_vout, static_cast<ptrdiff_t>(block_size / slice_size), o_stats);
+        }
+      }
+    }
 
-    const auto sentinel = std::numeric_limits<Tout>::max();
-    disjoint_min_sets sets(static_cast<std::size_t>(std::floor(std::sqrt(o_vout.size()))));
-    const auto accept = accep_t();
-    const auto neighbor_relation = nl_relation_t();
+    disjoint_min_sets sets(static_cast<std::size_t>(o_vout.size()));
+    ScanRows(i_vin, o_vout, 0, vInbound[0], sets);
+
+    // in order to enumerate label along scanning
+    const auto nb_labels = sets.flatten();
+    if (o_stats) { o_stats->reset(Rank, nb_labels); }
 
+    // flatten pass
     {
+      const auto accept = accep_t();
       auto beg1 = begin(vInbound);
       auto end1 = end(vInbound);
       for (; beg1 != end1; ++beg1) {
-        auto curr_center_val = i_vin[*beg1];
-        if (!accept(curr_center_val)) { continue; }
-        auto label = sentinel;
-        for (const auto &idx_nl_upper : nl_upper) {
-          const auto delta_nl_idx = *beg1 + idx_nl_upper;
-          if (!vInbound.contains(delta_nl_idx)) { continue; }
-          if (neighbor_relation(curr_center_val, i_vin[delta_nl_idx])) {
-            const auto new_label = o_vout[delta_nl_idx];
-            if (label == sentinel || label == new_label)///????
-            {
-              label = new_label;
-            } else {
-              label = static_cast<Tout>(
-                sets.union_sets(static_cast<std::size_t>(label), static_cast<std::size_t>(new_label)));
-            }
-          }
+        const auto curr_val = i_vin[*beg1];
+        if (accept(curr_val)) {
+          const auto label = sets.label(static_cast<std::size_t>(o_vout[*beg1]));
+          o_vout[*beg1] = static_cast<Tout>(label);
+          if (o_stats) { o_stats->add_pixel(label, *beg1, static_cast<double>(curr_val)); }
         }
+      }
+    }
+    if (o_stats) { o_stats->finalize(); }
+    return nb_labels;
+  }
+
+private:
+  /**
+   * @brief First pass of the two pass labelling restricted to rows [row_begin,row_end[ of the first dimension
+   * Neighbors outside these rows are ignored, provisional labels are allocated in @c sets
+   */
+  static void ScanRows(const ViewIn<const Tin, Rank> &i_vin,
+    const ViewOut<Tout, Rank> &o_vout,
+    ptrdiff_t row_begin,
+    ptrdiff_t row_end,
+    disjoint_min_sets<> &sets)
+  {
+    auto [nl_upper, _] = poutre::se::details::static_se_traits<nl_static>::split_coordinates_upper_lower();
+
+    const auto vInbound = i_vin.bound();
+    auto slab_bound = vInbound;
+    slab_bound[0] = row_end - row_begin;
+    poutre::details::av::index<Rank> shift(0);
+    shift[0] = row_begin;
+
+    const auto sentinel = std::numeric_limits<Tout>::max();
+    const auto accept = accep_t();
+    const auto neighbor_relation = nl_relation_t();
 
-        if (label == sentinel) { label = static_cast<Tout>(sets.get_new_label()); }
-        o_vout[*beg1] = label;
+    std::size_t nb_scanned = 0;
+    auto beg1 = begin(slab_bound);
+    auto end1 = end(slab_bound);
+    for (; beg1 != end1; ++beg1) {
+      ++nb_scanned;
+      const auto curr_idx = *beg1 + shift;
+      auto curr_center_val = i_vin[curr_idx];
+      if (!accept(curr_center_val)) { continue; }
+      auto label = sentinel;
+      for (const auto &idx_nl_upper : nl_upper) {
+        const auto delta_nl_idx = curr_idx + idx_nl_upper;
+        if (!vInbound.contains(delta_nl_idx) || delta_nl_idx[0] < row_begin) { continue; }
+        if (neighbor_relation(curr_center_val, i_vin[delta_nl_idx])) {
+          const auto new_label = o_vout[delta_nl_idx];
+          if (label == sentinel || label == new_label) {
+            label = new_label;
+          } else {
+            label =
+              static_cast<Tout>(sets.union_sets(static_cast<std::size_t>(label), static_cast<std::size_t>(new_label)));
+          }
+        }
       }
+
+      if (label == sentinel) { label = static_cast<Tout>(sets.get_new_label(nb_scanned)); }
+      o_vout[curr_idx] = label;
+    }
+  }
+
+  /**
+   * @brief Block based labelling
+   *
+   * -# each slab of rows_per_slab rows is labelled independently, local labels are made consecutive
+   * -# local labels are shifted to a global range, equivalences across slab borders are merged in a
+   * concurrent_disjoint_min_sets
+   * -# global labels are made consecutive and written back in parallel
+   *
+   * Roots are minimal provisional labels, i.e. first pixel of each component in raster order, so output is identical
+   * to the serial labelling.
+   */
+  static std::size_t LabelSlabs(const ViewIn<const Tin, Rank> &i_vin,
+    const ViewOut<Tout, Rank> &o_vout,
+    ptrdiff_t rows_per_slab,
+    LabelStatistics *o_stats)
+  {
+    auto [nl_upper, _] = poutre::se::details::static_se_traits<nl_static>::split_coordinates_upper_lower();
+    const ptrdiff_t extension = poutre::se::details::static_se_traits<nl_static>::maximum_extension();
+
+    const auto vInbound = i_vin.bound();
+    const auto nbrows = vInbound[0];
+    const auto nbslabs = static_cast<std::size_t>((nbrows + rows_per_slab - 1) / rows_per_slab);
+    const auto slice_size = static_cast<std::size_t>(vInbound.size()) / static_cast<std::size_t>(nbrows);
+    const auto accept = accep_t();
+    const auto neighbor_relation = nl_relation_t();
+
+    struct slab_labels
+    {
+      //! provisional label -> consecutive local label (1 based)
+      std::vector<std::size_t> local_labels;
+      std::size_t nb_labels = 0;
+      std::size_t offset = 0;
+      //! statistics by local label
+      LabelStatistics stats;
+    };
+    std::vector<slab_labels> slabs(nbslabs);
+
+    const auto slab_bound_for = [&](std::size_t slab, poutre::details::av::index<Rank> &shift) {
+      auto slab_bound = vInbound;
+      shift = poutre::details::av::index<Rank>(0);
+      shift[0] = static_cast<ptrdiff_t>(slab) * rows_per_slab;
+      slab_bound[0] = std::min(nbrows, shift[0] + rows_per_slab) - shift[0];
+      return slab_bound;
+    };
+
+    auto &ctx = ExecutionContext::get();
+    // independent labelling of each slab
+    ctx.ParallelFor(nbslabs, [&](std::size_t slab) {
+      const auto row_begin = static_cast<ptrdiff_t>(slab) * rows_per_slab;
+      const auto row_end = std::min(nbrows, row_begin + rows_per_slab);
+      disjoint_min_sets sets(static_cast<std::size_t>(row_end - row_begin) * slice_size);
+      ScanRows(i_vin, o_vout, row_begin, row_end, sets);
+      // later phases only read slab tables
+      slabs[slab].nb_labels = sets.flatten();
+      slabs[slab].local_labels = std::move(sets.parents);
+    });
+
+    std::size_t nb_provisional = 0;
+    for (auto &slab : slabs) {
+      slab.offset = nb_provisional;
+      nb_provisional += slab.nb_labels;
     }
+    // global provisional label of a pixel already labelled in its slab (0 based)
+    const auto global_label = [&slabs](std::size_t slab, Tout local) {
+      const auto &current = slabs[slab];
+      return current.offset + current.local_labels[static_cast<std::size_t>(local)] - 1;
+    };
 
-    // temp display
-    // {
-    //   std::cout<<"before min label \n";
-    //   std::cout<<"out \n";
-    //   {
-    //     auto begit = begin(vInbound);
-    //     auto endit = end(vInbound);
-    //     for( ; begit != endit; ++begit ) {
-    //       std::cout << static_cast<int>(o_vout[*begit]) << " ";
-    //     }
-    //     std::cout<<"\n";
-    //   }
-    // }
+    // merge equivalences along slab borders
+    concurrent_disjoint_min_sets<> merger(nb_provisional);
+    if (nbslabs > 1) {
+      ctx.ParallelFor(nbslabs - 1, [&](std::size_t border) {
+        const std::size_t slab = border + 1;
+        poutre::details::av::index<Rank> shift;
+        auto border_bound = slab_bound_for(slab, shift);
+        border_bound[0] = std::min(border_bound[0], extension);
+        auto beg1 = begin(border_bound);
+        auto end1 = end(border_bound);
+        for (; beg1 != end1; ++beg1) {
+          const auto curr_idx = *beg1 + shift;
+          auto curr_center_val = i_vin[curr_idx];
+          if (!accept(curr_center_val)) { continue; }
+          for (const auto &idx_nl_upper : nl_upper) {
+            const auto delta_nl_idx = curr_idx + idx_nl_upper;
+            if (!vInbound.contains(delta_nl_idx) || delta_nl_idx[0] >= shift[0]) { continue; }
+            if (neighbor_relation(curr_center_val, i_vin[delta_nl_idx])) {
+              const auto nl_slab = static_cast<std::size_t>(delta_nl_idx[0] / rows_per_slab);
+              merger.union_sets(
+                global_label(slab, o_vout[curr_idx]), global_label(nl_slab, o_vout[delta_nl_idx]));
+            }
+          }
+        }
+      });
+    }
 
     // in order to enumerate label along scanning
-    const auto [new_labels, nb_labels] = sets.min_label();
-    //
-    // // temp display
-    // {
-    //   std::cout<<"min label \n";
-    //   {
-    //
-    //     for( const auto&val:new_labels ) {
-    //       std::cout << static_cast<int>(val) << " ";
-    //     }
-    //     std::cout<<"\n";
-    //   }
-    // }
+    const auto nb_labels = merger.flatten();
 
     // flatten pass
-    {
-      auto beg1 = begin(vInbound);
-      auto end1 = end(vInbound);
+    ctx.ParallelFor(nbslabs, [&](std::size_t slab) {
+      auto &current = slabs[slab];
+      if (o_stats) { current.stats.reset(Rank, current.nb_labels); }
+      poutre::details::av::index<Rank> shift;
+      auto slab_bound = slab_bound_for(slab, shift);
+      auto beg1 = begin(slab_bound);
+      auto end1 = end(slab_bound);
       for (; beg1 != end1; ++beg1) {
-        if (accept(i_vin[*beg1])) {
-          o_vout[*beg1] = static_cast<Tout>(new_labels[sets.find_root(static_cast<std::size_t>(o_vout[*beg1]))]);
+        const auto curr_idx = *beg1 + shift;
+        const auto curr_val = i_vin[curr_idx];
+        if (accept(curr_val)) {
+          const auto local = current.local_labels[static_cast<std::size_t>(o_vout[curr_idx])];
+          o_vout[curr_idx] = static_cast<Tout>(merger.label(current.offset + local - 1));
+          if (o_stats) { current.stats.add_pixel(local, curr_idx, static_cast<double>(curr_val)); }
         }
       }
+    });
+    if (o_stats) { MergeSlabStatistics(slabs, merger, nb_labels, *o_stats); }
+    return nb_labels;
+  }
+};
+
+/**
+ * @brief Foreground runs of the rows of a contiguous 2D buffer
+ *
+ * Background is skipped by SIMD scans (see simd::find_first_not_equal).
+ */
+template<typename Tin> struct dense_row_runs
+{
+  const Tin *ptrIn;
+  ptrdiff_t xsize;
+
+  //! call emit(begin,end) for each run [begin,end[ of row, in increasing order
+  template<class Func> void operator()(ptrdiff_t row, Func &&emit) const
+  {
+    const Tin *ptrRow = ptrIn + row * xsize;
+    const Tin *const ptrRowEnd = ptrRow + xsize;
+    const Tin *curr = ptrRow;
+    while (curr != ptrRowEnd) {
+      curr = simd::find_first_not_equal(curr, ptrRowEnd, static_cast<Tin>(0));
+      if (curr == ptrRowEnd) { break; }
+      const Tin *run_end = simd::find_first_equal(curr, ptrRowEnd, static_cast<Tin>(0));
+      emit(curr - ptrRow, run_end - ptrRow);
+      curr = run_end;
+    }
+  }
+
+  //! pixel values of the run starting at (row,begin)
+  [[nodiscard]] const Tin *values(ptrdiff_t row, ptrdiff_t begin) const { return ptrIn + row * xsize + begin; }
+};
+
+/**
+ * @brief Run based binary labelling of 2D images
+ *
+ * Foreground of each row is encoded as runs [begin,end[ provided by RowRuns (see dense_row_runs). Runs are connected
+ * to overlapping runs of the previous row, so each foreground pixel is written once and neighbors are never tested
+ * pixel by pixel.
+ * Rows are split in slabs labelled in parallel, and merged like t_label_helper does.
+ * Provisional labels are allocated in raster order, so output is identical to t_label_helper.
+ *
+ * @tparam connectivity8 true for SESquare2D, false for SECross2D
+ */
+template<typename Tout, bool connectivity8> struct t_label_runs_2D
+{
+  template<class RowRuns>
+  std::size_t operator()(const RowRuns &row_runs,
+    ptrdiff_t ysize,
+    ptrdiff_t xsize,
+    Tout *ptrOut,
+    LabelStatistics *o_stats = nullptr) const
+  {
+    const auto nbpixels = static_cast<std::size_t>(ysize * xsize);
+    // init output
+    std::fill(ptrOut, ptrOut + nbpixels, static_cast<Tout>(0));
+    if (nbpixels == 0) { return 0; }
+
+    auto &ctx = ExecutionContext::get();
+    const auto block_size = ctx.ComputeBlockSize(nbpixels, static_cast<std::size_t>(xsize));
+    const auto rows_per_slab = static_cast<ptrdiff_t>(block_size / static_cast<std::size_t>(xsize));
+    const auto nbslabs = static_cast<std::size_t>((ysize + rows_per_slab - 1) / rows_per_slab);
+
+    std::vector<slab_runs> slabs(nbslabs);
+
+    // independent labelling of each slab
+    ctx.ParallelFor(nbslabs, [&](std::size_t slab) {
+      const auto row_begin = static_cast<ptrdiff_t>(slab) * rows_per_slab;
+      const auto row_end = std::min(ysize, row_begin + rows_per_slab);
+      ScanRows(row_runs, xsize, row_begin, row_end, slabs[slab]);
+    });
+
+    std::size_t nb_provisional = 0;
+    for (auto &slab : slabs) {
+      slab.offset = nb_provisional;
+      nb_provisional += slab.nb_labels;
+    }
+
+    // merge equivalences along slab borders
+    concurrent_disjoint_min_sets<> merger(nb_provisional);
+    if (nbslabs > 1) {
+      ctx.ParallelFor(nbslabs - 1, [&](std::size_t border) {
+        const auto &upper = slabs[border];
+        const auto &lower = slabs[border + 1];
+        const auto upper_rows = upper.row_first_run.size() - 1;
+        ForEachOverlap(upper.runs.data() + upper.row_first_run[upper_rows - 1],
+          upper.runs.data() + upper.row_first_run[upper_rows],
+          lower.runs.data(),
+          lower.runs.data() + lower.row_first_run[1],
+          [&](const label_run &upper_run, const label_run &lower_run) {
+            merger.union_sets(upper.offset + upper_run.label - 1, lower.offset + lower_run.label - 1);
+          });
+      });
     }
+
+    // in order to enumerate label along scanning
+    const auto nb_labels = merger.flatten();
+
+    // write runs
+    ctx.ParallelFor(nbslabs, [&](std::size_t slab) {
+      auto &current = slabs[slab];
+      if (o_stats) { current.stats.reset(2, current.nb_labels); }
+      const auto row_begin = static_cast<ptrdiff_t>(slab) * rows_per_slab;
+      for (std::size_t row = 0; row + 1 < current.row_first_run.size(); ++row) {
+        const auto image_row = row_begin + static_cast<ptrdiff_t>(row);
+        Tout *ptrRow = ptrOut + image_row * xsize;
+        for (auto run = current.row_first_run[row]; run < current.row_first_run[row + 1]; ++run) {
+          const auto &curr_run = current.runs[run];
+          const auto label = static_cast<Tout>(merger.label(current.offset + curr_run.label - 1));
+          std::fill(ptrRow + curr_run.begin, ptrRow + curr_run.end, label);
+          if (o_stats) {
+            current.stats.add_run(
+              curr_run.label, image_row, curr_run.begin, curr_run.end, row_runs.values(image_row, curr_run.begin));
+          }
+        }
+      }
+    });
+    if (o_stats) { MergeSlabStatistics(slabs, merger, nb_labels, *o_stats); }
     return nb_labels;
   }
+
+private:
+  static constexpr std::size_t no_label = std::numeric_limits<std::size_t>::max();
+
+  struct label_run
+  {
+    ptrdiff_t begin;
+    ptrdiff_t end;
+    std::size_t label;
+  };
+
+  struct slab_runs
+  {
+    std::vector<label_run> runs;
+    //! runs of row i (relative to slab) are [row_first_run[i],row_first_run[i+1][
+    std::vector<std::size_t> row_first_run;
+    std::size_t nb_labels = 0;
+    std::size_t offset = 0;
+    //! statistics by local label
+    LabelStatistics stats;
+  };
+
+  //! call func(upper_run,lower_run) for each pair of connected runs of two consecutive rows
+  template<class LowerRun, class Func>
+  static void ForEachOverlap(const label_run *upper_first,
+    const label_run *upper_last,
+    LowerRun *lower_first,
+    LowerRun *lower_last,
+    Func &&func)
+  {
+    // with 8-connectivity, diagonal contact is enough
+    constexpr ptrdiff_t reach = connectivity8 ? 1 : 0;
+    for (; lower_first != lower_last; ++lower_first) {
+      // skip upper runs ending before current run, they can't touch next runs either
+      while (upper_first != upper_last && upper_first->end + reach <= lower_first->begin) { ++upper_first; }
+      for (auto upper = upper_first; upper != upper_last && upper->begin < lower_first->end + reach; ++upper) {
+        func(*upper, *lower_first);
+      }
+    }
+  }
+
+  //! extract and label runs of rows [row_begin,row_end[, local labels are consecutive (1 based) at exit
+  template<class RowRuns>
+  static void
+    ScanRows(const RowRuns &row_runs, ptrdiff_t xsize, ptrdiff_t row_begin, ptrdiff_t row_end, slab_runs &slab)
+  {
+    disjoint_min_sets sets(static_cast<std::size_t>((row_end - row_begin) * xsize));
+    slab.row_first_run.reserve(static_cast<std::size_t>(row_end - row_begin + 1));
+    slab.row_first_run.push_back(0);
+    for (auto row = row_begin; row < row_end; ++row) {
+      const std::size_t row_first = slab.runs.size();
+      row_runs(row,
+        [&slab](ptrdiff_t begin, ptrdiff_t end) { slab.runs.push_back(label_run{ begin, end, no_label }); });
+      if (row != row_begin) {
+        const auto prev_first = slab.row_first_run[slab.row_first_run.size() - 2];
+        ForEachOverlap(slab.runs.data() + prev_first,
+          slab.runs.data() + row_first,
+          slab.runs.data() + row_first,
+          slab.runs.data() + slab.runs.size(),
+          [&sets](const label_run &upper_run, label_run &lower_run) {
+            lower_run.label = (lower_run.label == no_label) ? upper_run.label
+                                                            : sets.union_sets(lower_run.label, upper_run.label);
+          });
+      }
+      for (auto run = row_first; run < slab.runs.size(); ++run) {
+        if (slab.runs[run].label == no_label) {
+          slab.runs[run].label = sets.get_new_label(static_cast<std::size_t>((row - row_begin + 1) * xsize));
+        }
+      }
+      slab.row_first_run.push_back(slab.runs.size());
+    }
+
+    slab.nb_labels = sets.flatten();
+    for (auto &run : slab.runs) { run.label = sets.label(run.label); }
+  }
+};
+
+/**
+ * @brief Foreground runs of the rows of a packed 2D image
+ *
+ * Runs are bounded by count of trailing zeros/ones, background words are skipped 64 pixels at a time.
+ */
+struct binpack_row_runs
+{
+  const poutre::details::image_t<pBinPack, 2> &img;
+  //! values of any run, pixels of a packed image are 1
+  std::vector<pUINT8> ones;
+
+  //! call emit(begin,end) for each run [begin,end[ of row, in increasing order
+  template<class Func> void operator()(ptrdiff_t row, Func &&emit) const
+  {
+    const auto *words = img.GetLineWords(row);
+    const auto xsize = img.line_size();
+    ptrdiff_t pos = 0;
+    while (pos < xsize) {
+      const auto begin = NextBit<true>(words, pos);
+      if (begin >= xsize) { break; }
+      const auto end = NextBit<false>(words, begin);
+      emit(begin, end);
+      pos = end;
+    }
+  }
+
+  [[nodiscard]] const pUINT8 *values(POUTRE_MAYBE_UNUSED ptrdiff_t row, POUTRE_MAYBE_UNUSED ptrdiff_t begin) const
+  { return ones.data(); }
+
+private:
+  //! first pixel >= pos equal to value, line_size() if none
+  template<bool value> [[nodiscard]] ptrdiff_t NextBit(const pUINT64 *words, ptrdiff_t pos) const
+  {
+    constexpr auto word_bits = TypeTraits<pBinPack>::word_bits;
+    auto index = pos / word_bits;
+    auto word = (value ? words[index] : ~words[index]) & (~pUINT64(0) << (pos % word_bits));
+    while (word == 0) {
+      if (++index == img.words_per_line()) { return img.line_size(); }
+      word = value ? words[index] : ~words[index];
+    }
+    return std::min(img.line_size(), (index * word_bits) + std::countr_zero(word));
+  }
+};
+
+//! Run based binary labelling of contiguous 2D views @see t_label_runs_2D
+template<typename Tin, typename Tout, bool connectivity8> struct t_label_binary_runs_2D
+{
+  std::size_t operator()(const poutre::details::av::array_view<const Tin, 2> &i_vin,
+    const poutre::details::av::array_view<Tout, 2> &o_vout,
+    LabelStatistics *o_stats = nullptr) const
+  {
+    POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
+    auto vInbound = i_vin.bound();
+    auto vOutbound = o_vout.bound();
+    POUTRE_CHECK(vOutbound == vInbound, "Incompatible bound");
+    POUTRE_CHECK(i_vin.stride() == o_vout.stride(), "Incompatible stride");
+    const ptrdiff_t ysize = vInbound[0];
+    const ptrdiff_t xsize = vInbound[1];
+    return t_label_runs_2D<Tout, connectivity8>()(
+      dense_row_runs<Tin>{ i_vin.data(), xsize }, ysize, xsize, o_vout.data(), o_stats);
+  }
 };
 
 template<poutre::se::Common_NL_SE nl_static,
@@ -260,8 +791,31 @@ struct t_label_binaryHelper
     typename label_binary_accept<Tin>::type,
     typename label_binary_neighbor_relation<Tin>::type>;
 
-  size_t operator()(const ViewIn<const Tin, Rank> &i_vin, const ViewOut<Tout, Rank> &o_vout) const
-  { return t_label_operator()(i_vin, o_vout); }
+  size_t operator()(const ViewIn<const Tin, Rank> &i_vin,
+    const ViewOut<Tout, Rank> &o_vout,
+    LabelStatistics *o_stats = nullptr) const
+  { return t_label_operator()(i_vin, o_vout, o_stats); }
+};
+
+//! Run based kernel for 2D binary images
+template<typename Tout>
+struct t_label_binaryHelper<poutre::se::Common_NL_SE::SESquare2D,
+  pUINT8,
+  Tout,
+  2,
+  poutre::details::av::array_view,
+  poutre::details::av::array_view> : t_label_binary_runs_2D<pUINT8, Tout, true>
+{
+};
+
+template<typename Tout>
+struct t_label_binaryHelper<poutre::se::Common_NL_SE::SECross2D,
+  pUINT8,
+  Tout,
+  2,
+  poutre::details::av::array_view,
+  poutre::details::av::array_view> : t_label_binary_runs_2D<pUINT8, Tout, false>
+{
 };
 
 template<poutre::se::Common_NL_SE nl_static,
@@ -281,8 +835,10 @@ struct t_label_flat_zones_Helper
     typename label_flat_zones_accept<Tin>::type,
     typename label_flat_zones_neighbor_relation<Tin>::type>;
 
-  size_t operator()(const ViewIn<const Tin, Rank> &i_vin, const ViewOut<Tout, Rank> &o_vout) const
-  { return t_label_operator()(i_vin, o_vout); }
+  size_t operator()(const ViewIn<const Tin, Rank> &i_vin,
+    const ViewOut<Tout, Rank> &o_vout,
+    LabelStatistics *o_stats = nullptr) const
+  { return t_label_operator()(i_vin, o_vout, o_stats); }
 };
 
 template<typename Tin,
@@ -292,7 +848,8 @@ template<typename Tin,
   template<typename, ptrdiff_t> class ViewOut>
 size_t t_label_binaryDispatch(const ViewIn<const Tin, Rank> &i_vin,
   const poutre::se::Common_NL_SE nl_static,
-  const ViewOut<Tout, Rank> &o_vout)
+  const ViewOut<Tout, Rank> &o_vout,
+  LabelStatistics *o_stats = nullptr)
 {
   POUTRE_CHECK(i_vin.size() == o_vout.size(), "t_label_binaryDispatch Incompatible views size");
 
@@ -300,7 +857,7 @@ size_t t_label_binaryDispatch(const ViewIn<const Tin, Rank> &i_vin,
     switch (nl_static) {
     case poutre::se::Common_NL_SE::SESegmentX1D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SESegmentX1D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("t_label_binaryDispatch unsupported nl_static");
@@ -312,19 +869,19 @@ size_t t_label_binaryDispatch(const ViewIn<const Tin, Rank> &i_vin,
     switch (nl_static) {
     case poutre::se::Common_NL_SE::SESquare2D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SESquare2D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SECross2D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SECross2D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentX2D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SESegmentX2D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentY2D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SESegmentY2D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("t_label_binaryDispatch unsupported nl_static");
@@ -335,23 +892,23 @@ size_t t_label_binaryDispatch(const ViewIn<const Tin, Rank> &i_vin,
     switch (nl_static) {
     case poutre::se::Common_NL_SE::SECross3D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SECross3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESquare3D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SESquare3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentX3D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SESegmentX3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentY3D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SESegmentY3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentZ3D: {
       t_label_binaryHelper<poutre::se::Common_NL_SE::SESegmentZ3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("t_label_binaryDispatch unsupported nl_static");
@@ -366,14 +923,44 @@ size_t t_label_binaryDispatch(const ViewIn<const Tin, Rank> &i_vin,
 template<typename Tin, typename Tout, ptrdiff_t Rank>
 size_t t_label_binary(const poutre::details::image_t<Tin, Rank> &i_img,
   poutre::se::Common_NL_SE nl_static,
-  poutre::details::image_t<Tout, Rank> &o_img)
+  poutre::details::image_t<Tout, Rank> &o_img,
+  LabelStatistics *o_stats = nullptr)
 {
   AssertSizesCompatible(i_img, o_img, "t_label_binary incompatible size");
   AssertImagesAreDifferent(i_img, o_img, "t_label_binary output must be != than input images");
 
   auto viewIn = view(i_img);
   auto viewOut = view(o_img);
-  return t_label_binaryDispatch(viewIn, nl_static, viewOut);
+  return t_label_binaryDispatch(viewIn, nl_static, viewOut, o_stats);
+}
+
+/**
+ * @brief Binary labelling of packed image
+ *
+ * 2D SESquare2D/SECross2D read the runs from the words, other SE are labelled on the unpacked image.
+ */
+template<typename Tout, ptrdiff_t Rank>
+size_t t_label_binary(const poutre::details::image_t<pBinPack, Rank> &i_img,
+  poutre::se::Common_NL_SE nl_static,
+  poutre::details::image_t<Tout, Rank> &o_img,
+  LabelStatistics *o_stats = nullptr)
+{
+  AssertSizesCompatible(i_img, o_img, "t_label_binary incompatible size");
+  AssertImagesAreDifferent(i_img, o_img, "t_label_binary output must be != than input images");
+
+  if constexpr (Rank == 2) {
+    const auto shape = i_img.shape();
+    const binpack_row_runs row_runs{ i_img, std::vector<pUINT8>(o_stats ? static_cast<std::size_t>(shape[1]) : 0, 1) };
+    if (nl_static == poutre::se::Common_NL_SE::SESquare2D) {
+      return t_label_runs_2D<Tout, true>()(row_runs, shape[0], shape[1], o_img.data(), o_stats);
+    }
+    if (nl_static == poutre::se::Common_NL_SE::SECross2D) {
+      return t_label_runs_2D<Tout, false>()(row_runs, shape[0], shape[1], o_img.data(), o_stats);
+    }
+  }
+  poutre::details::image_t<pUINT8, Rank> unpacked(i_img.GetShape());
+  poutre::details::t_UnpackBinary(i_img, unpacked);
+  return t_label_binary(unpacked, nl_static, o_img, o_stats);
 }
 
 template<typename Tin,
@@ -383,7 +970,8 @@ template<typename Tin,
   template<typename, ptrdiff_t> class ViewOut>
 size_t t_label_flat_zonesDispatch(const ViewIn<const Tin, Rank> &i_vin,
   const poutre::se::Common_NL_SE nl_static,
-  const ViewOut<Tout, Rank> &o_vout)
+  const ViewOut<Tout, Rank> &o_vout,
+  LabelStatistics *o_stats = nullptr)
 {
   POUTRE_CHECK(i_vin.size() == o_vout.size(), "t_label_flat_zonesDispatch Incompatible views size");
 
@@ -391,7 +979,7 @@ size_t t_label_flat_zonesDispatch(const ViewIn<const Tin, Rank> &i_vin,
     switch (nl_static) {
     case poutre::se::Common_NL_SE::SESegmentX1D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SESegmentX1D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("t_label_flat_zonesDispatch unsupported nl_static");
@@ -403,19 +991,19 @@ size_t t_label_flat_zonesDispatch(const ViewIn<const Tin, Rank> &i_vin,
     switch (nl_static) {
     case poutre::se::Common_NL_SE::SESquare2D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SESquare2D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SECross2D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SECross2D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentX2D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SESegmentX2D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentY2D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SESegmentY2D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("t_label_flat_zonesDispatch unsupported nl_static");
@@ -426,23 +1014,23 @@ size_t t_label_flat_zonesDispatch(const ViewIn<const Tin, Rank> &i_vin,
     switch (nl_static) {
     case poutre::se::Common_NL_SE::SECross3D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SECross3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESquare3D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SESquare3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentX3D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SESegmentX3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentY3D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SESegmentY3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     case poutre::se::Common_NL_SE::SESegmentZ3D: {
       t_label_flat_zones_Helper<poutre::se::Common_NL_SE::SESegmentZ3D, Tin, Tout, Rank, ViewIn, ViewOut> op;
-      return op(i_vin, o_vout);
+      return op(i_vin, o_vout, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("t_label_flat_zonesDispatch unsupported nl_static");
@@ -457,14 +1045,15 @@ size_t t_label_flat_zonesDispatch(const ViewIn<const Tin, Rank> &i_vin,
 template<typename Tin, typename Tout, ptrdiff_t Rank>
 size_t t_label_flat_zones(const poutre::details::image_t<Tin, Rank> &i_img,
   poutre::se::Common_NL_SE nl_static,
-  poutre::details::image_t<Tout, Rank> &o_img)
+  poutre::details::image_t<Tout, Rank> &o_img,
+  LabelStatistics *o_stats = nullptr)
 {
   AssertSizesCompatible(i_img, o_img, "t_label_flat_zones incompatible size");
   AssertImagesAreDifferent(i_img, o_img, "t_label_flat_zones output must be != than input images");
 
   auto viewIn = view(i_img);
   auto viewOut = view(o_img);
-  return t_label_flat_zonesDispatch(viewIn, nl_static, viewOut);
+  return t_label_flat_zonesDispatch(viewIn, nl_static, viewOut, o_stats);
 }
 //! @} doxygroup: poutre_label_group
 }// namespace poutre::label::details
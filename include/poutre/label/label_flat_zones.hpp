@@ -20,6 +20,7 @@
 #include <poutre/base/config.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/label/label.hpp>
+#include <poutre/label/label_statistics.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 
 namespace poutre::label {
@@ -34,5 +35,13 @@ namespace poutre::label {
  */
 LAB_API std::size_t label_flat_zones(const IInterface &i_img, se::Common_NL_SE nl_static, IInterface &o_img);
 
+/*!@brief Same as label_flat_zones, o_stats is filled with statistics of each label on the fly (no extra pass over o_img)
+ * @return number of labels
+ */
+LAB_API std::size_t label_flat_zones(const IInterface &i_img,
+  se::Common_NL_SE nl_static,
+  IInterface &o_img,
+  LabelStatistics &o_stats);
+
 //! @} doxygroup: poutre_label_group
 }// namespace poutre::label
\ No newline at end of file
@@ -0,0 +1,188 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   label_statistics.hpp
+ * @author Thomas Retornaz
+ * @brief  Per label statistics gathered while labelling
+ *
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/label/label.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace poutre::label {
+/**
+ * @addtogroup poutre_label_group
+ *@{
+ */
+
+/**
+ * @brief Statistics of each label, stored as structure of arrays
+ *
+ * Entry i refers to label i+1 (0 is background). Coordinates are stored label by label, @c rank values per label,
+ * e.g. bbox_min[i*rank+dim].
+ */
+struct LabelStatistics
+{
+  //! rank of the labelled image
+  std::ptrdiff_t rank = 0;
+  //! number of pixels
+  std::vector<std::size_t> area;
+  //! bounding box lower corner (inclusive)
+  std::vector<std::ptrdiff_t> bbox_min;
+  //! bounding box upper corner (inclusive)
+  std::vector<std::ptrdiff_t> bbox_max;
+  //! first pixel in raster order
+  std::vector<std::ptrdiff_t> first_pixel;
+  //! mean coordinates
+  std::vector<double> centroid;
+  //! sum of input values
+  std::vector<double> sum;
+  //! min of input values
+  std::vector<double> min;
+  //! max of input values
+  std::vector<double> max;
+
+  //! number of labels
+  [[nodiscard]] std::size_t size() const noexcept { return area.size(); }
+
+  //! clear and allocate nb_labels empty entries
+  void reset(std::ptrdiff_t i_rank, std::size_t nb_labels)
+  {
+    rank = i_rank;
+    const auto nb_coords = nb_labels * static_cast<std::size_t>(rank);
+    area.assign(nb_labels, 0);
+    bbox_min.assign(nb_coords, std::numeric_limits<std::ptrdiff_t>::max());
+    bbox_max.assign(nb_coords, std::numeric_limits<std::ptrdiff_t>::lowest());
+    first_pixel.assign(nb_coords, 0);
+    centroid.assign(nb_coords, 0.);
+    sum.assign(nb_labels, 0.);
+    min.assign(nb_labels, std::numeric_limits<double>::max());
+    max.assign(nb_labels, std::numeric_limits<double>::lowest());
+  }
+
+  /**
+   * @brief Accumulate one pixel, pixels of a label must be added in raster order
+   * @param label label in [1,size()]
+   * @param coords indexable coordinates (rank values)
+   */
+  template<class Coords> void add_pixel(std::size_t label, const Coords &coords, double value) POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(label > 0 && label <= size(), "add_pixel: label out of range");
+    const auto entry = label - 1;
+    const auto ucrank = static_cast<std::size_t>(rank);
+    const auto offset = entry * ucrank;
+    if (area[entry] == 0) {
+      for (std::size_t dim = 0; dim < ucrank; ++dim) { first_pixel[offset + dim] = coords[dim]; }
+    }
+    ++area[entry];
+    for (std::size_t dim = 0; dim < ucrank; ++dim) {
+      const auto coord = static_cast<std::ptrdiff_t>(coords[dim]);
+      bbox_min[offset + dim] = std::min(bbox_min[offset + dim], coord);
+      bbox_max[offset + dim] = std::max(bbox_max[offset + dim], coord);
+      centroid[offset + dim] += static_cast<double>(coord);
+    }
+    sum[entry] += value;
+    min[entry] = std::min(min[entry], value);
+    max[entry] = std::max(max[entry], value);
+  }
+
+  /**
+   * @brief Accumulate run [begin,end[ of row (2D only), runs of a label must be added in raster order
+   * @param values input values of the run
+   */
+  template<typename T>
+  void add_run(std::size_t label, std::ptrdiff_t row, std::ptrdiff_t begin, std::ptrdiff_t end, const T *values)
+    POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(label > 0 && label <= size(), "add_run: label out of range");
+    POUTRE_ASSERTCHECK(rank == 2, "add_run: only for 2D");
+    POUTRE_ASSERTCHECK(begin < end, "add_run: empty run");
+    const auto entry = label - 1;
+    const auto offset = entry * 2;
+    const auto length = end - begin;
+    if (area[entry] == 0) {
+      first_pixel[offset] = row;
+      first_pixel[offset + 1] = begin;
+    }
+    area[entry] += static_cast<std::size_t>(length);
+    bbox_min[offset] = std::min(bbox_min[offset], row);
+    bbox_max[offset] = std::max(bbox_max[offset], row);
+    bbox_min[offset + 1] = std::min(bbox_min[offset + 1], begin);
+    bbox_max[offset + 1] = std::max(bbox_max[offset + 1], end - 1);
+    centroid[offset] += static_cast<double>(row) * static_cast<double>(length);
+    centroid[offset + 1] += static_cast<double>(begin + end - 1) * static_cast<double>(length) / 2.;
+    auto run_sum = sum[entry];
+    auto run_min = min[entry];
+    auto run_max = max[entry];
+    for (std::ptrdiff_t i = 0; i < length; ++i) {
+      const auto value = static_cast<double>(values[i]);
+      run_sum += value;
+      run_min = std::min(run_min, value);
+      run_max = std::max(run_max, value);
+    }
+    sum[entry] = run_sum;
+    min[entry] = run_min;
+    max[entry] = run_max;
+  }
+
+  /**
+   * @brief Merge entry other_label of other (not finalized) in entry label
+   * @warning entries must be merged in raster order of their first pixel
+   */
+  void merge(std::size_t label, const LabelStatistics &other, std::size_t other_label) POUTRE_NOEXCEPTONLYNDEBUG
+  {
+    POUTRE_ASSERTCHECK(label > 0 && label <= size(), "merge: label out of range");
+    POUTRE_ASSERTCHECK(other_label > 0 && other_label <= other.size(), "merge: other label out of range");
+    POUTRE_ASSERTCHECK(other.rank == rank, "merge: rank mismatch");
+    const auto entry = label - 1;
+    const auto other_entry = other_label - 1;
+    if (other.area[other_entry] == 0) { return; }
+    const auto ucrank = static_cast<std::size_t>(rank);
+    const auto offset = entry * ucrank;
+    const auto other_offset = other_entry * ucrank;
+    if (area[entry] == 0) {
+      for (std::size_t dim = 0; dim < ucrank; ++dim) {
+        first_pixel[offset + dim] = other.first_pixel[other_offset + dim];
+      }
+    }
+    area[entry] += other.area[other_entry];
+    for (std::size_t dim = 0; dim < ucrank; ++dim) {
+      bbox_min[offset + dim] = std::min(bbox_min[offset + dim], other.bbox_min[other_offset + dim]);
+      bbox_max[offset + dim] = std::max(bbox_max[offset + dim], other.bbox_max[other_offset + dim]);
+      centroid[offset + dim] += other.centroid[other_offset + dim];
+    }
+    sum[entry] += other.sum[other_entry];
+    min[entry] = std::min(min[entry], other.min[other_entry]);
+    max[entry] = std::max(max[entry], other.max[other_entry]);
+  }
+
+  //! turn accumulated coordinates in centroids, call once all pixels are added
+  void finalize() POUTRE_NOEXCEPT
+  {
+    const auto ucrank = static_cast<std::size_t>(rank);
+    for (std::size_t entry = 0; entry < area.size(); ++entry) {
+      if (area[entry] == 0) { continue; }
+      for (std::size_t dim = 0; dim < ucrank; ++dim) {
+        centroid[entry * ucrank + dim] /= static_cast<double>(area[entry]);
+      }
+    }
+  }
+};
+
+//! @} doxygroup: poutre_label_group
+}// namespace poutre::label
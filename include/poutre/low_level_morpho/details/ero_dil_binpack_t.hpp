@@ -0,0 +1,279 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   ero_dil_binpack_t.hpp
+ * @author Thomas Retornaz
+ * @brief  Erode dilate of bit-packed binary images with static SE
+ *
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/image_bin_t.hpp>
+#include <poutre/base/details/simd/simd_dispatch.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/trace.hpp>
+#include <poutre/base/types_traits.hpp>
+#include <poutre/structuring_element/details/neighbor_list_static_se_t.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace poutre::llm::details {
+/**
+ * @addtogroup poutre_llm_group
+ *@{
+ */
+
+//! Dilation of packed words, pixels outside the image are false
+struct BinOpSupBinPack
+{
+  using word_type = TypeTraits<pBinPack>::storage_type;
+  static constexpr word_type neutral = 0;
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::Sup;
+  static word_type process(word_type A0, word_type A1) { return A0 | A1; }
+};
+
+//! Erosion of packed words, pixels outside the image are true
+struct BinOpInfBinPack
+{
+  using word_type = TypeTraits<pBinPack>::storage_type;
+  static constexpr word_type neutral = ~word_type(0);
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::Inf;
+  static word_type process(word_type A0, word_type A1) { return A0 & A1; }
+};
+
+/**
+ * @brief io_line(x) = op(io_line(x), i_line(x+dx)) over the wpl words of a packed line
+ *
+ * A shift by dx pixels is a shift by floor(dx/64) words plus a carry of dx mod 64 bits between adjacent words. Words
+ * read outside the line and the padding bits of the last word are BinOp::neutral. Words whose sources are all
+ * inside the line are processed by @c simd::DispatchedBinPackShiftLine, simd batches of the best arch of the running
+ * CPU. Padding bits of io_line are left dirty, the caller masks them once all shifts are combined.
+ */
+template<class BinOp>
+void t_BinPackCombineShiftedLine(const pUINT64 *i_line,
+  std::ptrdiff_t wpl,
+  pUINT64 tail,
+  std::ptrdiff_t dx,
+  pUINT64 *io_line) noexcept
+{
+  constexpr auto word_bits = TypeTraits<pBinPack>::word_bits;
+  // floor division, dx may be negative
+  const std::ptrdiff_t q = (dx >= 0) ? dx / word_bits : -((-dx + word_bits - 1) / word_bits);
+  const auto r = static_cast<int>(dx - (q * word_bits));
+
+  auto fetch = [&](std::ptrdiff_t j) -> pUINT64 {
+    if (j < 0 || j >= wpl) { return BinOp::neutral; }
+    if (j == wpl - 1) { return i_line[j] | (BinOp::neutral & ~tail); }
+    return i_line[j];
+  };
+  auto shifted = [&](std::ptrdiff_t i) -> pUINT64 {
+    if (r == 0) { return fetch(i + q); }
+    return (fetch(i + q) >> r) | (fetch(i + q + 1) << (word_bits - r));
+  };
+
+  // words i whose sources are in [0,wpl-2], no bound nor padding to care about
+  const std::ptrdiff_t lo = std::clamp<std::ptrdiff_t>(-q, 0, wpl);
+  const std::ptrdiff_t hi = std::clamp<std::ptrdiff_t>(wpl - 1 - q - (r > 0 ? 1 : 0), lo, wpl);
+  std::ptrdiff_t i = 0;
+  for (; i < lo; ++i) { io_line[i] = BinOp::process(io_line[i], shifted(i)); }
+  simd::DispatchedBinPackShiftLine(BinOp::dispatched_kernel, i_line, q, r, io_line, i, hi);
+  i = hi;
+  for (; i < wpl; ++i) { io_line[i] = BinOp::process(io_line[i], shifted(i)); }
+}
+
+/**
+ * @brief Static SE seen as packed lines: offsets of the lines (all dimensions but the last one) and, for each of them,
+ * the shifts along the last dimension
+ */
+template<std::ptrdiff_t Rank> struct binpack_se_plan
+{
+  using line_offset = std::array<std::ptrdiff_t, static_cast<std::size_t>(Rank - 1)>;
+  std::vector<line_offset> line_offsets;
+  std::vector<std::vector<std::ptrdiff_t>> shifts;
+  //! all lines share the same shifts: shift once each line, then combine lines
+  bool separable = false;
+
+  explicit binpack_se_plan(const std::vector<poutre::details::av::index<Rank>> &coordinates)
+  {
+    std::map<line_offset, std::vector<std::ptrdiff_t>> groups;
+    for (const auto &coord : coordinates) {
+      line_offset offset{};
+      for (std::ptrdiff_t i = 0; i < Rank - 1; ++i) { offset[static_cast<std::size_t>(i)] = coord[i]; }
+      groups[offset].push_back(coord[Rank - 1]);
+    }
+    for (auto &[offset, dx] : groups) {
+      std::sort(dx.begin(), dx.end());
+      dx.erase(std::unique(dx.begin(), dx.end()), dx.end());
+      line_offsets.push_back(offset);
+      shifts.push_back(dx);
+    }
+    separable = shifts.size() > 1 && shifts.front().size() > 1
+                && std::all_of(shifts.begin(), shifts.end(), [&](const auto &dx) { return dx == shifts.front(); });
+  }
+};
+
+//! coordinates of a static SE of rank Rank
+template<std::ptrdiff_t Rank>
+std::vector<poutre::details::av::index<Rank>> t_BinPackStaticSECoordinates(poutre::se::Common_NL_SE nl_static)
+{
+  using poutre::se::Common_NL_SE;
+  using poutre::se::details::static_se_traits;
+  auto to_vector = [](const auto &coordinates) {
+    return std::vector<poutre::details::av::index<Rank>>(coordinates.begin(), coordinates.end());
+  };
+  if constexpr (Rank == 1) {
+    if (nl_static == Common_NL_SE::SESegmentX1D) {
+      return to_vector(static_se_traits<Common_NL_SE::SESegmentX1D>::coordinates);
+    }
+  }
+  if constexpr (Rank == 2) {
+    switch (nl_static) {
+    case Common_NL_SE::SESegmentX2D:
+      return to_vector(static_se_traits<Common_NL_SE::SESegmentX2D>::coordinates);
+    case Common_NL_SE::SESegmentY2D:
+      return to_vector(static_se_traits<Common_NL_SE::SESegmentY2D>::coordinates);
+    case Common_NL_SE::SESquare2D:
+      return to_vector(static_se_traits<Common_NL_SE::SESquare2D>::coordinates);
+    case Common_NL_SE::SECross2D:
+      return to_vector(static_se_traits<Common_NL_SE::SECross2D>::coordinates);
+    default:
+      break;
+    }
+  }
+  if constexpr (Rank == 3) {
+    switch (nl_static) {
+    case Common_NL_SE::SESegmentX3D:
+      return to_vector(static_se_traits<Common_NL_SE::SESegmentX3D>::coordinates);
+    case Common_NL_SE::SESegmentY3D:
+      return to_vector(static_se_traits<Common_NL_SE::SESegmentY3D>::coordinates);
+    case Common_NL_SE::SESegmentZ3D:
+      return to_vector(static_se_traits<Common_NL_SE::SESegmentZ3D>::coordinates);
+    case Common_NL_SE::SECross3D:
+      return to_vector(static_se_traits<Common_NL_SE::SECross3D>::coordinates);
+    case Common_NL_SE::SESquare3D:
+      return to_vector(static_se_traits<Common_NL_SE::SESquare3D>::coordinates);
+    default:
+      break;
+    }
+  }
+  POUTRE_RUNTIME_ERROR("t_BinPackStaticSECoordinates unsupported nl_static");
+}
+
+/**
+ * @brief Erode/Dilate a packed image by a list of coordinates, pixels outside the image are ignored
+ *
+ * Each output line is the AND/OR of the shifted neighbor lines. When all lines of the SE share the same shifts
+ * (squares), lines are shifted once in a temporary image and then only combined.
+ */
+template<class BinOp, std::ptrdiff_t Rank>
+void t_ErodeDilateBinPack(const poutre::details::image_t<pBinPack, Rank> &i_img,
+  const binpack_se_plan<Rank> &plan,
+  poutre::details::image_t<pBinPack, Rank> &o_img)
+{
+  const auto shape = i_img.shape();
+  const auto xsize = i_img.line_size();
+  const auto wpl = i_img.words_per_line();
+  const auto nb_lines = i_img.nb_lines();
+  const auto tail = i_img.tail_mask();
+  if (xsize == 0 || nb_lines == 0) { return; }
+
+  // neighbor line of line by offset, -1 if outside
+  auto neighbor = [&](std::ptrdiff_t line, const typename binpack_se_plan<Rank>::line_offset &offset) {
+    std::ptrdiff_t res = 0;
+    std::ptrdiff_t stride = 1;
+    for (std::ptrdiff_t dim = Rank - 2; dim >= 0; --dim) {
+      const auto coord = (line % shape[dim]) + offset[static_cast<std::size_t>(dim)];
+      if (coord < 0 || coord >= shape[dim]) { return std::ptrdiff_t{ -1 }; }
+      res += coord * stride;
+      stride *= shape[dim];
+      line /= shape[dim];
+    }
+    return res;
+  };
+  auto for_each_line = [&](auto &&func) {
+    const auto linesize = static_cast<std::size_t>(xsize);
+    const auto length = linesize * static_cast<std::size_t>(nb_lines);
+    ParallelForBlocks(length, linesize, [&](std::size_t begin, std::size_t end) {
+      const auto last = static_cast<std::ptrdiff_t>(end / linesize);
+      for (auto line = static_cast<std::ptrdiff_t>(begin / linesize); line < last; ++line) { func(line); }
+    });
+  };
+
+  if (plan.separable) {
+    poutre::details::image_t<pBinPack, Rank> tmp(i_img.GetShape());
+    for_each_line([&](std::ptrdiff_t line) {
+      auto *tmp_line = tmp.GetLineWords(line);
+      std::fill(tmp_line, tmp_line + wpl, BinOp::neutral);
+      for (const auto dx : plan.shifts.front()) {
+        t_BinPackCombineShiftedLine<BinOp>(i_img.GetLineWords(line), wpl, tail, dx, tmp_line);
+      }
+    });
+    for_each_line([&](std::ptrdiff_t line) {
+      auto *out_line = o_img.GetLineWords(line);
+      std::fill(out_line, out_line + wpl, BinOp::neutral);
+      for (const auto &offset : plan.line_offsets) {
+        const auto other = neighbor(line, offset);
+        if (other >= 0) { t_BinPackCombineShiftedLine<BinOp>(tmp.GetLineWords(other), wpl, tail, 0, out_line); }
+      }
+      out_line[wpl - 1] &= tail;
+    });
+    return;
+  }
+
+  for_each_line([&](std::ptrdiff_t line) {
+    auto *out_line = o_img.GetLineWords(line);
+    std::fill(out_line, out_line + wpl, BinOp::neutral);
+    for (std::size_t group = 0; group < plan.line_offsets.size(); ++group) {
+      const auto other = neighbor(line, plan.line_offsets[group]);
+      if (other < 0) { continue; }
+      for (const auto dx : plan.shifts[group]) {
+        t_BinPackCombineShiftedLine<BinOp>(i_img.GetLineWords(other), wpl, tail, dx, out_line);
+      }
+    }
+    out_line[wpl - 1] &= tail;
+  });
+}
+
+//! Erode packed binary image by static SE
+template<std::ptrdiff_t Rank>
+void t_Erode(const poutre::details::image_t<pBinPack, Rank> &i_img,
+  poutre::se::Common_NL_SE nl_static,
+  poutre::details::image_t<pBinPack, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Erode binpack");
+  AssertSizesCompatible(i_img, o_img, "t_Erode incompatible size");
+  AssertImagesAreDifferent(i_img, o_img, "t_Erode output must be != than input images");
+  const binpack_se_plan<Rank> plan(t_BinPackStaticSECoordinates<Rank>(nl_static));
+  t_ErodeDilateBinPack<BinOpInfBinPack>(i_img, plan, o_img);
+}
+
+//! Dilate packed binary image by static SE
+template<std::ptrdiff_t Rank>
+void t_Dilate(const poutre::details::image_t<pBinPack, Rank> &i_img,
+  poutre::se::Common_NL_SE nl_static,
+  poutre::details::image_t<pBinPack, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Dilate binpack");
+  AssertSizesCompatible(i_img, o_img, "t_Dilate incompatible size");
+  AssertImagesAreDifferent(i_img, o_img, "t_Dilate output must be != than input images");
+  const binpack_se_plan<Rank> plan(t_BinPackStaticSECoordinates<Rank>(nl_static));
+  t_ErodeDilateBinPack<BinOpSupBinPack>(i_img, plan, o_img);
+}
+
+//! @} doxygroup: poutre_llm_group
+}// namespace poutre::llm::details
@@ -16,11 +16,19 @@
  *
  */
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <numbers>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
 #include <poutre/base/trace.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_line_se_t.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_static_se_t.hpp>
+#include <poutre/structuring_element/details/neighbor_list_se_t.hpp>
+#include <type_traits>
+#include <vector>
 #include <poutre/pixel_processing/details/copy_convert_t.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 
@@ -30,6 +38,162 @@ namespace poutre::llm::details {
  *@{
  */
 
+//! Periodic line {i*(dx,dy), |i|<=size_half} of a 2D SE decomposition
+struct PeriodicLineComponent
+{
+  ptrdiff_t dx;
+  ptrdiff_t dy;
+  ptrdiff_t size_half;
+};
+
+/**
+ * @brief Erode/Dilate by the Minkowski sum of periodic lines and nb_cross 3x3 crosses
+ *
+ * Passes run on a copy padded with the neutral value by the SE half extent, so that the result is exactly the one of
+ * the composed SE, borders included, whatever the order of the passes.
+ */
+template<bool IsErosion, typename TIn, typename TOut>
+void t_ErodeDilateLineDecomposition(const poutre::details::image_t<TIn, 2> &i_img,
+  const std::vector<PeriodicLineComponent> &lines,
+  int nb_cross,
+  poutre::details::image_t<TOut, 2> &o_img)
+{
+  using BinOp = std::conditional_t<IsErosion, BinOpInfLine<TIn>, BinOpSupLine<TIn>>;
+  const auto shape = i_img.shape();
+  const ptrdiff_t ysize = shape[0];
+  const ptrdiff_t xsize = shape[1];
+  ptrdiff_t pad_x = nb_cross;
+  ptrdiff_t pad_y = nb_cross;
+  for (const auto &line : lines) {
+    pad_x += std::max<ptrdiff_t>(line.size_half, 0) * std::abs(line.dx);
+    pad_y += std::max<ptrdiff_t>(line.size_half, 0) * std::abs(line.dy);
+  }
+  const ptrdiff_t pxsize = xsize + 2 * pad_x;
+  const ptrdiff_t pysize = ysize + 2 * pad_y;
+  const std::vector<std::size_t> pshape{ static_cast<std::size_t>(pysize), static_cast<std::size_t>(pxsize) };
+  poutre::details::image_t<TIn, 2> padded(pshape, poutre::AllocationMode::Pooled);
+  poutre::details::image_t<TIn, 2> tmp(pshape, poutre::AllocationMode::Pooled);
+  std::fill(padded.begin(), padded.end(), BinOp::neutral);
+  for (ptrdiff_t y = 0; y < ysize; ++y) {
+    std::memcpy(padded.data() + (y + pad_y) * pxsize + pad_x,
+      i_img.data() + y * xsize,
+      static_cast<std::size_t>(xsize) * sizeof(TIn));
+  }
+  for (const auto &line : lines) {
+    if (line.size_half <= 0) continue;
+    t_ErodeDilatePeriodicLine<TIn, BinOp>(
+      padded.data(), tmp.data(), pysize, pxsize, line.dx, line.dy, line.size_half);
+    padded.swap(tmp);
+  }
+  for (int i = 0; i < nb_cross; ++i) {
+    if constexpr (IsErosion) {
+      t_Erode(padded, se::Common_NL_SE::SECross2D, tmp);
+    } else {
+      t_Dilate(padded, se::Common_NL_SE::SECross2D, tmp);
+    }
+    padded.swap(tmp);
+  }
+  for (ptrdiff_t y = 0; y < ysize; ++y) {
+    const TIn *line_in = padded.data() + (y + pad_y) * pxsize + pad_x;
+    std::copy(line_in, line_in + xsize, o_img.data() + y * xsize);
+  }
+}
+
+/**
+ * @brief Octagon of size @c size as lines, same SE as size-nb_square crosses followed by nb_square squares
+ *
+ * - square of half size b: lines along X and Y
+ * - diamond of radius 2h+1: diagonal periodic lines of half size h then one cross (diagonal lines alone only reach
+ * pixels with even coordinates sum), even radius get one more cross
+ */
+inline void t_OctagonDecomposition(const int size, std::vector<PeriodicLineComponent> &lines, int &nb_cross)
+{
+  const double nb_square_dbl = ((static_cast<double>(size)) / (1 + std::numbers::sqrt2));
+  const double nb_square_floor = floor(nb_square_dbl);
+  const auto nb_square =
+    static_cast<ptrdiff_t>(((nb_square_dbl - nb_square_floor) < 0.5) ? (nb_square_floor) : (nb_square_floor + 1));
+  const ptrdiff_t diamond_radius = size - nb_square;
+  ptrdiff_t diag_half = 0;
+  nb_cross = 0;
+  if (diamond_radius > 0) {
+    nb_cross = (diamond_radius % 2 == 1) ? 1 : 2;
+    diag_half = (diamond_radius - nb_cross) / 2;
+  }
+  lines = { { 1, 0, nb_square }, { 0, 1, nb_square }, { 1, 1, diag_half }, { 1, -1, diag_half } };
+}
+
+//! Radius up to which disks are exact (neighbor list), bigger ones are approximated by periodic lines
+inline constexpr int disk_exact_max_radius = 4;
+
+/**
+ * @brief Disk of radius r approximated by a 16-gon, Minkowski sum of periodic lines along
+ * (1,0),(0,1),(1,1),(1,-1),(2,1),(1,2),(2,-1),(1,-2)
+ *
+ * Line lengths follow a regular 16-gon of inradius r (side 2r*tan(pi/16)), axis lines absorb rounding so that
+ * extent along X and Y is exactly r.
+ */
+inline std::vector<PeriodicLineComponent> t_DiskDecomposition(const int radius)
+{
+  const double side = 2. * static_cast<double>(radius) * std::tan(std::numbers::pi / 16.);
+  const auto diag_half = static_cast<ptrdiff_t>(std::lround(side / (2. * std::numbers::sqrt2)));
+  const auto knight_half = static_cast<ptrdiff_t>(std::lround(side / (2. * std::sqrt(5.))));
+  const auto axis_half = std::max<ptrdiff_t>(radius - 2 * diag_half - 6 * knight_half, 0);
+  return { { 1, 0, axis_half },
+    { 0, 1, axis_half },
+    { 1, 1, diag_half },
+    { 1, -1, diag_half },
+    { 2, 1, knight_half },
+    { 1, 2, knight_half },
+    { 2, -1, knight_half },
+    { 1, -2, knight_half } };
+}
+
+//! Exact discrete disk {(y,x), x*x+y*y<=radius*radius}
+inline se::details::neighbor_list_t<2> t_DiskNeighborList(const int radius)
+{
+  se::details::neighbor_list_t<2>::storage_type coords;
+  for (ptrdiff_t y = -radius; y <= radius; ++y) {
+    for (ptrdiff_t x = -radius; x <= radius; ++x) {
+      if (x * x + y * y <= static_cast<ptrdiff_t>(radius) * radius) { coords.push_back({ y, x }); }
+    }
+  }
+  return se::details::neighbor_list_t<2>(coords);
+}
+
+template<typename TIn, typename TOut>
+void t_DilateDisk(const poutre::details::image_t<TIn, 2> &i_img,
+  const int radius,
+  poutre::details::image_t<TOut, 2> &o_img)
+{
+  POUTRE_CHECK(radius >= 0, "t_DilateDisk radius must be >= 0");
+  if (radius == 0) {
+    poutre::details::t_Copy(i_img, o_img);
+    return;
+  }
+  if (radius <= disk_exact_max_radius) {
+    t_Dilate(i_img, t_DiskNeighborList(radius), o_img);
+    return;
+  }
+  t_ErodeDilateLineDecomposition<false>(i_img, t_DiskDecomposition(radius), 0, o_img);
+}
+
+template<typename TIn, typename TOut>
+void t_ErodeDisk(const poutre::details::image_t<TIn, 2> &i_img,
+  const int radius,
+  poutre::details::image_t<TOut, 2> &o_img)
+{
+  POUTRE_CHECK(radius >= 0, "t_ErodeDisk radius must be >= 0");
+  if (radius == 0) {
+    poutre::details::t_Copy(i_img, o_img);
+    return;
+  }
+  if (radius <= disk_exact_max_radius) {
+    t_Erode(i_img, t_DiskNeighborList(radius), o_img);
+    return;
+  }
+  t_ErodeDilateLineDecomposition<true>(i_img, t_DiskDecomposition(radius), 0, o_img);
+}
+
 template<typename TIn, typename TOut>
 void t_DilateOctagon(const poutre::details::image_t<TIn, 2> &i_img,
   const int size,
@@ -44,23 +208,47 @@ void t_DilateOctagon(const poutre::details::image_t<TIn, 2> &i_img,
     t_Dilate(i_img, se::Common_NL_SE::SECross2D, o_img);
     return;
   }
-  const double nb_square_dbl = ((static_cast<double>(size)) / (1 + sqrt(2)));
+  std::vector<PeriodicLineComponent> lines;
+  int nb_cross = 0;
+  t_OctagonDecomposition(size, lines, nb_cross);
+  t_ErodeDilateLineDecomposition<false>(i_img, lines, nb_cross, o_img);
+}
+
+/**
+ * @brief Rhombicuboctahedron as size-nb_square 3D crosses then nb_square 3D squares
+ *
+ * Passes ping-pong between @c o_img and one pooled temporary, the first target is chosen from the parity of the
+ * number of passes so that the last one writes into @c o_img. The caller buffer is never swapped away, which keeps
+ * views (mapped files, numpy arrays) valid and pooled storage inside the operator.
+ */
+template<bool IsErosion, typename TIn, typename TOut>
+void t_ErodeDilateRhombicuboctahedron(const poutre::details::image_t<TIn, 3> &i_img,
+  const int size,
+  poutre::details::image_t<TOut, 3> &o_img)
+{
+  const double nb_square_dbl = ((static_cast<double>(size)) / (1 + std::numbers::sqrt2));
   const double nb_square_floor = floor(nb_square_dbl);
   int nb_square = 0;
   nb_square = static_cast<int>(((nb_square_dbl - nb_square_floor) < 0.5) ? (nb_square_floor) : (nb_square_floor + 1));
+  const int nb_pass = size;// first cross, size-nb_square-1 crosses, nb_square squares
 
-  auto tmpImg_t = poutre::details::t_CloneGeometry(i_img);// NOLINT
-
-  t_Dilate(i_img, se::Common_NL_SE::SECross2D, o_img);
-
-  for (int i = 1; i < size - nb_square; i++) {
-    t_Dilate(o_img, se::Common_NL_SE::SECross2D, *tmpImg_t);
-    tmpImg_t->swap(o_img);
-  }
+  auto tmpImg_t = poutre::details::t_CloneGeometry(o_img, poutre::AllocationMode::Pooled);// NOLINT
+  auto apply = [](const auto &src, se::Common_NL_SE nl, auto &dst) {
+    if constexpr (IsErosion) {
+      t_Erode(src, nl, dst);
+    } else {
+      t_Dilate(src, nl, dst);
+    }
+  };
+  // pass i writes into o_img when the number of remaining passes after it is even
+  auto target = [&](int pass) -> poutre::details::image_t<TOut, 3> & {
+    return ((nb_pass - 1 - pass) % 2 == 0) ? o_img : *tmpImg_t;
+  };
 
-  for (int i = 0; i < nb_square; i++) {
-    t_Dilate(o_img, se::Common_NL_SE::SESquare2D, *tmpImg_t);
-    tmpImg_t->swap(o_img);
+  apply(i_img, se::Common_NL_SE::SECross3D, target(0));
+  for (int pass = 1; pass < nb_pass; pass++) {
+    const auto nl = pass < size - nb_square ? se::Common_NL_SE::SECross3D : se::Common_NL_SE::SESquare3D;
+    apply(target(pass - 1), nl, target(pass));
   }
 }
 
@@ -78,24 +266,7 @@ void t_DilateRhombicuboctahedron(const poutre::details::image_t<TIn, 3> &i_img,
     t_Dilate(i_img, se::Common_NL_SE::SECross2D, o_img);
     return;
   }
-  const double nb_square_dbl = ((static_cast<double>(size)) / (1 + std::numbers::sqrt2));
-  const double nb_square_floor = floor(nb_square_dbl);
-  int nb_square = 0;
-  nb_square = static_cast<int>(((nb_square_dbl - nb_square_floor) < 0.5) ? (nb_square_floor) : (nb_square_floor + 1));
-
-  auto tmpImg_t = poutre::details::t_CloneGeometry(i_img);// NOLINT
-
-  t_Dilate(i_img, se::Common_NL_SE::SECross3D, o_img);
-
-  for (int i = 1; i < size - nb_square; i++) {
-    t_Dilate(o_img, se::Common_NL_SE::SECross3D, *tmpImg_t);
-    tmpImg_t->swap(o_img);
-  }
-
-  for (int i = 0; i < nb_square; i++) {
-    t_Dilate(o_img, se::Common_NL_SE::SESquare3D, *tmpImg_t);
-    tmpImg_t->swap(o_img);
-  }
+  t_ErodeDilateRhombicuboctahedron<false>(i_img, size, o_img);
 }
 
 template<typename TIn, typename TOut>
@@ -112,24 +283,10 @@ void t_ErodeOctagon(const poutre::details::image_t<TIn, 2> &i_img,
     t_Erode(i_img, se::Common_NL_SE::SECross2D, o_img);
     return;
   }
-  const double nb_square_dbl = ((static_cast<double>(size)) / (1 + std::numbers::sqrt2));
-  const double nb_square_floor = floor(nb_square_dbl);
-  int nb_square = 0;
-  nb_square = static_cast<int>(((nb_square_dbl - nb_square_floor) < 0.5) ? (nb_square_floor) : (nb_square_floor + 1));
-
-  auto tmpImg_t = poutre::details::t_CloneGeometry(i_img);// NOLINT
-
-  t_Erode(i_img, se::Common_NL_SE::SECross2D, o_img);
-
-  for (int i = 1; i < size - nb_square; i++) {
-    t_Erode(o_img, se::Common_NL_SE::SECross2D, *tmpImg_t);
-    tmpImg_t->swap(o_img);
-  }
-
-  for (int i = 0; i < nb_square; i++) {
-    t_Erode(o_img, se::Common_NL_SE::SESquare2D, *tmpImg_t);
-    tmpImg_t->swap(o_img);
-  }
+  std::vector<PeriodicLineComponent> lines;
+  int nb_cross = 0;
+  t_OctagonDecomposition(size, lines, nb_cross);
+  t_ErodeDilateLineDecomposition<true>(i_img, lines, nb_cross, o_img);
 }
 
 template<typename TIn, typename TOut>
@@ -146,24 +303,7 @@ void t_ErodeRhombicuboctahedron(const poutre::details::image_t<TIn, 3> &i_img,
     t_Erode(i_img, se::Common_NL_SE::SECross2D, o_img);
     return;
   }
-  const double nb_square_dbl = ((static_cast<double>(size)) / (1 + std::numbers::sqrt2));
-  const double nb_square_floor = floor(nb_square_dbl);
-  int nb_square = 0;
-  nb_square = static_cast<int>(((nb_square_dbl - nb_square_floor) < 0.5) ? (nb_square_floor) : (nb_square_floor + 1));
-
-  auto tmpImg_t = poutre::details::t_CloneGeometry(i_img);// NOLINT
-
-  t_Erode(i_img, se::Common_NL_SE::SECross3D, o_img);
-
-  for (int i = 1; i < size - nb_square; i++) {
-    t_Erode(o_img, se::Common_NL_SE::SECross3D, *tmpImg_t);
-    tmpImg_t->swap(o_img);
-  }
-
-  for (int i = 0; i < nb_square; i++) {
-    t_Erode(o_img, se::Common_NL_SE::SESquare3D, *tmpImg_t);
-    tmpImg_t->swap(o_img);
-  }
+  t_ErodeDilateRhombicuboctahedron<true>(i_img, size, o_img);
 }
 
 
@@ -181,6 +321,9 @@ void t_Dilate(const poutre::details::image_t<TIn, Rank> &i_img,
     case poutre::se::Compound_NL_SE::Octagon: {
       return t_DilateOctagon(i_img, size, o_img);
     }
+    case poutre::se::Compound_NL_SE::Disk: {
+      return t_DilateDisk(i_img, size, o_img);
+    }
     default: {
       POUTRE_RUNTIME_ERROR("t_Dilate 2D unsupported compound_nl");
     }
@@ -213,6 +356,9 @@ void t_Erode(const poutre::details::image_t<TIn, Rank> &i_img,
     case poutre::se::Compound_NL_SE::Octagon: {
       return t_ErodeOctagon(i_img, size, o_img);
     }
+    case poutre::se::Compound_NL_SE::Disk: {
+      return t_ErodeDisk(i_img, size, o_img);
+    }
     default: {
       POUTRE_RUNTIME_ERROR("t_Erode 2D unsupported compound_nl");
     }
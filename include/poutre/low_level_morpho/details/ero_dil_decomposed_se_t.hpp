@@ -0,0 +1,133 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   ero_dil_decomposed_se_t.hpp
+ * @author Thomas Retornaz
+ * @brief  Erode dilate with a decomposition plan of a runtime neighbor list SE
+ *
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/trace.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_line_se_t.hpp>
+#include <poutre/structuring_element/se_decomposition.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+namespace poutre::llm::details {
+/**
+ * @addtogroup poutre_llm_group
+ *@{
+ */
+
+/**
+ * @brief Erode/Dilate a ysize x xsize image following a decomposition plan
+ *
+ * out(p) = inf/sup of in(p+b) for b in the SE, pixels outside the image are ignored. The input is padded with the
+ * neutral element by the SE extents, so that each translated rectangle is exact up to the borders.
+ */
+template<typename T, class BinOp>
+void t_ErodeDilateDecomposed(const T *i_in,
+  T *o_out,
+  ptrdiff_t ysize,
+  ptrdiff_t xsize,
+  const poutre::se::DecompositionPlan2D &plan)
+{
+  POUTRE_CHECK(!plan.groups.empty(), "t_ErodeDilateDecomposed empty plan");
+  if (xsize == 0 || ysize == 0) return;
+  const ptrdiff_t top = std::max<ptrdiff_t>(0, -plan.extent_min[0]);
+  const ptrdiff_t left = std::max<ptrdiff_t>(0, -plan.extent_min[1]);
+  const ptrdiff_t pysize = ysize + top + std::max<ptrdiff_t>(0, plan.extent_max[0]);
+  const ptrdiff_t pxsize = xsize + left + std::max<ptrdiff_t>(0, plan.extent_max[1]);
+  const auto psize = static_cast<std::size_t>(pysize * pxsize);
+
+  std::vector<T> padded(psize, BinOp::neutral);
+  for (ptrdiff_t y = 0; y < ysize; ++y) {
+    std::memcpy(padded.data() + ((y + top) * pxsize) + left,
+      i_in + (y * xsize),
+      static_cast<std::size_t>(xsize) * sizeof(T));
+  }
+  std::fill_n(o_out, static_cast<std::size_t>(xsize * ysize), BinOp::neutral);
+
+  using inView = poutre::details::av::array_view<const T, 2>;
+  using outView = poutre::details::av::array_view<T, 2>;
+  std::vector<T> tmpx;
+  std::vector<T> tmpy;
+  for (const auto &group : plan.groups) {
+    const T *rect = padded.data();
+    if (group.size_half_x > 0) {
+      tmpx.resize(psize);
+      const inView vin(rect, { pysize, pxsize });
+      outView vout(tmpx.data(), { pysize, pxsize });
+      t_ErodeDilateXOpLineDispatcher<T, T, 2, poutre::details::av::array_view, poutre::details::av::array_view, BinOp>
+        dispatcher;
+      dispatcher(vin, group.size_half_x, vout);
+      rect = tmpx.data();
+    }
+    if (group.size_half_y > 0) {
+      tmpy.resize(psize);
+      const inView vin(rect, { pysize, pxsize });
+      outView vout(tmpy.data(), { pysize, pxsize });
+      t_ErodeDilateYOpLineDispatcher<T, T, 2, poutre::details::av::array_view, poutre::details::av::array_view, BinOp>
+        dispatcher;
+      dispatcher(vin, group.size_half_y, vout);
+      rect = tmpy.data();
+    }
+    // accumulate translated rectangles, blocks of whole lines
+    const auto linesize = static_cast<std::size_t>(xsize);
+    ParallelForBlocks(linesize * static_cast<std::size_t>(ysize), linesize, [&](std::size_t begin, std::size_t end) {
+      BinOp op;
+      for (auto y = static_cast<ptrdiff_t>(begin / linesize); y < static_cast<ptrdiff_t>(end / linesize); ++y) {
+        T *lineout = o_out + (y * xsize);
+        for (const auto &shift : group.shifts) {
+          const T *linein = rect + ((y + top + shift[0]) * pxsize) + left + shift[1];
+          for (ptrdiff_t x = 0; x < xsize; ++x) { lineout[x] = op(lineout[x], linein[x]); }
+        }
+      }
+    });
+  }
+}
+
+//! Erode by the plan of a 2D neighbor list
+template<typename T>
+void t_Erode(const poutre::details::image_t<T, 2> &i_img,
+  const poutre::se::DecompositionPlan2D &plan,
+  poutre::details::image_t<T, 2> &o_img)
+{
+  POUTRE_ENTERING("t_Erode decomposed SE");
+  AssertSizesCompatible(i_img, o_img, "t_Erode incompatible size");
+  AssertImagesAreDifferent(i_img, o_img, "t_Erode output must be != than input images");
+  const auto shape = i_img.shape();
+  t_ErodeDilateDecomposed<T, BinOpInfLine<T>>(i_img.data(), o_img.data(), shape[0], shape[1], plan);
+}
+
+//! Dilate by the plan of a 2D neighbor list
+template<typename T>
+void t_Dilate(const poutre::details::image_t<T, 2> &i_img,
+  const poutre::se::DecompositionPlan2D &plan,
+  poutre::details::image_t<T, 2> &o_img)
+{
+  POUTRE_ENTERING("t_Dilate decomposed SE");
+  AssertSizesCompatible(i_img, o_img, "t_Dilate incompatible size");
+  AssertImagesAreDifferent(i_img, o_img, "t_Dilate output must be != than input images");
+  const auto shape = i_img.shape();
+  t_ErodeDilateDecomposed<T, BinOpSupLine<T>>(i_img.data(), o_img.data(), shape[0], shape[1], plan);
+}
+
+//! @} doxygroup: poutre_llm_group
+}// namespace poutre::llm::details
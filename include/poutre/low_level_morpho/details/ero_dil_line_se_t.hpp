@@ -17,11 +17,20 @@
  */
 
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <numbers>
 #include <numeric>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/simd/simd_algorithm.hpp>
+#include <poutre/base/details/simd/simd_dispatch.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/trace.hpp>
+#include <poutre/base/types_traits.hpp>
+#include <vector>
 #include <poutre/pixel_processing/details/copy_convert_t.hpp>
 #include <poutre/pixel_processing/details/transpose_op_t.hpp>
 
@@ -34,15 +43,21 @@ namespace poutre::llm::details {
 template<typename T> struct BinOpInfLine
 {
 public:
+  using simd_type = typename TypeTraits<T>::simd_type;
   static constexpr T neutral = std::numeric_limits<T>::max();
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::Inf;
   static T operator()(const T &A0, const T &A1) { return std::min<T>(A0, A1); }
+  static simd_type operator()(const simd_type &A0, const simd_type &A1) { return xs::min(A0, A1); }
 };
 
 template<typename T> struct BinOpSupLine
 {
 public:
+  using simd_type = typename TypeTraits<T>::simd_type;
   static constexpr T neutral = std::numeric_limits<T>::lowest();
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::Sup;
   static T operator()(const T &A0, const T &A1) { return std::max<T>(A0, A1); }
+  static simd_type operator()(const simd_type &A0, const simd_type &A1) { return xs::max(A0, A1); }
 };
 
 // todo bench against Lemonier algorithm
@@ -88,6 +103,137 @@ void van_herck_1d(T *__restrict f,
   }
 }
 
+/**
+ * @brief Scratch buffers of the batched van Herk kernels
+ *
+ * Buffers only grow, one instance per thread is kept alive (see @c t_VanHerckScratch) so that repeated line
+ * erosions/dilations (e.g. rectangle openings) do not hit the allocator.
+ */
+template<typename T> struct VanHerckScratch
+{
+  std::vector<T> neutral_row;
+  std::vector<T> g;
+  std::vector<T> h_current;
+  std::vector<T> h_previous;
+  //! interleaved rows (x major, row minor) for the horizontal kernel
+  std::vector<T> rows_in;
+  std::vector<T> rows_out;
+};
+
+//! Per thread scratch buffers
+template<typename T> VanHerckScratch<T> &t_VanHerckScratch()
+{
+  thread_local VanHerckScratch<T> scratch;
+  return scratch;
+}
+
+//! Ensure buffer holds at least size elements, never shrink
+template<typename T> void t_GrowScratch(std::vector<T> &buffer, std::size_t size)
+{
+  if (buffer.size() < size) { buffer.resize(size); }
+}
+
+//! out[i]=op(a[i],b[i]) for i in [0,size[, simd lanes then scalar epilogue
+template<typename T, class BinOp>
+void t_LineBinOp(const T *__restrict a, const T *__restrict b, T *__restrict out, ptrdiff_t size, BinOp op)
+  POUTRE_NOEXCEPT
+{
+  using simd_type = typename TypeTraits<T>::simd_type;
+  constexpr auto simd_size = static_cast<ptrdiff_t>(simd_type::size);
+  ptrdiff_t i = 0;
+  for (; i + simd_size <= size; i += simd_size) {
+    xs::store_unaligned(out + i, op(xs::load_unaligned(a + i), xs::load_unaligned(b + i)));
+  }
+  for (; i < size; ++i) { out[i] = op(a[i], b[i]); }
+}
+
+//! Width (in elements) of the column strips processed at once by the vertical van Herk
+template<typename T> constexpr ptrdiff_t t_VerticalStripWidth() POUTRE_NOEXCEPT
+{
+  return static_cast<ptrdiff_t>(std::max<std::size_t>(1024 / sizeof(T), TypeTraits<T>::simd_type::size));
+}
+
+/**
+ * @brief van Herk/Gil-Werman along y on columns [x_begin,x_end[ of a ysize x xsize row major image
+ *
+ * Same recurrence as @c van_herck_1d but each "pixel" is a row of the strip, so every step is a simd min/max
+ * between two contiguous rows. Chunks of 2k+1 rows are processed one after the other: output row y needs h[y-k]
+ * (current or previous chunk) and g[y+k] (current chunk), so only three chunk buffers are kept alive in @c scratch.
+ * Inf/sup on dispatched types run the strip kernel compiled for the best arch of the running CPU.
+ */
+template<typename T, class BinOp>
+void van_herck_vertical(const T *__restrict in,
+  T *__restrict out,
+  ptrdiff_t xsize,
+  ptrdiff_t ysize,
+  ptrdiff_t x_begin,
+  ptrdiff_t x_end,
+  ptrdiff_t size_line_segment,
+  BinOp op,
+  VanHerckScratch<T> &scratch)
+{
+  const ptrdiff_t width = x_end - x_begin;
+  if (width <= 0 || ysize == 0) return;
+  const ptrdiff_t alpha = 2 * size_line_segment + 1;
+  const ptrdiff_t row_end = ysize + size_line_segment;
+  const auto chunk_elements = static_cast<size_t>(std::min(alpha, ysize + 2 * size_line_segment) * width);
+
+  auto &neutral_row = scratch.neutral_row;
+  auto &g = scratch.g;
+  auto &h_current = scratch.h_current;
+  auto &h_previous = scratch.h_previous;
+  neutral_row.assign(static_cast<size_t>(width), BinOp::neutral);
+  t_GrowScratch(g, chunk_elements);
+  t_GrowScratch(h_current, chunk_elements);
+  t_GrowScratch(h_previous, chunk_elements);
+  if constexpr (simd::is_dispatched_binary_op_v<BinOp, T, T, T>) {
+    simd::DispatchedVanHerckStrip(BinOp::dispatched_kernel,
+      in,
+      out,
+      xsize,
+      ysize,
+      x_begin,
+      x_end,
+      size_line_segment,
+      neutral_row.data(),
+      g.data(),
+      h_current.data(),
+      h_previous.data());
+    return;
+  }
+
+  // row r of the padded input
+  auto f = [&](ptrdiff_t r) -> const T * {
+    return (r < 0 || r >= ysize) ? neutral_row.data() : in + r * xsize + x_begin;
+  };
+  const auto row_bytes = static_cast<size_t>(width) * sizeof(T);
+
+  for (ptrdiff_t chunk_start = -size_line_segment; chunk_start < row_end; chunk_start += alpha) {
+    const ptrdiff_t chunk_size = std::min(alpha, row_end - chunk_start);
+    // Forward pass
+    std::memcpy(g.data(), f(chunk_start), row_bytes);
+    for (ptrdiff_t r = 1; r < chunk_size; ++r) {
+      t_LineBinOp(g.data() + (r - 1) * width, f(chunk_start + r), g.data() + r * width, width, op);
+    }
+    // Backward pass
+    std::memcpy(h_current.data() + (chunk_size - 1) * width, f(chunk_start + chunk_size - 1), row_bytes);
+    for (ptrdiff_t r = chunk_size - 2; r >= 0; --r) {
+      t_LineBinOp(h_current.data() + (r + 1) * width, f(chunk_start + r), h_current.data() + r * width, width, op);
+    }
+    // rows y such that y + k falls in the current chunk
+    const ptrdiff_t y_begin = std::max<ptrdiff_t>(chunk_start - size_line_segment, 0);
+    const ptrdiff_t y_end = std::min(chunk_start - size_line_segment + chunk_size, ysize);
+    for (ptrdiff_t y = y_begin; y < y_end; ++y) {
+      const ptrdiff_t rh = y - size_line_segment - chunk_start;
+      const T *hrow =
+        rh >= 0 ? h_current.data() + rh * width : h_previous.data() + (rh + alpha) * width;
+      const T *grow = g.data() + (y + size_line_segment - chunk_start) * width;
+      t_LineBinOp(hrow, grow, out + y * xsize + x_begin, width, op);
+    }
+    h_current.swap(h_previous);
+  }
+}
+
 template<typename T1,
   typename T2,
   ptrdiff_t Rank,
@@ -162,30 +308,38 @@ struct t_ErodeDilateXOpLineDispatcher<T, T, 2, poutre::details::av::array_view,
       poutre::details::t_Copy(i_vin, o_vout);
       return;
     }
-    using lineView = T *;
-    using const_lineView = const T *;
-    ptrdiff_t size_line = xsize;
-    // need auxiliary buffer
-    using tmpBuffer = std::vector<T>;
-    const auto padded_size = static_cast<size_t>(size_line + 2 * size_line_segment);
-    tmpBuffer f(padded_size);
-    tmpBuffer g(padded_size);
-    tmpBuffer h(padded_size);
-    // NOLINTBEGIN
-    for (scoord y = 0; y < ysize; y++) {
-      const_lineView bufInputCurrentLine = i_vin.data() + y * xsize;
-      lineView bufOutputCurrentLine = o_vout.data() + y * xsize;
-      std::fill_n(f.begin(), f.size(), BinOp::neutral);
-      std::memcpy(f.data() + size_line_segment, bufInputCurrentLine, static_cast<size_t>(size_line) * sizeof(T));
-      van_herck_1d(f.data() + size_line_segment,
-        g.data() + size_line_segment,
-        h.data() + size_line_segment,
-        size_line,
-        size_line_segment,
-        op);
-      std::memcpy(bufOutputCurrentLine, f.data() + size_line_segment, static_cast<size_t>(size_line) * sizeof(T));
-    }
-    // NOLINTEND
+    const T *rawIn = i_vin.data();
+    T *rawOut = o_vout.data();
+    // blocks of simd lanes rows (of the widest dispatched arch), boundaries fall on row blocks and grain size is in
+    // pixels
+    const auto lanes = static_cast<ptrdiff_t>(simd::t_AlignedBlockStep<T>());
+    const auto row_size = static_cast<std::size_t>(xsize);
+    ParallelForBlocks(static_cast<std::size_t>(ysize) * row_size,
+      static_cast<std::size_t>(lanes) * row_size,
+      [&](std::size_t begin, std::size_t end) {
+        const auto y_first = static_cast<ptrdiff_t>(begin / row_size);
+        const auto y_last = static_cast<ptrdiff_t>(end / row_size);
+        auto &scratch = t_VanHerckScratch<T>();
+        t_GrowScratch(scratch.rows_in, static_cast<std::size_t>(lanes) * row_size);
+        t_GrowScratch(scratch.rows_out, static_cast<std::size_t>(lanes) * row_size);
+        for (ptrdiff_t y = y_first; y < y_last; y += lanes) {
+          const auto nbrows = std::min(lanes, y_last - y);
+          // interleave rows: rows_in[x*nbrows+row], so that the recurrence along x runs across rows in simd
+          poutre::details::t_TransposeBlocked(
+            rawIn + y * xsize, nbrows, xsize, scratch.rows_in.data(), ptrdiff_t{ 0 }, nbrows);
+          van_herck_vertical(scratch.rows_in.data(),
+            scratch.rows_out.data(),
+            nbrows,
+            xsize,
+            ptrdiff_t{ 0 },
+            nbrows,
+            size_line_segment,
+            op,
+            scratch);
+          poutre::details::t_TransposeBlocked(
+            scratch.rows_out.data(), xsize, nbrows, rawOut + y * xsize, ptrdiff_t{ 0 }, xsize);
+        }
+      });
   }
 };
 
@@ -245,6 +399,102 @@ void t_DilateX(const poutre::details::image_t<TIn, Rank> &i_img,
   return t_DilateX(viewIn, size_segment, viewOut);
 }
 
+template<typename T1,
+  typename T2,
+  ptrdiff_t Rank,
+  template<typename, ptrdiff_t> class View1,
+  template<typename, ptrdiff_t> class View2,
+  class BinOp>
+struct t_ErodeDilateYOpLineDispatcher
+{
+  // generic case not supported yet
+  static_assert(false, "To be implemented for generic views");
+};
+
+template<typename T, class BinOp>
+struct t_ErodeDilateYOpLineDispatcher<T, T, 2, poutre::details::av::array_view, poutre::details::av::array_view, BinOp>
+{
+  void operator()(const poutre::details::av::array_view<const T, 2> &i_vin,
+    ptrdiff_t size_line_segment,
+    poutre::details::av::array_view<T, 2> &o_vout) const
+  {
+    BinOp op;
+    POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
+    auto ibd = i_vin.bound();
+    auto obd = o_vout.bound();
+    auto istride = i_vin.stride();
+    auto ostride = o_vout.stride();
+    scoord ysize = ibd[0];
+    scoord xsize = ibd[1];
+    POUTRE_CHECK(ibd == obd, "bound not compatible");
+    POUTRE_CHECK(istride == ostride, "stride not compatible");
+    if (xsize == 0 || ysize == 0) return;
+
+    if (size_line_segment <= 0) {
+      poutre::details::t_Copy(i_vin, o_vout);
+      return;
+    }
+    const T *rawIn = i_vin.data();
+    T *rawOut = o_vout.data();
+    // range counted column strip by column strip, so that blocks boundaries fall on strips and grain size is in pixels
+    const auto strip_width = t_VerticalStripWidth<T>();
+    const auto column_size = static_cast<std::size_t>(ysize);
+    ParallelForBlocks(static_cast<std::size_t>(xsize) * column_size,
+      static_cast<std::size_t>(strip_width) * column_size,
+      [&](std::size_t begin, std::size_t end) {
+        const auto x_first = static_cast<ptrdiff_t>(begin / column_size);
+        const auto x_last = static_cast<ptrdiff_t>(end / column_size);
+        auto &scratch = t_VanHerckScratch<T>();
+        for (ptrdiff_t x = x_first; x < x_last; x += strip_width) {
+          van_herck_vertical(
+            rawIn, rawOut, xsize, ysize, x, std::min(x + strip_width, x_last), size_line_segment, op, scratch);
+        }
+      });
+  }
+};
+
+template<typename TIn,
+  typename TOut,
+  ptrdiff_t Rank,
+  template<typename, ptrdiff_t> class ViewIn,
+  template<typename, ptrdiff_t> class ViewOut>
+void t_ErodeY(const ViewIn<const TIn, Rank> &i_vin, ptrdiff_t size_segment, ViewOut<TOut, Rank> &o_vout)
+{
+  POUTRE_ENTERING("t_ErodeY view dispatcher");
+  POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
+  using BinOp = BinOpInfLine<TIn>;
+  t_ErodeDilateYOpLineDispatcher<TIn, TOut, Rank, ViewIn, ViewOut, BinOp> dispatcher;
+  dispatcher(i_vin, size_segment, o_vout);
+}
+
+template<typename TIn, typename TOut>
+void t_ErodeY(const poutre::details::image_t<TIn, 2> &i_img,
+  ptrdiff_t size_segment,
+  poutre::details::image_t<TOut, 2> &o_img)
+{
+  POUTRE_ENTERING("t_ErodeY");
+  AssertSizesCompatible(i_img, o_img, "t_ErodeY incompatible size");
+  AssertAsTypesCompatible(i_img, o_img, "t_ErodeY incompatible types");
+  AssertImagesAreDifferent(i_img, o_img, "t_ErodeY output must be != than input images");
+  auto viewIn = view(i_img);
+  auto viewOut = view(o_img);
+  return t_ErodeY(viewIn, size_segment, viewOut);
+}
+
+template<typename TIn,
+  typename TOut,
+  ptrdiff_t Rank,
+  template<typename, ptrdiff_t> class ViewIn,
+  template<typename, ptrdiff_t> class ViewOut>
+void t_DilateY(const ViewIn<const TIn, Rank> &i_vin, ptrdiff_t size_segment, ViewOut<TOut, Rank> &o_vout)
+{
+  POUTRE_ENTERING("t_DilateY view dispatcher");
+  POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
+  using BinOp = BinOpSupLine<TIn>;
+  t_ErodeDilateYOpLineDispatcher<TIn, TOut, Rank, ViewIn, ViewOut, BinOp> dispatcher;
+  dispatcher(i_vin, size_segment, o_vout);
+}
+
 template<typename TIn, typename TOut>
 void t_DilateY(const poutre::details::image_t<TIn, 2> &i_img,
   ptrdiff_t size_segment,
@@ -254,29 +504,246 @@ void t_DilateY(const poutre::details::image_t<TIn, 2> &i_img,
   AssertSizesCompatible(i_img, o_img, "t_DilateY incompatible size");
   AssertAsTypesCompatible(i_img, o_img, "t_DilateY incompatible types");
   AssertImagesAreDifferent(i_img, o_img, "t_DilateY output must be != than input images");
+  auto viewIn = view(i_img);
+  auto viewOut = view(o_img);
+  return t_DilateY(viewIn, size_segment, viewOut);
+}
+
+/**
+ * @name Lines along arbitrary discrete directions
+ * Image is split in disjoint chains of pixels (translated discrete lines), van Herk is run along each chain.
+ * Chains are gathered in the per thread scratch, so cost per pixel doesn't depend on the segment size.
+ */
+/**@{*/
+
+/**
+ * @brief van Herk along chains of pixels of a contiguous image
+ *
+ * @param chain_offsets callable (chain index, std::vector<ptrdiff_t>& offsets) filling linear offsets of the chain
+ * pixels in order
+ * @param max_chain_size upper bound of chain length, also used to weight chains when splitting over the thread pool
+ */
+template<typename T, class BinOp, class ChainOffsets>
+void t_ErodeDilateAlongChains(const T *i_in,
+  T *o_out,
+  std::size_t nb_chains,
+  std::size_t max_chain_size,
+  ptrdiff_t size_line_segment,
+  BinOp op,
+  ChainOffsets chain_offsets)
+{
+  if (nb_chains == 0 || max_chain_size == 0) return;
+  ParallelForBlocks(nb_chains * max_chain_size, max_chain_size, [&](std::size_t begin, std::size_t end) {
+    auto &scratch = t_VanHerckScratch<T>();
+    std::vector<ptrdiff_t> offsets;
+    offsets.reserve(max_chain_size);
+    for (std::size_t chain = begin / max_chain_size; chain < end / max_chain_size; ++chain) {
+      offsets.clear();
+      chain_offsets(chain, offsets);
+      const auto size_line = static_cast<ptrdiff_t>(offsets.size());
+      if (size_line == 0) continue;
+      const auto padded_size = static_cast<std::size_t>(size_line + 2 * size_line_segment);
+      t_GrowScratch(scratch.rows_in, padded_size);
+      t_GrowScratch(scratch.g, padded_size);
+      t_GrowScratch(scratch.h_current, padded_size);
+      T *f = scratch.rows_in.data() + size_line_segment;
+      std::fill_n(f - size_line_segment, size_line_segment, BinOp::neutral);
+      std::fill_n(f + size_line, size_line_segment, BinOp::neutral);
+      for (ptrdiff_t i = 0; i < size_line; ++i) { f[i] = i_in[offsets[static_cast<std::size_t>(i)]]; }
+      van_herck_1d(f,
+        scratch.g.data() + size_line_segment,
+        scratch.h_current.data() + size_line_segment,
+        size_line,
+        size_line_segment,
+        op);
+      for (ptrdiff_t i = 0; i < size_line; ++i) { o_out[offsets[static_cast<std::size_t>(i)]] = f[i]; }
+    }
+  });
+}
+
+/**
+ * @brief Erode/Dilate a ysize x xsize image by the periodic line {i*(dx,dy), |i|<=size_half}
+ *
+ * Chains start on pixels p such that p-(dx,dy) falls outside the image. Unit horizontal/vertical steps use the
+ * dedicated X/Y kernels.
+ */
+template<typename T, class BinOp>
+void t_ErodeDilatePeriodicLine(const T *i_in,
+  T *o_out,
+  ptrdiff_t ysize,
+  ptrdiff_t xsize,
+  ptrdiff_t dx,
+  ptrdiff_t dy,
+  ptrdiff_t size_half)
+{
+  POUTRE_CHECK(dx != 0 || dy != 0, "periodic line step must be != (0,0)");
+  if (xsize == 0 || ysize == 0) return;
+  if (size_half <= 0) {
+    std::memcpy(o_out, i_in, static_cast<std::size_t>(xsize * ysize) * sizeof(T));
+    return;
+  }
+  // SE is symmetric, walk chains with dy>0 or (dy==0 and dx>0)
+  if (dy < 0 || (dy == 0 && dx < 0)) {
+    dx = -dx;
+    dy = -dy;
+  }
+  using inView = poutre::details::av::array_view<const T, 2>;
+  using outView = poutre::details::av::array_view<T, 2>;
+  if ((dx == 1 && dy == 0) || (dx == 0 && dy == 1)) {
+    const inView vin(i_in, { ysize, xsize });
+    outView vout(o_out, { ysize, xsize });
+    if (dy == 0) {
+      t_ErodeDilateXOpLineDispatcher<T, T, 2, poutre::details::av::array_view, poutre::details::av::array_view, BinOp>
+        dispatcher;
+      dispatcher(vin, size_half, vout);
+    } else {
+      t_ErodeDilateYOpLineDispatcher<T, T, 2, poutre::details::av::array_view, poutre::details::av::array_view, BinOp>
+        dispatcher;
+      dispatcher(vin, size_half, vout);
+    }
+    return;
+  }
+  // chain starts, y-dy<0 or x-dx outside [0,xsize[
+  std::vector<ptrdiff_t> starts;
+  for (ptrdiff_t y = 0; y < ysize; ++y) {
+    if (y < dy) {
+      for (ptrdiff_t x = 0; x < xsize; ++x) { starts.push_back(y * xsize + x); }
+    } else {
+      const ptrdiff_t nb_border = std::min(std::abs(dx), xsize);
+      const ptrdiff_t x_begin = dx > 0 ? 0 : xsize - nb_border;
+      for (ptrdiff_t x = x_begin; x < x_begin + nb_border; ++x) { starts.push_back(y * xsize + x); }
+    }
+  }
+  const auto max_chain_size = static_cast<std::size_t>(
+    std::min(dy > 0 ? (ysize + dy - 1) / dy : xsize, dx != 0 ? (xsize + std::abs(dx) - 1) / std::abs(dx) : ysize));
+  t_ErodeDilateAlongChains(i_in,
+    o_out,
+    starts.size(),
+    max_chain_size,
+    size_half,
+    BinOp(),
+    [&](std::size_t chain, std::vector<ptrdiff_t> &offsets) {
+      ptrdiff_t y = starts[chain] / xsize;
+      ptrdiff_t x = starts[chain] % xsize;
+      for (; y < ysize && x >= 0 && x < xsize; y += dy, x += dx) { offsets.push_back(y * xsize + x); }
+    });
+}
+
+/**
+ * @brief Erode/Dilate a ysize x xsize image along Bresenham lines of direction angle (degrees, (cos,sin) in (x,y))
+ *
+ * Following Soille, Breen and Jones, the image is swept by translations of one Bresenham line along the minor axis,
+ * each pixel belonging to exactly one line. SE is 2*size_half+1 consecutive pixels of that line, so its digital shape
+ * may slightly change with the position along the line (phase of the discretisation).
+ */
+template<typename T, class BinOp>
+void t_ErodeDilateBresenhamLine(const T *i_in,
+  T *o_out,
+  ptrdiff_t ysize,
+  ptrdiff_t xsize,
+  double angle,
+  ptrdiff_t size_half)
+{
+  if (xsize == 0 || ysize == 0) return;
+  const double radian = angle * std::numbers::pi / 180.;
+  const double cosa = std::cos(radian);
+  const double sina = std::sin(radian);
+  // major axis has unit steps
+  const bool shallow = std::abs(cosa) >= std::abs(sina);
+  const ptrdiff_t major_size = shallow ? xsize : ysize;
+  const ptrdiff_t minor_size = shallow ? ysize : xsize;
+  const double slope = shallow ? sina / cosa : cosa / sina;
+  std::vector<ptrdiff_t> minor_offsets(static_cast<std::size_t>(major_size));
+  for (ptrdiff_t i = 0; i < major_size; ++i) {
+    minor_offsets[static_cast<std::size_t>(i)] = static_cast<ptrdiff_t>(std::lround(static_cast<double>(i) * slope));
+  }
+  if (std::all_of(minor_offsets.begin(), minor_offsets.end(), [](ptrdiff_t v) { return v == 0; })) {
+    t_ErodeDilatePeriodicLine<T, BinOp>(i_in, o_out, ysize, xsize, shallow ? 1 : 0, shallow ? 0 : 1, size_half);
+    return;
+  }
+  if (size_half <= 0) {
+    std::memcpy(o_out, i_in, static_cast<std::size_t>(xsize * ysize) * sizeof(T));
+    return;
+  }
+  const auto [min_offset, max_offset] = std::minmax_element(minor_offsets.begin(), minor_offsets.end());
+  // line c covers pixels (major=i, minor=c+minor_offsets[i])
+  const ptrdiff_t first_line = -*max_offset;
+  const ptrdiff_t last_line = minor_size - 1 - *min_offset;
+  t_ErodeDilateAlongChains(i_in,
+    o_out,
+    static_cast<std::size_t>(last_line - first_line + 1),
+    static_cast<std::size_t>(major_size),
+    size_half,
+    BinOp(),
+    [&](std::size_t chain, std::vector<ptrdiff_t> &offsets) {
+      const ptrdiff_t line = first_line + static_cast<ptrdiff_t>(chain);
+      for (ptrdiff_t i = 0; i < major_size; ++i) {
+        const ptrdiff_t minor = line + minor_offsets[static_cast<std::size_t>(i)];
+        if (minor < 0 || minor >= minor_size) continue;
+        offsets.push_back(shallow ? minor * xsize + i : i * xsize + minor);
+      }
+    });
+}
+/**@}*/
+
+template<typename TIn, typename TOut>
+void t_ErodePeriodicLine(const poutre::details::image_t<TIn, 2> &i_img,
+  ptrdiff_t dx,
+  ptrdiff_t dy,
+  ptrdiff_t size_half,
+  poutre::details::image_t<TOut, 2> &o_img)
+{
+  POUTRE_ENTERING("t_ErodePeriodicLine");
+  AssertSizesCompatible(i_img, o_img, "t_ErodePeriodicLine incompatible size");
+  AssertAsTypesCompatible(i_img, o_img, "t_ErodePeriodicLine incompatible types");
+  AssertImagesAreDifferent(i_img, o_img, "t_ErodePeriodicLine output must be != than input images");
   const auto shape = i_img.shape();
-  poutre::details::image_t<TOut, 2> tmp{ static_cast<std::size_t>(shape[0]), static_cast<std::size_t>(shape[1]) };
-  poutre::details::image_t<TOut, 2> tmp2{ static_cast<std::size_t>(shape[0]), static_cast<std::size_t>(shape[1]) };
-  poutre::details::t_transpose(i_img, tmp);
-  t_DilateX(tmp, size_segment, tmp2);
-  poutre::details::t_transpose(tmp2, o_img);
+  t_ErodeDilatePeriodicLine<TIn, BinOpInfLine<TIn>>(
+    i_img.data(), o_img.data(), shape[0], shape[1], dx, dy, size_half);
 }
 
 template<typename TIn, typename TOut>
-void t_ErodeY(const poutre::details::image_t<TIn, 2> &i_img,
-  ptrdiff_t size_segment,
+void t_DilatePeriodicLine(const poutre::details::image_t<TIn, 2> &i_img,
+  ptrdiff_t dx,
+  ptrdiff_t dy,
+  ptrdiff_t size_half,
   poutre::details::image_t<TOut, 2> &o_img)
 {
-  POUTRE_ENTERING("t_DilateY");
-  AssertSizesCompatible(i_img, o_img, "t_DilateY incompatible size");
-  AssertAsTypesCompatible(i_img, o_img, "t_DilateY incompatible types");
-  AssertImagesAreDifferent(i_img, o_img, "t_DilateY output must be != than input images");
+  POUTRE_ENTERING("t_DilatePeriodicLine");
+  AssertSizesCompatible(i_img, o_img, "t_DilatePeriodicLine incompatible size");
+  AssertAsTypesCompatible(i_img, o_img, "t_DilatePeriodicLine incompatible types");
+  AssertImagesAreDifferent(i_img, o_img, "t_DilatePeriodicLine output must be != than input images");
+  const auto shape = i_img.shape();
+  t_ErodeDilatePeriodicLine<TIn, BinOpSupLine<TIn>>(
+    i_img.data(), o_img.data(), shape[0], shape[1], dx, dy, size_half);
+}
+
+template<typename TIn, typename TOut>
+void t_ErodeLine(const poutre::details::image_t<TIn, 2> &i_img,
+  double angle,
+  ptrdiff_t size_half,
+  poutre::details::image_t<TOut, 2> &o_img)
+{
+  POUTRE_ENTERING("t_ErodeLine");
+  AssertSizesCompatible(i_img, o_img, "t_ErodeLine incompatible size");
+  AssertAsTypesCompatible(i_img, o_img, "t_ErodeLine incompatible types");
+  AssertImagesAreDifferent(i_img, o_img, "t_ErodeLine output must be != than input images");
+  const auto shape = i_img.shape();
+  t_ErodeDilateBresenhamLine<TIn, BinOpInfLine<TIn>>(i_img.data(), o_img.data(), shape[0], shape[1], angle, size_half);
+}
+
+template<typename TIn, typename TOut>
+void t_DilateLine(const poutre::details::image_t<TIn, 2> &i_img,
+  double angle,
+  ptrdiff_t size_half,
+  poutre::details::image_t<TOut, 2> &o_img)
+{
+  POUTRE_ENTERING("t_DilateLine");
+  AssertSizesCompatible(i_img, o_img, "t_DilateLine incompatible size");
+  AssertAsTypesCompatible(i_img, o_img, "t_DilateLine incompatible types");
+  AssertImagesAreDifferent(i_img, o_img, "t_DilateLine output must be != than input images");
   const auto shape = i_img.shape();
-  poutre::details::image_t<TOut, 2> tmp{ static_cast<std::size_t>(shape[0]), static_cast<std::size_t>(shape[1]) };
-  poutre::details::image_t<TOut, 2> tmp2{ static_cast<std::size_t>(shape[0]), static_cast<std::size_t>(shape[1]) };
-  poutre::details::t_transpose(i_img, tmp);
-  t_ErodeX(tmp, size_segment, tmp2);
-  poutre::details::t_transpose(tmp2, o_img);
+  t_ErodeDilateBresenhamLine<TIn, BinOpSupLine<TIn>>(i_img.data(), o_img.data(), shape[0], shape[1], angle, size_half);
 }
 
 //! @} doxygroup: poutre_llm_group
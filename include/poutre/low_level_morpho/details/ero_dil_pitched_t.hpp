@@ -0,0 +1,141 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   ero_dil_pitched_t.hpp
+ * @author Thomas Retornaz
+ * @brief  Erode dilate on halo padded images, without border handling
+ *
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/image_pitched_t.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/trace.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
+#include <poutre/structuring_element/details/neighbor_list_se_t.hpp>
+#include <poutre/structuring_element/details/neighbor_list_static_se_t.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+namespace poutre::llm::details {
+/**
+ * @addtogroup poutre_llm_group
+ *@{
+ */
+
+/**
+ * @brief Linear offsets of coordinates in the padded storage of i_img
+ *
+ * @throw if a neighbor goes beyond the halo of i_img
+ */
+template<typename T, ptrdiff_t Rank, class Range>
+std::vector<ptrdiff_t> t_PitchedOffsets(const poutre::details::image_pitched_t<T, Rank> &i_img,
+  const Range &coordinates)
+{
+  const auto stride = i_img.stride();
+  std::vector<ptrdiff_t> offsets;
+  for (const auto &coord : coordinates) {
+    ptrdiff_t offset = 0;
+    for (size_t dim = 0; dim < static_cast<size_t>(Rank); ++dim) {
+      POUTRE_CHECK(std::abs(coord[dim]) <= i_img.halo(), "SE extension must be <= halo of the pitched image");
+      offset += coord[dim] * stride[dim];
+    }
+    offsets.push_back(offset);
+  }
+  std::sort(offsets.begin(), offsets.end());
+  offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+  return offsets;
+}
+
+/**
+ * @brief Erode/dilate the valid region of io_img regarding offsets, put the result in o_img
+ *
+ * The halo of io_img is filled with @c BinOp::neutral, then each row is processed by
+ * @c t_ErodeDilatePitchedLine (ero_dil_runtime_nl_se_t.hpp), the valid region of io_img is left untouched.
+ */
+template<typename T1, typename T2, ptrdiff_t Rank, class BinOp>
+void t_ErodeDilatePitched(poutre::details::image_pitched_t<T1, Rank> &io_img,
+  const std::vector<ptrdiff_t> &offsets,
+  poutre::details::image_t<T2, Rank> &o_img)
+{
+  POUTRE_CHECK(io_img.shape() == o_img.shape(), "t_ErodeDilatePitched incompatible size");
+  if (o_img.size() == 0) { return; }
+  io_img.FillHalo(BinOp::neutral);
+
+  const ptrdiff_t xsize = io_img.shape()[static_cast<size_t>(Rank - 1)];
+  const auto nb_neighbors = static_cast<ptrdiff_t>(offsets.size());
+  const auto &c_img = io_img;
+  T2 *o_data = o_img.data();
+
+  // blocks of whole rows
+  const auto linesize = static_cast<std::size_t>(xsize);
+  poutre::ParallelForBlocks(o_img.size(), linesize, [&, linesize](std::size_t begin, std::size_t end) {
+    for (auto row = static_cast<ptrdiff_t>(begin / linesize); row < static_cast<ptrdiff_t>(end / linesize); ++row) {
+      t_ErodeDilatePitchedLine<T1, T2, BinOp>(
+        c_img.GetRow(row), o_data + row * xsize, xsize, offsets.data(), nb_neighbors);
+    }
+  });
+}
+
+//! Dilate io_img regarding nl (extension <= halo), fill the halo with the sup neutral element
+template<typename TIn, typename TOut, ptrdiff_t Rank>
+void t_Dilate(poutre::details::image_pitched_t<TIn, Rank> &io_img,
+  const poutre::se::details::neighbor_list_t<Rank> &nl,
+  poutre::details::image_t<TOut, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Dilate pitched");
+  using BinOp = BinOpSupRuntime<TIn, TOut>;
+  t_ErodeDilatePitched<TIn, TOut, Rank, BinOp>(io_img, t_PitchedOffsets(io_img, nl), o_img);
+}
+
+//! Erode io_img regarding nl (extension <= halo), fill the halo with the inf neutral element
+template<typename TIn, typename TOut, ptrdiff_t Rank>
+void t_Erode(poutre::details::image_pitched_t<TIn, Rank> &io_img,
+  const poutre::se::details::neighbor_list_t<Rank> &nl,
+  poutre::details::image_t<TOut, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Erode pitched");
+  using BinOp = BinOpInfRuntime<TIn, TOut>;
+  t_ErodeDilatePitched<TIn, TOut, Rank, BinOp>(io_img, t_PitchedOffsets(io_img, nl), o_img);
+}
+
+//! Dilate io_img regarding the static SE nl_static (extension <= halo)
+template<poutre::se::Common_NL_SE nl_static, typename TIn, typename TOut, ptrdiff_t Rank>
+void t_Dilate(poutre::details::image_pitched_t<TIn, Rank> &io_img, poutre::details::image_t<TOut, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Dilate pitched static");
+  using se_traits = poutre::se::details::static_se_traits<nl_static>;
+  static_assert(se_traits::rank == Rank, "SE and image rank mismatch");
+  using BinOp = BinOpSupRuntime<TIn, TOut>;
+  t_ErodeDilatePitched<TIn, TOut, Rank, BinOp>(io_img, t_PitchedOffsets(io_img, se_traits::coordinates), o_img);
+}
+
+//! Erode io_img regarding the static SE nl_static (extension <= halo)
+template<poutre::se::Common_NL_SE nl_static, typename TIn, typename TOut, ptrdiff_t Rank>
+void t_Erode(poutre::details::image_pitched_t<TIn, Rank> &io_img, poutre::details::image_t<TOut, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Erode pitched static");
+  using se_traits = poutre::se::details::static_se_traits<nl_static>;
+  static_assert(se_traits::rank == Rank, "SE and image rank mismatch");
+  using BinOp = BinOpInfRuntime<TIn, TOut>;
+  t_ErodeDilatePitched<TIn, TOut, Rank, BinOp>(io_img, t_PitchedOffsets(io_img, se_traits::coordinates), o_img);
+}
+
+//! @} doxygroup: poutre_llm_group
+}// namespace poutre::llm::details
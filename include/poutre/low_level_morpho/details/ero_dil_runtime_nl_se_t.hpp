@@ -17,12 +17,18 @@
  */
 
 #include <algorithm>
+#include <cstddef>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/simd/simd_algorithm.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/trace.hpp>
+#include <poutre/base/types_traits.hpp>
 #include <poutre/structuring_element/details/neighbor_list_se_t.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
+#include <type_traits>
+#include <vector>
 
 namespace poutre::llm::details {
 /**
@@ -33,15 +39,21 @@ namespace poutre::llm::details {
 template<typename T1, typename T2> struct BinOpInfRuntime
 {
 public:
+  using simd_type = typename TypeTraits<T1>::simd_type;
   static constexpr T1 neutral = std::numeric_limits<T1>::max();
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::Inf;
   static T2 process(const T1 &A0, const T1 &A1) { return static_cast<T2>(std::min<T1>(A0, A1)); }
+  static simd_type process(const simd_type &A0, const simd_type &A1) { return xs::min(A0, A1); }
 };
 
 template<typename T1, typename T2> struct BinOpSupRuntime
 {
 public:
+  using simd_type = typename TypeTraits<T1>::simd_type;
   static constexpr T1 neutral = std::numeric_limits<T1>::lowest();
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::Sup;
   static T2 process(const T1 &A0, const T1 &A1) { return static_cast<T2>(std::max<T1>(A0, A1)); }
+  static simd_type process(const simd_type &A0, const simd_type &A1) { return xs::max(A0, A1); }
 };
 
 //-----STRIDED VIEW OR Image_t generic with static SE
@@ -97,99 +109,177 @@ struct t_ErodeDilateDispatcherRuntime
 };
 
 
-// specialisation array_view 2d
-//----2D array_view/DenseImage<T,2>
+/**
+ * @brief Runtime neighbor list compiled against the strides of a contiguous view
+ *
+ * Neighbors are deduplicated and turned once into linear offsets, so that a pixel far enough from the borders is
+ * processed with one load per neighbor and no index arithmetic. Extents are kept per axis: a pixel is in the
+ * interior iff extent_before[d] <= coord[d] < size[d] - extent_after[d] for every axis d.
+ */
+template<ptrdiff_t Rank> struct compiled_neighbor_list_t
+{
+  using index_type = poutre::details::av::index<Rank>;
+
+  //! neighbor coordinates, duplicates removed
+  std::vector<index_type> coordinates;
+  //! linear offsets of coordinates, same order
+  std::vector<ptrdiff_t> offsets;
+  //! backward extension on each axis (>=0)
+  index_type extent_before = index_type(0);
+  //! forward extension on each axis (>=0)
+  index_type extent_after = index_type(0);
+
+  compiled_neighbor_list_t(const poutre::se::details::neighbor_list_t<Rank> &nl, const index_type &stride)
+    : coordinates(nl.begin(), nl.end())
+  {
+    std::sort(coordinates.begin(), coordinates.end());
+    coordinates.erase(std::unique(coordinates.begin(), coordinates.end()), coordinates.end());
+    offsets.reserve(coordinates.size());
+    for (const auto &coord : coordinates) {
+      ptrdiff_t offset = 0;
+      for (size_t dim = 0; dim < static_cast<size_t>(Rank); ++dim) {
+        offset += coord[dim] * stride[dim];
+        extent_before[dim] = std::max(extent_before[dim], -coord[dim]);
+        extent_after[dim] = std::max(extent_after[dim], coord[dim]);
+      }
+      offsets.push_back(offset);
+    }
+  }
+};
+
+/**
+ * @brief Erode/dilate xsize pixels of linein regarding offsets, put the result in lineout
+ *
+ * Every linein[x + offsets[k]] must be addressable, no bound check is done: one branch free loop, several pixels at
+ * once through unaligned loads shifted by each offset, then a scalar tail. Shared by the interior of contiguous
+ * images and by every row of halo padded ones. Same dispatched types run the kernel compiled for the best arch of the
+ * running CPU (@c simd::DispatchedNeighborLine).
+ */
 template<typename T1, typename T2, class BinOp>
-void t_ErodeDilateIterateBorderArrayView2DRuntimeHelper(const T1 *&i_vin,
-  const poutre::se::details::neighbor_list_t<2> &nl_runtime,
-  T2 *&o_vout,
-  scoord xsize,// NOLINT
-  scoord ysize,// NOLINT
-  scoord stride,
-  ptrdiff_t i_XCenter,
-  ptrdiff_t i_YCenter)
+void t_ErodeDilatePitchedLine(const T1 *linein,
+  T2 *lineout,
+  ptrdiff_t xsize,
+  const ptrdiff_t *offsets,
+  ptrdiff_t nb_neighbors)
 {
-  auto i_vinbeg = i_vin;
-  auto o_voutbeg = o_vout;
-  auto val = BinOp::neutral;
-  poutre::details::av::idx2d center{ i_YCenter, i_XCenter };
-  for (const auto &idxnl : nl_runtime) {
-    scoord const currentx = center[1] + idxnl[1];
-    scoord const currenty = center[0] + idxnl[0];
-    if (currentx < 0) { continue; }
-    if (currenty < 0) { continue; }
-    if (currentx >= xsize) { continue; }
-    if (currenty >= ysize) { continue; }
-    val = BinOp::process(val, i_vinbeg[(stride * currenty) + currentx]);
+  if constexpr (std::is_same_v<T1, T2> && simd::is_dispatched_type_v<T1>) {
+    simd::DispatchedNeighborLine(BinOp::dispatched_kernel, linein, lineout, xsize, offsets, nb_neighbors);
+    return;
+  }
+  ptrdiff_t x = 0;
+  if constexpr (std::is_same_v<T1, T2>) {
+    using simd_type = typename BinOp::simd_type;
+    constexpr auto simd_size = static_cast<ptrdiff_t>(simd_type::size);
+    for (; x + simd_size <= xsize; x += simd_size) {
+      simd_type val(BinOp::neutral);
+      for (ptrdiff_t k = 0; k < nb_neighbors; ++k) {
+        val = BinOp::process(val, simd_type::load_unaligned(linein + x + offsets[k]));
+      }
+      val.store_unaligned(lineout + x);
+    }
+  }
+  for (; x < xsize; ++x) {
+    auto val = BinOp::neutral;
+    for (ptrdiff_t k = 0; k < nb_neighbors; ++k) { val = BinOp::process(val, linein[x + offsets[k]]); }
+    lineout[x] = static_cast<T2>(val);
   }
-  o_voutbeg[(stride * i_YCenter) + i_XCenter] = static_cast<T2>(val);
 }
 
-template<typename T1, typename T2, class BinOp>
+/**
+ * @brief Process line @c row (last axis) of a contiguous view with a compiled neighbor list
+ *
+ * Border pixels check each neighbor against the bounds. Interior pixels go through @c t_ErodeDilatePitchedLine,
+ * branch free.
+ */
+template<typename T1, typename T2, ptrdiff_t Rank, class BinOp>
+void t_ErodeDilateRuntimeLine(const T1 *i_data,
+  T2 *o_data,
+  const poutre::details::av::index<Rank> &size,
+  const poutre::details::av::index<Rank> &stride,
+  const compiled_neighbor_list_t<Rank> &cnl,
+  ptrdiff_t row)
+{
+  constexpr auto last = static_cast<size_t>(Rank - 1);
+  const ptrdiff_t xsize = size[last];
+  poutre::details::av::index<Rank> coord(0);
+  ptrdiff_t row_offset = 0;
+  bool row_interior = true;
+  for (ptrdiff_t dim = Rank - 2, remaining = row; dim >= 0; --dim) {
+    const auto udim = static_cast<size_t>(dim);
+    coord[udim] = remaining % size[udim];
+    remaining /= size[udim];
+    row_offset += coord[udim] * stride[udim];
+    row_interior = row_interior && coord[udim] >= cnl.extent_before[udim]
+                   && coord[udim] < size[udim] - cnl.extent_after[udim];
+  }
+  const T1 *linein = i_data + row_offset;
+  T2 *lineout = o_data + row_offset;
+  const ptrdiff_t *offsets = cnl.offsets.data();
+  const auto nb_neighbors = static_cast<ptrdiff_t>(cnl.offsets.size());
+
+  auto border = [&](ptrdiff_t x) {
+    auto val = BinOp::neutral;
+    coord[last] = x;
+    for (ptrdiff_t k = 0; k < nb_neighbors; ++k) {
+      const auto &nb = cnl.coordinates[static_cast<size_t>(k)];
+      bool inside = true;
+      for (size_t dim = 0; dim < static_cast<size_t>(Rank); ++dim) {
+        const auto current = coord[dim] + nb[dim];
+        inside = inside && current >= 0 && current < size[dim];
+      }
+      if (inside) { val = BinOp::process(val, linein[x + offsets[k]]); }
+    }
+    lineout[x] = static_cast<T2>(val);
+  };
+
+  ptrdiff_t xbeg = std::min(cnl.extent_before[last], xsize);
+  ptrdiff_t xend = std::max(xsize - cnl.extent_after[last], xbeg);
+  if (!row_interior) { xbeg = xend = xsize; }
+  for (ptrdiff_t x = 0; x < xbeg; ++x) { border(x); }
+
+  t_ErodeDilatePitchedLine<T1, T2, BinOp>(linein + xbeg, lineout + xbeg, xend - xbeg, offsets, nb_neighbors);
+  for (ptrdiff_t x = xend; x < xsize; ++x) { border(x); }
+}
+
+// specialisation contiguous array_view/DenseImage<T,Rank>
+template<typename T1, typename T2, ptrdiff_t Rank, class BinOp>
 struct t_ErodeDilateDispatcherRuntime<T1,
   T2,
-  2,
+  Rank,
   poutre::details::av::array_view,
   poutre::details::av::array_view,
   BinOp>
 {
   // cppcheck-suppress constParameterReference
-  void operator()(const poutre::details::av::array_view<const T1, 2> &i_vin,
-    const poutre::se::details::neighbor_list_t<2> &nl_runtime,
-    const poutre::details::av::array_view<T2, 2> &o_vout)
+  void operator()(const poutre::details::av::array_view<const T1, Rank> &i_vin,
+    const poutre::se::details::neighbor_list_t<Rank> &nl_runtime,
+    const poutre::details::av::array_view<T2, Rank> &o_vout)
   {
     POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
     auto ibd = i_vin.bound();
     auto obd = o_vout.bound();
     auto istride = i_vin.stride();
     auto ostride = o_vout.stride();
-    scoord ysize = ibd[0];
-    scoord xsize = ibd[1];
-
     POUTRE_CHECK(ibd == obd, "bound not compatible");
     POUTRE_CHECK(istride == ostride, "stride not compatible");
-    auto [min_extension, max_extension] = nl_runtime.maximum_extension();
-    auto half_size = std::max(max_extension[0], max_extension[1]);// TODO REFINE THIS
-    auto i_vinbeg = i_vin.data();
-    auto o_voutbeg = o_vout.data();
-    // handling the upper lines
-    for (ptrdiff_t y = 0; y < half_size; ++y) {
-      for (ptrdiff_t x = 0; x < xsize; ++x) {
-        t_ErodeDilateIterateBorderArrayView2DRuntimeHelper<T1, T2, BinOp>(
-          i_vinbeg, nl_runtime, o_voutbeg, xsize, ysize, istride[0], x, y);
-      }
-    }
-    // handling the lower lines
-    for (ptrdiff_t y = ysize - half_size; y < ysize; ++y) {
-      for (ptrdiff_t x = 0; x < xsize; ++x) {
-        t_ErodeDilateIterateBorderArrayView2DRuntimeHelper<T1, T2, BinOp>(
-          i_vinbeg, nl_runtime, o_voutbeg, xsize, ysize, istride[0], x, y);
-      }
-    }
-    // Main lines area
-    for (ptrdiff_t y = half_size; y < ysize - half_size; ++y) {
-      // handling the first columns
-      for (ptrdiff_t x = 0; x < half_size; ++x) {
-        t_ErodeDilateIterateBorderArrayView2DRuntimeHelper<T1, T2, BinOp>(
-          i_vinbeg, nl_runtime, o_voutbeg, xsize, ysize, istride[0], x, y);
-      }
-      for (ptrdiff_t x = half_size; x < xsize - half_size; ++x) {
-        auto val = BinOp::neutral;
-        poutre::details::av::idx2d center{ y, x };
+    if (i_vin.size() == 0) { return; }
 
-        for (const auto &idxnl : nl_runtime) {
-          scoord const currentx = center[1] + idxnl[1];
-          scoord const currenty = center[0] + idxnl[0];
-          val = BinOp::process(val, i_vinbeg[(xsize * currenty) + currentx]);
+    poutre::details::av::index<Rank> size;
+    for (size_t dim = 0; dim < static_cast<size_t>(Rank); ++dim) { size[dim] = ibd[dim]; }
+    const compiled_neighbor_list_t<Rank> cnl(nl_runtime, istride);
+    const T1 *i_data = i_vin.data();
+    T2 *o_data = o_vout.data();
+
+    // blocks of whole lines along the last axis
+    const auto linesize = static_cast<std::size_t>(size[static_cast<size_t>(Rank - 1)]);
+    poutre::ParallelForBlocks(static_cast<std::size_t>(i_vin.size()),
+      linesize,
+      [&, linesize](std::size_t begin, std::size_t end) {
+        for (auto row = begin / linesize; row < end / linesize; ++row) {
+          t_ErodeDilateRuntimeLine<T1, T2, Rank, BinOp>(
+            i_data, o_data, size, istride, cnl, static_cast<ptrdiff_t>(row));
         }
-        o_voutbeg[(xsize * y) + x] = static_cast<T2>(val);
-      }
-      // handling the last columns
-      for (ptrdiff_t x = xsize - half_size; x < xsize; ++x) {
-        t_ErodeDilateIterateBorderArrayView2DRuntimeHelper<T1, T2, BinOp>(
-          i_vinbeg, nl_runtime, o_voutbeg, xsize, ysize, istride[0], x, y);
-      }
-    }
+      });
   }
 };
 
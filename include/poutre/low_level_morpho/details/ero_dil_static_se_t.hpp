@@ -22,6 +22,7 @@
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
 #include <poutre/base/details/simd/simd_algorithm.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/pixel_processing/details/arith_op_t.hpp>
 #include <poutre/pixel_processing/details/copy_convert_t.hpp>
@@ -372,6 +373,25 @@ struct t_ErodeDilateDispatcher<nl_static,
   }
 };
 
+/**
+ * @brief Split rows [0,ysize[ of a contiguous 2D image in horizontal strips and run func(ybeg,yend) on each strip
+ * through @c ExecutionContext
+ *
+ * Each strip reads a one-row halo from its neighbours in the input and writes only its own output rows,
+ * so strips can be processed concurrently. Small images are processed as one strip on the calling thread.
+ */
+template<class Func> void t_ErodeDilateRowStrips(scoord xsize, scoord ysize, Func &&func)
+{
+  if (xsize <= 0 || ysize <= 0) { return; }
+  const auto linesize = static_cast<std::size_t>(xsize);
+  // block boundaries are multiples of linesize -> whole rows
+  poutre::ParallelForBlocks(linesize * static_cast<std::size_t>(ysize),
+    linesize,
+    [&func, linesize](std::size_t begin, std::size_t end) {
+      func(static_cast<scoord>(begin / linesize), static_cast<scoord>(end / linesize));
+    });
+}
+
 template<typename TIn, typename TOut, class HelperOp>
 struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESquare2D,
   TIn,
@@ -381,21 +401,12 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESquare2D,
   poutre::details::av::array_view,
   HelperOp>
 {
-  void operator()(const poutre::details::av::array_view<const TIn, 2> &i_vin,
-    const poutre::details::av::array_view<TOut, 2> &o_vout) const
-  {
-    POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
-    auto ibd = i_vin.bound();
-    auto obd = o_vout.bound();// NOLINT
-    auto istride = i_vin.stride();
-    auto ostride = o_vout.stride();
-    scoord ysize = ibd[0];
-    scoord xsize = ibd[1];
-    POUTRE_CHECK(ibd == obd, "bound not compatible");
-    POUTRE_CHECK(istride == ostride, "stride not compatible");
-    using tmpBuffer = std::vector<TIn, xs::aligned_allocator<TIn, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
-    using lineView = TIn *__restrict;// array_view<TIn, 1>;
+  using tmpBuffer = std::vector<TIn, xs::aligned_allocator<TIn, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
+  using lineView = TIn *__restrict;// array_view<TIn, 1>;
 
+  // process output lines [ybeg,yend[, read input lines [ybeg-1,yend] clipped to image
+  static void ProcessStrip(const TIn *i_data, TOut *o_data, scoord xsize, scoord ysize, scoord ybeg, scoord yend)
+  {
     tmpBuffer tempLine(static_cast<std::size_t>(xsize));
     tmpBuffer tempLine1(static_cast<std::size_t>(xsize));
     tmpBuffer tempLine2(static_cast<std::size_t>(xsize));
@@ -404,159 +415,156 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESquare2D,
     lineView bufTempLine1(tempLine1.data());
     lineView bufTempLine2(tempLine2.data());
     lineView bufTempLine3(tempLine3.data());
-    lineView bufInputPreviousLine = nullptr;
-    // lineView bufInputCurrentLine=nullptr; // NOLINT used here after
-    lineView bufInputNextLine = nullptr;
     lineView bufOuputCurrentLine = nullptr;
 
     // quick run one line
     if (ysize == 1) {
-      bufInputPreviousLine = const_cast<TIn *>(i_vin.data());
-      bufOuputCurrentLine = o_vout.data();
-      // dilate/erode line 0
-      HelperOp::ShiftRightLeftAndArith(bufInputPreviousLine, xsize, 1, 1, bufTempLine, bufOuputCurrentLine);
+      HelperOp::ShiftRightLeftAndArith(i_data, xsize, 1, 1, bufTempLine, o_data);
       return;
     }
 
-    // compute first line
-    // translate to clipped connection
-    // x . x
-    // x x x
-    bufInputPreviousLine = const_cast<TIn *>(i_vin.data());
-    // dilate/erode line 0
-    HelperOp::ShiftRightLeftAndArith(bufInputPreviousLine, xsize, 1, 1, bufTempLine, bufTempLine1);
-
-    bufInputNextLine = const_cast<TIn *>(i_vin.data()) + xsize;
-    bufOuputCurrentLine = o_vout.data();
-    // dilate/erode line 1
-    HelperOp::ShiftRightLeftAndArith(bufInputNextLine, xsize, 1, 1, bufTempLine, bufTempLine2);
-
-    // sup(dilate line 1,dilate line 0) or inf(erode line 1,erode line 0)
-    HelperOp::ApplyArith(bufTempLine1, bufTempLine2, xsize, bufOuputCurrentLine);
-
-    // bufInputCurrentLine = bufInputNextLine;
-    // then loop
-    for (scoord y = 2; y < ysize; y++) {
-      // Invariant of the loop
-      // bufTempLine1 contains dilation/erosion of previous line Y-2
-      // bufTempLine2 contains dilation/erosion of current line Y-1
-      // bufTempLine3 contains dilation/erosion of next line ie Y
-
-      // actual computation
-      // 1 2 3   <--- bufInputPreviousLine y-2
-      // 4 5 6   <--- bufInputCurrentLine  y-1
-      // 7 8 9   <--- bufInputNextLine     y
-
-      bufOuputCurrentLine = o_vout.data() + ((y - 1) * xsize);
-      bufInputNextLine = const_cast<TIn *>(i_vin.data()) + ((y)*xsize);
-      // dilate/erode(y)
-      HelperOp::ShiftRightLeftAndArith(bufInputNextLine, xsize, 1, 1, bufTempLine, bufTempLine3);
-
-      // sup(dilate(y-2),dilate(y-1)) or inf(erode(y-2),erode(y-1))
-      HelperOp::ApplyArith(bufTempLine1, bufTempLine2, xsize, bufTempLine);
-      // sup(dilate(y-2),dilate(y-1),dilate(y)) or
-      // inf(erode(y-2),erode(y-1),erode(y))
-      HelperOp::ApplyArith(bufTempLine, bufTempLine3, xsize, bufOuputCurrentLine);
-
-      // so use swap to don't loose ref on bufTempLine3
-      std::swap(bufTempLine3, bufTempLine2);
-      std::swap(bufTempLine3, bufTempLine1);
+    // Invariant of the loop
+    // bufTempLine1 contains dilation/erosion of previous line Y-1 (if any)
+    // bufTempLine2 contains dilation/erosion of current line Y
+    // bufTempLine3 contains dilation/erosion of next line ie Y+1 (if any)
+    if (ybeg > 0) {
+      // halo from upper strip
+      HelperOp::ShiftRightLeftAndArith(i_data + ((ybeg - 1) * xsize), xsize, 1, 1, bufTempLine, bufTempLine1);
+    }
+    HelperOp::ShiftRightLeftAndArith(i_data + (ybeg * xsize), xsize, 1, 1, bufTempLine, bufTempLine2);
+
+    for (scoord y = ybeg; y < yend; y++) {
+      bufOuputCurrentLine = o_data + (y * xsize);
+      if (y == 0) {
+        // translate to clipped connection
+        // x . x
+        // x x x
+        HelperOp::ShiftRightLeftAndArith(i_data + xsize, xsize, 1, 1, bufTempLine, bufTempLine3);
+        HelperOp::ApplyArith(bufTempLine2, bufTempLine3, xsize, bufOuputCurrentLine);
+      } else if (y == ysize - 1) {
+        // translate to clipped connection
+        // x x x
+        // x . x
+        HelperOp::ApplyArith(bufTempLine1, bufTempLine2, xsize, bufOuputCurrentLine);
+      } else {
+        // 1 2 3   <--- y-1
+        // 4 5 6   <--- y
+        // 7 8 9   <--- y+1 (halo from lower strip on last line)
+        HelperOp::ShiftRightLeftAndArith(i_data + ((y + 1) * xsize), xsize, 1, 1, bufTempLine, bufTempLine3);
+        // sup(dilate(y-1),dilate(y)) or inf(erode(y-1),erode(y))
+        HelperOp::ApplyArith(bufTempLine1, bufTempLine2, xsize, bufTempLine);
+        // sup(dilate(y-1),dilate(y),dilate(y+1)) or
+        // inf(erode(y-1),erode(y),erode(y+1))
+        HelperOp::ApplyArith(bufTempLine, bufTempLine3, xsize, bufOuputCurrentLine);
+      }
+      // so use swap to don't loose ref on bufTempLine1
+      std::swap(bufTempLine1, bufTempLine2);
+      std::swap(bufTempLine2, bufTempLine3);
     }
-    // end last line
-    // translate to clipped connection
-    // x x x
-    // x . x
-    bufOuputCurrentLine = o_vout.data() + xsize * (ysize - 1);
-    HelperOp::ApplyArith(bufTempLine1, bufTempLine2, xsize, bufOuputCurrentLine);
   }
-};
 
-template<typename TIn, typename TOut, class HelperOp>
-struct t_ErodeDilateDispatcher<se::Common_NL_SE::SECross2D,
-  TIn,
-  TOut,
-  2,
-  poutre::details::av::array_view,
-  poutre::details::av::array_view,
-  HelperOp>
-{
   void operator()(const poutre::details::av::array_view<const TIn, 2> &i_vin,
     const poutre::details::av::array_view<TOut, 2> &o_vout) const
   {
     POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
     auto ibd = i_vin.bound();
-    auto obd = o_vout.bound();
+    auto obd = o_vout.bound();// NOLINT
     auto istride = i_vin.stride();
     auto ostride = o_vout.stride();
     scoord ysize = ibd[0];
     scoord xsize = ibd[1];
     POUTRE_CHECK(ibd == obd, "bound not compatible");
     POUTRE_CHECK(istride == ostride, "stride not compatible");
-    using tmpBuffer = std::vector<TIn, xs::aligned_allocator<TIn, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
-    // using lineView = array_view<TIn, 1>;
-    using lineView = TIn *__restrict;// array_view<TIn, 1>;
 
+    const TIn *i_data = i_vin.data();
+    TOut *o_data = o_vout.data();
+    t_ErodeDilateRowStrips(xsize, ysize, [=](scoord ybeg, scoord yend) {
+      ProcessStrip(i_data, o_data, xsize, ysize, ybeg, yend);
+    });
+  }
+};
+
+template<typename TIn, typename TOut, class HelperOp>
+struct t_ErodeDilateDispatcher<se::Common_NL_SE::SECross2D,
+  TIn,
+  TOut,
+  2,
+  poutre::details::av::array_view,
+  poutre::details::av::array_view,
+  HelperOp>
+{
+  using tmpBuffer = std::vector<TIn, xs::aligned_allocator<TIn, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
+  // using lineView = array_view<TIn, 1>;
+  using lineView = TIn *__restrict;// array_view<TIn, 1>;
+
+  // process output lines [ybeg,yend[, read input lines [ybeg-1,yend] clipped to image
+  static void ProcessStrip(const TIn *i_data, TOut *o_data, scoord xsize, scoord ysize, scoord ybeg, scoord yend)
+  {
     tmpBuffer tempLine(static_cast<std::size_t>(xsize));
     tmpBuffer tempLine2(static_cast<std::size_t>(xsize));
     lineView bufTempLine(tempLine.data());
     lineView bufTempLine2(tempLine2.data());
-    lineView bufInputPreviousLine = nullptr;
-    lineView bufInputCurrentLine = nullptr;
-    lineView bufInputNextLine = nullptr;
+    const TIn *bufInputPreviousLine = nullptr;
+    const TIn *bufInputCurrentLine = nullptr;
+    const TIn *bufInputNextLine = nullptr;
     lineView bufOuputCurrentLine = nullptr;
 
     // quick run one line
     if (ysize == 1) {
-      bufInputPreviousLine = const_cast<TIn *>(i_vin.data());
-      bufOuputCurrentLine = o_vout.data();
-      // dilate/erode line 0
-      HelperOp::ShiftRightLeftAndArith(bufInputPreviousLine, xsize, 1, 1, bufTempLine, bufOuputCurrentLine);
+      HelperOp::ShiftRightLeftAndArith(i_data, xsize, 1, 1, bufTempLine, o_data);
       return;
     }
 
-    // compute first line
-    // translate to clipped connection
-    // x . x
-    // ? x ?
-    bufInputPreviousLine = const_cast<TIn *>(i_vin.data());
-    // dilate/erode line 0
-    HelperOp::ShiftRightLeftAndArith(bufInputPreviousLine, xsize, 1, 1, bufTempLine, bufTempLine2);
-
-    bufInputNextLine = const_cast<TIn *>(i_vin.data()) + xsize;
-    bufOuputCurrentLine = o_vout.data();
-
-    // inf/sup between dilate line 0 and line 1
-    HelperOp::ApplyArith(bufTempLine2, bufInputNextLine, xsize, bufOuputCurrentLine);
-
-    // then loop
-    bufInputCurrentLine = bufInputNextLine;
-    for (scoord y = 2; y < ysize; y++) {
+    for (scoord y = ybeg; y < yend; y++) {
       // actual computation
-      // 1 2 3   <--- bufInputPreviousLine y-2
-      // 4 5 6   <--- bufInputCurrentLine  y-1
-      // 7 8 9   <--- bufInputNextLine     y
-      bufOuputCurrentLine = o_vout.data() + ((y - 1) * xsize);
-      bufInputNextLine = const_cast<TIn *>(i_vin.data()) + (y)*xsize;
-      // dilate(y-1)/erode(y-1)
+      // 1 2 3   <--- bufInputPreviousLine y-1
+      // 4 5 6   <--- bufInputCurrentLine  y
+      // 7 8 9   <--- bufInputNextLine     y+1
+      bufInputCurrentLine = i_data + (y * xsize);
+      bufOuputCurrentLine = o_data + (y * xsize);
+      // dilate(y)/erode(y)
       HelperOp::ShiftRightLeftAndArith(bufInputCurrentLine, xsize, 1, 1, bufTempLine, bufTempLine2);
-
-      // sup(y-2,dilate(y-1)),inf(y-2,erode(y-1))
-      HelperOp::ApplyArith(bufInputPreviousLine, bufTempLine2, xsize, bufTempLine);
-      // sup(sup(y-2,dilate(y-1),y) || inf(inf(y-2,erode(y-1),y)
-      HelperOp::ApplyArith(bufTempLine, bufInputNextLine, xsize, bufOuputCurrentLine);
-      // swap
-      bufInputPreviousLine = bufInputCurrentLine;// previous <--current
-      bufInputCurrentLine = bufInputNextLine;// current <-- next
+      if (y == 0) {
+        // translate to clipped connection
+        // x . x
+        // ? x ?
+        bufInputNextLine = bufInputCurrentLine + xsize;
+        HelperOp::ApplyArith(bufTempLine2, bufInputNextLine, xsize, bufOuputCurrentLine);
+      } else if (y == ysize - 1) {
+        // translate to clipped connection
+        //. x .
+        // x x x
+        bufInputPreviousLine = bufInputCurrentLine - xsize;
+        HelperOp::ApplyArith(bufInputPreviousLine, bufTempLine2, xsize, bufOuputCurrentLine);
+      } else {
+        bufInputPreviousLine = bufInputCurrentLine - xsize;
+        bufInputNextLine = bufInputCurrentLine + xsize;
+        // sup(y-1,dilate(y)),inf(y-1,erode(y))
+        HelperOp::ApplyArith(bufInputPreviousLine, bufTempLine2, xsize, bufTempLine);
+        // sup(sup(y-1,dilate(y),y+1) || inf(inf(y-1,erode(y),y+1)
+        HelperOp::ApplyArith(bufTempLine, bufInputNextLine, xsize, bufOuputCurrentLine);
+      }
     }
-    // end last line
-    // translate to clipped connection
-    //. x .
-    // x x x
-    // note that bufInputCurrentLine already point on ySize-1 (see above)
-    bufOuputCurrentLine = o_vout.data() + xsize * (ysize - 1);
-    // dilate/erode line y-1
-    HelperOp::ShiftRightLeftAndArith(bufInputCurrentLine, xsize, 1, 1, bufTempLine, bufTempLine2);
-    HelperOp::ApplyArith(bufInputPreviousLine, bufTempLine2, xsize, bufOuputCurrentLine);
+  }
+
+  void operator()(const poutre::details::av::array_view<const TIn, 2> &i_vin,
+    const poutre::details::av::array_view<TOut, 2> &o_vout) const
+  {
+    POUTRE_CHECK(i_vin.size() == o_vout.size(), "Incompatible views size");
+    auto ibd = i_vin.bound();
+    auto obd = o_vout.bound();
+    auto istride = i_vin.stride();
+    auto ostride = o_vout.stride();
+    scoord ysize = ibd[0];
+    scoord xsize = ibd[1];
+    POUTRE_CHECK(ibd == obd, "bound not compatible");
+    POUTRE_CHECK(istride == ostride, "stride not compatible");
+
+    const TIn *i_data = i_vin.data();
+    TOut *o_data = o_vout.data();
+    t_ErodeDilateRowStrips(xsize, ysize, [=](scoord ybeg, scoord yend) {
+      ProcessStrip(i_data, o_data, xsize, ysize, ybeg, yend);
+    });
   }
 };
 
@@ -569,6 +577,21 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESegmentX2D,
   poutre::details::av::array_view,
   HelperOp>
 {
+  using tmpBuffer = std::vector<TIn, xs::aligned_allocator<TIn, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
+  using lineView = TIn *__restrict;// array_view<TIn, 1>;
+
+  // process output lines [ybeg,yend[, no halo needed
+  static void ProcessStrip(const TIn *i_data, TOut *o_data, scoord xsize, scoord ybeg, scoord yend)
+  {
+    tmpBuffer tempLine(static_cast<std::size_t>(xsize));
+    lineView bufTempLine(tempLine.data());
+    for (scoord y = ybeg; y < yend; y++) {
+      const TIn *bufInputCurrentLine = i_data + (y * xsize);
+      lineView bufOuputCurrentLine = o_data + (y * xsize);
+      HelperOp::ShiftRightLeftAndArith(bufInputCurrentLine, xsize, 1, 1, bufTempLine, bufOuputCurrentLine);
+    }
+  }
+
   void operator()(const poutre::details::av::array_view<const TIn, 2> &i_vin,
     const poutre::details::av::array_view<TOut, 2> &o_vout) const
   {
@@ -581,12 +604,6 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESegmentX2D,
     scoord xsize = ibd[1];
     POUTRE_CHECK(ibd == obd, "bound not compatible");
     POUTRE_CHECK(istride == ostride, "stride not compatible");
-    using tmpBuffer = std::vector<TIn, xs::aligned_allocator<TIn, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
-    using lineView = TIn *__restrict;// array_view<TIn, 1>;
-
-    tmpBuffer tempLine(static_cast<std::size_t>(xsize));
-    lineView bufTempLine(tempLine.data());
-
 
     // quick exit one column
     if (xsize == 1) {
@@ -594,13 +611,10 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESegmentX2D,
       return;
     }
 
-    for (scoord y = 0; y < ysize; y++) {
-      lineView bufInputCurrentLine = nullptr;
-      lineView bufOuputCurrentLine = nullptr;
-      bufInputCurrentLine = const_cast<TIn *>(i_vin.data()) + y * xsize;
-      bufOuputCurrentLine = o_vout.data() + y * xsize;
-      HelperOp::ShiftRightLeftAndArith(bufInputCurrentLine, xsize, 1, 1, bufTempLine, bufOuputCurrentLine);
-    }
+    const TIn *i_data = i_vin.data();
+    TOut *o_data = o_vout.data();
+    t_ErodeDilateRowStrips(
+      xsize, ysize, [=](scoord ybeg, scoord yend) { ProcessStrip(i_data, o_data, xsize, ybeg, yend); });
   }
 };
 
@@ -613,6 +627,39 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESegmentY2D,
   poutre::details::av::array_view,
   HelperOp>
 {
+  using tmpBuffer = std::vector<TIn, xs::aligned_allocator<TIn, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
+  // using lineView = array_view<TIn, 1>;
+  using lineView = TIn *__restrict;
+
+  // process output lines [ybeg,yend[, read input lines [ybeg-1,yend] clipped to image
+  static void ProcessStrip(const TIn *i_data, TOut *o_data, scoord xsize, scoord ysize, scoord ybeg, scoord yend)
+  {
+    tmpBuffer tempLine(static_cast<std::size_t>(xsize));
+    lineView bufTempLine(tempLine.data());
+    for (scoord y = ybeg; y < yend; y++) {
+      // actual computation
+      // 1   <--- bufInputPreviousLine y-1
+      // 4   <--- bufInputCurrentLine  y
+      // 7   <--- bufInputNextLine     y+1
+      const TIn *bufInputCurrentLine = i_data + (xsize * y);
+      lineView bufOuputCurrentLine = o_data + (xsize * y);
+      if (y == 0) {
+        // translate to clipped connection
+        // ? . ?
+        // ? x ?
+        HelperOp::ApplyArith(bufInputCurrentLine, bufInputCurrentLine + xsize, xsize, bufOuputCurrentLine);
+      } else if (y == ysize - 1) {
+        // translate to clipped connection
+        //? x ?
+        //? . ?
+        HelperOp::ApplyArith(bufInputCurrentLine - xsize, bufInputCurrentLine, xsize, bufOuputCurrentLine);
+      } else {
+        HelperOp::ApplyArith(bufInputCurrentLine - xsize, bufInputCurrentLine, xsize, bufTempLine);
+        HelperOp::ApplyArith(bufTempLine, bufInputCurrentLine + xsize, xsize, bufOuputCurrentLine);
+      }
+    }
+  }
+
   void operator()(const poutre::details::av::array_view<const TIn, 2> &i_vin,
     const poutre::details::av::array_view<TOut, 2> &o_vout) const
   {
@@ -625,15 +672,6 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESegmentY2D,
     scoord xsize = ibd[1];
     POUTRE_CHECK(ibd == obd, "bound not compatible");
     POUTRE_CHECK(istride == ostride, "stride not compatible");
-    using tmpBuffer = std::vector<TIn, xs::aligned_allocator<TIn, SIMD_IDEAL_MAX_ALIGN_BYTES>>;
-    // using lineView = array_view<TIn, 1>;
-    using lineView = TIn *__restrict;
-    tmpBuffer tempLine(static_cast<std::size_t>(xsize));
-    lineView bufTempLine(tempLine.data());
-    lineView bufInputPreviousLine = nullptr;
-    lineView bufInputCurrentLine = nullptr;
-    lineView bufInputNextLine = nullptr;
-    lineView bufOuputCurrentLine = nullptr;
 
     // quick run one line
     if (ysize == 1) {
@@ -641,42 +679,11 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESegmentY2D,
       return;
     }
 
-    // compute first line
-    // translate to clipped connection
-    // ? . ?
-    // ? x ?
-    bufInputPreviousLine = const_cast<TIn *>(i_vin.data());
-    bufInputNextLine = const_cast<TIn *>(i_vin.data()) + xsize;
-    ;
-    bufOuputCurrentLine = o_vout.data();
-    // inf/sup between dilate line 0 and line 1
-    HelperOp::ApplyArith(bufInputPreviousLine, bufInputNextLine, xsize, bufOuputCurrentLine);
-
-    // then loop
-    bufInputCurrentLine = bufInputNextLine;
-    for (scoord y = 2; y < ysize; y++) {
-      // actual computation
-      // 1   <--- bufInputPreviousLine y-2
-      // 4   <--- bufInputCurrentLine  y-1
-      // 7   <--- bufInputNextLine     y
-      bufOuputCurrentLine = o_vout.data() + (xsize * (y - 1));
-
-      bufInputNextLine = const_cast<TIn *>(i_vin.data()) + (xsize * (y));
-      bufInputPreviousLine = const_cast<TIn *>(i_vin.data()) + (xsize * (y - 2));
-      bufInputCurrentLine = const_cast<TIn *>(i_vin.data()) + (xsize * (y - 1));
-
-      HelperOp::ApplyArith(bufInputPreviousLine, bufInputCurrentLine, xsize, bufTempLine);
-      HelperOp::ApplyArith(bufTempLine, bufInputNextLine, xsize, bufOuputCurrentLine);
-    }
-    // end last line
-    // translate to clipped connection
-    //? x ?
-    //? x ?
-    bufInputPreviousLine = const_cast<TIn *>(i_vin.data()) + (xsize * (ysize - 2));
-    // cppcheck-suppress redundantAssignment
-    bufInputCurrentLine = const_cast<TIn *>(i_vin.data()) + (xsize * (ysize - 1));
-    bufOuputCurrentLine = o_vout.data() + (xsize * (ysize - 1));
-    HelperOp::ApplyArith(bufInputPreviousLine, bufInputCurrentLine, xsize, bufOuputCurrentLine);
+    const TIn *i_data = i_vin.data();
+    TOut *o_data = o_vout.data();
+    t_ErodeDilateRowStrips(xsize, ysize, [=](scoord ybeg, scoord yend) {
+      ProcessStrip(i_data, o_data, xsize, ysize, ybeg, yend);
+    });
   }
 };
 
@@ -775,66 +782,38 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SESquare3D,
     auto obd = o_vout.bound();// NOLINT
     auto istride = i_vin.stride();
     auto ostride = o_vout.stride();
-    const auto xsize = static_cast<std::size_t>(ibd[0]);
+    // bound is {z,y,x}, slices are contiguous ysize x xsize planes
+    const auto zsize = static_cast<std::size_t>(ibd[0]);
     const auto ysize = static_cast<std::size_t>(ibd[1]);
-    const auto zsize = static_cast<std::size_t>(ibd[2]);
+    const auto xsize = static_cast<std::size_t>(ibd[2]);
     POUTRE_CHECK(ibd == obd, "bound not compatible");
     POUTRE_CHECK(istride == ostride, "stride not compatible");
+    if (zsize == 0) return;
 
     TIn *psrc = const_cast<TIn *>(i_vin.data());
     TOut *pdest = o_vout.data();
 
-    auto imtmp1 = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    auto imtmp2 = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    auto imtmp3 = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    auto imtmpL = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    auto imtmp = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    TIn *ppivot = nullptr;
-
-    TIn *ptmp1 = imtmp1.data();
-    TIn *ptmp2 = imtmp2.data();
-    TIn *ptmp3 = imtmp3.data();
-    TIn *ptmpL = imtmpL.data();
-
-    // first at boundary clip SE
-    t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, 0, ptmp1);
-    t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, 1, ptmp2);
-
-    HelperOp::EroDilOp2D(view(imtmp1), view(imtmp));
-    imtmp.swap(imtmp1);
-    HelperOp::EroDilOp2D(view(imtmp2), view(imtmp));
-    imtmp.swap(imtmp2);
-
-    HelperOp::ApplyArith(view(imtmp1), view(imtmp2), view(imtmpL));
-    // copy back slice to 3D
-    t_3DCopyOneSliceFrom2D(ptmpL, xsize, ysize, xsize, ysize, 0, pdest);
-
-    // main loop
-    for (std::size_t i = 2; i < zsize; i++) {
-      t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, i, ptmp3);
-
-      HelperOp::EroDilOp2D(view(imtmp3), view(imtmp));
-      imtmp.swap(imtmp3);
-
-      HelperOp::ApplyArith(view(imtmp1), view(imtmp2), view(imtmpL));
-      HelperOp::ApplyArith(view(imtmpL), view(imtmp3), view(imtmp));
-      imtmp.swap(imtmpL);
-
-      t_3DCopyOneSliceFrom2D(ptmpL, xsize, ysize, xsize, ysize, i - 1, pdest);
-
-      ppivot = ptmp1;
-      ptmp1 = ptmp2;
-      ptmp2 = ptmp3;
-      ptmp3 = ppivot;
-
-      imtmp = imtmp1;
-      imtmp1 = imtmp2;
-      imtmp2 = imtmp3;
-      imtmp3 = imtmp;
+    // 2D square of previous, current and next slices, rotated by swapping storages (data() follows the images)
+    auto imprev = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+    auto imcur = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+    auto imnext = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+    auto imslice = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+    auto imres = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+
+    t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, 0, imslice.data());
+    HelperOp::EroDilOp2D(view(imslice), view(imcur));
+    for (std::size_t i = 0; i < zsize; i++) {
+      imres = imcur;
+      if (i > 0) { HelperOp::ApplyArith(view(imres), view(imprev), view(imres)); }
+      if (i + 1 < zsize) {
+        t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, i + 1, imslice.data());
+        HelperOp::EroDilOp2D(view(imslice), view(imnext));
+        HelperOp::ApplyArith(view(imres), view(imnext), view(imres));
+      }
+      t_3DCopyOneSliceFrom2D(imres.data(), xsize, ysize, xsize, ysize, i, pdest);
+      imprev.swap(imcur);
+      imcur.swap(imnext);
     }
-    HelperOp::ApplyArith(view(imtmp1), view(imtmp2), view(imtmpL));
-
-    t_3DCopyOneSliceFrom2D(ptmpL, xsize, ysize, xsize, ysize, zsize - 1, pdest);
   }
 };
 
@@ -855,62 +834,36 @@ struct t_ErodeDilateDispatcher<se::Common_NL_SE::SECross3D,
     auto obd = o_vout.bound();// NOLINT
     auto istride = i_vin.stride();
     auto ostride = o_vout.stride();
-    const auto xsize = static_cast<std::size_t>(ibd[0]);
+    // bound is {z,y,x}, slices are contiguous ysize x xsize planes
+    const auto zsize = static_cast<std::size_t>(ibd[0]);
     const auto ysize = static_cast<std::size_t>(ibd[1]);
-    const auto zsize = static_cast<std::size_t>(ibd[2]);
+    const auto xsize = static_cast<std::size_t>(ibd[2]);
     POUTRE_CHECK(ibd == obd, "bound not compatible");
     POUTRE_CHECK(istride == ostride, "stride not compatible");
+    if (zsize == 0) return;
 
     TIn *psrc = const_cast<TIn *>(i_vin.data());
     TOut *pdest = o_vout.data();
 
-    auto imtmp1 = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    auto imtmp2 = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    auto imtmp3 = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    auto imtmpL = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    auto imtmp = poutre::details::image_t<TIn, 2>({ xsize, ysize });
-    TIn *ppivot = nullptr;
-
-    TIn *ptmp1 = imtmp1.data();
-    TIn *ptmp2 = imtmp2.data();
-    TIn *ptmp3 = imtmp3.data();
-    TIn *ptmpL = imtmpL.data();
-
-    t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, 0, ptmp1);
-    t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, 1, ptmp2);
-
-    HelperOp::EroDilOp2D(view(imtmp1), view(imtmpL));
-
-    HelperOp::ApplyArith(view(imtmpL), view(imtmp2), view(imtmp));
-    imtmp.swap(imtmpL);
-
-    t_3DCopyOneSliceFrom2D(ptmpL, xsize, ysize, xsize, ysize, 0, pdest);
-
-    for (std::size_t i = 2; i < zsize; i++) {
-      t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, i, ptmp3);
-
-      HelperOp::EroDilOp2D(view(imtmp2), view(imtmpL));
-
-      HelperOp::ApplyArith(view(imtmpL), view(imtmp1), view(imtmpL));
-      HelperOp::ApplyArith(view(imtmpL), view(imtmp3), view(imtmp));
-      imtmp.swap(imtmpL);
-
-      t_3DCopyOneSliceFrom2D(ptmpL, xsize, ysize, xsize, ysize, i - 1, pdest);
-
-      ppivot = ptmp1;
-      ptmp1 = ptmp2;
-      ptmp2 = ptmp3;
-      ptmp3 = ppivot;
-
-      imtmp = imtmp1;
-      imtmp1 = imtmp2;
-      imtmp2 = imtmp3;
-      imtmp3 = imtmp;
+    // previous, current and next slices, rotated by swapping storages (data() follows the images)
+    auto imprev = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+    auto imcur = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+    auto imnext = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+    auto imres = poutre::details::image_t<TIn, 2>({ ysize, xsize });
+
+    t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, 0, imcur.data());
+    for (std::size_t i = 0; i < zsize; i++) {
+      // 2D cross in the slice, then inf/sup with the slices above and below
+      HelperOp::EroDilOp2D(view(imcur), view(imres));
+      if (i > 0) { HelperOp::ApplyArith(view(imres), view(imprev), view(imres)); }
+      if (i + 1 < zsize) {
+        t_3DCopyOneSliceTo2D(psrc, xsize, ysize, xsize, ysize, i + 1, imnext.data());
+        HelperOp::ApplyArith(view(imres), view(imnext), view(imres));
+      }
+      t_3DCopyOneSliceFrom2D(imres.data(), xsize, ysize, xsize, ysize, i, pdest);
+      imprev.swap(imcur);
+      imcur.swap(imnext);
     }
-    HelperOp::EroDilOp2D(view(imtmp2), view(imtmpL));
-    HelperOp::ApplyArith(view(imtmpL), view(imtmp1), view(imtmpL));
-
-    t_3DCopyOneSliceFrom2D(ptmpL, xsize, ysize, xsize, ysize, zsize - 1, pdest);
   }
 };
 
@@ -0,0 +1,213 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   ero_dil_tiled_t.hpp
+ * @author Thomas Retornaz
+ * @brief  Erode dilate on tiled images, tile by tile
+ *
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/image_pitched_t.hpp>
+#include <poutre/base/details/data_structures/image_tiled_t.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/trace.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_pitched_t.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
+#include <poutre/structuring_element/details/neighbor_list_se_t.hpp>
+#include <poutre/structuring_element/details/neighbor_list_static_se_t.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <vector>
+
+namespace poutre::llm::details {
+/**
+ * @addtogroup poutre_llm_group
+ *@{
+ */
+
+/**
+ * @brief Erode/dilate i_img regarding coordinates, put the result in o_img (same shape and tile edge)
+ *
+ * Tiles are processed independently (in parallel): each one is gathered with a halo of the SE extension in a pitched
+ * scratch (pixels outside the image read as @c BinOp::neutral), then each scratch row goes through
+ * @c t_ErodeDilatePitchedLine. Whatever the axis of the SE, all reads stay in the scratch.
+ */
+template<typename T, ptrdiff_t Rank, class BinOp, class Range>
+void t_ErodeDilateTiled(const poutre::details::image_tiled_t<T, Rank> &i_img,
+  const Range &coordinates,
+  poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  POUTRE_CHECK(i_img.shape() == o_img.shape(), "t_ErodeDilateTiled incompatible size");
+  POUTRE_CHECK(i_img.tile_edge() == o_img.tile_edge(), "t_ErodeDilateTiled incompatible tiles");
+  POUTRE_CHECK(&i_img != &o_img, "t_ErodeDilateTiled output must be != than input images");
+  if (i_img.size() == 0) { return; }
+
+  ptrdiff_t halo = 0;
+  for (const auto &coord : coordinates) {
+    for (size_t dim = 0; dim < static_cast<size_t>(Rank); ++dim) { halo = std::max(halo, std::abs(coord[dim])); }
+  }
+  const ptrdiff_t edge = i_img.tile_edge();
+  const auto tile_dims = std::vector<size_t>(static_cast<size_t>(Rank), static_cast<size_t>(edge));
+  std::vector<poutre::details::av::index<Rank>> tiles;
+  tiles.reserve(i_img.nb_tiles());
+  for (const auto &tile : i_img.grid()) { tiles.push_back(tile); }
+
+  // blocks of whole tiles
+  const auto tilesize = static_cast<std::size_t>(i_img.tile_size());
+  poutre::ParallelForBlocks(tiles.size() * tilesize, tilesize, [&, tilesize](std::size_t begin, std::size_t end) {
+    poutre::details::image_pitched_t<T, Rank> scratch(tile_dims, halo);
+    const auto offsets = t_PitchedOffsets(scratch, coordinates);
+    const auto stride = scratch.stride();
+    // first pixel of the halo
+    ptrdiff_t halo_origin = 0;
+    for (size_t dim = 0; dim < static_cast<size_t>(Rank); ++dim) { halo_origin -= halo * stride[dim]; }
+
+    for (auto itile = begin / tilesize; itile < end / tilesize; ++itile) {
+      const auto &tile = tiles[itile];
+      i_img.ReadTileWithHalo(tile, halo, scratch.data() + halo_origin, stride, BinOp::neutral);
+      T *out = o_img.GetTile(tile);
+      const auto &c_scratch = scratch;
+      for (ptrdiff_t row = 0; row < scratch.nb_rows(); ++row) {
+        t_ErodeDilatePitchedLine<T, T, BinOp>(
+          c_scratch.GetRow(row), out + row * edge, edge, offsets.data(), static_cast<ptrdiff_t>(offsets.size()));
+      }
+    }
+  });
+}
+
+//! Dilate i_img regarding nl, put the result in o_img (same shape and tile edge)
+template<typename T, ptrdiff_t Rank>
+void t_Dilate(const poutre::details::image_tiled_t<T, Rank> &i_img,
+  const poutre::se::details::neighbor_list_t<Rank> &nl,
+  poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Dilate tiled");
+  t_ErodeDilateTiled<T, Rank, BinOpSupRuntime<T, T>>(i_img, nl, o_img);
+}
+
+//! Erode i_img regarding nl, put the result in o_img (same shape and tile edge)
+template<typename T, ptrdiff_t Rank>
+void t_Erode(const poutre::details::image_tiled_t<T, Rank> &i_img,
+  const poutre::se::details::neighbor_list_t<Rank> &nl,
+  poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Erode tiled");
+  t_ErodeDilateTiled<T, Rank, BinOpInfRuntime<T, T>>(i_img, nl, o_img);
+}
+
+//! Dilate i_img regarding the static SE nl_static, put the result in o_img (same shape and tile edge)
+template<poutre::se::Common_NL_SE nl_static, typename T, ptrdiff_t Rank>
+void t_Dilate(const poutre::details::image_tiled_t<T, Rank> &i_img, poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Dilate tiled static");
+  using se_traits = poutre::se::details::static_se_traits<nl_static>;
+  static_assert(se_traits::rank == Rank, "SE and image rank mismatch");
+  t_ErodeDilateTiled<T, Rank, BinOpSupRuntime<T, T>>(i_img, se_traits::coordinates, o_img);
+}
+
+//! Erode i_img regarding the static SE nl_static, put the result in o_img (same shape and tile edge)
+template<poutre::se::Common_NL_SE nl_static, typename T, ptrdiff_t Rank>
+void t_Erode(const poutre::details::image_tiled_t<T, Rank> &i_img, poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  POUTRE_ENTERING("t_Erode tiled static");
+  using se_traits = poutre::se::details::static_se_traits<nl_static>;
+  static_assert(se_traits::rank == Rank, "SE and image rank mismatch");
+  t_ErodeDilateTiled<T, Rank, BinOpInfRuntime<T, T>>(i_img, se_traits::coordinates, o_img);
+}
+
+//! static SE dispatch of t_Erode/t_Dilate on tiled images
+template<bool IsErosion, poutre::se::Common_NL_SE nl_static, typename T, ptrdiff_t Rank>
+void t_ErodeDilateTiledStatic(const poutre::details::image_tiled_t<T, Rank> &i_img,
+  poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  if constexpr (IsErosion) {
+    t_Erode<nl_static>(i_img, o_img);
+  } else {
+    t_Dilate<nl_static>(i_img, o_img);
+  }
+}
+
+//! Erode (IsErosion) or dilate i_img regarding the runtime static SE nl_static, put the result in o_img
+template<bool IsErosion, typename T, ptrdiff_t Rank>
+void t_ErodeDilateTiledDispatch(const poutre::details::image_tiled_t<T, Rank> &i_img,
+  const poutre::se::Common_NL_SE nl_static,
+  poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  if constexpr (Rank == 2) {
+    switch (nl_static) {
+    case poutre::se::Common_NL_SE::SESegmentX2D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SESegmentX2D>(i_img, o_img);
+    } break;
+    case poutre::se::Common_NL_SE::SESegmentY2D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SESegmentY2D>(i_img, o_img);
+    } break;
+    case poutre::se::Common_NL_SE::SESquare2D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SESquare2D>(i_img, o_img);
+    } break;
+    case poutre::se::Common_NL_SE::SECross2D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SECross2D>(i_img, o_img);
+    } break;
+    default: {
+      POUTRE_RUNTIME_ERROR("t_ErodeDilateTiledDispatch unsupported nl_static");
+    }
+    }
+  } else if constexpr (Rank == 3) {
+    switch (nl_static) {
+    case poutre::se::Common_NL_SE::SECross3D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SECross3D>(i_img, o_img);
+    } break;
+    case poutre::se::Common_NL_SE::SESquare3D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SESquare3D>(i_img, o_img);
+    } break;
+    case poutre::se::Common_NL_SE::SESegmentX3D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SESegmentX3D>(i_img, o_img);
+    } break;
+    case poutre::se::Common_NL_SE::SESegmentY3D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SESegmentY3D>(i_img, o_img);
+    } break;
+    case poutre::se::Common_NL_SE::SESegmentZ3D: {
+      t_ErodeDilateTiledStatic<IsErosion, poutre::se::Common_NL_SE::SESegmentZ3D>(i_img, o_img);
+    } break;
+    default: {
+      POUTRE_RUNTIME_ERROR("t_ErodeDilateTiledDispatch unsupported nl_static");
+    }
+    }
+  } else {
+    POUTRE_RUNTIME_ERROR("t_ErodeDilateTiledDispatch unsupported rank");
+  }
+}
+
+//! Dilate i_img regarding the runtime static SE nl_static, put the result in o_img (same shape and tile edge)
+template<typename T, ptrdiff_t Rank>
+void t_Dilate(const poutre::details::image_tiled_t<T, Rank> &i_img,
+  const poutre::se::Common_NL_SE nl_static,
+  poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  t_ErodeDilateTiledDispatch<false>(i_img, nl_static, o_img);
+}
+
+//! Erode i_img regarding the runtime static SE nl_static, put the result in o_img (same shape and tile edge)
+template<typename T, ptrdiff_t Rank>
+void t_Erode(const poutre::details::image_tiled_t<T, Rank> &i_img,
+  const poutre::se::Common_NL_SE nl_static,
+  poutre::details::image_tiled_t<T, Rank> &o_img)
+{
+  t_ErodeDilateTiledDispatch<true>(i_img, nl_static, o_img);
+}
+
+//! @} doxygroup: poutre_llm_group
+}// namespace poutre::llm::details
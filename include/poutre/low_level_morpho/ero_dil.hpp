@@ -28,10 +28,14 @@ namespace poutre {
  *@{
  */
 
-//! Erode iter times i_img regarding the nl_static SE, put the result in o_img
+/*!@brief Erode iter times i_img regarding the nl_static SE, put the result in o_img
+ * @note large SESquare2D iterations are computed as a (2*iter+1) rectangle, see @c ErodeRect
+ */
 LLM_API void Erode(const IInterface &i_img, se::Common_NL_SE nl_static, const int iter, IInterface &o_img);
 
-//! Dilate iter times i_img regarding the nl_static SE, put the result in o_img
+/*!@brief Dilate iter times i_img regarding the nl_static SE, put the result in o_img
+ * @note large SESquare2D iterations are computed as a (2*iter+1) rectangle, see @c DilateRect
+ */
 LLM_API void Dilate(const IInterface &i_img, se::Common_NL_SE nl_static, const int iter, IInterface &o_img);
 
 //! Erode i_img regarding the compound SE, put the result in o_img
@@ -40,10 +44,16 @@ LLM_API void Erode(const IInterface &i_img, se::Compound_NL_SE nl_compound, cons
 //! Dilate i_img regarding the compound SE, put the result in o_img
 LLM_API void Dilate(const IInterface &i_img, se::Compound_NL_SE nl_compound, const int size, IInterface &o_img);
 
-//! Erode i_img regarding the SE, put the result in o_img
+/*!@brief Erode i_img regarding the SE, put the result in o_img
+ * @note 2D neighbor lists run through their cached decomposition plan (see @c se::GetDecompositionPlan) when it is
+ * cheaper, a @c se::ChainedStructuringElement is applied element after element
+ */
 LLM_API void Erode(const IInterface &i_img, const se::IStructuringElement& str_el, IInterface &o_img);
 
-//! Dilate i_img regarding the SE, put the result in o_img
+/*!@brief Dilate i_img regarding the SE, put the result in o_img
+ * @note 2D neighbor lists run through their cached decomposition plan (see @c se::GetDecompositionPlan) when it is
+ * cheaper, a @c se::ChainedStructuringElement is applied element after element
+ */
 LLM_API void Dilate(const IInterface &i_img, const se::IStructuringElement& str_el, IInterface &o_img);
 
 //! @} doxygroup: image_processing_llm_group
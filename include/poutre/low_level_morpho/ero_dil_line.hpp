@@ -46,6 +46,55 @@ LLM_API void ErodeY(const IInterface &i_img, const ptrdiff_t size_half_segment,
  */
 LLM_API void DilateY(const IInterface &i_img, const ptrdiff_t size_half_segment, IInterface &o_img);
 
+/*!@brief Erode i_img regarding a (2*size_half_x+1)x(2*size_half_y+1) rectangle SE, put the result in o_img
+ * Rectangle is decomposed in a line along X followed by a line along Y, so cost doesn't depend on SE size
+ * @warning 1D (size_half_y must be 0) and 2D only
+ */
+LLM_API void
+  ErodeRect(const IInterface &i_img, const ptrdiff_t size_half_x, const ptrdiff_t size_half_y, IInterface &o_img);
+
+/*!@brief Dilate i_img regarding a (2*size_half_x+1)x(2*size_half_y+1) rectangle SE, put the result in o_img
+ * Rectangle is decomposed in a line along X followed by a line along Y, so cost doesn't depend on SE size
+ * @warning 1D (size_half_y must be 0) and 2D only
+ */
+LLM_API void
+  DilateRect(const IInterface &i_img, const ptrdiff_t size_half_x, const ptrdiff_t size_half_y, IInterface &o_img);
+
 
 //! @} doxygroup: image_processing_llm_group
+/*!@brief Erode i_img regarding a discrete line segment of 2*size_half_segment+1 pixels with direction angle, put the
+ * result in o_img
+ * @param angle degrees, direction is (cos(angle),sin(angle)) in (x,y) image coordinates
+ * @note Bresenham lines swept over the image (Soille-Breen-Jones), cost doesn't depend on segment size
+ * @warning 2D only
+ */
+LLM_API void
+  ErodeLine(const IInterface &i_img, const double angle, const ptrdiff_t size_half_segment, IInterface &o_img);
+
+/*!@brief Dilate i_img regarding a discrete line segment of 2*size_half_segment+1 pixels with direction angle, put the
+ * result in o_img
+ * @param angle degrees, direction is (cos(angle),sin(angle)) in (x,y) image coordinates
+ * @note Bresenham lines swept over the image (Soille-Breen-Jones), cost doesn't depend on segment size
+ * @warning 2D only
+ */
+LLM_API void
+  DilateLine(const IInterface &i_img, const double angle, const ptrdiff_t size_half_segment, IInterface &o_img);
+
+/*!@brief Erode i_img regarding the periodic line {i*(dx,dy), |i|<=size_half}, put the result in o_img
+ * @warning 2D only
+ */
+LLM_API void ErodePeriodicLine(const IInterface &i_img,
+  const ptrdiff_t dx,
+  const ptrdiff_t dy,
+  const ptrdiff_t size_half,
+  IInterface &o_img);
+
+/*!@brief Dilate i_img regarding the periodic line {i*(dx,dy), |i|<=size_half}, put the result in o_img
+ * @warning 2D only
+ */
+LLM_API void DilatePeriodicLine(const IInterface &i_img,
+  const ptrdiff_t dx,
+  const ptrdiff_t dy,
+  const ptrdiff_t size_half,
+  IInterface &o_img);
 }// namespace poutre
\ No newline at end of file
@@ -30,8 +30,9 @@ namespace poutre {
 //! Deep clone of provided image
 PP_API std::unique_ptr<IInterface> Clone(const IInterface &i_img1);
 
-//! Clone of provided image but no data copied
-PP_API std::unique_ptr<IInterface> CloneGeometry(const IInterface &i_img1);
+//! Clone of provided image but no data copied, zero filled unless @c AllocationMode::Uninitialized
+PP_API std::unique_ptr<IInterface> CloneGeometry(const IInterface &i_img1,
+  AllocationMode mode = AllocationMode::Zeroed);
 
 //! Convert the provided image: using same geometries  but with different @c  CompoundType and @c
 //! PType, data is copied via hard casting
@@ -39,11 +40,15 @@ PP_API std::unique_ptr<IInterface> Convert(const IInterface &i_img1, CompoundTyp
 
 //! Convert the provided image: using same geometries  but with different @c  CompoundType and @c
 //! PType, no data is copied
-PP_API std::unique_ptr<IInterface> ConvertGeometry(const IInterface &i_img1, CompoundType ctype, PType ptype);
+PP_API std::unique_ptr<IInterface> ConvertGeometry(const IInterface &i_img1,
+  CompoundType ctype,
+  PType ptype,
+  AllocationMode mode = AllocationMode::Zeroed);
 
 //! Create a clone of provided image using same geometries but with different  @c PType, no data
 //! is copied
-PP_API std::unique_ptr<IInterface> ConvertGeometry(const IInterface &i_img1, PType ptype);
+PP_API std::unique_ptr<IInterface>
+  ConvertGeometry(const IInterface &i_img1, PType ptype, AllocationMode mode = AllocationMode::Zeroed);
 
 //! Copy i_img1 in o_img, images must have the same type
 PP_API void CopyInto(const IInterface &i_img, IInterface &o_img);
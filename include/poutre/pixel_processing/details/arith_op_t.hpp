@@ -50,8 +50,12 @@ struct op_Invert<T1,
   std::enable_if_t<std::is_same_v<std::remove_const_t<T1>, std::remove_const_t<T2>> && std::is_arithmetic_v<T1>>>
 {
 public:
+  static constexpr auto dispatched_kernel = simd::DispatchedUnaryKernel::Invert;
   op_Invert() = default;
 
+  //! no constant operand
+  [[nodiscard]] std::remove_const_t<T1> dispatched_value() const POUTRE_NOEXCEPT { return {}; }
+
   POUTRE_ALWAYS_INLINE T1 operator()(T1 const &a0) const POUTRE_NOEXCEPT { return -a0; }
 
   template<typename U> POUTRE_ALWAYS_INLINE U operator()(U const &a0) const POUTRE_NOEXCEPT { return -a0; }
@@ -109,6 +113,7 @@ private:
   using accutype = typename TypeTraits<T1>::accu_type;
 
 public:
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::SaturatedSub;
   op_Saturated_Sub() : m_minval(TypeTraits<T1>::min()) {}
 
   POUTRE_ALWAYS_INLINE T1 operator()(T1 const &a0, T1 const &a1) const POUTRE_NOEXCEPT
@@ -176,6 +181,7 @@ private:
   using accutype = typename TypeTraits<T1>::accu_type;
 
 public:
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::SaturatedAdd;
   op_Saturated_Add() : m_maxval(TypeTraits<T1>::max()) {}
   POUTRE_ALWAYS_INLINE T1 operator()(T1 const &a0, T1 const &a1) const POUTRE_NOEXCEPT
   {
@@ -242,7 +248,9 @@ private:
   using accutype = typename TypeTraits<T1>::accu_type;
 
 public:
+  static constexpr auto dispatched_kernel = simd::DispatchedUnaryKernel::SaturatedAddConstant;
   explicit op_Saturated_Add_Constant(T1 val) : m_val(val), m_maxval(TypeTraits<T1>::max()), m_simd_val(val) {}
+  [[nodiscard]] std::remove_const_t<T1> dispatched_value() const POUTRE_NOEXCEPT { return m_val; }
   POUTRE_ALWAYS_INLINE T1 operator()(T1 const &a0) const POUTRE_NOEXCEPT
   {
     accutype res = static_cast<accutype>(m_val) + static_cast<accutype>(a0);
@@ -305,7 +313,9 @@ private:
   using accutype = typename TypeTraits<T1>::accu_type;
 
 public:
+  static constexpr auto dispatched_kernel = simd::DispatchedUnaryKernel::SaturatedSubConstant;
   explicit op_Saturated_Sub_Constant(T1 val) : m_val(val), m_minval(TypeTraits<T1>::min()), m_simd_val(val) {}
+  [[nodiscard]] std::remove_const_t<T1> dispatched_value() const POUTRE_NOEXCEPT { return m_val; }
 
   POUTRE_ALWAYS_INLINE T1 operator()(T1 const &a0) const POUTRE_NOEXCEPT
   {
@@ -359,6 +369,7 @@ struct op_Sup<T1,
                    && std::is_same_v<std::remove_const_t<T1>, std::remove_const_t<T3>> && std::is_arithmetic_v<T1>>>
 {
 public:
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::Sup;
   op_Sup() = default;
   POUTRE_ALWAYS_INLINE T3 operator()(T1 const &a0, T2 const &a1) const POUTRE_NOEXCEPT { return (a0 > a1 ? a0 : a1); }
   template<typename U> POUTRE_ALWAYS_INLINE U operator()(U const &a0, U const &a1) const POUTRE_NOEXCEPT
@@ -409,6 +420,7 @@ struct op_Inf<T1,
                    && std::is_same_v<std::remove_const_t<T1>, std::remove_const_t<T3>> && std::is_arithmetic_v<T1>>>
 {
 public:
+  static constexpr auto dispatched_kernel = simd::DispatchedBinaryKernel::Inf;
   op_Inf() = default;
 
   POUTRE_ALWAYS_INLINE T3 operator()(T1 const &a0, T2 const &a1) const POUTRE_NOEXCEPT { return (a0 < a1 ? a0 : a1); }
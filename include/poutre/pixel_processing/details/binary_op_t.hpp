@@ -22,6 +22,7 @@
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/simd/simd_algorithm.hpp>//simd transform
+#include <poutre/base/execution.hpp>
 #include <poutre/base/trace.hpp>
 
 #include <algorithm>//transform
@@ -115,11 +116,13 @@ struct PixelWiseBinaryOpDispatcher<T1,
     POUTRE_ASSERTCHECK(i_vin1.size() == i_vin2.size(), "Incompatible views size");
     POUTRE_ASSERTCHECK(o_vout.size() == i_vin2.size(), "Incompatible views size");
     auto i_vinbeg1 = i_vin1.data();
-    auto i_vinend1 = i_vin1.data() + i_vin1.size();
     auto i_vinbeg2 = i_vin2.data();
     auto o_voutbeg = o_vout.data();
 
-    std::transform(i_vinbeg1, i_vinend1, i_vinbeg2, o_voutbeg, op);
+    ParallelForBlocks(
+      static_cast<std::size_t>(i_vin1.size()), simd::t_AlignedBlockStep<T1>(), [&](std::size_t begin, std::size_t end) {
+        std::transform(i_vinbeg1 + begin, i_vinbeg1 + end, i_vinbeg2 + begin, o_voutbeg + begin, op);
+      });
   }
 };
 
@@ -149,6 +152,7 @@ struct PixelWiseBinaryOpDispatcher<T1,
     auto i_vinend1 = i_vin1.data() + i_vin1.size();
     auto i_vinbeg2 = i_vin2.data();
     auto i_voutbeg = o_vout.data();
+    // block parallel over ExecutionContext, serial for small images
     simd::transform(i_vinbeg1, i_vinend1, i_vinbeg2, i_voutbeg, op);
   }
 };
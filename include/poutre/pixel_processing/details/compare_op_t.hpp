@@ -21,6 +21,9 @@
 
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/simd/simd_algorithm.hpp>
+#include <poutre/base/details/simd/simd_dispatch.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
@@ -29,6 +32,11 @@
 #include <poutre/pixel_processing/details/ternary_op_t.hpp>
 #include <poutre/pixel_processing/details/unary_op_t.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
 
 namespace poutre::details {
 /**
@@ -51,6 +59,7 @@ template<typename T> struct OpCompEqual<T, T, std::enable_if_t<std::is_arithmeti
 {
   using simd_t = typename TypeTraits<T>::simd_type;
   using simd_mask_t = typename TypeTraits<T>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::Equal;
   OpCompEqual() = default;
   POUTRE_ALWAYS_INLINE bool operator()(T a0, T a1) const POUTRE_NOEXCEPT { return static_cast<bool>(a0 == a1); }
   template<typename U> POUTRE_ALWAYS_INLINE simd_mask_t operator()(const U &lhs, const U &rhs) const POUTRE_NOEXCEPT
@@ -72,6 +81,7 @@ template<typename T> struct OpCompDiff<T, T, std::enable_if_t<std::is_arithmetic
 {
   using simd_t = typename TypeTraits<T>::simd_type;
   using simd_mask_t = typename TypeTraits<T>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::Diff;
   OpCompDiff() = default;
   POUTRE_ALWAYS_INLINE bool operator()(T a0, T a1) const POUTRE_NOEXCEPT { return static_cast<bool>(a0 != a1); }
   template<typename U> POUTRE_ALWAYS_INLINE simd_mask_t operator()(const U &lhs, const U &rhs) const POUTRE_NOEXCEPT
@@ -93,6 +103,7 @@ template<typename T> struct OpCompSup<T, T, std::enable_if_t<std::is_arithmetic_
 {
   using simd_t = typename TypeTraits<T>::simd_type;
   using simd_mask_t = typename TypeTraits<T>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::Sup;
   OpCompSup() = default;
   POUTRE_ALWAYS_INLINE bool operator()(T a0, T a1) const POUTRE_NOEXCEPT { return static_cast<bool>(a0 > a1); }
   template<typename U> POUTRE_ALWAYS_INLINE simd_mask_t operator()(const U &lhs, const U &rhs) const POUTRE_NOEXCEPT
@@ -115,6 +126,7 @@ template<typename T> struct OpCompInf<T, T, std::enable_if_t<std::is_arithmetic_
 {
   using simd_t = typename TypeTraits<T>::simd_type;
   using simd_mask_t = typename TypeTraits<T>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::Inf;
   OpCompInf() = default;
   POUTRE_ALWAYS_INLINE bool operator()(T a0, T a1) const POUTRE_NOEXCEPT { return static_cast<bool>(a0 < a1); }
   template<typename U> POUTRE_ALWAYS_INLINE simd_mask_t operator()(const U &lhs, const U &rhs) const POUTRE_NOEXCEPT
@@ -136,6 +148,7 @@ template<typename T> struct OpCompSupEqual<T, T, std::enable_if_t<std::is_arithm
 {
   using simd_t = typename TypeTraits<T>::simd_type;
   using simd_mask_t = typename TypeTraits<T>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::SupEqual;
   OpCompSupEqual() = default;
   POUTRE_ALWAYS_INLINE bool operator()(T a0, T a1) const POUTRE_NOEXCEPT { return static_cast<bool>(a0 >= a1); }
   template<typename U> POUTRE_ALWAYS_INLINE simd_mask_t operator()(const U &lhs, const U &rhs) const POUTRE_NOEXCEPT
@@ -157,6 +170,7 @@ template<typename T> struct OpCompInfEqual<T, T, std::enable_if_t<std::is_arithm
 {
   using simd_t = typename TypeTraits<T>::simd_type;
   using simd_mask_t = typename TypeTraits<T>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::InfEqual;
   OpCompInfEqual() = default;
   POUTRE_ALWAYS_INLINE bool operator()(T a0, T a1) const POUTRE_NOEXCEPT { return static_cast<bool>(a0 <= a1); }
   template<typename U> POUTRE_ALWAYS_INLINE simd_mask_t operator()(const U &lhs, const U &rhs) const POUTRE_NOEXCEPT
@@ -178,6 +192,7 @@ template<typename T1> struct OpCompEqualValue<T1, std::enable_if_t<std::is_arith
   T1 m_val;
   using simd_t = typename TypeTraits<T1>::simd_type;
   using simd_mask_t = typename TypeTraits<T1>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::Equal;
   simd_t m_val_pack;
   explicit OpCompEqualValue(T1 const &ival) : m_val(ival), m_val_pack(ival) {}
   POUTRE_ALWAYS_INLINE bool operator()(T1 lhs) const POUTRE_NOEXCEPT { return lhs == m_val; }
@@ -201,6 +216,7 @@ template<typename T1> struct OpCompDiffValue<T1, std::enable_if_t<std::is_arithm
   T1 m_val;
   using simd_t = typename TypeTraits<T1>::simd_type;
   using simd_mask_t = typename TypeTraits<T1>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::Diff;
   simd_t m_val_pack;
   explicit OpCompDiffValue(T1 ival) : m_val(ival), m_val_pack(ival) {}
   POUTRE_ALWAYS_INLINE bool operator()(T1 lhs) const POUTRE_NOEXCEPT { return lhs != m_val; }
@@ -224,6 +240,7 @@ template<typename T1> struct OpCompSupValue<T1, std::enable_if_t<std::is_arithme
   T1 m_val;
   using simd_t = typename TypeTraits<T1>::simd_type;
   using simd_mask_t = typename TypeTraits<T1>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::Sup;
   simd_t m_val_pack;
   explicit OpCompSupValue(T1 ival) : m_val(ival), m_val_pack(ival) {}
   POUTRE_ALWAYS_INLINE bool operator()(T1 lhs) const POUTRE_NOEXCEPT { return lhs > m_val; }
@@ -247,6 +264,7 @@ template<typename T1> struct OpCompSupEqualValue<T1, std::enable_if_t<std::is_ar
   T1 m_val;
   using simd_t = typename TypeTraits<T1>::simd_type;
   using simd_mask_t = typename TypeTraits<T1>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::SupEqual;
   simd_t m_val_pack;
   explicit OpCompSupEqualValue(T1 ival) : m_val(ival), m_val_pack(ival) {}
   POUTRE_ALWAYS_INLINE bool operator()(T1 lhs) const POUTRE_NOEXCEPT { return lhs >= m_val; }
@@ -270,6 +288,7 @@ template<typename T1> struct OpCompInfValue<T1, std::enable_if_t<std::is_arithme
   T1 m_val;
   using simd_t = typename TypeTraits<T1>::simd_type;
   using simd_mask_t = typename TypeTraits<T1>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::Inf;
   simd_t m_val_pack;
   explicit OpCompInfValue(T1 ival) : m_val(ival), m_val_pack(ival) {}
   POUTRE_ALWAYS_INLINE bool operator()(T1 lhs) const POUTRE_NOEXCEPT { return lhs < m_val; }
@@ -292,6 +311,7 @@ template<typename T1> struct OpCompInfEqualValue<T1, std::enable_if_t<std::is_ar
   T1 m_val;
   using simd_t = typename TypeTraits<T1>::simd_type;
   using simd_mask_t = typename TypeTraits<T1>::simd_mask_type;
+  static constexpr auto dispatched_compare = simd::DispatchedCompare::InfEqual;
   simd_t m_val_pack;
   explicit OpCompInfEqualValue(T1 ival) : m_val(ival), m_val_pack(ival) {}
   POUTRE_ALWAYS_INLINE bool operator()(T1 lhs) const POUTRE_NOEXCEPT { return lhs <= m_val; }
@@ -302,6 +322,163 @@ template<typename T1> struct OpCompInfEqualValue<T1, std::enable_if_t<std::is_ar
   }
 };
 
+/*************************************************************************************************************************************/
+/*                                          COMPARE/SELECT KERNEL */
+/*************************************************************************************************************************************/
+// Tin != Tout can't go through simd::transform (lanes differ), so the mask is computed with Tin batches, gathered as
+// bits, then rebuilt with Tout batches to blend true/false operands. Same dispatched types also take this path, so that
+// the kernel runs on the best arch of the host instead of the baseline ternary/quaternary transforms.
+
+//! true if views are all contiguous array_view
+template<class... Views> inline constexpr bool t_AreArrayViews = false;
+template<typename... T, ptrdiff_t... Rank>
+inline constexpr bool t_AreArrayViews<av::array_view<T, Rank>...> = true;
+
+//! true if compare/select from Tin to Tout should use the mixed types simd kernel
+template<typename Tin, typename Tout>
+inline constexpr bool t_IsCompareSelectMixed =
+  std::is_arithmetic_v<std::remove_const_t<Tin>> && std::is_arithmetic_v<std::remove_const_t<Tout>>
+  && !std::is_same_v<std::remove_const_t<Tin>, std::remove_const_t<Tout>>
+  && std::max(TypeTraits<std::remove_const_t<Tin>>::simd_type::size,
+       TypeTraits<std::remove_const_t<Tout>>::simd_type::size)
+       <= 64;
+
+//! true if compare/select from Tin to Tout should use the compare/select kernel: mixed types or dispatched same types
+template<typename Tin, typename Tout>
+inline constexpr bool t_UseCompareSelectKernel =
+  t_IsCompareSelectMixed<Tin, Tout>
+  || (std::is_same_v<std::remove_const_t<Tin>, std::remove_const_t<Tout>>
+      && simd::is_dispatched_type_v<std::remove_const_t<Tin>>);
+
+//! constant operand of compare/select
+template<typename T> struct compare_operand_value
+{
+  using simd_t = typename TypeTraits<T>::simd_type;
+  T m_val;
+  simd_t m_val_pack;
+  explicit compare_operand_value(T i_val) : m_val(i_val), m_val_pack(i_val) {}
+  POUTRE_ALWAYS_INLINE T operator()(std::size_t /*i*/) const POUTRE_NOEXCEPT { return m_val; }
+  POUTRE_ALWAYS_INLINE simd_t batch(std::size_t /*i*/) const POUTRE_NOEXCEPT { return m_val_pack; }
+  [[nodiscard]] simd::DispatchedOperand<T> dispatched() const POUTRE_NOEXCEPT { return { nullptr, m_val }; }
+};
+
+//! contiguous buffer operand of compare/select
+template<typename T> struct compare_operand_buffer
+{
+  using simd_t = typename TypeTraits<T>::simd_type;
+  const T *m_ptr;
+  explicit compare_operand_buffer(const T *i_ptr) : m_ptr(i_ptr) {}
+  POUTRE_ALWAYS_INLINE T operator()(std::size_t i) const POUTRE_NOEXCEPT { return m_ptr[i]; }
+  POUTRE_ALWAYS_INLINE simd_t batch(std::size_t i) const POUTRE_NOEXCEPT { return simd_t::load_unaligned(m_ptr + i); }
+  [[nodiscard]] simd::DispatchedOperand<T> dispatched() const POUTRE_NOEXCEPT { return { m_ptr, T{} }; }
+};
+
+//! mask of unary compare operator (value embedded in operator, @c OpCompEqualValue ...)
+template<typename Tin, class CompareOp> struct compare_mask_unary
+{
+  using simd_t = typename TypeTraits<Tin>::simd_type;
+  using compare_op = CompareOp;
+  const Tin *m_ptr;
+  CompareOp cop;
+  compare_mask_unary(const Tin *i_ptr, const CompareOp &op) : m_ptr(i_ptr), cop(op) {}
+  //! compared to the value embedded in the operator
+  [[nodiscard]] simd::DispatchedOperand<Tin> dispatched() const POUTRE_NOEXCEPT { return { nullptr, cop.m_val }; }
+  POUTRE_ALWAYS_INLINE bool operator()(std::size_t i) const POUTRE_NOEXCEPT { return cop(m_ptr[i]); }
+  POUTRE_ALWAYS_INLINE auto batch(std::size_t i) const POUTRE_NOEXCEPT
+  {
+    return cop(simd_t::load_unaligned(m_ptr + i));
+  }
+};
+
+//! mask of binary compare operator (@c OpCompEqual ...), second operand is a compare_operand_xxx
+template<typename Tin, class CompareOp, class Operand> struct compare_mask_binary
+{
+  using simd_t = typename TypeTraits<Tin>::simd_type;
+  using compare_op = CompareOp;
+  const Tin *m_ptr;
+  CompareOp cop;
+  Operand m_comp;
+  compare_mask_binary(const Tin *i_ptr, const CompareOp &op, const Operand &comp) : m_ptr(i_ptr), cop(op), m_comp(comp)
+  {}
+  [[nodiscard]] simd::DispatchedOperand<Tin> dispatched() const POUTRE_NOEXCEPT { return m_comp.dispatched(); }
+  POUTRE_ALWAYS_INLINE bool operator()(std::size_t i) const POUTRE_NOEXCEPT { return cop(m_ptr[i], m_comp(i)); }
+  POUTRE_ALWAYS_INLINE auto batch(std::size_t i) const POUTRE_NOEXCEPT
+  {
+    return cop(simd_t::load_unaligned(m_ptr + i), m_comp.batch(i));
+  }
+};
+
+/**
+ * @brief out[i] = mask(i) ? vtrue(i) : vfalse(i) over [begin,end[ where mask works on Tin and out on Tout
+ *
+ * Each step handles the lane count of the narrowest type: several Tin masks are packed as bits then split in Tout
+ * masks feeding xs::select.
+ */
+template<typename Tin, typename Tout, class MaskOp, class TrueOp, class FalseOp>
+void t_CompareSelectMixed_serial(std::size_t begin,
+  std::size_t end,
+  const MaskOp &mask,
+  const TrueOp &vtrue,
+  const FalseOp &vfalse,
+  Tout *__restrict o_ptr) POUTRE_NOEXCEPTONLYNDEBUG
+{
+  using simd_mask_out_t = typename TypeTraits<Tout>::simd_mask_type;
+  constexpr std::size_t lanes_in = TypeTraits<Tin>::simd_type::size;
+  constexpr std::size_t lanes_out = TypeTraits<Tout>::simd_type::size;
+  constexpr std::size_t lanes = std::max(lanes_in, lanes_out);
+  constexpr std::uint64_t out_bits = lanes_out >= 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << lanes_out) - 1;
+
+  std::size_t i = begin;
+  for (; i + lanes <= end; i += lanes) {
+    std::uint64_t bits = 0;
+    for (std::size_t k = 0; k < lanes; k += lanes_in) {
+      bits |= static_cast<std::uint64_t>(mask.batch(i + k).mask()) << k;
+    }
+    for (std::size_t k = 0; k < lanes; k += lanes_out) {
+      const auto sel = simd_mask_out_t::from_mask((bits >> k) & out_bits);
+      xs::store_unaligned(o_ptr + i + k, xs::select(sel, vtrue.batch(i + k), vfalse.batch(i + k)));
+    }
+  }
+  //---epilogue
+  for (; i < end; ++i) { o_ptr[i] = mask(i) ? vtrue(i) : vfalse(i); }
+}
+
+//! true if the compare/select runs the kernel compiled for the best arch of the running CPU
+template<typename Tin, typename Tout, class MaskOp, class TrueOp, class FalseOp>
+inline constexpr bool t_IsDispatchedCompareSelect =
+  simd::is_dispatched_type_v<Tin> && simd::is_dispatched_type_v<Tout>
+  && requires(const MaskOp &mask, const TrueOp &vtrue, const FalseOp &vfalse) {
+       MaskOp::compare_op::dispatched_compare;
+       mask.m_ptr;
+       mask.dispatched();
+       vtrue.dispatched();
+       vfalse.dispatched();
+     };
+
+//! Block parallel version of @c t_CompareSelectMixed_serial over [0,size[
+template<typename Tin, typename Tout, class MaskOp, class TrueOp, class FalseOp>
+void t_CompareSelectMixed(std::size_t size,
+  const MaskOp &mask,
+  const TrueOp &vtrue,
+  const FalseOp &vfalse,
+  Tout *o_ptr) POUTRE_NOEXCEPTONLYNDEBUG
+{
+  const auto step = std::max(simd::t_AlignedBlockStep<Tin>(), simd::t_AlignedBlockStep<Tout>());
+  if constexpr (t_IsDispatchedCompareSelect<Tin, Tout, MaskOp, TrueOp, FalseOp>) {
+    const auto comp = mask.dispatched();
+    const auto dtrue = vtrue.dispatched();
+    const auto dfalse = vfalse.dispatched();
+    ParallelForBlocks(size, step, [&](std::size_t begin, std::size_t end) {
+      simd::DispatchedCompareSelect(
+        MaskOp::compare_op::dispatched_compare, mask.m_ptr, comp, dtrue, dfalse, o_ptr, begin, end);
+    });
+  } else {
+    ParallelForBlocks(size, step, [&](std::size_t begin, std::size_t end) {
+      t_CompareSelectMixed_serial<Tin>(begin, end, mask, vtrue, vfalse, o_ptr);
+    });
+  }
+}
+
 /*************************************************************************************************************************************/
 /*                                                      SSS */
 /*************************************************************************************************************************************/
@@ -366,9 +543,17 @@ void t_ViewCompare_sss(const ViewIn<const Tin, Rank> &i_vin,
   Tout i_valfalse,
   ViewOut<Tout, Rank> &o_vout)
 {
-  using myop = compare_sss<Tin, Tout, Op>;
-  myop op(i_op, i_valtrue, i_valfalse);
-  t_unary_op(i_vin, op, o_vout);
+  if constexpr (t_UseCompareSelectKernel<Tin, Tout> && t_AreArrayViews<ViewIn<const Tin, Rank>, ViewOut<Tout, Rank>>) {
+    t_CompareSelectMixed<Tin>(static_cast<std::size_t>(i_vin.size()),
+      compare_mask_unary<Tin, Op>(i_vin.data(), i_op),
+      compare_operand_value<Tout>(i_valtrue),
+      compare_operand_value<Tout>(i_valfalse),
+      o_vout.data());
+  } else {
+    using myop = compare_sss<Tin, Tout, Op>;
+    myop op(i_op, i_valtrue, i_valfalse);
+    t_unary_op(i_vin, op, o_vout);
+  }
 }
 
 template<typename Tin,
@@ -514,9 +699,24 @@ void t_ViewCompare_iii(const ViewIn<const Tin, Rank> &i_vin,
   const ViewFalse<const Tfalse, Rank> &i_vfalse,
   ViewOut<Tout, Rank> &o_vout)
 {
-  using myop = compare_iii<Tin, Tcomp, Ttrue, Tfalse, Tout, Op>;
-  myop op(i_op);
-  t_quaternary_op(i_vin, op, i_vcomp, i_vtrue, i_vfalse, o_vout);
+  if constexpr (t_UseCompareSelectKernel<Tin, Tout> && std::is_same_v<Tin, Tcomp> && std::is_same_v<Ttrue, Tout>
+                && std::is_same_v<Tfalse, Tout>
+                && t_AreArrayViews<ViewIn<const Tin, Rank>,
+                  ViewComp<const Tcomp, Rank>,
+                  ViewTrue<const Ttrue, Rank>,
+                  ViewFalse<const Tfalse, Rank>,
+                  ViewOut<Tout, Rank>>) {
+    t_CompareSelectMixed<Tin>(static_cast<std::size_t>(i_vin.size()),
+      compare_mask_binary<Tin, Op, compare_operand_buffer<Tcomp>>(
+        i_vin.data(), i_op, compare_operand_buffer<Tcomp>(i_vcomp.data())),
+      compare_operand_buffer<Ttrue>(i_vtrue.data()),
+      compare_operand_buffer<Tfalse>(i_vfalse.data()),
+      o_vout.data());
+  } else {
+    using myop = compare_iii<Tin, Tcomp, Ttrue, Tfalse, Tout, Op>;
+    myop op(i_op);
+    t_quaternary_op(i_vin, op, i_vcomp, i_vtrue, i_vfalse, o_vout);
+  }
 }
 
 template<typename Tin,
@@ -680,9 +880,22 @@ void t_ViewCompare_sii(const ViewIn<const Tin, Rank> &i_vin,
   const ViewFalse<const Tfalse, Rank> &i_vfalse,
   ViewOut<Tout, Rank> &o_vout)
 {
-  using myop = compare_sii<Tin, Ttrue, Tfalse, Tout, Op>;
-  myop op(i_compval, i_op);
-  t_ternary_op(i_vin, op, i_vtrue, i_vfalse, o_vout);
+  if constexpr (t_UseCompareSelectKernel<Tin, Tout> && std::is_same_v<Ttrue, Tout> && std::is_same_v<Tfalse, Tout>
+                && t_AreArrayViews<ViewIn<const Tin, Rank>,
+                  ViewTrue<const Ttrue, Rank>,
+                  ViewFalse<const Tfalse, Rank>,
+                  ViewOut<Tout, Rank>>) {
+    t_CompareSelectMixed<Tin>(static_cast<std::size_t>(i_vin.size()),
+      compare_mask_binary<Tin, Op, compare_operand_value<Tin>>(
+        i_vin.data(), i_op, compare_operand_value<Tin>(i_compval)),
+      compare_operand_buffer<Ttrue>(i_vtrue.data()),
+      compare_operand_buffer<Tfalse>(i_vfalse.data()),
+      o_vout.data());
+  } else {
+    using myop = compare_sii<Tin, Ttrue, Tfalse, Tout, Op>;
+    myop op(i_compval, i_op);
+    t_ternary_op(i_vin, op, i_vtrue, i_vfalse, o_vout);
+  }
 }
 
 template<typename Tin,
@@ -825,9 +1038,20 @@ void t_ViewCompare_sis(const ViewIn<Tin, Rank> &i_vin,
   Tout i_valfalse,
   ViewOut<Tout, Rank> &o_vout)
 {
-  using myop = compare_sis<Tin, Ttrue, Tout, Op>;
-  myop op(i_valfalse, i_op);
-  t_binary_op(i_vin, op, i_vtrue, o_vout);
+  using tin_t = std::remove_const_t<Tin>;
+  using ttrue_t = std::remove_const_t<Ttrue>;
+  if constexpr (t_UseCompareSelectKernel<tin_t, Tout> && std::is_same_v<ttrue_t, Tout>
+                && t_AreArrayViews<ViewIn<Tin, Rank>, ViewTrue<Ttrue, Rank>, ViewOut<Tout, Rank>>) {
+    t_CompareSelectMixed<tin_t>(static_cast<std::size_t>(i_vin.size()),
+      compare_mask_unary<tin_t, Op>(i_vin.data(), i_op),
+      compare_operand_buffer<ttrue_t>(i_vtrue.data()),
+      compare_operand_value<Tout>(i_valfalse),
+      o_vout.data());
+  } else {
+    using myop = compare_sis<Tin, Ttrue, Tout, Op>;
+    myop op(i_valfalse, i_op);
+    t_binary_op(i_vin, op, i_vtrue, o_vout);
+  }
 }
 
 template<typename Tin,
@@ -980,9 +1204,22 @@ void t_ViewCompare_isi(const ViewIn<const Tin, Rank> &i_vin,
   const ViewFalse<const Tfalse, Rank> &i_vfalse,
   ViewOut<Tout, Rank> &o_vout)
 {
-  using myop = compare_isi<Tin, Tcomp, Tfalse, Tout, Op>;
-  myop op(i_valtrue, i_op);
-  t_ternary_op(i_vin, op, i_vcomp, i_vfalse, o_vout);
+  if constexpr (t_UseCompareSelectKernel<Tin, Tout> && std::is_same_v<Tin, Tcomp> && std::is_same_v<Tfalse, Tout>
+                && t_AreArrayViews<ViewIn<const Tin, Rank>,
+                  ViewComp<const Tcomp, Rank>,
+                  ViewFalse<const Tfalse, Rank>,
+                  ViewOut<Tout, Rank>>) {
+    t_CompareSelectMixed<Tin>(static_cast<std::size_t>(i_vin.size()),
+      compare_mask_binary<Tin, Op, compare_operand_buffer<Tcomp>>(
+        i_vin.data(), i_op, compare_operand_buffer<Tcomp>(i_vcomp.data())),
+      compare_operand_value<Tout>(i_valtrue),
+      compare_operand_buffer<Tfalse>(i_vfalse.data()),
+      o_vout.data());
+  } else {
+    using myop = compare_isi<Tin, Tcomp, Tfalse, Tout, Op>;
+    myop op(i_valtrue, i_op);
+    t_ternary_op(i_vin, op, i_vcomp, i_vfalse, o_vout);
+  }
 }
 
 template<typename Tin,
@@ -1138,9 +1375,22 @@ void t_ViewCompare_iis(const ViewIn<const Tin, Rank> &i_vin,
   Tout i_valfalse,
   ViewOut<Tout, Rank> &o_vout)
 {
-  using myop = compare_iis<Tin, Tcomp, Ttrue, Tout, Op>;
-  myop op(i_valfalse, i_op);
-  t_ternary_op(i_vin, op, i_vcomp, i_vtrue, o_vout);
+  if constexpr (t_UseCompareSelectKernel<Tin, Tout> && std::is_same_v<Tin, Tcomp> && std::is_same_v<Ttrue, Tout>
+                && t_AreArrayViews<ViewIn<const Tin, Rank>,
+                  ViewComp<const Tcomp, Rank>,
+                  ViewTrue<const Ttrue, Rank>,
+                  ViewOut<Tout, Rank>>) {
+    t_CompareSelectMixed<Tin>(static_cast<std::size_t>(i_vin.size()),
+      compare_mask_binary<Tin, Op, compare_operand_buffer<Tcomp>>(
+        i_vin.data(), i_op, compare_operand_buffer<Tcomp>(i_vcomp.data())),
+      compare_operand_buffer<Ttrue>(i_vtrue.data()),
+      compare_operand_value<Tout>(i_valfalse),
+      o_vout.data());
+  } else {
+    using myop = compare_iis<Tin, Tcomp, Ttrue, Tout, Op>;
+    myop op(i_valfalse, i_op);
+    t_ternary_op(i_vin, op, i_vcomp, i_vtrue, o_vout);
+  }
 }
 
 template<typename Tin,
@@ -1283,9 +1533,18 @@ void t_ViewCompare_ssi(const ViewIn<const Tin, Rank> &i_vin,
   const ViewFalse<const Tfalse, Rank> &i_vfalse,
   ViewOut<Tout, Rank> &o_vout)
 {
-  using myop = compare_ssi<Tin, Tfalse, Tout, Op>;
-  myop op(i_valtrue, i_op);
-  t_binary_op(i_vin, op, i_vfalse, o_vout);
+  if constexpr (t_UseCompareSelectKernel<Tin, Tout> && std::is_same_v<Tfalse, Tout>
+                && t_AreArrayViews<ViewIn<const Tin, Rank>, ViewFalse<const Tfalse, Rank>, ViewOut<Tout, Rank>>) {
+    t_CompareSelectMixed<Tin>(static_cast<std::size_t>(i_vin.size()),
+      compare_mask_unary<Tin, Op>(i_vin.data(), i_op),
+      compare_operand_value<Tout>(i_valtrue),
+      compare_operand_buffer<Tfalse>(i_vfalse.data()),
+      o_vout.data());
+  } else {
+    using myop = compare_ssi<Tin, Tfalse, Tout, Op>;
+    myop op(i_valtrue, i_op);
+    t_binary_op(i_vin, op, i_vfalse, o_vout);
+  }
 }
 
 template<typename Tin,
@@ -1434,9 +1693,19 @@ void t_ViewCompare_iss(const ViewIn1<const Tin1, Rank> &i_vin1,
   Tout i_valfalse,
   ViewOut<Tout, Rank> &o_vout)
 {
-  using myop = compare_iss<Tin1, Tin2, Tout, Op>;
-  myop op(i_valtrue, i_valfalse, i_op);
-  t_binary_op(i_vin1, op, i_vin2, o_vout);
+  if constexpr (t_UseCompareSelectKernel<Tin1, Tout> && std::is_same_v<Tin1, Tin2>
+                && t_AreArrayViews<ViewIn1<const Tin1, Rank>, ViewIn2<const Tin2, Rank>, ViewOut<Tout, Rank>>) {
+    t_CompareSelectMixed<Tin1>(static_cast<std::size_t>(i_vin1.size()),
+      compare_mask_binary<Tin1, Op, compare_operand_buffer<Tin2>>(
+        i_vin1.data(), i_op, compare_operand_buffer<Tin2>(i_vin2.data())),
+      compare_operand_value<Tout>(i_valtrue),
+      compare_operand_value<Tout>(i_valfalse),
+      o_vout.data());
+  } else {
+    using myop = compare_iss<Tin1, Tin2, Tout, Op>;
+    myop op(i_valtrue, i_valfalse, i_op);
+    t_binary_op(i_vin1, op, i_vin2, o_vout);
+  }
 }
 
 template<typename Tin1,
@@ -105,12 +105,14 @@ void t_Copy(const image_t<T1, Rank> &i_image, image_t<T2, Rank> &o_image)
   t_Copy(viewIn, viewOut);
 }
 
-template<typename T, ptrdiff_t Rank> std::unique_ptr<image_t<T, Rank>> t_CloneGeometry(const image_t<T, Rank> &i_image)
-{ return std::make_unique<image_t<T, Rank>>(i_image.GetShape()); }
+template<typename T, ptrdiff_t Rank>
+std::unique_ptr<image_t<T, Rank>> t_CloneGeometry(const image_t<T, Rank> &i_image,
+  AllocationMode mode = AllocationMode::Zeroed)
+{ return std::make_unique<image_t<T, Rank>>(i_image.GetShape(), mode); }
 
 template<typename T, ptrdiff_t Rank> std::unique_ptr<image_t<T, Rank>> t_Clone(const image_t<T, Rank> &i_image)
 {
-  auto res = std::make_unique<image_t<T, Rank>>(i_image.GetShape());
+  auto res = std::make_unique<image_t<T, Rank>>(i_image.GetShape(), AllocationMode::Uninitialized);
   t_Copy(i_image, *res);
   return res;
 }
@@ -23,6 +23,7 @@
 #include <poutre/base/details/simd/simd_algorithm.hpp> //simd transform
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
 
 namespace poutre::details {
 /**
@@ -128,13 +129,15 @@ struct PixelWiseTernaryOpDispatcher<T1,
   {
     POUTRE_ENTERING("PixelWiseTernaryOpDispatcher both array view");
     auto i_vinbeg1 = i_vin1.data();
-    auto i_vinend1 = i_vin1.data() + i_vin1.size();
     auto i_vinbeg2 = i_vin2.data();
     auto i_vinbeg3 = i_vin3.data();
     auto i_voutbeg = o_vout.data();
-    for (; i_vinbeg1 != i_vinend1; ++i_vinbeg1, ++i_vinbeg2, ++i_vinbeg3, ++i_voutbeg) {
-      *i_voutbeg = static_cast<Tout>(op(*i_vinbeg1, *i_vinbeg2, *i_vinbeg3));
-    }
+    ParallelForBlocks(
+      static_cast<std::size_t>(i_vin1.size()), simd::t_AlignedBlockStep<T1>(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+          i_voutbeg[i] = static_cast<Tout>(op(i_vinbeg1[i], i_vinbeg2[i], i_vinbeg3[i]));
+        }
+      });
   }
 };
 
@@ -166,6 +169,7 @@ struct PixelWiseTernaryOpDispatcher<T1,
     auto i_vinbeg2 = i_vin2.data();
     auto i_vinbeg3 = i_vin3.data();
     auto i_voutbeg = o_vout.data();
+    // block parallel over ExecutionContext, serial for small images
     simd::transform(i_vinbeg1, i_vinend1, i_vinbeg2, i_vinbeg3, i_voutbeg, op);
   }
 };
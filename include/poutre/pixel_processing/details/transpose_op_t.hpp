@@ -21,9 +21,14 @@
 
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/simd/simd_dispatch.hpp>
+#include <poutre/base/details/simd/simd_transpose.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 
+#include <cstddef>
+
 namespace poutre::details {
 /**
  * @addtogroup image_processing_isometry_group Image Processing transpose helpers
@@ -42,6 +47,27 @@ struct t_transposeDispatcher
   static_assert(false, "To be implemented for generic views");
 };
 
+/**
+ * @brief Cache blocked transpose of rows [row_begin,row_end[ of a src_rows x src_cols row major matrix
+ *
+ * dst is the src_cols x src_rows row major matrix, dst[c*src_rows+r]=src[r*src_cols+c]. Scalar pixels run the
+ * kernel compiled for the best arch of the running CPU, see @c simd::t_TransposeBlocked.
+ */
+template<typename T>
+void t_TransposeBlocked(const T *__restrict src,
+  std::ptrdiff_t src_rows,
+  std::ptrdiff_t src_cols,
+  T *__restrict dst,
+  std::ptrdiff_t row_begin,
+  std::ptrdiff_t row_end) POUTRE_NOEXCEPT
+{
+  if constexpr (simd::is_dispatched_type_v<T>) {
+    simd::DispatchedTransposeBlocked(src, src_rows, src_cols, dst, row_begin, row_end);
+  } else {
+    simd::t_TransposeBlocked<xs::default_arch>(src, src_rows, src_cols, dst, row_begin, row_end);
+  }
+}
+
 template<typename T> struct t_transposeDispatcher<T, 2, av::array_view, av::array_view>
 {
   void operator()(const av::array_view<const T, 2> &i_vin, const av::array_view<T, 2> &o_vout) const
@@ -58,19 +84,28 @@ template<typename T> struct t_transposeDispatcher<T, 2, av::array_view, av::arra
 
     POUTRE_CHECK(oysize == xsize, "ibd[0]!=obd[1] bound not compatible");
     POUTRE_CHECK(oxsize == ysize, "ibd[1]!=obd[0] bound not compatible");
+    if (xsize == 0 || ysize == 0) return;
 
-    auto i_vinbeg = i_vin.data();
-    auto o_voutbeg = o_vout.data();
-
-    for (scoord y = 0; y < oysize; y++) {
-      for (scoord x = 0; x < oxsize; x++) { o_voutbeg[y * oxsize + x] = i_vinbeg[x * oysize + y]; }
-    }
+    // o_vout[y * oxsize + x] = i_vin[x * oysize + y], i.e. input is read as a ysize x xsize row major matrix
+    const T *i_vinbeg = i_vin.data();
+    T *o_voutbeg = o_vout.data();
+    const auto src_rows = ysize;
+    const auto src_cols = xsize;
+    // split on source rows, blocks boundaries are multiple of cache tile rows
+    const auto row_size = static_cast<std::size_t>(src_cols);
+    const auto step = static_cast<std::size_t>(simd::t_TransposeRowBlock<T>()) * row_size;
+    ParallelForBlocks(static_cast<std::size_t>(src_rows) * row_size, step, [&](std::size_t begin, std::size_t end) {
+      t_TransposeBlocked(i_vinbeg,
+        src_rows,
+        src_cols,
+        o_voutbeg,
+        static_cast<std::ptrdiff_t>(begin / row_size),
+        static_cast<std::ptrdiff_t>(end / row_size));
+    });
   }
 };
 
 
-// todo SIMD ?
-
 template<typename T,
   ptrdiff_t Rank,
   template<typename, ptrdiff_t> class ViewIn,
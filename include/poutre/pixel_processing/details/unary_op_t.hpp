@@ -23,6 +23,7 @@
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
 #include <poutre/base/details/simd/simd_algorithm.hpp>//simd transform
+#include <poutre/base/execution.hpp>
 
 namespace poutre::details {
 
@@ -96,9 +97,11 @@ struct PixelWiseUnaryOpDispatcher<TIn,
   {
     POUTRE_ENTERING("PixelWiseUnaryOpDispatcher both array view != types");
     auto i_vinbeg = i_vin.data();
-    auto i_vinend = i_vin.data() + i_vin.size();
     auto o_voutbeg = o_vout.data();
-    std::transform(i_vinbeg, i_vinend, o_voutbeg, op);
+    ParallelForBlocks(
+      static_cast<std::size_t>(i_vin.size()), simd::t_AlignedBlockStep<TIn>(), [&](std::size_t begin, std::size_t end) {
+        std::transform(i_vinbeg + begin, i_vinbeg + end, o_voutbeg + begin, op);
+      });
   }
 };
 
@@ -123,40 +126,8 @@ struct PixelWiseUnaryOpDispatcher<TIn,
 
     const auto length = i_vin.size();
     if (!length) { return; }
+    // block parallel over ExecutionContext, serial for small images
     simd::transform(i_vinbeg, i_vinend, i_voutbeg, op);
-    // work but speedup is only 20% for 1024 images and degrade for smaller size
-    /* const auto block_size = 2048 * poutre::TypeTraits<TIn>::simd_loop_step;
-    const auto num_blocks = (length + block_size - 1) / block_size;
-    if (num_blocks<=1) {
-      simd::transform(i_vinbeg, i_vinend, i_voutbeg, op);
-      return;
-    }
-    std::vector<poutre::thread::TaskFuture<TOut*>> futures;
-    auto pool = poutre::thread::TreadPool(num_blocks);
-
-    TIn * block_start    = i_vinbeg;
-    TOut *block_startout = i_voutbeg;
-
-    TIn *block_end = nullptr;
-    TOut *block_out_end = nullptr;
-
-    for( size_t i = 0; i < (num_blocks - 1); ++i )
-    {
-      block_end = block_start;
-      block_out_end = block_startout;
-      std::advance(block_end, block_size);
-      std::advance(block_out_end, block_size);
-      futures.push_back(pool.submit([=] {return simd::transform(block_start, block_end, block_startout, op); }));
-      block_start = block_end;
-      block_startout = block_out_end;
-      //std::advance(block_startout, block_size);
-    }
-    simd::transform(block_start, i_vinend, block_startout, op);// epilogue last part
-    for( auto &f : futures )
-    {
-      f.get();
-    }
-    */
   }
 };
 
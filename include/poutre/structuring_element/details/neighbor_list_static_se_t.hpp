@@ -398,37 +398,56 @@ struct static_se_traits<Common_NL_SE::SESquare3D>
   POUTRE_STATIC_CONSTEXPR std::pair<std::array<neighbor_element, 13>,std::array<neighbor_element, 13>> split_coordinates_upper_lower()
   {
     POUTRE_CONSTEXPR std::array<neighbor_element, 13> coordinates_upper = {
-      neighbor_element{ +1, +0, +0 },
-      neighbor_element{ -1, +1, +0 },
-      neighbor_element{ +0, +1, +0 },
-      neighbor_element{ +1, +1, +0 },
+      neighbor_element{ -1, -1, -1 },
+      neighbor_element{ -1, -1, 0 },
       neighbor_element{ -1, -1, +1 },
-      neighbor_element{ 0, -1, +1 },
-      neighbor_element{ +1, -1, +1 },
+      neighbor_element{ -1, 0, -1 },
+      neighbor_element{ -1, 0, 0 },
       neighbor_element{ -1, 0, +1 },
-      neighbor_element{ 0, 0, +1 },
-      neighbor_element{ +1, 0, +1 },
+      neighbor_element{ -1, +1, -1 },
+      neighbor_element{ -1, +1, 0 },
       neighbor_element{ -1, +1, +1 },
-      neighbor_element{ 0, +1, +1 },
-      neighbor_element{ +1, +1, +1 },
+      neighbor_element{ 0, -1, -1 },
+      neighbor_element{ 0, -1, 0 },
+      neighbor_element{ 0, -1, +1 },
+      neighbor_element{ 0, 0, -1 },
     };
     POUTRE_CONSTEXPR std::array<neighbor_element, 13> coordinates_lower = {
-      neighbor_element{-1, -1, -1},
-      neighbor_element{0, -1, -1},
-      neighbor_element{1, -1, -1},
-      neighbor_element{-1, 0, -1},
-      neighbor_element{0, 0, -1},
-      neighbor_element{+1, 0, -1},
-      neighbor_element{-1, +1, -1},
-      neighbor_element{0, +1, -1},
-      neighbor_element{+1, +1, -1},
-      neighbor_element{-1, -1, 0},
-      neighbor_element{0, -1, 0},
-      neighbor_element{+1, -1, 0},
-      neighbor_element{-1, 0, 0},
+      neighbor_element{ 0, 0, +1 },
+      neighbor_element{ 0, +1, -1 },
+      neighbor_element{ 0, +1, 0 },
+      neighbor_element{ 0, +1, +1 },
+      neighbor_element{ +1, -1, -1 },
+      neighbor_element{ +1, -1, 0 },
+      neighbor_element{ +1, -1, +1 },
+      neighbor_element{ +1, 0, -1 },
+      neighbor_element{ +1, 0, 0 },
+      neighbor_element{ +1, 0, +1 },
+      neighbor_element{ +1, +1, -1 },
+      neighbor_element{ +1, +1, 0 },
+      neighbor_element{ +1, +1, +1 },
     };
     return std::make_pair(coordinates_upper, coordinates_lower);
   }
 };
+
+/**
+ * @brief Convert a list of neighbor coordinates to linear offset deltas for a contiguous view of given stride
+ *
+ * For an interior pixel at linear offset @c off, neighbor @c coords[i] is at linear offset @c off+offsets[i]
+ */
+template<typename neighbor_element, std::size_t N, ptrdiff_t Rank>
+POUTRE_CONSTEXPR std::array<ptrdiff_t, N> t_LinearOffsets(const std::array<neighbor_element, N> &coords,
+  const poutre::details::av::index<Rank> &stride) POUTRE_NOEXCEPT
+{
+  std::array<ptrdiff_t, N> offsets = {};
+  for (std::size_t i = 0; i < N; ++i) {
+    ptrdiff_t offset = 0;
+    for (std::size_t dim = 0; dim < static_cast<std::size_t>(Rank); ++dim) { offset += coords[i][dim] * stride[dim]; }
+    offsets[i] = offset;
+  }
+  return offsets;
+}
+
 //! @} doxygroup: poutre_se_nl_static_group
 }
\ No newline at end of file
@@ -46,6 +46,12 @@ public:
   //! Append the se to the list \warning{the ownership is transferred}
   void append(std::unique_ptr<IStructuringElement> strel);
 
+  //! Number of se in the chain
+  [[nodiscard]] std::size_t GetChainSize() const noexcept;
+
+  //! Access se at position pos of the chain @throw runtime_error if pos is out of range
+  [[nodiscard]] const IStructuringElement &GetElement(std::size_t pos) const;
+
   /*!
    *@name  Virtual methods inherited from IStructuringElement
    *@{
@@ -0,0 +1,83 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   se_decomposition.hpp
+ * @author Thomas Retornaz
+ * @brief  Decomposition of arbitrary 2D neighbor list SE in cheaper components
+ *
+ *
+ */
+
+#include <poutre/base/config.hpp>
+#include <poutre/structuring_element/details/neighbor_list_se_t.hpp>
+#include <poutre/structuring_element/structuring_element.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace poutre::se {
+/**
+ * @addtogroup poutre_se_decomposition_group Decomposition of neighbor list SE
+ * @ingroup se_group
+ *@{
+ */
+
+/**
+ * @brief Centered rectangle (2*size_half_y+1)x(2*size_half_x+1) translated by each shift
+ *
+ * The rectangle is the Minkowski sum of one horizontal and one vertical segment, so it costs two van Herk passes
+ * whatever its size, each extra shift costs one inf/sup.
+ */
+struct RectangleGroup
+{
+  ptrdiff_t size_half_x = 0;
+  ptrdiff_t size_half_y = 0;
+  //! translations {y,x}
+  std::vector<std::array<ptrdiff_t, 2>> shifts;
+};
+
+/**
+ * @brief Plan of a 2D neighbor list SE as a union of translated rectangles
+ *
+ * Points are split in horizontal runs, runs identical on consecutive lines are stacked in rectangles. Even sides are
+ * covered by two overlapping odd sides, which is harmless as inf/sup are idempotent. Rectangles sharing the same
+ * size are grouped so that only the shifts differ.
+ */
+struct SE_API DecompositionPlan2D
+{
+  std::vector<RectangleGroup> groups;
+  //! smallest coordinates {y,x} of the SE
+  std::array<ptrdiff_t, 2> extent_min = { 0, 0 };
+  //! largest coordinates {y,x} of the SE
+  std::array<ptrdiff_t, 2> extent_max = { 0, 0 };
+  //! number of distinct points, ie operations per pixel of the direct neighbor list
+  std::size_t nb_points = 0;
+
+  //! Estimated operations per pixel of the plan (padding and crop included)
+  [[nodiscard]] std::size_t Cost() const noexcept;
+  //! True if the plan is cheaper than the direct neighbor list
+  [[nodiscard]] bool IsWorthIt() const noexcept { return !groups.empty() && Cost() < nb_points; }
+};
+
+//! Analyse nl and build its decomposition plan
+SE_API DecompositionPlan2D DecomposeNeighborList(const details::neighbor_list_t<2> &nl);
+
+/**
+ * @brief Decomposition plan of nl, cached by SE content
+ *
+ * Thread safe. The cache is bounded, plans stay valid as long as the returned pointer is held.
+ */
+SE_API std::shared_ptr<const DecompositionPlan2D> GetDecompositionPlan(const details::neighbor_list_t<2> &nl);
+
+//! @} doxygroup: poutre_se_decomposition_group
+}// namespace poutre::se
@@ -59,7 +59,8 @@ enum class Common_NL_SE : std::uint8_t {
 enum class Compound_NL_SE : std::uint8_t {
   Undef,
   Octagon,//!< alternate 2D Cross and Square SE
-  Rhombicuboctahedron//!< alternate 3D Cross and Square SE
+  Rhombicuboctahedron,//!< alternate 3D Cross and Square SE
+  Disk//!< 2D disk (size is the radius), periodic lines approximation for large radius
 };
 
 //! @} doxygroup: poutre_se_interface_group
@@ -3,13 +3,98 @@
 //
 // NOLINTBEGIN
 #include <nanobind/nanobind.h>
+#include <nanobind/ndarray.h>
 #include <nanobind/stl/string.h>
 #include <nanobind/stl/unique_ptr.h>
 #include <nanobind/stl/vector.h>
 #include <poutre/base/image_interface.hpp>
 
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
 namespace nb = nanobind;
 
+namespace {
+nb::dlpack::dtype ToDType(poutre::PType ptype)
+{
+  switch (ptype) {
+  case poutre::PType::PType_GrayUINT8:
+    return nb::dtype<poutre::pUINT8>();
+  case poutre::PType::PType_GrayUINT16:
+    return nb::dtype<poutre::pUINT16>();
+  case poutre::PType::PType_GrayINT16:
+    return nb::dtype<poutre::pINT16>();
+  case poutre::PType::PType_GrayINT32:
+    return nb::dtype<poutre::pINT32>();
+  case poutre::PType::PType_F32:
+    return nb::dtype<poutre::pFLOAT>();
+  case poutre::PType::PType_GrayINT64:
+    return nb::dtype<poutre::pINT64>();
+  case poutre::PType::PType_D64:
+    return nb::dtype<poutre::pDOUBLE>();
+  default:
+    throw std::runtime_error("to_numpy: unsupported ptype");
+  }
+}
+
+poutre::PType FromDType(nb::dlpack::dtype dtype)
+{
+  if (dtype == nb::dtype<poutre::pUINT8>()) { return poutre::PType::PType_GrayUINT8; }
+  if (dtype == nb::dtype<poutre::pUINT16>()) { return poutre::PType::PType_GrayUINT16; }
+  if (dtype == nb::dtype<poutre::pINT16>()) { return poutre::PType::PType_GrayINT16; }
+  if (dtype == nb::dtype<poutre::pINT32>()) { return poutre::PType::PType_GrayINT32; }
+  if (dtype == nb::dtype<poutre::pFLOAT>()) { return poutre::PType::PType_F32; }
+  if (dtype == nb::dtype<poutre::pINT64>()) { return poutre::PType::PType_GrayINT64; }
+  if (dtype == nb::dtype<poutre::pDOUBLE>()) { return poutre::PType::PType_D64; }
+  throw std::runtime_error(
+    "from_numpy: unsupported dtype, expect uint8, uint16, int16, int32, float32, int64 or float64");
+}
+
+std::size_t NbChannels(poutre::CompoundType ctype)
+{
+  switch (ctype) {
+  case poutre::CompoundType::CompoundType_Scalar:
+    return 1;
+  case poutre::CompoundType::CompoundType_3Planes:
+    return 3;
+  case poutre::CompoundType::CompoundType_4Planes:
+    return 4;
+  default:
+    throw std::runtime_error("unsupported ctype");
+  }
+}
+
+// image buffer as numpy array, no copy, compound types add a trailing channel axis
+nb::ndarray<nb::numpy> ToNumpy(poutre::IInterface &img)
+{
+  if (img.GetTileEdge() != 0) {
+    throw std::runtime_error("to_numpy: tiled images have no row major buffer, convert_into a row major image first");
+  }
+  auto shape = img.GetShape();
+  const auto nb_channels = NbChannels(img.GetCType());
+  if (nb_channels > 1) { shape.push_back(nb_channels); }
+  return nb::ndarray<nb::numpy>(
+    img.GetVoidPtr(), shape.size(), shape.data(), nb::handle(), nullptr, ToDType(img.GetPType()));
+}
+
+// wrap C-contiguous array without copy, a trailing axis of size 3/4 is read as channels if ctype is not scalar
+std::unique_ptr<poutre::IInterface> FromNumpy(nb::ndarray<nb::c_contig, nb::device::cpu> array,
+  poutre::CompoundType ctype)
+{
+  std::vector<std::size_t> shape(array.ndim());
+  for (std::size_t i = 0; i < array.ndim(); ++i) { shape[i] = array.shape(i); }
+  const auto nb_channels = NbChannels(ctype);
+  if (nb_channels > 1) {
+    if (shape.empty() || shape.back() != nb_channels) {
+      throw std::runtime_error("from_numpy: last axis must match the number of channels of ctype");
+    }
+    shape.pop_back();
+  }
+  return poutre::CreateView(array.data(), shape, ctype, FromDType(array.dtype()));
+}
+}// namespace
+
 void init_base_image(nb::module_ &mod)
 {
   nb::class_<poutre::IInterface>(mod, "Image", "Common image interface")
@@ -17,6 +102,11 @@ void init_base_image(nb::module_ &mod)
     .def("ctype", &poutre::IInterface::GetCType)
     .def("shape", &poutre::IInterface::GetShape)
     .def("rank", &poutre::IInterface::GetRank)
+    .def("tile_edge", &poutre::IInterface::GetTileEdge)
+    .def("to_numpy",
+      &ToNumpy,
+      nb::rv_policy::reference_internal,
+      "numpy array sharing the image buffer (no copy), valid while the image lives")
     .def("__repr__", &poutre::IInterface::str);
   ;
 
@@ -24,7 +114,35 @@ void init_base_image(nb::module_ &mod)
   mod.def("as_types_compatible", &poutre::AsTypesCompatible, "test if two images have compatible types");
   mod.def("are_images_different", &poutre::AreImagesDifferent, "test if two images belong to different memory");
 
-  mod.def("factory_image", &poutre::Create, "Factory to create image from given shape, types");
+  nb::enum_<poutre::AllocationMode>(mod, "AllocationMode")
+    .value("zeroed", poutre::AllocationMode::Zeroed)
+    .value("uninitialized", poutre::AllocationMode::Uninitialized)
+    .value("pooled", poutre::AllocationMode::Pooled)
+    .export_values();
+
+  mod.def("factory_image",
+    &poutre::Create,
+    nb::arg("shape"),
+    nb::arg("ctype"),
+    nb::arg("ptype"),
+    nb::arg("mode") = poutre::AllocationMode::Zeroed,
+    "Factory to create image from given shape, types, zero filled unless mode is uninitialized");
+
+  mod.def("factory_tiled_image",
+    &poutre::CreateTiled,
+    nb::arg("shape"),
+    nb::arg("ctype"),
+    nb::arg("ptype"),
+    nb::arg("tile_edge") = 0,
+    nb::arg("mode") = poutre::AllocationMode::Zeroed,
+    "Factory to create image stored tile by tile, tile_edge 0 for the default of the rank");
+
+  mod.def("from_numpy",
+    &FromNumpy,
+    nb::arg("array").noconvert(),
+    nb::arg("ctype") = poutre::CompoundType::CompoundType_Scalar,
+    nb::keep_alive<0, 1>(),
+    "Wrap a C-contiguous numpy array as image without copy, usable as input or output of any operator");
 
   mod.def("from_string", &poutre::ImageFromString, "Factory to create image from given string");
   mod.def("to_string", &poutre::ImageToString, "Serialize the whole image to string");
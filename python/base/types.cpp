@@ -9,7 +9,10 @@ namespace nb = nanobind;
 void init_base_types(nb::module_ &mod)
 {
   nb::enum_<poutre::PType>(mod, "PType")
+    .value("BinPack", poutre::PType::PType_BinPack)
     .value("GrayUINT8", poutre::PType::PType_GrayUINT8)
+    .value("GrayUINT16", poutre::PType::PType_GrayUINT16)
+    .value("GrayINT16", poutre::PType::PType_GrayINT16)
     .value("GrayINT32", poutre::PType::PType_GrayINT32)
     .value("GrayINT64", poutre::PType::PType_GrayINT64)
     .value("F32", poutre::PType::PType_F32)
@@ -16,16 +16,16 @@ void init_geodesy(nb::module_ &mod)
     .value("erode", poutre::geo::reconstruction_type::erode)
     .export_values();
 
-  mod.def("h_minima", &poutre::geo::h_maxima);
-  mod.def("h_minima", &poutre::geo::h_minima);
-  mod.def("h_concave", &poutre::geo::h_concave);
-  mod.def("h_convex", &poutre::geo::h_convex);
-  mod.def("dynamic_pseudo_closing", &poutre::geo::dynamic_pseudo_closing);
-  mod.def("dynamic_pseudo_opening", &poutre::geo::dynamic_pseudo_opening);
+  mod.def("h_maxima", &poutre::geo::h_maxima, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("h_minima", &poutre::geo::h_minima, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("h_concave", &poutre::geo::h_concave, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("h_convex", &poutre::geo::h_convex, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("dynamic_pseudo_closing", &poutre::geo::dynamic_pseudo_closing, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("dynamic_pseudo_opening", &poutre::geo::dynamic_pseudo_opening, nb::call_guard<nb::gil_scoped_release>());
 
-  mod.def("high_leveling", &poutre::geo::high_leveling);
-  mod.def("low_leveling", &poutre::geo::low_leveling);
-  mod.def("leveling", &poutre::geo::leveling);
+  mod.def("high_leveling", &poutre::geo::high_leveling, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("low_leveling", &poutre::geo::low_leveling, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("leveling", &poutre::geo::leveling, nb::call_guard<nb::gil_scoped_release>());
 }
 
 // NOLINTEND
\ No newline at end of file
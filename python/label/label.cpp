@@ -3,16 +3,51 @@
 //
 // NOLINTBEGIN
 #include <nanobind/nanobind.h>
+#include <nanobind/stl/vector.h>
 #include <poutre/label/label_binary.hpp>
 #include <poutre/label/label_extrema.hpp>
 #include <poutre/label/label_flat_zones.hpp>
+#include <poutre/label/label_statistics.hpp>
 
 namespace nb = nanobind;
 
 void init_label(nb::module_ &mod)
 {
-  mod.def("label_binary", &poutre::label::label_binary);
-  mod.def("label_flat_zones", &poutre::label::label_flat_zones);
-  mod.def("label_maxima", &poutre::label::label_maxima);
-  mod.def("label_minima", &poutre::label::label_minima);
-}
\ No newline at end of file
+  nb::class_<poutre::label::LabelStatistics>(
+    mod, "LabelStatistics", "Statistics of each label, entry i refers to label i+1, coordinates are flattened by rank")
+    .def(nb::init<>())
+    .def("size", &poutre::label::LabelStatistics::size)
+    .def_ro("rank", &poutre::label::LabelStatistics::rank)
+    .def_ro("area", &poutre::label::LabelStatistics::area)
+    .def_ro("bbox_min", &poutre::label::LabelStatistics::bbox_min)
+    .def_ro("bbox_max", &poutre::label::LabelStatistics::bbox_max)
+    .def_ro("first_pixel", &poutre::label::LabelStatistics::first_pixel)
+    .def_ro("centroid", &poutre::label::LabelStatistics::centroid)
+    .def_ro("sum", &poutre::label::LabelStatistics::sum)
+    .def_ro("min", &poutre::label::LabelStatistics::min)
+    .def_ro("max", &poutre::label::LabelStatistics::max);
+
+  mod.def("label_binary",
+    nb::overload_cast<const poutre::IInterface &, poutre::se::Common_NL_SE, poutre::IInterface &>(
+      &poutre::label::label_binary),
+    nb::call_guard<nb::gil_scoped_release>());
+  mod.def("label_binary",
+    nb::overload_cast<const poutre::IInterface &,
+      poutre::se::Common_NL_SE,
+      poutre::IInterface &,
+      poutre::label::LabelStatistics &>(&poutre::label::label_binary),
+    nb::call_guard<nb::gil_scoped_release>());
+  mod.def("label_flat_zones",
+    nb::overload_cast<const poutre::IInterface &, poutre::se::Common_NL_SE, poutre::IInterface &>(
+      &poutre::label::label_flat_zones),
+    nb::call_guard<nb::gil_scoped_release>());
+  mod.def("label_flat_zones",
+    nb::overload_cast<const poutre::IInterface &,
+      poutre::se::Common_NL_SE,
+      poutre::IInterface &,
+      poutre::label::LabelStatistics &>(&poutre::label::label_flat_zones),
+    nb::call_guard<nb::gil_scoped_release>());
+  mod.def("label_maxima", &poutre::label::label_maxima, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("label_minima", &poutre::label::label_minima, nb::call_guard<nb::gil_scoped_release>());
+}
+// NOLINTEND
@@ -12,18 +12,28 @@ namespace nb = nanobind;
 void init_llm_ero_dil(nb::module_ &mod)
 {
   mod.def("erode",// cppcheck-suppress cstyleCast
-    static_cast<void (*)(const poutre::IInterface &, poutre::se::Common_NL_SE, const int, poutre::IInterface &)>(&poutre::Erode));
+    static_cast<void (*)(const poutre::IInterface &, poutre::se::Common_NL_SE, const int, poutre::IInterface &)>(&poutre::Erode),
+    nb::call_guard<nb::gil_scoped_release>());
   mod.def("erode",// cppcheck-suppress cstyleCast
-    static_cast<void (*)(const poutre::IInterface &, poutre::se::Compound_NL_SE, const int, poutre::IInterface &)>(&poutre::Erode));
+    static_cast<void (*)(const poutre::IInterface &, poutre::se::Compound_NL_SE, const int, poutre::IInterface &)>(&poutre::Erode),
+    nb::call_guard<nb::gil_scoped_release>());
   mod.def("dilate",// cppcheck-suppress cstyleCast
-    static_cast<void (*)(const poutre::IInterface &, poutre::se::Common_NL_SE, const int, poutre::IInterface &)>(&poutre::Dilate));
+    static_cast<void (*)(const poutre::IInterface &, poutre::se::Common_NL_SE, const int, poutre::IInterface &)>(&poutre::Dilate),
+    nb::call_guard<nb::gil_scoped_release>());
   mod.def("dilate",// cppcheck-suppress cstyleCast
-    static_cast<void (*)(const poutre::IInterface &, poutre::se::Compound_NL_SE, const int, poutre::IInterface &)>(&poutre::Dilate));
+    static_cast<void (*)(const poutre::IInterface &, poutre::se::Compound_NL_SE, const int, poutre::IInterface &)>(&poutre::Dilate),
+    nb::call_guard<nb::gil_scoped_release>());
 
-  mod.def("dilateX", &poutre::DilateX);
-  mod.def("dilateY", &poutre::DilateY);
-  mod.def("erodeX", &poutre::ErodeX);
-  mod.def("erodeY", &poutre::ErodeY);
+  mod.def("dilateX", &poutre::DilateX, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("dilateY", &poutre::DilateY, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("erodeX", &poutre::ErodeX, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("erodeY", &poutre::ErodeY, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("dilateRect", &poutre::DilateRect, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("erodeRect", &poutre::ErodeRect, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("dilateLine", &poutre::DilateLine, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("erodeLine", &poutre::ErodeLine, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("dilatePeriodicLine", &poutre::DilatePeriodicLine, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("erodePeriodicLine", &poutre::ErodePeriodicLine, nb::call_guard<nb::gil_scoped_release>());
 }
 
 // NOLINTEND
\ No newline at end of file
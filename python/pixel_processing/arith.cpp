@@ -10,12 +10,12 @@ namespace nb = nanobind;
 
 void init_pp_arith(nb::module_ &mod)
 {
-  mod.def("arith_invert_image", &poutre::ArithInvertImage);
-  mod.def("arith_inf_image", &poutre::ArithInfImage);
-  mod.def("arith_sup_image", &poutre::ArithSupImage);
-  mod.def("arith_saturated_add_image", &poutre::ArithSaturatedAddImage);
-  mod.def("arith_saturated_sub_image", &poutre::ArithSaturatedSubImage);
-  mod.def("arith_saturated_add_constant", &poutre::ArithSaturatedAddConstant);
-  mod.def("arith_saturated_sub_constant", &poutre::ArithSaturatedSubConstant);
+  mod.def("arith_invert_image", &poutre::ArithInvertImage, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("arith_inf_image", &poutre::ArithInfImage, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("arith_sup_image", &poutre::ArithSupImage, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("arith_saturated_add_image", &poutre::ArithSaturatedAddImage, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("arith_saturated_sub_image", &poutre::ArithSaturatedSubImage, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("arith_saturated_add_constant", &poutre::ArithSaturatedAddConstant, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("arith_saturated_sub_constant", &poutre::ArithSaturatedSubConstant, nb::call_guard<nb::gil_scoped_release>());
 }
 // NOLINTEND
\ No newline at end of file
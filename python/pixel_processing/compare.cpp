@@ -18,7 +18,8 @@ void init_pp_compare(nb::module_ &mod)
       const poutre::ScalarTypeVariant &,
       const poutre::ScalarTypeVariant &,
       const poutre::ScalarTypeVariant &,
-      poutre::IInterface &)>(&poutre::CompareImage));
+      poutre::IInterface &)>(&poutre::CompareImage),
+    nb::call_guard<nb::gil_scoped_release>());
 
   mod.def("compare",// cppcheck-suppress cstyleCast
     static_cast<void (*)(const poutre::IInterface &,
@@ -26,7 +27,8 @@ void init_pp_compare(nb::module_ &mod)
       const poutre::IInterface &,
       const poutre::IInterface &,
       const poutre::IInterface &,
-      poutre::IInterface &)>(&poutre::CompareImage));
+      poutre::IInterface &)>(&poutre::CompareImage),
+    nb::call_guard<nb::gil_scoped_release>());
 
   mod.def("compare",// cppcheck-suppress cstyleCast
     static_cast<void (*)(const poutre::IInterface &,
@@ -34,7 +36,8 @@ void init_pp_compare(nb::module_ &mod)
       const poutre::ScalarTypeVariant &,
       const poutre::IInterface &,
       const poutre::IInterface &,
-      poutre::IInterface &)>(&poutre::CompareImage));
+      poutre::IInterface &)>(&poutre::CompareImage),
+    nb::call_guard<nb::gil_scoped_release>());
 
 
   mod.def("compare",// cppcheck-suppress cstyleCast
@@ -43,7 +46,8 @@ void init_pp_compare(nb::module_ &mod)
       const poutre::ScalarTypeVariant &,
       const poutre::IInterface &,
       const poutre::ScalarTypeVariant &,
-      poutre::IInterface &)>(&poutre::CompareImage));
+      poutre::IInterface &)>(&poutre::CompareImage),
+    nb::call_guard<nb::gil_scoped_release>());
 
   mod.def("compare",// cppcheck-suppress cstyleCast
     static_cast<void (*)(const poutre::IInterface &,
@@ -51,7 +55,8 @@ void init_pp_compare(nb::module_ &mod)
       const poutre::IInterface &,
       const poutre::ScalarTypeVariant &,
       const poutre::IInterface &,
-      poutre::IInterface &)>(&poutre::CompareImage));
+      poutre::IInterface &)>(&poutre::CompareImage),
+    nb::call_guard<nb::gil_scoped_release>());
 
   mod.def("compare",// cppcheck-suppress cstyleCast
     static_cast<void (*)(const poutre::IInterface &,
@@ -59,7 +64,8 @@ void init_pp_compare(nb::module_ &mod)
       const poutre::IInterface &,
       const poutre::ScalarTypeVariant &,
       const poutre::ScalarTypeVariant &,
-      poutre::IInterface &)>(&poutre::CompareImage));
+      poutre::IInterface &)>(&poutre::CompareImage),
+    nb::call_guard<nb::gil_scoped_release>());
 
   mod.def("compare",// cppcheck-suppress cstyleCast
     static_cast<void (*)(const poutre::IInterface &,
@@ -67,7 +73,8 @@ void init_pp_compare(nb::module_ &mod)
       const poutre::ScalarTypeVariant &,
       const poutre::ScalarTypeVariant &,
       const poutre::IInterface &,
-      poutre::IInterface &)>(&poutre::CompareImage));
+      poutre::IInterface &)>(&poutre::CompareImage),
+    nb::call_guard<nb::gil_scoped_release>());
 
   mod.def("compare",// cppcheck-suppress cstyleCast
     static_cast<void (*)(const poutre::IInterface &,
@@ -75,7 +82,8 @@ void init_pp_compare(nb::module_ &mod)
       const poutre::IInterface &,
       const poutre::IInterface &,
       const poutre::ScalarTypeVariant &,
-      poutre::IInterface &)>(&poutre::CompareImage));
+      poutre::IInterface &)>(&poutre::CompareImage),
+    nb::call_guard<nb::gil_scoped_release>());
 }
 
 // NOLINTEND
\ No newline at end of file
@@ -11,14 +11,24 @@ namespace nb = nanobind;
 
 void init_pp_copy_convert(nb::module_ &mod)
 {
-  mod.def("clone", &poutre::Clone);
-  mod.def("clone_geometry", &poutre::CloneGeometry);
-  mod.def("convert", &poutre::Convert);
+  mod.def("clone", &poutre::Clone, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("clone_geometry",
+    &poutre::CloneGeometry,
+    nb::arg("img"),
+    nb::arg("mode") = poutre::AllocationMode::Zeroed,
+    nb::call_guard<nb::gil_scoped_release>());
+  mod.def("convert", &poutre::Convert, nb::call_guard<nb::gil_scoped_release>());
   mod.def("convert_geometry",// cppcheck-suppress cstyleCast
     static_cast<std::unique_ptr<poutre::IInterface> (*)(
-      const poutre::IInterface &, poutre::CompoundType, poutre::PType)>(&poutre::ConvertGeometry));
-  mod.def("copy_into", &poutre::CopyInto);
-  mod.def("convert_into", &poutre::ConvertInto);
+      const poutre::IInterface &, poutre::CompoundType, poutre::PType, poutre::AllocationMode)>(
+      &poutre::ConvertGeometry),
+    nb::arg("img"),
+    nb::arg("ctype"),
+    nb::arg("ptype"),
+    nb::arg("mode") = poutre::AllocationMode::Zeroed,
+    nb::call_guard<nb::gil_scoped_release>());
+  mod.def("copy_into", &poutre::CopyInto, nb::call_guard<nb::gil_scoped_release>());
+  mod.def("convert_into", &poutre::ConvertInto, nb::call_guard<nb::gil_scoped_release>());
 }
 
 // NOLINTEND
\ No newline at end of file
@@ -32,6 +32,7 @@ void init_se_types(nb::module_ &mod)
   nb::enum_<poutre::se::Compound_NL_SE>(mod, "static_compound_se")
     .value("octagon", poutre::se::Compound_NL_SE::Octagon)
     .value("rhombicuboctahedron", poutre::se::Compound_NL_SE::Rhombicuboctahedron)
+    .value("disk", poutre::se::Compound_NL_SE::Disk)
     .export_values();
 }
 // NOLINTEND
\ No newline at end of file
@@ -0,0 +1,276 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <poutre/base/buffer_pool.hpp>
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/simd/simd_arch.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace poutre {
+
+BufferPool *BufferPool::m_instance;
+std::once_flag BufferPool::m_initFlag;
+
+namespace {
+  constexpr std::align_val_t pool_alignment{ SIMD_IDEAL_MAX_ALIGN_BYTES };
+
+  void FreeBuffer(void *buffer) POUTRE_NOEXCEPT { ::operator delete(buffer, pool_alignment); }
+
+  //! Cached buffers of one size class
+  struct Shelf
+  {
+    std::size_t bytes = 0;
+    std::vector<void *> buffers;
+  };
+
+  //! Cache of free buffers by size class
+  struct Cache
+  {
+    std::map<BufferPoolKey, Shelf> shelves;
+    std::size_t bytes = 0;
+
+    //! nullptr if no buffer cached for key
+    void *Pop(const BufferPoolKey &key)
+    {
+      const auto it = shelves.find(key);
+      if (it == shelves.end() || it->second.buffers.empty()) { return nullptr; }
+      void *buffer = it->second.buffers.back();
+      it->second.buffers.pop_back();
+      bytes -= it->second.bytes;
+      return buffer;
+    }
+
+    void Push(const BufferPoolKey &key, void *buffer, std::size_t nbbytes)
+    {
+      auto &shelf = shelves[key];
+      shelf.bytes = nbbytes;
+      shelf.buffers.push_back(buffer);
+      bytes += nbbytes;
+    }
+  };
+
+  //! set once the cache of the calling thread is destroyed (thread exit), trivially destructible on purpose
+  thread_local bool tl_cache_destroyed = false;// NOLINT
+}// namespace
+
+struct BufferPool::Impl
+{
+  //! Cache of the calling thread, registered so that Trim reaches it, given back to the shared cache on thread exit
+  struct LocalCache
+  {
+    //! only contended while another thread trims
+    std::mutex mutex;
+    Cache cache;
+    LocalCache()
+    {
+      auto &impl = *BufferPool::get().m_impl;
+      const std::scoped_lock lock(impl.locals_mutex);
+      impl.locals.push_back(this);
+    }
+    LocalCache(const LocalCache &) = delete;
+    LocalCache &operator=(const LocalCache &) = delete;
+    LocalCache(LocalCache &&) = delete;
+    LocalCache &operator=(LocalCache &&) = delete;
+    ~LocalCache()
+    {
+      tl_cache_destroyed = true;
+      auto &impl = *BufferPool::get().m_impl;
+      {
+        const std::scoped_lock lock(impl.locals_mutex);
+        std::erase(impl.locals, this);
+      }
+      for (auto &[key, shelf] : cache.shelves) {
+        for (void *buffer : shelf.buffers) {
+          impl.Uncached(shelf.bytes);
+          impl.ReleaseShared(key, buffer, shelf.bytes);
+        }
+      }
+    }
+  };
+
+  //! nullptr after thread exit
+  static LocalCache *ThreadCache()
+  {
+    if (tl_cache_destroyed) { return nullptr; }
+    thread_local LocalCache local;
+    return &local;
+  }
+
+  //! guard locals, taken before the mutex of a LocalCache
+  std::mutex locals_mutex;
+  //! caches of live threads
+  std::vector<LocalCache *> locals;
+
+  std::atomic<std::size_t> thread_capacity = BufferPool::default_thread_capacity;
+  std::atomic<std::size_t> global_capacity = BufferPool::default_global_capacity;
+
+  std::atomic<std::size_t> local_hits = 0;
+  std::atomic<std::size_t> global_hits = 0;
+  std::atomic<std::size_t> misses = 0;
+  std::atomic<std::size_t> releases = 0;
+  std::atomic<std::size_t> evictions = 0;
+  //! over all caches, thread ones included
+  std::atomic<std::size_t> cached_buffers = 0;
+  std::atomic<std::size_t> cached_bytes = 0;
+
+  //! guard shared
+  std::mutex mutex;
+  Cache shared;
+
+  void Uncached(std::size_t nbbytes)
+  {
+    cached_buffers.fetch_sub(1, std::memory_order_relaxed);
+    cached_bytes.fetch_sub(nbbytes, std::memory_order_relaxed);
+  }
+
+  void Cached(std::size_t nbbytes)
+  {
+    cached_buffers.fetch_add(1, std::memory_order_relaxed);
+    cached_bytes.fetch_add(nbbytes, std::memory_order_relaxed);
+  }
+
+  void Evict(void *buffer)
+  {
+    evictions.fetch_add(1, std::memory_order_relaxed);
+    FreeBuffer(buffer);
+  }
+
+  //! keep buffer in the shared cache if it fits, free it otherwise
+  void ReleaseShared(const BufferPoolKey &key, void *buffer, std::size_t nbbytes) POUTRE_NOEXCEPT
+  {
+    try {
+      const std::scoped_lock lock(mutex);
+      if (shared.bytes + nbbytes <= global_capacity.load()) {
+        shared.Push(key, buffer, nbbytes);
+        Cached(nbbytes);
+        return;
+      }
+    } catch (...) {// NOLINT(bugprone-empty-catch) bookkeeping allocation failure, the buffer is freed below
+    }
+    Evict(buffer);
+  }
+
+  void Clear(Cache &cache)
+  {
+    for (auto &[key, shelf] : cache.shelves) {
+      for (void *buffer : shelf.buffers) {
+        Uncached(shelf.bytes);
+        Evict(buffer);
+      }
+    }
+    cache.shelves.clear();
+    cache.bytes = 0;
+  }
+};
+
+BufferPool::BufferPool() : m_impl(std::make_unique<Impl>()) {}
+
+BufferPool::~BufferPool()
+{
+  const std::scoped_lock lock(m_impl->mutex);
+  m_impl->Clear(m_impl->shared);
+}
+
+void *BufferPool::Acquire(const BufferPoolKey &key, std::size_t bytes)
+{
+  POUTRE_CHECK(bytes > 0, "BufferPool::Acquire bytes must be > 0");
+  if (auto *local = Impl::ThreadCache(); local != nullptr) {
+    const std::scoped_lock lock(local->mutex);
+    if (void *buffer = local->cache.Pop(key); buffer != nullptr) {
+      m_impl->Uncached(bytes);
+      m_impl->local_hits.fetch_add(1, std::memory_order_relaxed);
+      return buffer;
+    }
+  }
+  {
+    const std::scoped_lock lock(m_impl->mutex);
+    if (void *buffer = m_impl->shared.Pop(key); buffer != nullptr) {
+      m_impl->Uncached(bytes);
+      m_impl->global_hits.fetch_add(1, std::memory_order_relaxed);
+      return buffer;
+    }
+  }
+  m_impl->misses.fetch_add(1, std::memory_order_relaxed);
+  return ::operator new(bytes, pool_alignment);
+}
+
+void BufferPool::Release(const BufferPoolKey &key, void *buffer, std::size_t bytes) POUTRE_NOEXCEPT
+{
+  if (buffer == nullptr) { return; }
+  m_impl->releases.fetch_add(1, std::memory_order_relaxed);
+  if (auto *local = Impl::ThreadCache(); local != nullptr) {
+    const std::scoped_lock lock(local->mutex);
+    if (local->cache.bytes + bytes <= m_impl->thread_capacity.load()) {
+      try {
+        local->cache.Push(key, buffer, bytes);
+        m_impl->Cached(bytes);
+        return;
+      } catch (...) {// NOLINT(bugprone-empty-catch) bookkeeping allocation failure, try the shared cache
+      }
+    }
+  }
+  m_impl->ReleaseShared(key, buffer, bytes);
+}
+
+void BufferPool::Trim()
+{
+  {
+    // idle pool workers hold their caches forever, so every thread cache is emptied, not only the calling one
+    const std::scoped_lock lock(m_impl->locals_mutex);
+    for (auto *local : m_impl->locals) {
+      const std::scoped_lock local_lock(local->mutex);
+      m_impl->Clear(local->cache);
+    }
+  }
+  const std::scoped_lock lock(m_impl->mutex);
+  m_impl->Clear(m_impl->shared);
+}
+
+void BufferPool::SetThreadCapacity(std::size_t bytes) { m_impl->thread_capacity.store(bytes); }
+
+std::size_t BufferPool::GetThreadCapacity() const { return m_impl->thread_capacity.load(); }
+
+void BufferPool::SetGlobalCapacity(std::size_t bytes) { m_impl->global_capacity.store(bytes); }
+
+std::size_t BufferPool::GetGlobalCapacity() const { return m_impl->global_capacity.load(); }
+
+BufferPoolStats BufferPool::GetStats() const
+{
+  BufferPoolStats stats;
+  stats.local_hits = m_impl->local_hits.load(std::memory_order_relaxed);
+  stats.global_hits = m_impl->global_hits.load(std::memory_order_relaxed);
+  stats.misses = m_impl->misses.load(std::memory_order_relaxed);
+  stats.releases = m_impl->releases.load(std::memory_order_relaxed);
+  stats.evictions = m_impl->evictions.load(std::memory_order_relaxed);
+  stats.cached_buffers = m_impl->cached_buffers.load(std::memory_order_relaxed);
+  stats.cached_bytes = m_impl->cached_bytes.load(std::memory_order_relaxed);
+  return stats;
+}
+
+void BufferPool::ResetStats()
+{
+  m_impl->local_hits.store(0);
+  m_impl->global_hits.store(0);
+  m_impl->misses.store(0);
+  m_impl->releases.store(0);
+  m_impl->evictions.store(0);
+}
+
+}// namespace poutre
@@ -0,0 +1,177 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#if defined(__linux__) || defined(_WIN32)
+#define BS_THREAD_POOL_NATIVE_EXTENSIONS
+#define POUTRE_HAS_THREAD_AFFINITY
+#endif
+#include <BS_thread_pool.hpp>
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/trace.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace poutre {
+
+ExecutionContext *ExecutionContext::m_instance;
+std::once_flag ExecutionContext::m_initFlag;
+
+namespace {
+  thread_local bool tl_is_worker = false;// NOLINT
+
+  //! Mark calling thread as running a block, so that nested parallel calls stay serial
+  struct ScopedWorker
+  {
+    bool previous;
+    ScopedWorker() : previous(tl_is_worker) { tl_is_worker = true; }
+    ScopedWorker(const ScopedWorker &) = delete;
+    ScopedWorker &operator=(const ScopedWorker &) = delete;
+    ScopedWorker(ScopedWorker &&) = delete;
+    ScopedWorker &operator=(ScopedWorker &&) = delete;
+    ~ScopedWorker() { tl_is_worker = previous; }
+  };
+
+  std::size_t HardwareConcurrency()
+  {
+    const auto nbthreads = static_cast<std::size_t>(std::thread::hardware_concurrency());
+    return nbthreads > 0 ? nbthreads : 1;
+  }
+}// namespace
+
+struct ExecutionContext::Impl
+{
+  //! settings are read on every kernel call, keep them lock free
+  std::atomic<std::size_t> nbthreads = HardwareConcurrency();
+  std::atomic<std::size_t> grain = ExecutionContext::default_grain_size;
+  std::atomic<bool> pinning = false;
+  //! guard pool (re)creation
+  std::mutex mutex;
+  //! shared_ptr so that running ParallelFor keep the pool alive while the context is reconfigured
+  std::shared_ptr<BS::light_thread_pool> pool;
+
+  std::shared_ptr<BS::light_thread_pool> GetPool()
+  {
+    const std::scoped_lock lock(mutex);
+    if (!pool) {
+      // calling thread process one block itself
+      const auto nbworkers = std::max<std::size_t>(nbthreads.load() - 1, 1);
+      const bool pin = pinning.load();
+      pool = std::make_shared<BS::light_thread_pool>(nbworkers, [pin]() {
+        tl_is_worker = true;
+#ifdef POUTRE_HAS_THREAD_AFFINITY
+        if (pin) {
+          const auto nbcores = HardwareConcurrency();
+          const auto index = BS::this_thread::get_index();
+          if (index.has_value()) {
+            std::vector<bool> affinity(nbcores, false);
+            // keep core 0 for calling thread
+            affinity[(index.value() + 1) % nbcores] = true;
+            BS::this_thread::set_os_thread_affinity(affinity);
+          }
+        }
+#else
+        (void)pin;
+#endif
+      });
+    }
+    return pool;
+  }
+};
+
+ExecutionContext::ExecutionContext() : m_impl(std::make_unique<Impl>()) {}
+
+ExecutionContext::~ExecutionContext() = default;
+
+void ExecutionContext::SetNumThreads(std::size_t nbthreads)
+{
+  const std::scoped_lock lock(m_impl->mutex);
+  m_impl->nbthreads = nbthreads == 0 ? HardwareConcurrency() : nbthreads;
+  m_impl->pool.reset();
+}
+
+std::size_t ExecutionContext::GetNumThreads() const { return m_impl->nbthreads.load(); }
+
+void ExecutionContext::SetGrainSize(std::size_t grain)
+{
+  POUTRE_CHECK(grain > 0, "ExecutionContext::SetGrainSize grain must be >0");
+  m_impl->grain = grain;
+}
+
+std::size_t ExecutionContext::GetGrainSize() const { return m_impl->grain.load(); }
+
+void ExecutionContext::SetPinning(bool pinning)
+{
+  const std::scoped_lock lock(m_impl->mutex);
+  if (m_impl->pinning.exchange(pinning) != pinning) { m_impl->pool.reset(); }
+}
+
+bool ExecutionContext::GetPinning() const { return m_impl->pinning.load(); }
+
+bool ExecutionContext::IsWorkerThread() POUTRE_NOEXCEPT { return tl_is_worker; }
+
+std::size_t ExecutionContext::ComputeBlockSize(std::size_t length, std::size_t step) const
+{
+  if (IsWorkerThread()) { return length; }
+  const std::size_t nbthreads = m_impl->nbthreads.load();
+  const std::size_t grain = m_impl->grain.load();
+  if (nbthreads <= 1 || length < 2 * grain) { return length; }
+  step = std::max<std::size_t>(step, 1);
+  const auto nbblocks = nbthreads * blocks_per_thread;
+  auto block_size = std::max(grain, (length + nbblocks - 1) / nbblocks);
+  // reach next multiple of step
+  block_size = ((block_size + step - 1) / step) * step;
+  return std::min(block_size, length);
+}
+
+void ExecutionContext::ParallelFor(std::size_t nbblocks, const std::function<void(std::size_t)> &task)
+{
+  POUTRE_ENTERING("ExecutionContext::ParallelFor");
+  if (nbblocks == 0) { return; }
+  if (nbblocks == 1 || IsWorkerThread()) {
+    for (std::size_t i = 0; i < nbblocks; ++i) { task(i); }
+    return;
+  }
+  auto pool = m_impl->GetPool();
+  std::vector<std::future<void>> futures;
+  futures.reserve(nbblocks - 1);
+  for (std::size_t i = 0; i < nbblocks - 1; ++i) {
+    futures.push_back(pool->submit_task([&task, i]() { task(i); }));
+  }
+  // epilogue last part, always wait for submitted blocks before leaving as they reference task
+  std::exception_ptr error;
+  try {
+    const ScopedWorker guard;
+    task(nbblocks - 1);
+  } catch (...) {
+    error = std::current_exception();
+  }
+  for (auto &fut : futures) {
+    try {
+      fut.get();
+    } catch (...) {
+      if (!error) { error = std::current_exception(); }
+    }
+  }
+  if (error) { std::rethrow_exception(error); }
+}
+
+}// namespace poutre
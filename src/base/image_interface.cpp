@@ -17,12 +17,14 @@
 #include <ostream>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/data_structures/image_tiled_t.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace poutre {
@@ -77,24 +79,55 @@ void AssertImagesAreDifferent(const IInterface &i_img1, const IInterface &i_img2
   if (!AreImagesDifferent(i_img1, i_img2)) { POUTRE_RUNTIME_ERROR(i_msg); }
 }
 
+void AssertLayoutsCompatible(const IInterface &i_img1, const IInterface &i_img2, const std::string &i_msg)
+{
+  POUTRE_ENTERING("AssertLayoutsCompatible");
+  if (i_img1.GetTileEdge() != i_img2.GetTileEdge()) { POUTRE_RUNTIME_ERROR(i_msg); }
+}
+
 // TODO FACTORIZE DISPATCH
 
+//! External storage to wrap, none if data is null
+struct ExternalBuffer
+{
+  void *data = nullptr;
+  //! kept alive by the image
+  std::shared_ptr<void> owner;
+};
+
+//! Allocate image (zero filled or not following mode) or wrap buffer (no copy) if not null
+template<class ImgType>
+std::unique_ptr<IInterface>
+  MakeImage(const std::vector<std::size_t> &dims, const ExternalBuffer &buffer, AllocationMode mode)
+{
+  if (buffer.data == nullptr) { return std::make_unique<ImgType>(dims, mode); }
+  return std::make_unique<ImgType>(static_cast<typename ImgType::pointer>(buffer.data), dims, buffer.owner);
+}
+
 // NDIMS
 template<std::ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateDenseDispatchPTypeScalar(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateDenseDispatchPTypeScalar(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
-  // todo think about bool/binary here
+  case PType::PType_BinPack:
+    return MakeImage<details::image_t<pBinPack, numDims>>(dims, buffer, mode);
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<pUINT8, numDims>>(dims);
+    return MakeImage<details::image_t<pUINT8, numDims>>(dims, buffer, mode);
+  case PType::PType_GrayUINT16:
+    return MakeImage<details::image_t<pUINT16, numDims>>(dims, buffer, mode);
+  case PType::PType_GrayINT16:
+    return MakeImage<details::image_t<pINT16, numDims>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<pINT32, numDims>>(dims);
+    return MakeImage<details::image_t<pINT32, numDims>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<pFLOAT, numDims>>(dims);
+    return MakeImage<details::image_t<pFLOAT, numDims>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<pINT64, numDims>>(dims);
+    return MakeImage<details::image_t<pINT64, numDims>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<pDOUBLE, numDims>>(dims);
+    return MakeImage<details::image_t<pDOUBLE, numDims>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateDenseDispatchPTypeScalar:: Unsupported scalar type:{}", ptype));
   }
@@ -102,20 +135,23 @@ std::unique_ptr<IInterface> CreateDenseDispatchPTypeScalar(const std::vector<std
 }
 
 template<std::ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateDenseDispatchPType3PLanes(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateDenseDispatchPType3PLanes(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
     // todo think about bool/binary here
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<compound_type<pUINT8, 3>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pUINT8, 3>, numDims>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<compound_type<pINT32, 3>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT32, 3>, numDims>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<compound_type<pFLOAT, 3>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pFLOAT, 3>, numDims>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<compound_type<pINT64, 3>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT64, 3>, numDims>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<compound_type<pDOUBLE, 3>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pDOUBLE, 3>, numDims>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateDenseDispatchPType3PLanes:: Unsupported compound type 3 with {}", ptype));
   }
@@ -123,20 +159,23 @@ std::unique_ptr<IInterface> CreateDenseDispatchPType3PLanes(const std::vector<st
 }
 
 template<std::ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateDenseDispatchPType4PLanes(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateDenseDispatchPType4PLanes(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
     // todo think about bool/binary here
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<compound_type<pUINT8, 4>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pUINT8, 4>, numDims>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<compound_type<pINT32, 4>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT32, 4>, numDims>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<compound_type<pFLOAT, 4>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pFLOAT, 4>, numDims>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<compound_type<pINT64, 4>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT64, 4>, numDims>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<compound_type<pDOUBLE, 4>, numDims>>(dims);
+    return MakeImage<details::image_t<compound_type<pDOUBLE, 4>, numDims>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateDenseDispatchPType3PLanes:: Unsupported compound type 3 with {}", ptype));
   }
@@ -144,18 +183,21 @@ std::unique_ptr<IInterface> CreateDenseDispatchPType4PLanes(const std::vector<st
 }
 
 template<std::ptrdiff_t numDims>
-std::unique_ptr<IInterface>
-  CreateDenseDispatchDims(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype)
+std::unique_ptr<IInterface> CreateDenseDispatchDims(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  CompoundType ctype,
+  PType ptype)
 {
   switch (ctype) {
   case CompoundType::CompoundType_Scalar: {
-    return CreateDenseDispatchPTypeScalar<numDims>(dims, ptype);
+    return CreateDenseDispatchPTypeScalar<numDims>(dims, buffer, mode, ptype);
   }
   case CompoundType::CompoundType_3Planes: {
-    return CreateDenseDispatchPType3PLanes<numDims>(dims, ptype);
+    return CreateDenseDispatchPType3PLanes<numDims>(dims, buffer, mode, ptype);
   }
   case CompoundType::CompoundType_4Planes: {
-    return CreateDenseDispatchPType4PLanes<numDims>(dims, ptype);
+    return CreateDenseDispatchPType4PLanes<numDims>(dims, buffer, mode, ptype);
   }
   default: {
     POUTRE_RUNTIME_ERROR(std::format("Unsupported compound type:{}", ctype));
@@ -165,20 +207,28 @@ std::unique_ptr<IInterface>
 
 // 1D
 template<std::ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateImage1DDispatchPTypeScalar(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateImage1DDispatchPTypeScalar(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
-  // todo think about bool/binary here
+  case PType::PType_BinPack:
+    return MakeImage<details::image_t<pBinPack, 1>>(dims, buffer, mode);
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<pUINT8, 1>>(dims);
+    return MakeImage<details::image_t<pUINT8, 1>>(dims, buffer, mode);
+  case PType::PType_GrayUINT16:
+    return MakeImage<details::image_t<pUINT16, 1>>(dims, buffer, mode);
+  case PType::PType_GrayINT16:
+    return MakeImage<details::image_t<pINT16, 1>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<pINT32, 1>>(dims);
+    return MakeImage<details::image_t<pINT32, 1>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<pFLOAT, 1>>(dims);
+    return MakeImage<details::image_t<pFLOAT, 1>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<pINT64, 1>>(dims);
+    return MakeImage<details::image_t<pINT64, 1>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<pDOUBLE, 1>>(dims);
+    return MakeImage<details::image_t<pDOUBLE, 1>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateImage1DDispatchPTypeScalar:: Unsupported scalar type:{}", ptype));
   }
@@ -186,19 +236,23 @@ std::unique_ptr<IInterface> CreateImage1DDispatchPTypeScalar(const std::vector<s
 }
 
 template<ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateImage1DDispatch(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype)
+std::unique_ptr<IInterface> CreateImage1DDispatch(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  CompoundType ctype,
+  PType ptype)
 {
   switch (ctype) {
   case CompoundType::CompoundType_Scalar: {
-    return CreateImage1DDispatchPTypeScalar<numDims>(dims, ptype);
+    return CreateImage1DDispatchPTypeScalar<numDims>(dims, buffer, mode, ptype);
   }
   // case CompoundType::CompoundType_3Planes:
   //   {
-  //   return  CreateDenseDispatchPType3PLanes<numDims>(dims, ptype);
+  //   return  CreateDenseDispatchPType3PLanes<numDims>(dims, buffer, mode, ptype);
   //   }break;
   // case CompoundType::CompoundType_4Planes:
   //   {
-  //   return  CreateDenseDispatchPType4PLanes<numDims>(dims, ptype);
+  //   return  CreateDenseDispatchPType4PLanes<numDims>(dims, buffer, mode, ptype);
   //   }break;
   default: {
     POUTRE_RUNTIME_ERROR(std::format("Unsupported compound type:{}", ctype));
@@ -208,20 +262,28 @@ std::unique_ptr<IInterface> CreateImage1DDispatch(const std::vector<std::size_t>
 
 // 2D
 template<ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateImage2DDispatchPTypeScalar(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateImage2DDispatchPTypeScalar(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
-  // todo think about bool/binary here
+  case PType::PType_BinPack:
+    return MakeImage<details::image_t<pBinPack, 2>>(dims, buffer, mode);
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<pUINT8, 2>>(dims);
+    return MakeImage<details::image_t<pUINT8, 2>>(dims, buffer, mode);
+  case PType::PType_GrayUINT16:
+    return MakeImage<details::image_t<pUINT16, 2>>(dims, buffer, mode);
+  case PType::PType_GrayINT16:
+    return MakeImage<details::image_t<pINT16, 2>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<pINT32, 2>>(dims);
+    return MakeImage<details::image_t<pINT32, 2>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<pFLOAT, 2>>(dims);
+    return MakeImage<details::image_t<pFLOAT, 2>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<pINT64, 2>>(dims);
+    return MakeImage<details::image_t<pINT64, 2>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<pDOUBLE, 2>>(dims);
+    return MakeImage<details::image_t<pDOUBLE, 2>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateImage2DDispatchPTypeScalar:: Unsupported scalar type:{}", ptype));
   }
@@ -229,20 +291,23 @@ std::unique_ptr<IInterface> CreateImage2DDispatchPTypeScalar(const std::vector<s
 }
 
 template<ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateImage2DDispatchPType3PLanes(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateImage2DDispatchPType3PLanes(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
   // todo think about bool/binary here
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<compound_type<pUINT8, 3>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pUINT8, 3>, 2>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<compound_type<pINT32, 3>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT32, 3>, 2>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<compound_type<pFLOAT, 3>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pFLOAT, 3>, 2>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<compound_type<pINT64, 3>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT64, 3>, 2>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<compound_type<pDOUBLE, 3>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pDOUBLE, 3>, 2>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateImage2DDispatchPType3PLanes:: Unsupported scalar type:{}", ptype));
   }
@@ -250,20 +315,23 @@ std::unique_ptr<IInterface> CreateImage2DDispatchPType3PLanes(const std::vector<
 }
 
 template<ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateImage2DDispatchPType4PLanes(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateImage2DDispatchPType4PLanes(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
   // todo think about bool/binary here
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<compound_type<pUINT8, 4>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pUINT8, 4>, 2>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<compound_type<pINT32, 4>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT32, 4>, 2>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<compound_type<pFLOAT, 4>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pFLOAT, 4>, 2>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<compound_type<pINT64, 4>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT64, 4>, 2>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<compound_type<pDOUBLE, 4>, 2>>(dims);
+    return MakeImage<details::image_t<compound_type<pDOUBLE, 4>, 2>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateImage2DDispatchPType4PLanes:: Unsupported scalar type:{}", ptype));
   }
@@ -271,17 +339,21 @@ std::unique_ptr<IInterface> CreateImage2DDispatchPType4PLanes(const std::vector<
 }
 
 template<ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateImage2DDispatch(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype)
+std::unique_ptr<IInterface> CreateImage2DDispatch(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  CompoundType ctype,
+  PType ptype)
 {
   switch (ctype) {
   case CompoundType::CompoundType_Scalar: {
-    return CreateImage2DDispatchPTypeScalar<numDims>(dims, ptype);
+    return CreateImage2DDispatchPTypeScalar<numDims>(dims, buffer, mode, ptype);
   }
   case CompoundType::CompoundType_3Planes: {
-    return CreateImage2DDispatchPType3PLanes<numDims>(dims, ptype);
+    return CreateImage2DDispatchPType3PLanes<numDims>(dims, buffer, mode, ptype);
   }
   case CompoundType::CompoundType_4Planes: {
-    return CreateImage2DDispatchPType4PLanes<numDims>(dims, ptype);
+    return CreateImage2DDispatchPType4PLanes<numDims>(dims, buffer, mode, ptype);
   }
   default: {
     POUTRE_RUNTIME_ERROR(std::format("Unsupported compound type:{}", ctype));
@@ -291,20 +363,28 @@ std::unique_ptr<IInterface> CreateImage2DDispatch(const std::vector<std::size_t>
 
 // 3D
 template<ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateImage3DDispatchPTypeScalar(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateImage3DDispatchPTypeScalar(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
-  // todo think about bool/binary here
+  case PType::PType_BinPack:
+    return MakeImage<details::image_t<pBinPack, 3>>(dims, buffer, mode);
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<pUINT8, 3>>(dims);
+    return MakeImage<details::image_t<pUINT8, 3>>(dims, buffer, mode);
+  case PType::PType_GrayUINT16:
+    return MakeImage<details::image_t<pUINT16, 3>>(dims, buffer, mode);
+  case PType::PType_GrayINT16:
+    return MakeImage<details::image_t<pINT16, 3>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<pINT32, 3>>(dims);
+    return MakeImage<details::image_t<pINT32, 3>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<pFLOAT, 3>>(dims);
+    return MakeImage<details::image_t<pFLOAT, 3>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<pINT64, 3>>(dims);
+    return MakeImage<details::image_t<pINT64, 3>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<pDOUBLE, 3>>(dims);
+    return MakeImage<details::image_t<pDOUBLE, 3>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateImage3DDispatchPTypeScalar:: Unsupported scalar type:{}", ptype));
   }
@@ -312,20 +392,23 @@ std::unique_ptr<IInterface> CreateImage3DDispatchPTypeScalar(const std::vector<s
 }
 
 template<ptrdiff_t numDims>
-std::unique_ptr<IInterface> CreateImage3DDispatchPType3PLanes(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateImage3DDispatchPType3PLanes(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
   // todo think about bool/binary here
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<compound_type<pUINT8, 3>>>(dims);
+    return MakeImage<details::image_t<compound_type<pUINT8, 3>>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<compound_type<pINT32, 3>>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT32, 3>>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<compound_type<pFLOAT, 3>>>(dims);
+    return MakeImage<details::image_t<compound_type<pFLOAT, 3>>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<compound_type<pINT64, 3>>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT64, 3>>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<compound_type<pDOUBLE, 3>>>(dims);
+    return MakeImage<details::image_t<compound_type<pDOUBLE, 3>>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateImage3DDispatchPType3PLanes:: Unsupported scalar type:{}", ptype));
   }
@@ -333,20 +416,23 @@ std::unique_ptr<IInterface> CreateImage3DDispatchPType3PLanes(const std::vector<
 }
 
 template<size_t numDims>
-std::unique_ptr<IInterface> CreateImage3DDispatchPType4PLanes(const std::vector<std::size_t> &dims, PType ptype)
+std::unique_ptr<IInterface> CreateImage3DDispatchPType4PLanes(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  PType ptype)
 {
   switch (ptype) {
   // todo think about bool/binary here
   case PType::PType_GrayUINT8:
-    return std::make_unique<details::image_t<compound_type<pUINT8, 4>>>(dims);
+    return MakeImage<details::image_t<compound_type<pUINT8, 4>>>(dims, buffer, mode);
   case PType::PType_GrayINT32:
-    return std::make_unique<details::image_t<compound_type<pINT32, 4>>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT32, 4>>>(dims, buffer, mode);
   case PType::PType_F32:
-    return std::make_unique<details::image_t<compound_type<pFLOAT, 4>>>(dims);
+    return MakeImage<details::image_t<compound_type<pFLOAT, 4>>>(dims, buffer, mode);
   case PType::PType_GrayINT64:
-    return std::make_unique<details::image_t<compound_type<pINT64, 4>>>(dims);
+    return MakeImage<details::image_t<compound_type<pINT64, 4>>>(dims, buffer, mode);
   case PType::PType_D64:
-    return std::make_unique<details::image_t<compound_type<pDOUBLE, 4>>>(dims);
+    return MakeImage<details::image_t<compound_type<pDOUBLE, 4>>>(dims, buffer, mode);
   default: {
     POUTRE_RUNTIME_ERROR(std::format("CreateImage3DDispatchPType4PLanes:: Unsupported scalar type:{}", ptype));
   }
@@ -354,17 +440,21 @@ std::unique_ptr<IInterface> CreateImage3DDispatchPType4PLanes(const std::vector<
 }
 
 template<size_t numDims>
-std::unique_ptr<IInterface> CreateImage3DDispatch(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype)
+std::unique_ptr<IInterface> CreateImage3DDispatch(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  CompoundType ctype,
+  PType ptype)
 {
   switch (ctype) {
   case CompoundType::CompoundType_Scalar: {
-    return CreateImage3DDispatchPTypeScalar<numDims>(dims, ptype);
+    return CreateImage3DDispatchPTypeScalar<numDims>(dims, buffer, mode, ptype);
   }
   case CompoundType::CompoundType_3Planes: {
-    return CreateImage3DDispatchPType3PLanes<numDims>(dims, ptype);
+    return CreateImage3DDispatchPType3PLanes<numDims>(dims, buffer, mode, ptype);
   }
   case CompoundType::CompoundType_4Planes: {
-    return CreateImage3DDispatchPType4PLanes<numDims>(dims, ptype);
+    return CreateImage3DDispatchPType4PLanes<numDims>(dims, buffer, mode, ptype);
   }
   default: {
     POUTRE_RUNTIME_ERROR(std::format("Unsupported compound type:{}", ctype));
@@ -372,26 +462,30 @@ std::unique_ptr<IInterface> CreateImage3DDispatch(const std::vector<std::size_t>
   }
 }
 
-//! Factory to build contiguous dense image
-std::unique_ptr<IInterface> Create(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype)
+namespace {
+//! Rank dispatch, wraps buffer if not null otherwise allocates
+std::unique_ptr<IInterface> CreateDispatchRank(const std::vector<std::size_t> &dims,
+  const ExternalBuffer &buffer,
+  AllocationMode mode,
+  CompoundType ctype,
+  PType ptype)
 {
-  POUTRE_ENTERING("CreateDense");
   const auto &numDims = dims.size();
   switch (numDims) {
   case 0: {
     POUTRE_RUNTIME_ERROR("Unsupported number of dims:0");
   }
   case 1: {
-    return CreateImage1DDispatch<1>(dims, ctype, ptype);
+    return CreateImage1DDispatch<1>(dims, buffer, mode, ctype, ptype);
   }
   case 2: {
-    return CreateImage2DDispatch<2>(dims, ctype, ptype);
+    return CreateImage2DDispatch<2>(dims, buffer, mode, ctype, ptype);
   }
   case 3: {
-    return CreateImage3DDispatch<3>(dims, ctype, ptype);
+    return CreateImage3DDispatch<3>(dims, buffer, mode, ctype, ptype);
   }
   case 4: {
-    return CreateDenseDispatchDims<4>(dims, ctype, ptype);
+    return CreateDenseDispatchDims<4>(dims, buffer, mode, ctype, ptype);
   }
   default: {
     POUTRE_RUNTIME_ERROR("Unsupported number of dims");
@@ -399,6 +493,78 @@ std::unique_ptr<IInterface> Create(const std::vector<std::size_t> &dims, Compoun
   }
 }
 
+}// namespace
+
+//! Factory to build contiguous dense image
+std::unique_ptr<IInterface>
+  Create(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype, AllocationMode mode)
+{
+  POUTRE_ENTERING("CreateDense");
+  return CreateDispatchRank(dims, ExternalBuffer{}, mode, ctype, ptype);
+}
+
+std::unique_ptr<IInterface> CreateView(void *buffer,
+  const std::vector<std::size_t> &dims,
+  CompoundType ctype,
+  PType ptype,
+  std::shared_ptr<void> owner)
+{
+  POUTRE_ENTERING("CreateView");
+  if (buffer == nullptr) { POUTRE_RUNTIME_ERROR("CreateView: null buffer"); }
+  return CreateDispatchRank(dims, ExternalBuffer{ buffer, std::move(owner) }, AllocationMode::Zeroed, ctype, ptype);
+}
+
+namespace {
+template<std::ptrdiff_t numDims>
+std::unique_ptr<IInterface>
+  CreateTiledDispatchPType(const std::vector<std::size_t> &dims, PType ptype, std::ptrdiff_t edge, AllocationMode mode)
+{
+  switch (ptype) {
+  case PType::PType_GrayUINT8:
+    return std::make_unique<details::image_tiled_t<pUINT8, numDims>>(dims, edge, mode);
+  case PType::PType_GrayUINT16:
+    return std::make_unique<details::image_tiled_t<pUINT16, numDims>>(dims, edge, mode);
+  case PType::PType_GrayINT16:
+    return std::make_unique<details::image_tiled_t<pINT16, numDims>>(dims, edge, mode);
+  case PType::PType_GrayINT32:
+    return std::make_unique<details::image_tiled_t<pINT32, numDims>>(dims, edge, mode);
+  case PType::PType_F32:
+    return std::make_unique<details::image_tiled_t<pFLOAT, numDims>>(dims, edge, mode);
+  case PType::PType_GrayINT64:
+    return std::make_unique<details::image_tiled_t<pINT64, numDims>>(dims, edge, mode);
+  case PType::PType_D64:
+    return std::make_unique<details::image_tiled_t<pDOUBLE, numDims>>(dims, edge, mode);
+  default: {
+    POUTRE_RUNTIME_ERROR(std::format("CreateTiled:: Unsupported scalar type:{}", ptype));
+  }
+  }
+}
+}// namespace
+
+std::unique_ptr<IInterface> CreateTiled(const std::vector<std::size_t> &dims,
+  CompoundType ctype,
+  PType ptype,
+  std::ptrdiff_t tile_edge,
+  AllocationMode mode)
+{
+  POUTRE_ENTERING("CreateTiled");
+  POUTRE_CHECK(ctype == CompoundType::CompoundType_Scalar, "CreateTiled: only scalar images can be tiled");
+  POUTRE_CHECK(tile_edge >= 0, "CreateTiled: tile_edge must be >= 0");
+  switch (dims.size()) {
+  case 2: {
+    const auto edge = tile_edge == 0 ? details::image_tiled_t<pUINT8, 2>::default_tile_edge : tile_edge;
+    return CreateTiledDispatchPType<2>(dims, ptype, edge, mode);
+  }
+  case 3: {
+    const auto edge = tile_edge == 0 ? details::image_tiled_t<pUINT8, 3>::default_tile_edge : tile_edge;
+    return CreateTiledDispatchPType<3>(dims, ptype, edge, mode);
+  }
+  default: {
+    POUTRE_RUNTIME_ERROR("CreateTiled: Unsupported number of dims");
+  }
+  }
+}
+
 /***********************************************************************************************************************/
 /*                                       IMAGE FROM STRING */
 /***********************************************************************************************************************/
@@ -574,6 +740,12 @@ void ImageFromStringDenseScalarDispatchPType(poutre::IInterface &img, PType ptyp
   case PType::PType_GrayUINT8: {
     ImageFromStringDenseScalarDispatchPTypeHelper<dims, pUINT8>(img, istrm);
   } break;
+  case PType::PType_GrayUINT16: {
+    ImageFromStringDenseScalarDispatchPTypeHelper<dims, pUINT16>(img, istrm);
+  } break;
+  case PType::PType_GrayINT16: {
+    ImageFromStringDenseScalarDispatchPTypeHelper<dims, pINT16>(img, istrm);
+  } break;
   case PType::PType_GrayINT32: {
     ImageFromStringDenseScalarDispatchPTypeHelper<dims, pINT32>(img, istrm);
   } break;
@@ -772,6 +944,14 @@ void ImageToStringDenseScalarDispatchPType(const poutre::IInterface &img, PType
     ImageToStringDenseScalarDispatchPTypeHelper<dims, poutre::pUINT8>(img, ostrm);
   } break;
 
+  case PType::PType_GrayUINT16: {
+    ImageToStringDenseScalarDispatchPTypeHelper<dims, poutre::pUINT16>(img, ostrm);
+  } break;
+
+  case PType::PType_GrayINT16: {
+    ImageToStringDenseScalarDispatchPTypeHelper<dims, poutre::pINT16>(img, ostrm);
+  } break;
+
   case PType::PType_GrayINT32: {
     ImageToStringDenseScalarDispatchPTypeHelper<dims, poutre::pINT32>(img, ostrm);
   } break;
@@ -13,18 +13,23 @@
 
 
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/data_structures/image_tiled_t.hpp>
 #include <poutre/base/types.hpp>
 
 namespace poutre::details
 {
 #if defined(POUTRE_IS_GCC) || defined(POUTRE_IS_CLANG)
 template class image_t<poutre::pUINT8, 1>;
+template class image_t<poutre::pUINT16, 1>;
+template class image_t<poutre::pINT16, 1>;
 template class image_t<poutre::pINT32, 1>;
 template class image_t<poutre::pFLOAT, 1>;
 template class image_t<poutre::pINT64, 1>;
 template class image_t<poutre::pDOUBLE, 1>;
 
 template class image_t<poutre::pUINT8, 2>;
+template class image_t<poutre::pUINT16, 2>;
+template class image_t<poutre::pINT16, 2>;
 template class image_t<poutre::pINT32, 2>;
 template class image_t<poutre::pFLOAT, 2>;
 template class image_t<poutre::pINT64, 2>;
@@ -43,25 +48,53 @@ template class image_t<compound_type<poutre::pINT64, 4>, 2>;
 template class image_t<compound_type<poutre::pDOUBLE, 4>, 2>;
 
 template class image_t<poutre::pUINT8, 3>;
+template class image_t<poutre::pUINT16, 3>;
+template class image_t<poutre::pINT16, 3>;
 template class image_t<poutre::pINT32, 3>;
 template class image_t<poutre::pFLOAT, 3>;
 template class image_t<poutre::pINT64, 3>;
 template class image_t<poutre::pDOUBLE, 3>;
 
 template class image_t<pUINT8, 4>;
+template class image_t<pUINT16, 4>;
+template class image_t<pINT16, 4>;
 template class image_t<pINT32, 4>;
 template class image_t<pFLOAT, 4>;
 template class image_t<pINT64, 4>;
 template class image_t<pDOUBLE, 4>;
+
+template class image_t<poutre::pBinPack, 1>;
+template class image_t<poutre::pBinPack, 2>;
+template class image_t<poutre::pBinPack, 3>;
+
+template class image_tiled_t<poutre::pUINT8, 2>;
+template class image_tiled_t<poutre::pUINT16, 2>;
+template class image_tiled_t<poutre::pINT16, 2>;
+template class image_tiled_t<poutre::pINT32, 2>;
+template class image_tiled_t<poutre::pFLOAT, 2>;
+template class image_tiled_t<poutre::pINT64, 2>;
+template class image_tiled_t<poutre::pDOUBLE, 2>;
+
+template class image_tiled_t<poutre::pUINT8, 3>;
+template class image_tiled_t<poutre::pUINT16, 3>;
+template class image_tiled_t<poutre::pINT16, 3>;
+template class image_tiled_t<poutre::pINT32, 3>;
+template class image_tiled_t<poutre::pFLOAT, 3>;
+template class image_tiled_t<poutre::pINT64, 3>;
+template class image_tiled_t<poutre::pDOUBLE, 3>;
 #else
 
 template class image_t<poutre::pUINT8, 1>;
+template class image_t<poutre::pUINT16, 1>;
+template class image_t<poutre::pINT16, 1>;
 template class image_t<poutre::pINT32, 1>;
 template class image_t<poutre::pFLOAT, 1>;
 template class image_t<poutre::pINT64, 1>;
 template class image_t<poutre::pDOUBLE, 1>;
 
 template class image_t<poutre::pUINT8, 2>;
+template class image_t<poutre::pUINT16, 2>;
+template class image_t<poutre::pINT16, 2>;
 template class image_t<poutre::pINT32, 2>;
 template class image_t<poutre::pFLOAT, 2>;
 template class image_t<poutre::pINT64, 2>;
@@ -80,16 +113,40 @@ template class image_t<compound_type<poutre::pINT64, 4>, 2>;
 template class image_t<compound_type<poutre::pDOUBLE, 4>, 2>;
 
 template class image_t<poutre::pUINT8, 3>;
+template class image_t<poutre::pUINT16, 3>;
+template class image_t<poutre::pINT16, 3>;
 template class image_t<poutre::pINT32, 3>;
 template class image_t<poutre::pFLOAT, 3>;
 template class image_t<poutre::pINT64, 3>;
 template class image_t<poutre::pDOUBLE, 3>;
 
 template class image_t<pUINT8, 4>;
+template class image_t<pUINT16, 4>;
+template class image_t<pINT16, 4>;
 template class image_t<pINT32, 4>;
 template class image_t<pFLOAT, 4>;
 template class image_t<pINT64, 4>;
 template class image_t<pDOUBLE, 4>;
+
+template class image_t<poutre::pBinPack, 1>;
+template class image_t<poutre::pBinPack, 2>;
+template class image_t<poutre::pBinPack, 3>;
+
+template class image_tiled_t<poutre::pUINT8, 2>;
+template class image_tiled_t<poutre::pUINT16, 2>;
+template class image_tiled_t<poutre::pINT16, 2>;
+template class image_tiled_t<poutre::pINT32, 2>;
+template class image_tiled_t<poutre::pFLOAT, 2>;
+template class image_tiled_t<poutre::pINT64, 2>;
+template class image_tiled_t<poutre::pDOUBLE, 2>;
+
+template class image_tiled_t<poutre::pUINT8, 3>;
+template class image_tiled_t<poutre::pUINT16, 3>;
+template class image_tiled_t<poutre::pINT16, 3>;
+template class image_tiled_t<poutre::pINT32, 3>;
+template class image_tiled_t<poutre::pFLOAT, 3>;
+template class image_tiled_t<poutre::pINT64, 3>;
+template class image_tiled_t<poutre::pDOUBLE, 3>;
 #endif
 
 }
\ No newline at end of file
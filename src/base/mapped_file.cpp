@@ -0,0 +1,422 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/simd/simd_arch.hpp>
+#include <poutre/base/mapped_file.hpp>
+#include <poutre/base/trace.hpp>
+#include <poutre/base/types_traits.hpp>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <format>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace poutre {
+
+namespace {
+  //! live mappings, first byte -> extent, to find a mapping back from a pixel pointer
+  std::mutex &RegistryMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+
+  struct RegisteredMapping
+  {
+    std::size_t size = 0;
+    MapAccess access = MapAccess::ReadOnly;
+  };
+
+  std::map<const std::byte *, RegisteredMapping> &Registry()
+  {
+    static std::map<const std::byte *, RegisteredMapping> registry;
+    return registry;
+  }
+
+  std::size_t PageSize() POUTRE_NOEXCEPT
+  {
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return static_cast<std::size_t>(info.dwPageSize);
+#else
+    return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+  }
+
+  //! first is rounded down to a page boundary
+  void AdviseRange(const std::byte *first,
+    std::size_t bytes,
+    AccessAdvice advice,
+    [[maybe_unused]] MapAccess access) POUTRE_NOEXCEPT
+  {
+    if (bytes == 0) { return; }
+    const auto page = PageSize();
+    const auto address = reinterpret_cast<std::uintptr_t>(first);// NOLINT
+    const auto aligned = address & ~(static_cast<std::uintptr_t>(page) - 1);
+    bytes += address - aligned;
+    auto *start = reinterpret_cast<void *>(aligned);// NOLINT
+#if defined(_WIN32)
+    if (advice == AccessAdvice::WillNeed) {
+      WIN32_MEMORY_RANGE_ENTRY range{ start, bytes };
+      PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#else
+    int flag = MADV_NORMAL;
+    switch (advice) {
+    case AccessAdvice::Normal: flag = MADV_NORMAL; break;
+    case AccessAdvice::Sequential: flag = MADV_SEQUENTIAL; break;
+    case AccessAdvice::Random: flag = MADV_RANDOM; break;
+    case AccessAdvice::WillNeed: flag = MADV_WILLNEED; break;
+    case AccessAdvice::DontNeed:
+      // MADV_DONTNEED drops the modified pages of a private (copy on write) mapping, reloading them from the file
+#if defined(MADV_COLD)
+      flag = MADV_COLD;
+#else
+      if (access == MapAccess::CopyOnWrite) { return; }
+      flag = MADV_DONTNEED;
+#endif
+      break;
+    }
+    // hint only, failure is harmless
+    (void)madvise(start, bytes, flag);
+#endif
+  }
+
+  constexpr std::array<char, 8> header_magic = { 'P', 'O', 'U', 'T', 'R', 'E', 'M', 'M' };
+  constexpr std::uint32_t header_version = 1;
+  //! payload offset alignment, a page so that pixels are SIMD aligned whatever the OS
+  constexpr std::size_t payload_alignment = 4096;
+  static_assert(payload_alignment % SIMD_IDEAL_MAX_ALIGN_BYTES == 0, "payload must be SIMD aligned");
+
+  //! fixed part of the image file header, followed by rank uint64 extents
+  struct MappedImageHeader
+  {
+    std::array<char, 8> magic = header_magic;
+    std::uint32_t version = header_version;
+    std::uint32_t ctype = 0;
+    std::uint32_t ptype = 0;
+    std::uint32_t rank = 0;
+    std::uint64_t payload_offset = 0;
+  };
+
+  std::size_t PayloadOffset(std::size_t rank)
+  {
+    const auto header_bytes = sizeof(MappedImageHeader) + rank * sizeof(std::uint64_t);
+    return (header_bytes + payload_alignment - 1) / payload_alignment * payload_alignment;
+  }
+}// namespace
+
+struct MappedFile::Impl
+{
+  std::byte *data = nullptr;
+  std::size_t size = 0;
+  MapAccess access = MapAccess::ReadOnly;
+#if defined(_WIN32)
+  HANDLE file = INVALID_HANDLE_VALUE;// NOLINT
+  HANDLE mapping = nullptr;// NOLINT
+#else
+  int fd = -1;
+#endif
+
+  Impl() = default;
+  Impl(const Impl &) = delete;
+  Impl &operator=(const Impl &) = delete;
+  Impl(Impl &&) = delete;
+  Impl &operator=(Impl &&) = delete;
+
+  ~Impl()
+  {
+    if (data != nullptr) {
+      {
+        const std::scoped_lock lock(RegistryMutex());
+        Registry().erase(data);
+      }
+#if defined(_WIN32)
+      UnmapViewOfFile(data);
+#else
+      munmap(data, size);
+#endif
+    }
+#if defined(_WIN32)
+    if (mapping != nullptr) { CloseHandle(mapping); }
+    if (file != INVALID_HANDLE_VALUE) { CloseHandle(file); }
+#else
+    if (fd >= 0) { close(fd); }
+#endif
+  }
+
+  //! open path, resized to create_bytes if not 0
+  void Open(const std::string &path, std::size_t create_bytes)
+  {
+    const bool create = create_bytes > 0;
+    const bool writable = access == MapAccess::ReadWrite;
+    const bool copy_on_write = access == MapAccess::CopyOnWrite;
+#if defined(_WIN32)
+    file = CreateFileA(path.c_str(),
+      writable ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ,
+      FILE_SHARE_READ,
+      nullptr,
+      create ? CREATE_ALWAYS : OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL,
+      nullptr);
+    if (file == INVALID_HANDLE_VALUE) { POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to open {}", path)); }
+    LARGE_INTEGER filesize;
+    if (create) {
+      filesize.QuadPart = static_cast<LONGLONG>(create_bytes);
+      if (SetFilePointerEx(file, filesize, nullptr, FILE_BEGIN) == 0 || SetEndOfFile(file) == 0) {
+        POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to resize {}", path));
+      }
+    }
+    if (GetFileSizeEx(file, &filesize) == 0) {
+      POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to stat {}", path));
+    }
+    size = static_cast<std::size_t>(filesize.QuadPart);
+    if (size == 0) { POUTRE_RUNTIME_ERROR(std::format("MappedFile: empty file {}", path)); }
+    // PAGE_WRITECOPY charges the whole view against the commit limit, only asked for when writes are wanted
+    const DWORD protect = writable ? PAGE_READWRITE : (copy_on_write ? PAGE_WRITECOPY : PAGE_READONLY);// NOLINT
+    const DWORD view_access = writable ? FILE_MAP_WRITE : (copy_on_write ? FILE_MAP_COPY : FILE_MAP_READ);// NOLINT
+    mapping = CreateFileMappingA(file, nullptr, protect, 0, 0, nullptr);
+    if (mapping == nullptr) { POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to map {}", path)); }
+    data = static_cast<std::byte *>(MapViewOfFile(mapping, view_access, 0, 0, 0));
+    if (data == nullptr) { POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to map {}", path)); }
+#else
+    int flags = writable ? O_RDWR : O_RDONLY;
+    if (create) { flags |= O_CREAT | O_TRUNC; }
+    fd = open(path.c_str(), flags, 0644);// NOLINT
+    if (fd < 0) { POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to open {}", path)); }
+    if (create && ftruncate(fd, static_cast<off_t>(create_bytes)) != 0) {
+      POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to resize {}", path));
+    }
+    struct stat info = {};
+    if (fstat(fd, &info) != 0) { POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to stat {}", path)); }
+    size = static_cast<std::size_t>(info.st_size);
+    if (size == 0) { POUTRE_RUNTIME_ERROR(std::format("MappedFile: empty file {}", path)); }
+    // a writable private mapping is commit charged for its whole size unless MAP_NORESERVE, read only is never
+    const int prot = access == MapAccess::ReadOnly ? PROT_READ : (PROT_READ | PROT_WRITE);
+    int map_flags = copy_on_write ? MAP_PRIVATE : MAP_SHARED;
+#if defined(MAP_NORESERVE)
+    if (copy_on_write) { map_flags |= MAP_NORESERVE; }
+#endif
+    void *ptr = mmap(nullptr, size, prot, map_flags, fd, 0);
+    if (ptr == MAP_FAILED) { POUTRE_RUNTIME_ERROR(std::format("MappedFile: unable to map {}", path)); }// NOLINT
+    data = static_cast<std::byte *>(ptr);
+#endif
+    const std::scoped_lock lock(RegistryMutex());
+    Registry()[data] = { size, access };
+  }
+};
+
+MappedFile::MappedFile(std::unique_ptr<Impl> impl) : m_impl(std::move(impl)) {}
+
+MappedFile::MappedFile(const std::string &path, MapAccess access) : m_impl(std::make_unique<Impl>())
+{
+  POUTRE_ENTERING("MappedFile");
+  m_impl->access = access;
+  m_impl->Open(path, 0);
+}
+
+MappedFile MappedFile::Create(const std::string &path, std::size_t bytes)
+{
+  POUTRE_ENTERING("MappedFile::Create");
+  POUTRE_CHECK(bytes > 0, "MappedFile::Create bytes must be > 0");
+  auto impl = std::make_unique<Impl>();
+  impl->access = MapAccess::ReadWrite;
+  impl->Open(path, bytes);
+  return MappedFile(std::move(impl));
+}
+
+MappedFile::MappedFile(MappedFile &&other) noexcept = default;
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept = default;
+MappedFile::~MappedFile() = default;
+
+std::byte *MappedFile::data() const noexcept { return m_impl ? m_impl->data : nullptr; }
+
+std::size_t MappedFile::size() const noexcept { return m_impl ? m_impl->size : 0; }
+
+MapAccess MappedFile::access() const noexcept { return m_impl ? m_impl->access : MapAccess::ReadOnly; }
+
+void MappedFile::Flush() const
+{
+  if (!m_impl || m_impl->access != MapAccess::ReadWrite) { return; }
+#if defined(_WIN32)
+  if (FlushViewOfFile(m_impl->data, 0) == 0 || FlushFileBuffers(m_impl->file) == 0) {
+    POUTRE_RUNTIME_ERROR("MappedFile::Flush failed");
+  }
+#else
+  if (msync(m_impl->data, m_impl->size, MS_SYNC) != 0) { POUTRE_RUNTIME_ERROR("MappedFile::Flush failed"); }
+#endif
+}
+
+void MappedFile::Advise(std::size_t offset, std::size_t bytes, AccessAdvice advice) const POUTRE_NOEXCEPT
+{
+  if (!m_impl || offset >= m_impl->size) { return; }
+  AdviseRange(m_impl->data + offset, std::min(bytes, m_impl->size - offset), advice, m_impl->access);
+}
+
+void AdviseAccess(const void *ptr, std::size_t bytes, AccessAdvice advice) POUTRE_NOEXCEPT
+{
+  if (ptr == nullptr || bytes == 0) { return; }
+  const auto *first = static_cast<const std::byte *>(ptr);
+  const std::scoped_lock lock(RegistryMutex());
+  const auto &registry = Registry();
+  auto it = registry.upper_bound(first);
+  if (it == registry.begin()) { return; }
+  --it;
+  const auto *end = it->first + it->second.size;
+  if (first >= end) { return; }
+  AdviseRange(first, std::min<std::size_t>(bytes, static_cast<std::size_t>(end - first)), advice, it->second.access);
+}
+
+void AdviseAccess(const IInterface &img, AccessAdvice advice) POUTRE_NOEXCEPT
+{
+  try {
+    AdviseAccess(img.GetVoidPtr(), ImageBytes(img.GetShape(), img.GetCType(), img.GetPType()), advice);
+  } catch (...) {// NOLINT(bugprone-empty-catch) hint only
+  }
+}
+
+ScopedAccessAdvice::ScopedAccessAdvice(const IInterface &img, AccessAdvice advice) POUTRE_NOEXCEPT
+{
+  try {
+    m_ptr = img.GetVoidPtr();
+    m_bytes = ImageBytes(img.GetShape(), img.GetCType(), img.GetPType());
+  } catch (...) {// NOLINT(bugprone-empty-catch) hint only
+    m_ptr = nullptr;
+    m_bytes = 0;
+  }
+  AdviseAccess(m_ptr, m_bytes, advice);
+}
+
+ScopedAccessAdvice::~ScopedAccessAdvice() { AdviseAccess(m_ptr, m_bytes, AccessAdvice::Normal); }
+
+std::size_t ImageBytes(const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype)
+{
+  if (dims.empty()) { return 0; }
+  std::size_t nbelements = 1;
+  for (const auto dim : dims) { nbelements *= dim; }
+  if (ptype == PType::PType_BinPack) {
+    POUTRE_CHECK(ctype == CompoundType::CompoundType_Scalar, "ImageBytes: PType_BinPack must be scalar");
+    constexpr auto word_bits = static_cast<std::size_t>(TypeTraits<pBinPack>::word_bits);
+    const auto xsize = dims.back();
+    const auto nblines = xsize == 0 ? 0 : nbelements / xsize;
+    return nblines * ((xsize + word_bits - 1) / word_bits) * sizeof(TypeTraits<pBinPack>::storage_type);
+  }
+  std::size_t scalar = 0;
+  switch (ptype) {
+  case PType::PType_GrayUINT8: scalar = sizeof(pUINT8); break;
+  case PType::PType_GrayUINT16: scalar = sizeof(pUINT16); break;
+  case PType::PType_GrayINT16: scalar = sizeof(pINT16); break;
+  case PType::PType_GrayINT32: scalar = sizeof(pINT32); break;
+  case PType::PType_F32: scalar = sizeof(pFLOAT); break;
+  case PType::PType_GrayINT64: scalar = sizeof(pINT64); break;
+  case PType::PType_D64: scalar = sizeof(pDOUBLE); break;
+  default: POUTRE_RUNTIME_ERROR(std::format("ImageBytes: unsupported ptype {}", ptype));
+  }
+  switch (ctype) {
+  case CompoundType::CompoundType_Scalar: return nbelements * scalar;
+  case CompoundType::CompoundType_3Planes: return nbelements * scalar * 3;
+  case CompoundType::CompoundType_4Planes: return nbelements * scalar * 4;// NOLINT
+  default: POUTRE_RUNTIME_ERROR(std::format("ImageBytes: unsupported ctype {}", ctype));
+  }
+}
+
+std::unique_ptr<IInterface> MapRawImage(const std::string &path,
+  const std::vector<std::size_t> &dims,
+  CompoundType ctype,
+  PType ptype,
+  MapAccess access,
+  std::size_t offset)
+{
+  POUTRE_ENTERING("MapRawImage");
+  POUTRE_CHECK(offset % SIMD_IDEAL_MAX_ALIGN_BYTES == 0, "MapRawImage offset must be SIMD aligned");
+  const auto bytes = ImageBytes(dims, ctype, ptype);
+  POUTRE_CHECK(bytes > 0, "MapRawImage empty image");
+  auto file = std::make_shared<MappedFile>(path, access);
+  if (offset + bytes > file->size()) { POUTRE_RUNTIME_ERROR(std::format("MapRawImage: {} is too small", path)); }
+  auto *pixels = file->data() + offset;
+  return CreateView(pixels, dims, ctype, ptype, std::move(file));
+}
+
+std::unique_ptr<IInterface> MapImage(const std::string &path, MapAccess access)
+{
+  POUTRE_ENTERING("MapImage");
+  auto file = std::make_shared<MappedFile>(path, access);
+  MappedImageHeader header;
+  if (file->size() < sizeof(header)) { POUTRE_RUNTIME_ERROR(std::format("MapImage: {} is truncated", path)); }
+  std::memcpy(&header, file->data(), sizeof(header));
+  if (header.magic != header_magic || header.version != header_version) {
+    POUTRE_RUNTIME_ERROR(std::format("MapImage: {} is not a mapped image file", path));
+  }
+  if (header.rank == 0 || file->size() < sizeof(header) + header.rank * sizeof(std::uint64_t)) {
+    POUTRE_RUNTIME_ERROR(std::format("MapImage: {} has an invalid header", path));
+  }
+  std::vector<std::size_t> dims(header.rank);
+  for (std::size_t i = 0; i < dims.size(); ++i) {
+    std::uint64_t extent = 0;
+    std::memcpy(&extent, file->data() + sizeof(header) + i * sizeof(std::uint64_t), sizeof(extent));
+    dims[i] = static_cast<std::size_t>(extent);
+  }
+  const auto ctype = static_cast<CompoundType>(header.ctype);
+  const auto ptype = static_cast<PType>(header.ptype);
+  const auto offset = static_cast<std::size_t>(header.payload_offset);
+  const auto bytes = ImageBytes(dims, ctype, ptype);
+  if (offset % SIMD_IDEAL_MAX_ALIGN_BYTES != 0 || bytes == 0 || offset + bytes > file->size()) {
+    POUTRE_RUNTIME_ERROR(std::format("MapImage: {} has an invalid payload", path));
+  }
+  auto *pixels = file->data() + offset;
+  return CreateView(pixels, dims, ctype, ptype, std::move(file));
+}
+
+std::unique_ptr<IInterface>
+  CreateMappedImage(const std::string &path, const std::vector<std::size_t> &dims, CompoundType ctype, PType ptype)
+{
+  POUTRE_ENTERING("CreateMappedImage");
+  const auto bytes = ImageBytes(dims, ctype, ptype);
+  POUTRE_CHECK(bytes > 0, "CreateMappedImage empty image");
+  const auto offset = PayloadOffset(dims.size());
+  auto file = std::make_shared<MappedFile>(MappedFile::Create(path, offset + bytes));
+  MappedImageHeader header;
+  header.ctype = static_cast<std::uint32_t>(ctype);
+  header.ptype = static_cast<std::uint32_t>(ptype);
+  header.rank = static_cast<std::uint32_t>(dims.size());
+  header.payload_offset = offset;
+  std::memcpy(file->data(), &header, sizeof(header));
+  for (std::size_t i = 0; i < dims.size(); ++i) {
+    const auto extent = static_cast<std::uint64_t>(dims[i]);
+    std::memcpy(file->data() + sizeof(header) + i * sizeof(std::uint64_t), &extent, sizeof(extent));
+  }
+  auto *pixels = file->data() + offset;
+  return CreateView(pixels, dims, ctype, ptype, std::move(file));
+}
+
+}// namespace poutre
@@ -0,0 +1,267 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <poutre/base/config.hpp>
+#include <poutre/base/details/simd/simd_arch.hpp>
+#include <poutre/base/details/simd/simd_dispatch.hpp>
+
+#include <cstddef>
+
+namespace {
+using poutre::simd::DispatchedBinaryKernel;
+using poutre::simd::DispatchedUnaryKernel;
+
+// forward to the kernel explicitly instantiated for Arch in simd_kernels_<arch>.cpp
+template<typename T> struct BinaryLineKernel
+{
+  template<class Arch>
+  void operator()(Arch arch,
+    DispatchedBinaryKernel kernel,
+    const T *in1,
+    const T *in2,
+    T *out,
+    std::size_t size) const
+  {
+    poutre::simd::t_BinaryLineKernel(arch, kernel, in1, in2, out, size);
+  }
+};
+
+template<typename T> struct VanHerckStripKernel
+{
+  template<class Arch>
+  void operator()(Arch arch,
+    DispatchedBinaryKernel kernel,
+    const T *in,
+    T *out,
+    std::ptrdiff_t xsize,
+    std::ptrdiff_t ysize,
+    std::ptrdiff_t x_begin,
+    std::ptrdiff_t x_end,
+    std::ptrdiff_t size_line_segment,
+    const T *neutral_row,
+    T *g,
+    T *h_current,
+    T *h_previous) const
+  {
+    poutre::simd::t_VanHerckStripKernel(
+      arch, kernel, in, out, xsize, ysize, x_begin, x_end, size_line_segment, neutral_row, g, h_current, h_previous);
+  }
+};
+
+template<typename Tin, typename Tout> struct CompareSelectKernel
+{
+  template<class Arch>
+  void operator()(Arch arch,
+    poutre::simd::DispatchedCompare compare,
+    const Tin *in,
+    poutre::simd::DispatchedOperand<Tin> comp,
+    poutre::simd::DispatchedOperand<Tout> vtrue,
+    poutre::simd::DispatchedOperand<Tout> vfalse,
+    Tout *out,
+    std::size_t begin,
+    std::size_t end) const
+  {
+    poutre::simd::t_CompareSelectKernel(arch, compare, in, comp, vtrue, vfalse, out, begin, end);
+  }
+};
+
+template<typename T> struct UnaryLineKernel
+{
+  template<class Arch>
+  void operator()(Arch arch,
+    DispatchedUnaryKernel kernel,
+    const T *in,
+    T value,
+    T *out,
+    std::size_t size) const
+  {
+    poutre::simd::t_UnaryLineKernel(arch, kernel, in, value, out, size);
+  }
+};
+
+template<typename T> struct NeighborLineKernel
+{
+  template<class Arch>
+  void operator()(Arch arch,
+    DispatchedBinaryKernel kernel,
+    const T *linein,
+    T *lineout,
+    std::ptrdiff_t xsize,
+    const std::ptrdiff_t *offsets,
+    std::ptrdiff_t nb_neighbors) const
+  {
+    poutre::simd::t_NeighborLineKernel(arch, kernel, linein, lineout, xsize, offsets, nb_neighbors);
+  }
+};
+
+struct BinPackShiftLineKernel
+{
+  template<class Arch>
+  void operator()(Arch arch,
+    DispatchedBinaryKernel kernel,
+    const poutre::u64 *i_line,
+    std::ptrdiff_t shift_words,
+    int shift_bits,
+    poutre::u64 *io_line,
+    std::ptrdiff_t begin,
+    std::ptrdiff_t end) const
+  {
+    poutre::simd::t_BinPackShiftLineKernel(arch, kernel, i_line, shift_words, shift_bits, io_line, begin, end);
+  }
+};
+
+template<typename T> struct TransposeBlockedKernel
+{
+  template<class Arch>
+  void operator()(Arch arch,
+    const T *src,
+    std::ptrdiff_t src_rows,
+    std::ptrdiff_t src_cols,
+    T *dst,
+    std::ptrdiff_t row_begin,
+    std::ptrdiff_t row_end) const
+  {
+    poutre::simd::t_TransposeBlockedKernel(arch, src, src_rows, src_cols, dst, row_begin, row_end);
+  }
+};
+
+template<typename T>
+void DispatchedTransformImpl(DispatchedBinaryKernel kernel, const T *in1, const T *in2, T *out, std::size_t size)
+{
+  // cpu features are queried once, then each call only walks the arch list
+  static auto dispatched = xs::dispatch<poutre::simd::dispatch_arch_list>(BinaryLineKernel<T>{});
+  dispatched(kernel, in1, in2, out, size);
+}
+
+const char *SelectArchName() POUTRE_NOEXCEPT
+{
+  const auto best = xs::available_architectures().best;
+  const char *name = nullptr;
+  poutre::simd::dispatch_arch_list::for_each([&](auto arch) {
+    if (name == nullptr && decltype(arch)::version() <= best) { name = decltype(arch)::name(); }
+  });
+  return name != nullptr ? name : "none";
+}
+
+// selected at load time
+const char *const dispatched_arch_name = SelectArchName();
+}// namespace
+
+namespace poutre::simd {
+void DispatchedTransform(DispatchedBinaryKernel kernel, const u8 *in1, const u8 *in2, u8 *out, std::size_t size)
+{
+  DispatchedTransformImpl(kernel, in1, in2, out, size);
+}
+void DispatchedTransform(DispatchedBinaryKernel kernel, const u16 *in1, const u16 *in2, u16 *out, std::size_t size)
+{
+  DispatchedTransformImpl(kernel, in1, in2, out, size);
+}
+void DispatchedTransform(DispatchedBinaryKernel kernel, const i16 *in1, const i16 *in2, i16 *out, std::size_t size)
+{
+  DispatchedTransformImpl(kernel, in1, in2, out, size);
+}
+void DispatchedTransform(DispatchedBinaryKernel kernel, const i32 *in1, const i32 *in2, i32 *out, std::size_t size)
+{
+  DispatchedTransformImpl(kernel, in1, in2, out, size);
+}
+void DispatchedTransform(DispatchedBinaryKernel kernel, const i64 *in1, const i64 *in2, i64 *out, std::size_t size)
+{
+  DispatchedTransformImpl(kernel, in1, in2, out, size);
+}
+void DispatchedTransform(DispatchedBinaryKernel kernel, const f32 *in1, const f32 *in2, f32 *out, std::size_t size)
+{
+  DispatchedTransformImpl(kernel, in1, in2, out, size);
+}
+void DispatchedTransform(DispatchedBinaryKernel kernel, const f64 *in1, const f64 *in2, f64 *out, std::size_t size)
+{
+  DispatchedTransformImpl(kernel, in1, in2, out, size);
+}
+
+template<typename T>
+void DispatchedUnaryTransform(DispatchedUnaryKernel kernel, const T *in, T value, T *out, std::size_t size)
+{
+  static auto dispatched = xs::dispatch<dispatch_arch_list>(UnaryLineKernel<T>{});
+  dispatched(kernel, in, value, out, size);
+}
+
+template<typename T>
+void DispatchedVanHerckStrip(DispatchedBinaryKernel kernel,
+  const T *in,
+  T *out,
+  std::ptrdiff_t xsize,
+  std::ptrdiff_t ysize,
+  std::ptrdiff_t x_begin,
+  std::ptrdiff_t x_end,
+  std::ptrdiff_t size_line_segment,
+  const T *neutral_row,
+  T *g,
+  T *h_current,
+  T *h_previous)
+{
+  static auto dispatched = xs::dispatch<dispatch_arch_list>(VanHerckStripKernel<T>{});
+  dispatched(kernel, in, out, xsize, ysize, x_begin, x_end, size_line_segment, neutral_row, g, h_current, h_previous);
+}
+
+template<typename Tin, typename Tout>
+void DispatchedCompareSelect(DispatchedCompare compare,
+  const Tin *in,
+  DispatchedOperand<Tin> comp,
+  DispatchedOperand<Tout> vtrue,
+  DispatchedOperand<Tout> vfalse,
+  Tout *out,
+  std::size_t begin,
+  std::size_t end)
+{
+  static auto dispatched = xs::dispatch<dispatch_arch_list>(CompareSelectKernel<Tin, Tout>{});
+  dispatched(compare, in, comp, vtrue, vfalse, out, begin, end);
+}
+
+template<typename T>
+void DispatchedNeighborLine(DispatchedBinaryKernel kernel,
+  const T *linein,
+  T *lineout,
+  std::ptrdiff_t xsize,
+  const std::ptrdiff_t *offsets,
+  std::ptrdiff_t nb_neighbors)
+{
+  static auto dispatched = xs::dispatch<dispatch_arch_list>(NeighborLineKernel<T>{});
+  dispatched(kernel, linein, lineout, xsize, offsets, nb_neighbors);
+}
+
+void DispatchedBinPackShiftLine(DispatchedBinaryKernel kernel,
+  const u64 *i_line,
+  std::ptrdiff_t shift_words,
+  int shift_bits,
+  u64 *io_line,
+  std::ptrdiff_t begin,
+  std::ptrdiff_t end)
+{
+  static auto dispatched = xs::dispatch<dispatch_arch_list>(BinPackShiftLineKernel{});
+  dispatched(kernel, i_line, shift_words, shift_bits, io_line, begin, end);
+}
+
+template<typename T>
+void DispatchedTransposeBlocked(const T *src,
+  std::ptrdiff_t src_rows,
+  std::ptrdiff_t src_cols,
+  T *dst,
+  std::ptrdiff_t row_begin,
+  std::ptrdiff_t row_end)
+{
+  static auto dispatched = xs::dispatch<dispatch_arch_list>(TransposeBlockedKernel<T>{});
+  dispatched(src, src_rows, src_cols, dst, row_begin, row_end);
+}
+
+POUTRE_DISPATCHED_TEMPLATES()
+
+const char *DispatchedArchName() POUTRE_NOEXCEPT { return dispatched_arch_name; }
+}// namespace poutre::simd
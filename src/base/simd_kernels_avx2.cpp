@@ -0,0 +1,18 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+// compiled with POUTRE_SIMD_FLAGS_AVX2, only include simd_kernels_impl.hpp here
+#include <poutre/base/details/simd/simd_kernels_impl.hpp>
+
+namespace poutre::simd {
+POUTRE_SIMD_KERNELS(, xs::avx2)
+}// namespace poutre::simd
@@ -0,0 +1,18 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+// single arch build (POUTRE_SIMD_DISPATCH off), kernels use the arch selected by global compiler flags
+#include <poutre/base/details/simd/simd_kernels_impl.hpp>
+
+namespace poutre::simd {
+POUTRE_SIMD_KERNELS(, xs::default_arch)
+}// namespace poutre::simd
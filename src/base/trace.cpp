@@ -22,8 +22,8 @@ namespace poutre {
 GlobalLogger* GlobalLogger::m_instance;
 std::once_flag GlobalLogger::m_initFlag;
 
-//! Private ctor
-GlobalLogger::GlobalLogger() : m_innerlogger(spdlog::stdout_color_st("POUTRE_GLOBAL_LOGGER"))
+//! Private ctor, multi threaded sink as operators may be called concurrently (e.g. python threads without GIL)
+GlobalLogger::GlobalLogger() : m_innerlogger(spdlog::stdout_color_mt("POUTRE_GLOBAL_LOGGER"))
 {
   (*m_innerlogger).set_level(::spdlog::level::off);
 }
@@ -290,10 +290,18 @@ std::ostream &operator<<(std::ostream &ost, PType ptype)// NOLINT(misc-unused-pa
     /* case PType::PType_Bin:
        os << "Bin";
        break;*/
-    /*      case PType_BinPack: // break;*/// TODO ?
+  case PType::PType_BinPack:
+    ost << "BinPack";
+    break;
   case PType::PType_GrayUINT8:
     ost << "GUINT8";
     break;
+  case PType::PType_GrayUINT16:
+    ost << "GUINT16";
+    break;
+  case PType::PType_GrayINT16:
+    ost << "GINT16";
+    break;
   case PType::PType_GrayINT32:
     ost << "GINT32";
     break;
@@ -328,9 +336,14 @@ std::istream &operator>>(std::istream &ist, PType &ptype)// NOLINT(misc-unused-p
 
   /* if (strType == "Bin")
      p = PType::PType_Bin;*/
-  /*      case PType_BinPack: // break;*/// TODO ?
-  else if (strType == "GUINT8") {
+  else if (strType == "BinPack") {
+    ptype = PType::PType_BinPack;
+  } else if (strType == "GUINT8") {
     ptype = PType::PType_GrayUINT8;
+  } else if (strType == "GUINT16") {
+    ptype = PType::PType_GrayUINT16;
+  } else if (strType == "GINT16") {
+    ptype = PType::PType_GrayINT16;
   } else if (strType == "GINT32") {
     ptype = PType::PType_GrayINT32;
   } else if (strType == "GINT64") {
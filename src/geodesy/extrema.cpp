@@ -31,7 +31,7 @@ void h_minima(const IInterface &i_img, const ScalarTypeVariant &pvalue, se::Comm
   AssertAsTypesCompatible(i_img, o_img, "h_minima incompatible types");
   AssertImagesAreDifferent(i_img, o_img, "h_minima output must be != than input images");
 
-  auto img_tmp = poutre::CloneGeometry(i_img); // NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
   poutre::ArithSaturatedAddConstant(i_img, pvalue, *img_tmp);
   poutre::geo::Reconstruction(poutre::geo::reconstruction_type::erode,*img_tmp,i_img, nl_static, o_img);
 }
@@ -43,7 +43,7 @@ void h_maxima(const IInterface &i_img, const ScalarTypeVariant &pvalue, se::Comm
   AssertAsTypesCompatible(i_img, o_img, "h_maxima incompatible types");
   AssertImagesAreDifferent(i_img, o_img, "h_maxima output must be != than input images");
 
-  auto img_tmp = poutre::CloneGeometry(i_img); // NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
   poutre::ArithSaturatedSubConstant(i_img, pvalue, *img_tmp);
   poutre::geo::Reconstruction(poutre::geo::reconstruction_type::dilate,*img_tmp,i_img, nl_static, o_img);
 }
@@ -55,7 +55,7 @@ void h_concave(const IInterface &i_img, const ScalarTypeVariant &pvalue, se::Com
   AssertAsTypesCompatible(i_img, o_img, "h_concave incompatible types");
   AssertImagesAreDifferent(i_img, o_img, "h_concave output must be != than input images");
 
-  auto img_tmp = poutre::CloneGeometry(i_img); // NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
   h_minima(i_img, pvalue, nl_static, *img_tmp);
   poutre::ArithSaturatedSubImage(*img_tmp,i_img, o_img);
 }
@@ -67,7 +67,7 @@ void h_convex(const IInterface &i_img, const ScalarTypeVariant &pvalue, se::Comm
   AssertAsTypesCompatible(i_img, o_img, "h_convex incompatible types");
   AssertImagesAreDifferent(i_img, o_img, "h_convex output must be != than input images");
 
-  auto img_tmp = poutre::CloneGeometry(i_img); // NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
   h_maxima(i_img, pvalue, nl_static, *img_tmp);
   poutre::ArithSaturatedSubImage(i_img, *img_tmp, o_img);
 }
@@ -79,9 +79,9 @@ void dynamic_pseudo_opening(const IInterface &i_img, const ScalarTypeVariant &pv
   AssertAsTypesCompatible(i_img, o_img, "dynamic_pseudo_opening incompatible types");
   AssertImagesAreDifferent(i_img, o_img, "dynamic_pseudo_opening output must be != than input images");
 
-  auto img_tmp = poutre::CloneGeometry(i_img); // NOLINT
-  auto img_extrema = poutre::CloneGeometry(i_img); // NOLINT
-  auto img_mask = poutre::CloneGeometry(i_img); // NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
+  auto img_extrema = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
+  auto img_mask = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
 
   poutre::ArithSaturatedSubConstant(i_img, pvalue, *img_tmp);
   poutre::geo::Reconstruction(poutre::geo::reconstruction_type::dilate,*img_tmp,i_img, nl_static, *img_extrema);
@@ -99,9 +99,9 @@ void dynamic_pseudo_closing(const IInterface &i_img, const ScalarTypeVariant &pv
   AssertAsTypesCompatible(i_img, o_img, "dynamic_pseudo_closing incompatible types");
   AssertImagesAreDifferent(i_img, o_img, "dynamic_pseudo_closing output must be != than input images");
 
-  auto img_tmp = poutre::CloneGeometry(i_img); // NOLINT
-  auto img_extrema = poutre::CloneGeometry(i_img); // NOLINT
-  auto img_mask = poutre::CloneGeometry(i_img); // NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
+  auto img_extrema = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
+  auto img_mask = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
 
   poutre::ArithSaturatedAddConstant(i_img, pvalue, *img_tmp);
   poutre::geo::Reconstruction(poutre::geo::reconstruction_type::erode,*img_tmp,i_img, nl_static, *img_extrema);
@@ -76,6 +76,12 @@ void low_leveling(const IInterface &i_ref, const IInterface &i_marker, se::Commo
     case poutre::PType::PType_GrayUINT8: {
       lowLevelingImageDispatch<1, poutre::PType::PType_GrayUINT8>(i_ref, i_marker, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      lowLevelingImageDispatch<1, poutre::PType::PType_GrayUINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      lowLevelingImageDispatch<1, poutre::PType::PType_GrayINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       lowLevelingImageDispatch<1, poutre::PType::PType_GrayINT32>(i_ref, i_marker, nl_static, o_img);
     } break;
@@ -98,6 +104,12 @@ void low_leveling(const IInterface &i_ref, const IInterface &i_marker, se::Commo
     case poutre::PType::PType_GrayUINT8: {
       lowLevelingImageDispatch<2, poutre::PType::PType_GrayUINT8>(i_ref, i_marker, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      lowLevelingImageDispatch<2, poutre::PType::PType_GrayUINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      lowLevelingImageDispatch<2, poutre::PType::PType_GrayINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       lowLevelingImageDispatch<2, poutre::PType::PType_GrayINT32>(i_ref, i_marker, nl_static, o_img);
     } break;
@@ -120,6 +132,12 @@ void low_leveling(const IInterface &i_ref, const IInterface &i_marker, se::Commo
     case poutre::PType::PType_GrayUINT8: {
       lowLevelingImageDispatch<3, poutre::PType::PType_GrayUINT8>(i_ref, i_marker, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      lowLevelingImageDispatch<3, poutre::PType::PType_GrayUINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      lowLevelingImageDispatch<3, poutre::PType::PType_GrayINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       lowLevelingImageDispatch<3, poutre::PType::PType_GrayINT32>(i_ref, i_marker, nl_static, o_img);
     } break;
@@ -158,6 +176,12 @@ void high_leveling(const IInterface &i_ref, const IInterface &i_marker, se::Comm
     case poutre::PType::PType_GrayUINT8: {
       highLevelingImageDispatch<1, poutre::PType::PType_GrayUINT8>(i_ref, i_marker, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      highLevelingImageDispatch<1, poutre::PType::PType_GrayUINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      highLevelingImageDispatch<1, poutre::PType::PType_GrayINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       highLevelingImageDispatch<1, poutre::PType::PType_GrayINT32>(i_ref, i_marker, nl_static, o_img);
     } break;
@@ -180,6 +204,12 @@ void high_leveling(const IInterface &i_ref, const IInterface &i_marker, se::Comm
     case poutre::PType::PType_GrayUINT8: {
       highLevelingImageDispatch<2, poutre::PType::PType_GrayUINT8>(i_ref, i_marker, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      highLevelingImageDispatch<2, poutre::PType::PType_GrayUINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      highLevelingImageDispatch<2, poutre::PType::PType_GrayINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       highLevelingImageDispatch<2, poutre::PType::PType_GrayINT32>(i_ref, i_marker, nl_static, o_img);
     } break;
@@ -202,6 +232,12 @@ void high_leveling(const IInterface &i_ref, const IInterface &i_marker, se::Comm
     case poutre::PType::PType_GrayUINT8: {
       highLevelingImageDispatch<3, poutre::PType::PType_GrayUINT8>(i_ref, i_marker, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      highLevelingImageDispatch<3, poutre::PType::PType_GrayUINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      highLevelingImageDispatch<3, poutre::PType::PType_GrayINT16>(i_ref, i_marker, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       highLevelingImageDispatch<3, poutre::PType::PType_GrayINT32>(i_ref, i_marker, nl_static, o_img);
     } break;
@@ -231,7 +267,7 @@ void high_leveling(const IInterface &i_ref, const IInterface &i_marker, se::Comm
 void leveling(const IInterface &i_ref, const IInterface &i_marker, se::Common_NL_SE nl_static, IInterface &o_img)
 {
   POUTRE_ENTERING("leveling");
-  auto img_tmp = poutre::CloneGeometry(i_ref);// NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_ref, AllocationMode::Pooled);// NOLINT
   high_leveling(i_ref, i_marker, nl_static, *img_tmp);
   low_leveling(*img_tmp, i_marker, nl_static, o_img);
 }
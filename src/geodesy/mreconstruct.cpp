@@ -14,11 +14,13 @@
 #include <cstddef>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/data_structures/image_tiled_t.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
 #include <poutre/geodesy/details/mreconstruct_t.hpp>
+#include <poutre/geodesy/details/mreconstruct_tiled_t.hpp>
 #include <poutre/geodesy/mreconstruct.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 
@@ -30,9 +32,22 @@ void ReconstructionImageDispatch(poutre::geo::reconstruction_type rect_type,
   poutre::se::Common_NL_SE nl_static,
   poutre::IInterface &o_img)
 {
-  using ImgType =
-    poutre::details::image_t<typename poutre::enum_to_type<poutre::CompoundType::CompoundType_Scalar, P>::type,
-      NumDims>;
+  using ValueType = typename poutre::enum_to_type<poutre::CompoundType::CompoundType_Scalar, P>::type;
+  if constexpr (NumDims >= 2) {
+    // tiled storage, per tile reconstruction iterated until stable
+    if (i_marker.GetTileEdge() != 0) {
+      using TiledType = poutre::details::image_tiled_t<ValueType, NumDims>;
+      const auto *tiledmarker_t = dynamic_cast<const TiledType *>(&i_marker);
+      if (!tiledmarker_t) { POUTRE_RUNTIME_ERROR("ReconstructionImageDispatch tiled i_marker downcast fail"); }
+      const auto *tiledmask_t = dynamic_cast<const TiledType *>(&i_mask);
+      if (!tiledmask_t) { POUTRE_RUNTIME_ERROR("ReconstructionImageDispatch tiled i_mask downcast fail"); }
+      auto *tiledout_t = dynamic_cast<TiledType *>(&o_img);
+      if (!tiledout_t) { POUTRE_RUNTIME_ERROR("ReconstructionImageDispatch tiled o_img downcast fail"); }
+      poutre::geo::details::t_Reconstruct(rect_type, *tiledmarker_t, *tiledmask_t, nl_static, *tiledout_t);
+      return;
+    }
+  }
+  using ImgType = poutre::details::image_t<ValueType, NumDims>;
   const auto *imgmarker_t = dynamic_cast<const ImgType *>(&i_marker);
   if (!imgmarker_t) { POUTRE_RUNTIME_ERROR("ReconstructionImageDispatch i_marker downcast fail"); }
   const auto *imgmask_t = dynamic_cast<const ImgType *>(&i_mask);
@@ -52,6 +67,8 @@ void Reconstruction(reconstruction_type rect_type,
   IInterface &o_img)
 {
   POUTRE_ENTERING("Reconstruction");
+  AssertLayoutsCompatible(i_marker, o_img, "Reconstruction marker and output must be both row major or tiled alike");
+  AssertLayoutsCompatible(i_mask, o_img, "Reconstruction mask and output must be both row major or tiled alike");
   switch (i_marker.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("Reconstruction Unsupported number of dims:0");
@@ -61,6 +78,12 @@ void Reconstruction(reconstruction_type rect_type,
     case poutre::PType::PType_GrayUINT8: {
       ReconstructionImageDispatch<1, poutre::PType::PType_GrayUINT8>(rect_type, i_marker, i_mask, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ReconstructionImageDispatch<1, poutre::PType::PType_GrayUINT16>(rect_type, i_marker, i_mask, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ReconstructionImageDispatch<1, poutre::PType::PType_GrayINT16>(rect_type, i_marker, i_mask, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ReconstructionImageDispatch<1, poutre::PType::PType_GrayINT32>(rect_type, i_marker, i_mask, nl_static, o_img);
     } break;
@@ -83,6 +106,12 @@ void Reconstruction(reconstruction_type rect_type,
     case poutre::PType::PType_GrayUINT8: {
       ReconstructionImageDispatch<2, poutre::PType::PType_GrayUINT8>(rect_type, i_marker, i_mask, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ReconstructionImageDispatch<2, poutre::PType::PType_GrayUINT16>(rect_type, i_marker, i_mask, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ReconstructionImageDispatch<2, poutre::PType::PType_GrayINT16>(rect_type, i_marker, i_mask, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ReconstructionImageDispatch<2, poutre::PType::PType_GrayINT32>(rect_type, i_marker, i_mask, nl_static, o_img);
     } break;
@@ -105,6 +134,12 @@ void Reconstruction(reconstruction_type rect_type,
     case poutre::PType::PType_GrayUINT8: {
       ReconstructionImageDispatch<3, poutre::PType::PType_GrayUINT8>(rect_type, i_marker, i_mask, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ReconstructionImageDispatch<3, poutre::PType::PType_GrayUINT16>(rect_type, i_marker, i_mask, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ReconstructionImageDispatch<3, poutre::PType::PType_GrayINT16>(rect_type, i_marker, i_mask, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ReconstructionImageDispatch<3, poutre::PType::PType_GrayINT32>(rect_type, i_marker, i_mask, nl_static, o_img);
     } break;
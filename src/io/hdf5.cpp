@@ -44,7 +44,10 @@ void StoreWithHDF5ScalarDispatch(const std::string &path,
                      PType ptype)
 {
 switch( ptype ) {
+  case PType::PType_BinPack: details::StoreWithHDF5BinPack_helper<dim>(iimage, path, image_name); break;
   case PType::PType_GrayUINT8: details::StoreWithHDF5_helper<pUINT8, dim>(iimage, path, image_name); break;
+  case PType::PType_GrayUINT16: details::StoreWithHDF5_helper<pUINT16, dim>(iimage, path, image_name); break;
+  case PType::PType_GrayINT16: details::StoreWithHDF5_helper<pINT16, dim>(iimage, path, image_name); break;
   case PType::PType_GrayINT32: details::StoreWithHDF5_helper<pINT32, dim>(iimage, path, image_name); break;
   case PType::PType_GrayINT64: details::StoreWithHDF5_helper<pINT64, dim>(iimage, path, image_name); break;
   case PType::PType_F32: details::StoreWithHDF5_helper<pFLOAT, dim>(iimage, path, image_name); break;
@@ -88,7 +91,10 @@ template <ptrdiff_t dim>
 void LoadFromHDF5Dispatch(IInterface &iimage, const H5::DataSet &data_set, PType ptype)
 {
   switch( ptype ) {
+  case PType::PType_BinPack: details::LoadFromHDF5BinPack_helper<dim>(iimage, data_set); break;
   case PType::PType_GrayUINT8: details::LoadFromHDF5_helper<pUINT8, dim>(iimage, data_set); break;
+  case PType::PType_GrayUINT16: details::LoadFromHDF5_helper<pUINT16, dim>(iimage, data_set); break;
+  case PType::PType_GrayINT16: details::LoadFromHDF5_helper<pINT16, dim>(iimage, data_set); break;
   case PType::PType_GrayINT32: details::LoadFromHDF5_helper<pINT32, dim>(iimage, data_set); break;
   case PType::PType_GrayINT64: details::LoadFromHDF5_helper<pINT64, dim>(iimage, data_set); break;
   case PType::PType_F32: details::LoadFromHDF5_helper<pFLOAT, dim>(iimage, data_set); break;
@@ -232,8 +238,14 @@ std::unique_ptr<IInterface>
   resAttr = dataset.openAttribute("IMAGE_P_TYPE");
   stype   = resAttr.getStrType();
   resAttr.read(stype, attrpType);
-  if( attrpType == details::PUINT8 ) {
+  if( attrpType == details::PBINPACK ) {
+    ptype = PType::PType_BinPack;
+  } else if( attrpType == details::PUINT8 ) {
     ptype = PType::PType_GrayUINT8;
+  } else if( attrpType == details::PUINT16 ) {
+    ptype = PType::PType_GrayUINT16;
+  } else if( attrpType == details::PINT16 ) {
+    ptype = PType::PType_GrayINT16;
   } else if( attrpType == details::PINT32 ) {
     ptype = PType::PType_GrayINT32;
   } else if( attrpType == details::PINT64 ) {
@@ -24,6 +24,7 @@
 #include <cstddef>
 #include <filesystem>
 #include <format>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -34,13 +35,32 @@ namespace poutre::io {
 void LoadFromOIIOScalarDispatch(OIIO::ImageInput &in_oiio, poutre::IInterface &img, PType ptype)
 {
   switch (ptype) {
-    // todo think about bool/binary here
+  case PType::PType_BinPack: {
+    using ImageType_t = poutre::details::image_t<pBinPack, 2>;
+    auto *img_t = dynamic_cast<ImageType_t *>(&img);
+    if (img_t == nullptr) { POUTRE_RUNTIME_ERROR("Dynamic cast fail"); }
+    poutre::details::image_t<pUINT8, 2> unpacked(img_t->GetShape());
+    details::FillImageFromOIIOScalar(in_oiio, unpacked);
+    poutre::details::t_PackBinary(unpacked, *img_t);
+  } break;
   case PType::PType_GrayUINT8: {
     using ImageType_t = poutre::details::image_t<pUINT8, 2>;
     auto *img_t = dynamic_cast<ImageType_t *>(&img);
     if (img_t == nullptr) { POUTRE_RUNTIME_ERROR("Dynamic cast fail"); }
     details::FillImageFromOIIOScalar(in_oiio, *img_t);
   } break;
+  case PType::PType_GrayUINT16: {
+    using ImageType_t = poutre::details::image_t<pUINT16, 2>;
+    auto *img_t = dynamic_cast<ImageType_t *>(&img);
+    if (img_t == nullptr) { POUTRE_RUNTIME_ERROR("Dynamic cast fail"); }
+    details::FillImageFromOIIOScalar(in_oiio, *img_t);
+  } break;
+  case PType::PType_GrayINT16: {
+    using ImageType_t = poutre::details::image_t<pINT16, 2>;
+    auto *img_t = dynamic_cast<ImageType_t *>(&img);
+    if (img_t == nullptr) { POUTRE_RUNTIME_ERROR("Dynamic cast fail"); }
+    details::FillImageFromOIIOScalar(in_oiio, *img_t);
+  } break;
   case PType::PType_GrayINT32: {
     using ImageType_t = poutre::details::image_t<pINT32, 2>;
     auto *img_t = dynamic_cast<ImageType_t *>(&img);
@@ -167,13 +187,35 @@ void StoreWithOIIOScalarDispatch(const IInterface &img,
   PType ptype)
 {
   switch (ptype) {
-    // todo think about bool/binary here
+  case PType::PType_BinPack: {
+    // written as 1 bit per sample where the format allows it (png, tiff), 0/255 otherwise
+    using ImageType_t = poutre::details::image_t<pBinPack, 2>;
+    const auto *img_t = dynamic_cast<const ImageType_t *>(&img);
+    if (img_t == nullptr) { POUTRE_RUNTIME_ERROR("Dynamic cast fail"); }
+    poutre::details::image_t<pUINT8, 2> unpacked(img_t->GetShape());
+    poutre::details::t_UnpackBinary(*img_t, unpacked, std::numeric_limits<pUINT8>::max());
+    auto binary_options = options;
+    binary_options.attribute("oiio:BitsPerSample", 1);
+    details::StoreWithOIIOScalar(unpacked, path, binary_options);
+  } break;
   case PType::PType_GrayUINT8: {
     using ImageType_t = poutre::details::image_t<pUINT8, 2>;
     const auto *img_t = dynamic_cast<const ImageType_t *>(&img);
     if (img_t == nullptr) { POUTRE_RUNTIME_ERROR("Dynamic cast fail"); }
     details::StoreWithOIIOScalar(*img_t, path, options);
   } break;
+  case PType::PType_GrayUINT16: {
+    using ImageType_t = poutre::details::image_t<pUINT16, 2>;
+    const auto *img_t = dynamic_cast<const ImageType_t *>(&img);
+    if (img_t == nullptr) { POUTRE_RUNTIME_ERROR("Dynamic cast fail"); }
+    details::StoreWithOIIOScalar(*img_t, path, options);
+  } break;
+  case PType::PType_GrayINT16: {
+    using ImageType_t = poutre::details::image_t<pINT16, 2>;
+    const auto *img_t = dynamic_cast<const ImageType_t *>(&img);
+    if (img_t == nullptr) { POUTRE_RUNTIME_ERROR("Dynamic cast fail"); }
+    details::StoreWithOIIOScalar(*img_t, path, options);
+  } break;
   case PType::PType_GrayINT32: {
     using ImageType_t = poutre::details::image_t<pINT32, 2>;
     const auto *img_t = dynamic_cast<const ImageType_t *>(&img);
@@ -355,6 +397,12 @@ std::unique_ptr<IInterface> LoadOIIO(const std::string &image_path)
   case OpenImageIO_v2_5::TypeDesc::BASETYPE::UINT8:
     ptype = PType::PType_GrayUINT8;
     break;
+  case OpenImageIO_v2_5::TypeDesc::BASETYPE::UINT16:
+    ptype = PType::PType_GrayUINT16;
+    break;
+  case OpenImageIO_v2_5::TypeDesc::BASETYPE::INT16:
+    ptype = PType::PType_GrayINT16;
+    break;
   case OpenImageIO_v2_5::TypeDesc::BASETYPE::INT32:
     ptype = PType::PType_GrayINT32;
     break;
@@ -376,6 +424,11 @@ std::unique_ptr<IInterface> LoadOIIO(const std::string &image_path)
     error_stream << " see desc \n" << spec.to_xml();
     POUTRE_RUNTIME_ERROR(error_stream.str());
   };
+  // 1 bit per sample files are binary images
+  if (ctype == CompoundType::CompoundType_Scalar && ptype == PType::PType_GrayUINT8
+      && spec.get_int_attribute("oiio:BitsPerSample", 8) == 1) {
+    ptype = PType::PType_BinPack;
+  }
   auto i_img = poutre::Create(dims, ctype, ptype);
   switch (ctype) {
   case CompoundType::CompoundType_Scalar: {
@@ -26,7 +26,8 @@ namespace {
 template<std::ptrdiff_t NumDims, poutre::PType P>
 size_t label_binaryImageDispatch(const poutre::IInterface &i_img,
   poutre::se::Common_NL_SE nl_static,
-  poutre::IInterface &o_img)
+  poutre::IInterface &o_img,
+  poutre::label::LabelStatistics *o_stats)
 {
   using ImgType =
     poutre::details::image_t<typename poutre::enum_to_type<poutre::CompoundType::CompoundType_Scalar, P>::type,
@@ -39,34 +40,46 @@ size_t label_binaryImageDispatch(const poutre::IInterface &i_img,
   auto *imgout_t = dynamic_cast<OImgType *>(&o_img);
   if (!imgout_t) { POUTRE_RUNTIME_ERROR("label_binaryImageDispatch o_img downcast fail"); }
 
-  return poutre::label::details::t_label_binary(*imgin_t, nl_static, *imgout_t);
+  return poutre::label::details::t_label_binary(*imgin_t, nl_static, *imgout_t, o_stats);
 }
 }// namespace
 namespace poutre::label {
 
-size_t label_binary(const IInterface &i_img, se::Common_NL_SE nl_static, IInterface &o_img)
+namespace {
+std::size_t label_binaryImpl(const IInterface &i_img,
+  se::Common_NL_SE nl_static,
+  IInterface &o_img,
+  LabelStatistics *o_stats)
 {
-  POUTRE_ENTERING("label_binary");
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("label_binary Unsupported number of dims:0");
   }
   case 1: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      return label_binaryImageDispatch<1, poutre::PType::PType_BinPack>(i_img, nl_static, o_img, o_stats);
+    }
     case poutre::PType::PType_GrayUINT8: {
-      return label_binaryImageDispatch<1, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<1, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img, o_stats);
+    }
+    case poutre::PType::PType_GrayUINT16: {
+      return label_binaryImageDispatch<1, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img, o_stats);
+    }
+    case poutre::PType::PType_GrayINT16: {
+      return label_binaryImageDispatch<1, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_GrayINT32: {
-      return label_binaryImageDispatch<1, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<1, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_GrayINT64: {
-      return label_binaryImageDispatch<1, poutre::PType::PType_GrayINT64>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<1, poutre::PType::PType_GrayINT64>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_F32: {
-      return label_binaryImageDispatch<1, poutre::PType::PType_F32>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<1, poutre::PType::PType_F32>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_D64: {
-      return label_binaryImageDispatch<1, poutre::PType::PType_D64>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<1, poutre::PType::PType_D64>(i_img, nl_static, o_img, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("label_binary unsupported PTYPE");
@@ -75,20 +88,29 @@ size_t label_binary(const IInterface &i_img, se::Common_NL_SE nl_static, IInterf
   }
   case 2: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      return label_binaryImageDispatch<2, poutre::PType::PType_BinPack>(i_img, nl_static, o_img, o_stats);
+    }
     case poutre::PType::PType_GrayUINT8: {
-      return label_binaryImageDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img, o_stats);
+    }
+    case poutre::PType::PType_GrayUINT16: {
+      return label_binaryImageDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img, o_stats);
+    }
+    case poutre::PType::PType_GrayINT16: {
+      return label_binaryImageDispatch<2, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_GrayINT32: {
-      return label_binaryImageDispatch<2, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<2, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_GrayINT64: {
-      return label_binaryImageDispatch<2, poutre::PType::PType_GrayINT64>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<2, poutre::PType::PType_GrayINT64>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_F32: {
-      return label_binaryImageDispatch<2, poutre::PType::PType_F32>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<2, poutre::PType::PType_F32>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_D64: {
-      return label_binaryImageDispatch<2, poutre::PType::PType_D64>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<2, poutre::PType::PType_D64>(i_img, nl_static, o_img, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("label_binary unsupported PTYPE");
@@ -97,20 +119,29 @@ size_t label_binary(const IInterface &i_img, se::Common_NL_SE nl_static, IInterf
   }
   case 3: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      return label_binaryImageDispatch<3, poutre::PType::PType_BinPack>(i_img, nl_static, o_img, o_stats);
+    }
     case poutre::PType::PType_GrayUINT8: {
-      return label_binaryImageDispatch<3, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<3, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img, o_stats);
+    }
+    case poutre::PType::PType_GrayUINT16: {
+      return label_binaryImageDispatch<3, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img, o_stats);
+    }
+    case poutre::PType::PType_GrayINT16: {
+      return label_binaryImageDispatch<3, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_GrayINT32: {
-      return label_binaryImageDispatch<3, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<3, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_GrayINT64: {
-      return label_binaryImageDispatch<3, poutre::PType::PType_GrayINT64>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<3, poutre::PType::PType_GrayINT64>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_F32: {
-      return label_binaryImageDispatch<3, poutre::PType::PType_F32>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<3, poutre::PType::PType_F32>(i_img, nl_static, o_img, o_stats);
     }
     case poutre::PType::PType_D64: {
-      return label_binaryImageDispatch<3, poutre::PType::PType_D64>(i_img, nl_static, o_img);
+      return label_binaryImageDispatch<3, poutre::PType::PType_D64>(i_img, nl_static, o_img, o_stats);
     }
     default: {
       POUTRE_RUNTIME_ERROR("label_binary unsupported PTYPE");
@@ -125,4 +156,17 @@ size_t label_binary(const IInterface &i_img, se::Common_NL_SE nl_static, IInterf
   }
   }
 }
-}// namespace poutre::label
\ No newline at end of file
+}// namespace
+
+std::size_t label_binary(const IInterface &i_img, se::Common_NL_SE nl_static, IInterface &o_img)
+{
+  POUTRE_ENTERING("label_binary");
+  return label_binaryImpl(i_img, nl_static, o_img, nullptr);
+}
+
+std::size_t label_binary(const IInterface &i_img, se::Common_NL_SE nl_static, IInterface &o_img, LabelStatistics &o_stats)
+{
+  POUTRE_ENTERING("label_binary with statistics");
+  return label_binaryImpl(i_img, nl_static, o_img, &o_stats);
+}
+}// namespace poutre::label
@@ -30,7 +30,7 @@ void label_minima(const IInterface &i_img,  se::Common_NL_SE nl_static, IInterfa
   AssertSizesCompatible(i_img, o_img, "label_minima incompatible size");
   AssertImagesAreDifferent(i_img, o_img, "label_minima output must be != than input images");
 
-  auto img_tmp = poutre::CloneGeometry(i_img); // NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
   poutre::geo::h_concave(i_img, CreatePixelValue(1,i_img.GetPType()),nl_static, *img_tmp);
   poutre::label::label_binary(*img_tmp, nl_static, o_img);
 }
@@ -41,7 +41,7 @@ void label_maxima(const IInterface &i_img,  se::Common_NL_SE nl_static, IInterfa
   AssertSizesCompatible(i_img, o_img, "label_maxima incompatible size");
   AssertImagesAreDifferent(i_img, o_img, "label_maxima output must be != than input images");
 
-  auto img_tmp = poutre::CloneGeometry(i_img); // NOLINT
+  auto img_tmp = poutre::CloneGeometry(i_img, AllocationMode::Pooled); // NOLINT
   poutre::geo::h_convex(i_img, CreatePixelValue(1,i_img.GetPType()),nl_static, *img_tmp);
   poutre::label::label_binary(*img_tmp, nl_static, o_img);
 }
@@ -18,9 +18,13 @@
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_decomposed_se_t.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
 #include <poutre/low_level_morpho/ero_dil.hpp>
+#include <poutre/pixel_processing/copy_convert.hpp>
 #include <poutre/structuring_element/details/neighbor_list_se_t.hpp>
+#include <poutre/structuring_element/se_chained.hpp>
+#include <poutre/structuring_element/se_decomposition.hpp>
 #include <poutre/structuring_element/se_interface.hpp>
 
 namespace {
@@ -36,6 +40,13 @@ void ErodeImageRuntimeNLDispatch(const poutre::IInterface &i_img,
   if (!img1_t) { POUTRE_RUNTIME_ERROR("ErodeImageDispatch img1_t downcast fail"); }
   auto *img2_t = dynamic_cast<ImgType *>(&o_img);
   if (!img2_t) { POUTRE_RUNTIME_ERROR("ErodeImageDispatch img2_t downcast fail"); }
+  if constexpr (NumDims == 2) {
+    const auto plan = poutre::se::GetDecompositionPlan(nl_runtime);
+    if (plan->IsWorthIt()) {
+      poutre::llm::details::t_Erode(*img1_t, *plan, *img2_t);
+      return;
+    }
+  }
   poutre::llm::details::t_Erode(*img1_t, nl_runtime, *img2_t);
 }
 
@@ -51,8 +62,39 @@ void DilateImageRuntimeNLDispatch(const poutre::IInterface &i_img,
   if (!img1_t) { POUTRE_RUNTIME_ERROR("DilateImageDispatch img1_t downcast fail"); }
   auto *img2_t = dynamic_cast<ImgType *>(&o_img);
   if (!img2_t) { POUTRE_RUNTIME_ERROR("DilateImageDispatch img2_t downcast fail"); }
+  if constexpr (NumDims == 2) {
+    const auto plan = poutre::se::GetDecompositionPlan(nl_runtime);
+    if (plan->IsWorthIt()) {
+      poutre::llm::details::t_Dilate(*img1_t, *plan, *img2_t);
+      return;
+    }
+  }
   poutre::llm::details::t_Dilate(*img1_t, nl_runtime, *img2_t);
 }
+
+// apply each SE of the chain in turn
+template<class Op>
+void ChainDispatch(const poutre::IInterface &i_img,
+  const poutre::se::ChainedStructuringElement &chain,
+  poutre::IInterface &o_img,
+  Op op)
+{
+  const auto nb_se = chain.GetChainSize();
+  if (nb_se == 0) { POUTRE_RUNTIME_ERROR("ChainDispatch empty chain"); }
+  auto tmp1 = nb_se > 1 ? poutre::CloneGeometry(i_img, poutre::AllocationMode::Pooled) : nullptr;
+  auto tmp2 = nb_se > 2 ? poutre::CloneGeometry(i_img, poutre::AllocationMode::Pooled) : nullptr;
+  const poutre::IInterface *src = &i_img;
+  for (std::size_t i = 0; i < nb_se; ++i) {
+    poutre::IInterface *dst = nullptr;
+    if (i + 1 == nb_se) {
+      dst = &o_img;
+    } else {
+      dst = src == tmp1.get() ? tmp2.get() : tmp1.get();
+    }
+    op(*src, chain.GetElement(i), *dst);
+    src = dst;
+  }
+}
 }// namespace
 
 namespace poutre {
@@ -63,6 +105,14 @@ void Dilate(const poutre::IInterface &i_img, const se::IStructuringElement &str_
   AssertAsTypesCompatible(i_img, o_img, "Dilate images must have compatible types");
   AssertImagesAreDifferent(i_img, o_img, "Dilate images input output images must be different");
 
+  if (const auto *chain = dynamic_cast<const se::ChainedStructuringElement *>(&str_el); chain != nullptr) {
+    ChainDispatch(
+      i_img, *chain, o_img, [](const IInterface &img_in, const se::IStructuringElement &strel, IInterface &img_out) {
+        Dilate(img_in, strel, img_out);
+      });
+    return;
+  }
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("Dilate Unsupported number of dims:0");
@@ -74,6 +124,12 @@ void Dilate(const poutre::IInterface &i_img, const se::IStructuringElement &str_
     case poutre::PType::PType_GrayUINT8: {
       DilateImageRuntimeNLDispatch<1, poutre::PType::PType_GrayUINT8>(i_img, *strel_ptr_t, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageRuntimeNLDispatch<1, poutre::PType::PType_GrayUINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageRuntimeNLDispatch<1, poutre::PType::PType_GrayINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageRuntimeNLDispatch<1, poutre::PType::PType_GrayINT32>(i_img, *strel_ptr_t, o_img);
     } break;
@@ -99,6 +155,12 @@ void Dilate(const poutre::IInterface &i_img, const se::IStructuringElement &str_
     case poutre::PType::PType_GrayUINT8: {
       DilateImageRuntimeNLDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, *strel_ptr_t, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageRuntimeNLDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageRuntimeNLDispatch<2, poutre::PType::PType_GrayINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageRuntimeNLDispatch<2, poutre::PType::PType_GrayINT32>(i_img, *strel_ptr_t, o_img);
     } break;
@@ -123,6 +185,12 @@ void Dilate(const poutre::IInterface &i_img, const se::IStructuringElement &str_
     case poutre::PType::PType_GrayUINT8: {
       DilateImageRuntimeNLDispatch<3, poutre::PType::PType_GrayUINT8>(i_img, *strel_ptr_t, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageRuntimeNLDispatch<3, poutre::PType::PType_GrayUINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageRuntimeNLDispatch<3, poutre::PType::PType_GrayINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageRuntimeNLDispatch<3, poutre::PType::PType_GrayINT32>(i_img, *strel_ptr_t, o_img);
     } break;
@@ -156,6 +224,14 @@ void Erode(const poutre::IInterface &i_img, const se::IStructuringElement &str_e
   AssertAsTypesCompatible(i_img, o_img, "Erode images must have compatible types");
   AssertImagesAreDifferent(i_img, o_img, "Erode images input output images must be different");
 
+  if (const auto *chain = dynamic_cast<const se::ChainedStructuringElement *>(&str_el); chain != nullptr) {
+    ChainDispatch(
+      i_img, *chain, o_img, [](const IInterface &img_in, const se::IStructuringElement &strel, IInterface &img_out) {
+        Erode(img_in, strel, img_out);
+      });
+    return;
+  }
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("Erode Unsupported number of dims:0");
@@ -167,6 +243,12 @@ void Erode(const poutre::IInterface &i_img, const se::IStructuringElement &str_e
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageRuntimeNLDispatch<1, poutre::PType::PType_GrayUINT8>(i_img, *strel_ptr_t, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageRuntimeNLDispatch<1, poutre::PType::PType_GrayUINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageRuntimeNLDispatch<1, poutre::PType::PType_GrayINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageRuntimeNLDispatch<1, poutre::PType::PType_GrayINT32>(i_img, *strel_ptr_t, o_img);
     } break;
@@ -192,6 +274,12 @@ void Erode(const poutre::IInterface &i_img, const se::IStructuringElement &str_e
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageRuntimeNLDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, *strel_ptr_t, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageRuntimeNLDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageRuntimeNLDispatch<2, poutre::PType::PType_GrayINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageRuntimeNLDispatch<2, poutre::PType::PType_GrayINT32>(i_img, *strel_ptr_t, o_img);
     } break;
@@ -216,6 +304,12 @@ void Erode(const poutre::IInterface &i_img, const se::IStructuringElement &str_e
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageRuntimeNLDispatch<3, poutre::PType::PType_GrayUINT8>(i_img, *strel_ptr_t, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageRuntimeNLDispatch<3, poutre::PType::PType_GrayUINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageRuntimeNLDispatch<3, poutre::PType::PType_GrayINT16>(i_img, *strel_ptr_t, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageRuntimeNLDispatch<3, poutre::PType::PType_GrayINT32>(i_img, *strel_ptr_t, o_img);
     } break;
@@ -73,6 +73,12 @@ void Erode(const IInterface &i_img, se::Compound_NL_SE nl_compound, const int si
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, nl_compound, size, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, nl_compound, size, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageDispatch<2, poutre::PType::PType_GrayINT16>(i_img, nl_compound, size, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageDispatch<2, poutre::PType::PType_GrayINT32>(i_img, nl_compound, size, o_img);
     } break;
@@ -95,6 +101,12 @@ void Erode(const IInterface &i_img, se::Compound_NL_SE nl_compound, const int si
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageDispatch<3, poutre::PType::PType_GrayUINT8>(i_img, nl_compound, size, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageDispatch<3, poutre::PType::PType_GrayUINT16>(i_img, nl_compound, size, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageDispatch<3, poutre::PType::PType_GrayINT16>(i_img, nl_compound, size, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageDispatch<3, poutre::PType::PType_GrayINT32>(i_img, nl_compound, size, o_img);
     } break;
@@ -139,6 +151,12 @@ void Dilate(const IInterface &i_img, se::Compound_NL_SE nl_compound, const int s
     case poutre::PType::PType_GrayUINT8: {
       DilateImageDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, nl_compound, size, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, nl_compound, size, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageDispatch<2, poutre::PType::PType_GrayINT16>(i_img, nl_compound, size, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageDispatch<2, poutre::PType::PType_GrayINT32>(i_img, nl_compound, size, o_img);
     } break;
@@ -161,6 +179,12 @@ void Dilate(const IInterface &i_img, se::Compound_NL_SE nl_compound, const int s
     case poutre::PType::PType_GrayUINT8: {
       DilateImageDispatch<3, poutre::PType::PType_GrayUINT8>(i_img, nl_compound, size, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageDispatch<3, poutre::PType::PType_GrayUINT16>(i_img, nl_compound, size, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageDispatch<3, poutre::PType::PType_GrayINT16>(i_img, nl_compound, size, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageDispatch<3, poutre::PType::PType_GrayINT32>(i_img, nl_compound, size, o_img);
     } break;
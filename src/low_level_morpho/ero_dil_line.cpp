@@ -12,6 +12,7 @@
 //==============================================================================
 
 #include <cstddef>
+#include <string>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
 #include <poutre/base/image_interface.hpp>
@@ -20,6 +21,7 @@
 #include <poutre/base/types_traits.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_line_se_t.hpp>
 #include <poutre/low_level_morpho/ero_dil_line.hpp>
+#include <poutre/pixel_processing/copy_convert.hpp>
 
 namespace {
 template<std::ptrdiff_t NumDims, poutre::PType P>
@@ -74,6 +76,74 @@ void DilateImageLineYDispatch(const poutre::IInterface &i_img, ptrdiff_t size_se
   poutre::llm::details::t_DilateY(*img1_t, size_segment, *img2_t);
 }
 
+// downcast 2D scalar images and call func(in, out) on typed images
+template<class Func>
+void Dispatch2D(const poutre::IInterface &i_img, poutre::IInterface &o_img, const std::string &name, Func &&func)
+{
+  if (i_img.GetRank() != 2) { POUTRE_RUNTIME_ERROR(name + " Unsupported number of dims"); }
+  auto call = [&]<poutre::PType P>() {
+    using ImgType =
+      poutre::details::image_t<typename poutre::enum_to_type<poutre::CompoundType::CompoundType_Scalar, P>::type, 2>;
+    const auto *img1_t = dynamic_cast<const ImgType *>(&i_img);
+    if (!img1_t) { POUTRE_RUNTIME_ERROR(name + " img1_t downcast fail"); }
+    auto *img2_t = dynamic_cast<ImgType *>(&o_img);
+    if (!img2_t) { POUTRE_RUNTIME_ERROR(name + " img2_t downcast fail"); }
+    func(*img1_t, *img2_t);
+  };
+  switch (i_img.GetPType()) {
+  case poutre::PType::PType_GrayUINT8: {
+    call.template operator()<poutre::PType::PType_GrayUINT8>();
+  } break;
+  case poutre::PType::PType_GrayUINT16: {
+    call.template operator()<poutre::PType::PType_GrayUINT16>();
+  } break;
+  case poutre::PType::PType_GrayINT16: {
+    call.template operator()<poutre::PType::PType_GrayINT16>();
+  } break;
+  case poutre::PType::PType_GrayINT32: {
+    call.template operator()<poutre::PType::PType_GrayINT32>();
+  } break;
+  case poutre::PType::PType_GrayINT64: {
+    call.template operator()<poutre::PType::PType_GrayINT64>();
+  } break;
+  case poutre::PType::PType_F32: {
+    call.template operator()<poutre::PType::PType_F32>();
+  } break;
+  case poutre::PType::PType_D64: {
+    call.template operator()<poutre::PType::PType_D64>();
+  } break;
+  default: {
+    POUTRE_RUNTIME_ERROR(name + " unsupported PTYPE");
+  }
+  }
+}
+
+using LineOp = void (*)(const poutre::IInterface &, const ptrdiff_t, poutre::IInterface &);
+
+// rectangle = line along X then line along Y, degenerated rectangles skip the temporary image
+void RectFromLines(const poutre::IInterface &i_img,
+  ptrdiff_t size_half_x,
+  ptrdiff_t size_half_y,
+  poutre::IInterface &o_img,
+  LineOp lineX,
+  LineOp lineY)
+{
+  POUTRE_CHECK(size_half_x >= 0 && size_half_y >= 0, "Rectangle half sizes must be >= 0");
+  const auto rank = i_img.GetRank();
+  if (rank != 1 && rank != 2) { POUTRE_RUNTIME_ERROR("Rectangle SE unsupported number of dims"); }
+  if (rank == 1) { POUTRE_CHECK(size_half_y == 0, "Rectangle SE on 1D image must have size_half_y == 0"); }
+  if (size_half_y == 0) {
+    lineX(i_img, size_half_x, o_img);
+    return;
+  }
+  if (size_half_x == 0) {
+    lineY(i_img, size_half_y, o_img);
+    return;
+  }
+  auto tmpImg = poutre::CloneGeometry(i_img, poutre::AllocationMode::Pooled);
+  lineX(i_img, size_half_x, *tmpImg);
+  lineY(*tmpImg, size_half_y, o_img);
+}
 }// namespace
 
 namespace poutre {
@@ -93,6 +163,12 @@ void DilateX(const poutre::IInterface &i_img, const ptrdiff_t size_half_segment,
     case poutre::PType::PType_GrayUINT8: {
       DilateImageLineXDispatch<1, poutre::PType::PType_GrayUINT8>(i_img, size_half_segment, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageLineXDispatch<1, poutre::PType::PType_GrayUINT16>(i_img, size_half_segment, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageLineXDispatch<1, poutre::PType::PType_GrayINT16>(i_img, size_half_segment, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageLineXDispatch<1, poutre::PType::PType_GrayINT32>(i_img, size_half_segment, o_img);
     } break;
@@ -115,6 +191,12 @@ void DilateX(const poutre::IInterface &i_img, const ptrdiff_t size_half_segment,
     case poutre::PType::PType_GrayUINT8: {
       DilateImageLineXDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, size_half_segment, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageLineXDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, size_half_segment, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageLineXDispatch<2, poutre::PType::PType_GrayINT16>(i_img, size_half_segment, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageLineXDispatch<2, poutre::PType::PType_GrayINT32>(i_img, size_half_segment, o_img);
     } break;
@@ -160,6 +242,12 @@ void DilateY(const poutre::IInterface &i_img, const ptrdiff_t size_half_segment,
     case poutre::PType::PType_GrayUINT8: {
       DilateImageLineYDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, size_half_segment, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageLineYDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, size_half_segment, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageLineYDispatch<2, poutre::PType::PType_GrayINT16>(i_img, size_half_segment, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageLineYDispatch<2, poutre::PType::PType_GrayINT32>(i_img, size_half_segment, o_img);
     } break;
@@ -202,6 +290,12 @@ void ErodeX(const poutre::IInterface &i_img, const ptrdiff_t size_half_segment,
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageLineXDispatch<1, poutre::PType::PType_GrayUINT8>(i_img, size_half_segment, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageLineXDispatch<1, poutre::PType::PType_GrayUINT16>(i_img, size_half_segment, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageLineXDispatch<1, poutre::PType::PType_GrayINT16>(i_img, size_half_segment, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageLineXDispatch<1, poutre::PType::PType_GrayINT32>(i_img, size_half_segment, o_img);
     } break;
@@ -224,6 +318,12 @@ void ErodeX(const poutre::IInterface &i_img, const ptrdiff_t size_half_segment,
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageLineXDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, size_half_segment, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageLineXDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, size_half_segment, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageLineXDispatch<2, poutre::PType::PType_GrayINT16>(i_img, size_half_segment, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageLineXDispatch<2, poutre::PType::PType_GrayINT32>(i_img, size_half_segment, o_img);
     } break;
@@ -268,6 +368,12 @@ void ErodeY(const poutre::IInterface &i_img, const ptrdiff_t size_half_segment,
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageLineYDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, size_half_segment, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageLineYDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, size_half_segment, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageLineYDispatch<2, poutre::PType::PType_GrayINT16>(i_img, size_half_segment, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageLineYDispatch<2, poutre::PType::PType_GrayINT32>(i_img, size_half_segment, o_img);
     } break;
@@ -293,4 +399,74 @@ void ErodeY(const poutre::IInterface &i_img, const ptrdiff_t size_half_segment,
   }
   }
 }
-}// namespace poutre
\ No newline at end of file
+
+void ErodeRect(const IInterface &i_img, const ptrdiff_t size_half_x, const ptrdiff_t size_half_y, IInterface &o_img)
+{
+  POUTRE_ENTERING("ErodeRect");
+  AssertSizesCompatible(i_img, o_img, "ErodeRect images have not compatible sizes");
+  AssertAsTypesCompatible(i_img, o_img, "ErodeRect images must have compatible types");
+  AssertImagesAreDifferent(i_img, o_img, "ErodeRect images input output images must be different");
+  RectFromLines(i_img, size_half_x, size_half_y, o_img, &ErodeX, &ErodeY);
+}
+
+void DilateRect(const IInterface &i_img, const ptrdiff_t size_half_x, const ptrdiff_t size_half_y, IInterface &o_img)
+{
+  POUTRE_ENTERING("DilateRect");
+  AssertSizesCompatible(i_img, o_img, "DilateRect images have not compatible sizes");
+  AssertAsTypesCompatible(i_img, o_img, "DilateRect images must have compatible types");
+  AssertImagesAreDifferent(i_img, o_img, "DilateRect images input output images must be different");
+  RectFromLines(i_img, size_half_x, size_half_y, o_img, &DilateX, &DilateY);
+}
+
+void ErodeLine(const IInterface &i_img, const double angle, const ptrdiff_t size_half_segment, IInterface &o_img)
+{
+  POUTRE_ENTERING("ErodeLine");
+  AssertSizesCompatible(i_img, o_img, "ErodeLine images have not compatible sizes");
+  AssertAsTypesCompatible(i_img, o_img, "ErodeLine images must have compatible types");
+  AssertImagesAreDifferent(i_img, o_img, "ErodeLine images input output images must be different");
+  Dispatch2D(i_img, o_img, "ErodeLine", [&](const auto &img_in, auto &img_out) {
+    poutre::llm::details::t_ErodeLine(img_in, angle, size_half_segment, img_out);
+  });
+}
+
+void DilateLine(const IInterface &i_img, const double angle, const ptrdiff_t size_half_segment, IInterface &o_img)
+{
+  POUTRE_ENTERING("DilateLine");
+  AssertSizesCompatible(i_img, o_img, "DilateLine images have not compatible sizes");
+  AssertAsTypesCompatible(i_img, o_img, "DilateLine images must have compatible types");
+  AssertImagesAreDifferent(i_img, o_img, "DilateLine images input output images must be different");
+  Dispatch2D(i_img, o_img, "DilateLine", [&](const auto &img_in, auto &img_out) {
+    poutre::llm::details::t_DilateLine(img_in, angle, size_half_segment, img_out);
+  });
+}
+
+void ErodePeriodicLine(const IInterface &i_img,
+  const ptrdiff_t dx,
+  const ptrdiff_t dy,
+  const ptrdiff_t size_half,
+  IInterface &o_img)
+{
+  POUTRE_ENTERING("ErodePeriodicLine");
+  AssertSizesCompatible(i_img, o_img, "ErodePeriodicLine images have not compatible sizes");
+  AssertAsTypesCompatible(i_img, o_img, "ErodePeriodicLine images must have compatible types");
+  AssertImagesAreDifferent(i_img, o_img, "ErodePeriodicLine images input output images must be different");
+  Dispatch2D(i_img, o_img, "ErodePeriodicLine", [&](const auto &img_in, auto &img_out) {
+    poutre::llm::details::t_ErodePeriodicLine(img_in, dx, dy, size_half, img_out);
+  });
+}
+
+void DilatePeriodicLine(const IInterface &i_img,
+  const ptrdiff_t dx,
+  const ptrdiff_t dy,
+  const ptrdiff_t size_half,
+  IInterface &o_img)
+{
+  POUTRE_ENTERING("DilatePeriodicLine");
+  AssertSizesCompatible(i_img, o_img, "DilatePeriodicLine images have not compatible sizes");
+  AssertAsTypesCompatible(i_img, o_img, "DilatePeriodicLine images must have compatible types");
+  AssertImagesAreDifferent(i_img, o_img, "DilatePeriodicLine images input output images must be different");
+  Dispatch2D(i_img, o_img, "DilatePeriodicLine", [&](const auto &img_in, auto &img_out) {
+    poutre::llm::details::t_DilatePeriodicLine(img_in, dx, dy, size_half, img_out);
+  });
+}
+}// namespace poutre
@@ -15,24 +15,42 @@
 #include <memory>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/data_structures/image_tiled_t.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_binpack_t.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_compound_static_se_t.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_static_se_t.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_tiled_t.hpp>
 #include <poutre/low_level_morpho/ero_dil.hpp>
+#include <poutre/low_level_morpho/ero_dil_line.hpp>
 #include <poutre/pixel_processing/copy_convert.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 
 namespace {
+// from this number of iterations, a (2*iter+1) square is computed through X and Y van Herk passes (cost independent of
+// iter) instead of iterating the 3x3 kernel
+constexpr int square_line_decomposition_min_iter = 4;
 
 template<std::ptrdiff_t NumDims, poutre::PType P>
 void ErodeImageDispatch(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static, poutre::IInterface &o_img)
 {
-  using ImgType =
-    poutre::details::image_t<typename poutre::enum_to_type<poutre::CompoundType::CompoundType_Scalar, P>::type,
-      NumDims>;
+  using ValueType = typename poutre::enum_to_type<poutre::CompoundType::CompoundType_Scalar, P>::type;
+  if constexpr (NumDims >= 2 && P != poutre::PType::PType_BinPack) {
+    // tiled storage, tile by tile with the SE extension as halo
+    if (i_img.GetTileEdge() != 0) {
+      using TiledType = poutre::details::image_tiled_t<ValueType, NumDims>;
+      const auto *tiled1_t = dynamic_cast<const TiledType *>(&i_img);
+      if (!tiled1_t) { POUTRE_RUNTIME_ERROR("ErodeImageDispatch tiled1_t downcast fail"); }
+      auto *tiled2_t = dynamic_cast<TiledType *>(&o_img);
+      if (!tiled2_t) { POUTRE_RUNTIME_ERROR("ErodeImageDispatch tiled2_t downcast fail"); }
+      poutre::llm::details::t_Erode(*tiled1_t, nl_static, *tiled2_t);
+      return;
+    }
+  }
+  using ImgType = poutre::details::image_t<ValueType, NumDims>;
   const auto *img1_t = dynamic_cast<const ImgType *>(&i_img);
   if (!img1_t) { POUTRE_RUNTIME_ERROR("ErodeImageDispatch img1_t downcast fail"); }
   auto *img2_t = dynamic_cast<ImgType *>(&o_img);
@@ -43,9 +61,20 @@ void ErodeImageDispatch(const poutre::IInterface &i_img, poutre::se::Common_NL_S
 template<std::ptrdiff_t NumDims, poutre::PType P>
 void DilateImageDispatch(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static, poutre::IInterface &o_img)
 {
-  using ImgType =
-    poutre::details::image_t<typename poutre::enum_to_type<poutre::CompoundType::CompoundType_Scalar, P>::type,
-      NumDims>;
+  using ValueType = typename poutre::enum_to_type<poutre::CompoundType::CompoundType_Scalar, P>::type;
+  if constexpr (NumDims >= 2 && P != poutre::PType::PType_BinPack) {
+    // tiled storage, tile by tile with the SE extension as halo
+    if (i_img.GetTileEdge() != 0) {
+      using TiledType = poutre::details::image_tiled_t<ValueType, NumDims>;
+      const auto *tiled1_t = dynamic_cast<const TiledType *>(&i_img);
+      if (!tiled1_t) { POUTRE_RUNTIME_ERROR("DilateImageDispatch tiled1_t downcast fail"); }
+      auto *tiled2_t = dynamic_cast<TiledType *>(&o_img);
+      if (!tiled2_t) { POUTRE_RUNTIME_ERROR("DilateImageDispatch tiled2_t downcast fail"); }
+      poutre::llm::details::t_Dilate(*tiled1_t, nl_static, *tiled2_t);
+      return;
+    }
+  }
+  using ImgType = poutre::details::image_t<ValueType, NumDims>;
   const auto *img1_t = dynamic_cast<const ImgType *>(&i_img);
   if (!img1_t) { POUTRE_RUNTIME_ERROR("DilateImageDispatch img1_t downcast fail"); }
   auto *img2_t = dynamic_cast<ImgType *>(&o_img);
@@ -58,6 +87,7 @@ void Erode(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static,
   AssertSizesCompatible(i_img, o_img, "Erode images have not compatible sizes");
   AssertAsTypesCompatible(i_img, o_img, "Erode images must have compatible types");
   AssertImagesAreDifferent(i_img, o_img, "Erode images input ouput images must be different");
+  AssertLayoutsCompatible(i_img, o_img, "Erode images must be both row major or tiled alike");
 
   switch (i_img.GetRank()) {
   case 0: {
@@ -65,9 +95,18 @@ void Erode(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static,
   }
   case 1: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      ErodeImageDispatch<1, poutre::PType::PType_BinPack>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageDispatch<1, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageDispatch<1, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageDispatch<1, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageDispatch<1, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
     } break;
@@ -87,9 +126,18 @@ void Erode(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static,
   } break;
   case 2: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      ErodeImageDispatch<2, poutre::PType::PType_BinPack>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageDispatch<2, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageDispatch<2, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
     } break;
@@ -109,9 +157,18 @@ void Erode(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static,
   } break;
   case 3: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      ErodeImageDispatch<3, poutre::PType::PType_BinPack>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayUINT8: {
       ErodeImageDispatch<3, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      ErodeImageDispatch<3, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      ErodeImageDispatch<3, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       ErodeImageDispatch<3, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
     } break;
@@ -143,6 +200,7 @@ void Dilate(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static,
   AssertSizesCompatible(i_img, o_img, "Dilate images have not compatible sizes");
   AssertAsTypesCompatible(i_img, o_img, "Dilate images must have compatible types");
   AssertImagesAreDifferent(i_img, o_img, "Dilate images input ouput images must be different");
+  AssertLayoutsCompatible(i_img, o_img, "Dilate images must be both row major or tiled alike");
 
   switch (i_img.GetRank()) {
   case 0: {
@@ -150,9 +208,18 @@ void Dilate(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static,
   }
   case 1: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      DilateImageDispatch<1, poutre::PType::PType_BinPack>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayUINT8: {
       DilateImageDispatch<1, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageDispatch<1, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageDispatch<1, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageDispatch<1, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
     } break;
@@ -172,9 +239,18 @@ void Dilate(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static,
   } break;
   case 2: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      DilateImageDispatch<2, poutre::PType::PType_BinPack>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayUINT8: {
       DilateImageDispatch<2, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageDispatch<2, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageDispatch<2, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageDispatch<2, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
     } break;
@@ -194,9 +270,18 @@ void Dilate(const poutre::IInterface &i_img, poutre::se::Common_NL_SE nl_static,
   } break;
   case 3: {
     switch (i_img.GetPType()) {
+    case poutre::PType::PType_BinPack: {
+      DilateImageDispatch<3, poutre::PType::PType_BinPack>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayUINT8: {
       DilateImageDispatch<3, poutre::PType::PType_GrayUINT8>(i_img, nl_static, o_img);
     } break;
+    case poutre::PType::PType_GrayUINT16: {
+      DilateImageDispatch<3, poutre::PType::PType_GrayUINT16>(i_img, nl_static, o_img);
+    } break;
+    case poutre::PType::PType_GrayINT16: {
+      DilateImageDispatch<3, poutre::PType::PType_GrayINT16>(i_img, nl_static, o_img);
+    } break;
     case poutre::PType::PType_GrayINT32: {
       DilateImageDispatch<3, poutre::PType::PType_GrayINT32>(i_img, nl_static, o_img);
     } break;
@@ -232,6 +317,7 @@ void Erode(const IInterface &i_img, se::Common_NL_SE nl_static, const int iter,
   AssertSizesCompatible(i_img, o_img, "Erode iter images have not compatible sizes");
   AssertAsTypesCompatible(i_img, o_img, "Erode iter images must have compatible types");
   AssertImagesAreDifferent(i_img, o_img, "Erode iter images input ouput images must be different");
+  AssertLayoutsCompatible(i_img, o_img, "Erode iter images must be both row major or tiled alike");
   POUTRE_CHECK(iter >= 0, "Erode iter must be >= 0");
 
   if (iter == 0) {
@@ -244,6 +330,14 @@ void Erode(const IInterface &i_img, se::Common_NL_SE nl_static, const int iter,
     return;
   }
 
+  // packed images stay on the word shifts, tiled ones (both images, checked above) on their tiles, line passes are
+  // for row major gray levels
+  if (nl_static == se::Common_NL_SE::SESquare2D && iter >= square_line_decomposition_min_iter
+      && i_img.GetPType() != PType::PType_BinPack && i_img.GetTileEdge() == 0) {
+    ErodeRect(i_img, iter, iter, o_img);
+    return;
+  }
+
   // Temporary image starts as a copy of the input image
   std::unique_ptr<IInterface> tmpImg(Clone(i_img));// NOLINT
   IInterface *tmpImg1 = tmpImg.get();
@@ -271,6 +365,7 @@ void Dilate(const IInterface &i_img, se::Common_NL_SE nl_static, const int iter,
   AssertSizesCompatible(i_img, o_img, "Dilate iter images have not compatible sizes");
   AssertAsTypesCompatible(i_img, o_img, "Dilate iter images must have compatible types");
   AssertImagesAreDifferent(i_img, o_img, "Dilate iter images input ouput images must be different");
+  AssertLayoutsCompatible(i_img, o_img, "Dilate iter images must be both row major or tiled alike");
   POUTRE_CHECK(iter >= 0, "Dilate iter must be >= 0");
 
   if (iter == 0) {
@@ -283,6 +378,14 @@ void Dilate(const IInterface &i_img, se::Common_NL_SE nl_static, const int iter,
     return;
   }
 
+  // packed images stay on the word shifts, tiled ones (both images, checked above) on their tiles, line passes are
+  // for row major gray levels
+  if (nl_static == se::Common_NL_SE::SESquare2D && iter >= square_line_decomposition_min_iter
+      && i_img.GetPType() != PType::PType_BinPack && i_img.GetTileEdge() == 0) {
+    DilateRect(i_img, iter, iter, o_img);
+    return;
+  }
+
   // Temporary image starts as a copy of the input image
   std::unique_ptr<IInterface> tmpImg(Clone(i_img));// NOLINT
   IInterface *tmpImg1 = tmpImg.get();
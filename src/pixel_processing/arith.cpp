@@ -15,6 +15,7 @@
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
 #include <poutre/base/image_interface.hpp>
+#include <poutre/base/mapped_file.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
@@ -132,6 +133,10 @@ void ArithSaturatedAddImage(const IInterface &i_img1, const IInterface &i_img2,
 
   POUTRE_CHECK(i_img1.GetCType() == CompoundType::CompoundType_Scalar, "ArithSaturatedAddImage must be scalar");
 
+  const ScopedAccessAdvice advice_i_img1(i_img1, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_img2(i_img2, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img1.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("ArithSaturatedAddImage Unsupported number of dims:0");
@@ -144,6 +149,12 @@ void ArithSaturatedAddImage(const IInterface &i_img1, const IInterface &i_img2,
     case PType::PType_GrayUINT8: {
       ArithSaturatedAddImageDispatch<2, PType::PType_GrayUINT8>(i_img1, i_img2, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSaturatedAddImageDispatch<2, PType::PType_GrayUINT16>(i_img1, i_img2, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSaturatedAddImageDispatch<2, PType::PType_GrayINT16>(i_img1, i_img2, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSaturatedAddImageDispatch<2, PType::PType_GrayINT32>(i_img1, i_img2, o_img);
     } break;
@@ -166,6 +177,12 @@ void ArithSaturatedAddImage(const IInterface &i_img1, const IInterface &i_img2,
     case PType::PType_GrayUINT8: {
       ArithSaturatedAddImageDispatch<3, PType::PType_GrayUINT8>(i_img1, i_img2, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSaturatedAddImageDispatch<3, PType::PType_GrayUINT16>(i_img1, i_img2, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSaturatedAddImageDispatch<3, PType::PType_GrayINT16>(i_img1, i_img2, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSaturatedAddImageDispatch<3, PType::PType_GrayINT32>(i_img1, i_img2, o_img);
     } break;
@@ -202,6 +219,10 @@ void ArithSaturatedSubImage(const IInterface &i_img1, const IInterface &i_img2,
 
   POUTRE_CHECK(i_img1.GetCType() == CompoundType::CompoundType_Scalar, "ArithSaturatedSubImage must be scalar");
 
+  const ScopedAccessAdvice advice_i_img1(i_img1, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_img2(i_img2, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img1.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("ArithSaturatedSubImage Unsupported number of dims:0");
@@ -214,6 +235,12 @@ void ArithSaturatedSubImage(const IInterface &i_img1, const IInterface &i_img2,
     case PType::PType_GrayUINT8: {
       ArithSaturatedSubImageDispatch<2, PType::PType_GrayUINT8>(i_img1, i_img2, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSaturatedSubImageDispatch<2, PType::PType_GrayUINT16>(i_img1, i_img2, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSaturatedSubImageDispatch<2, PType::PType_GrayINT16>(i_img1, i_img2, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSaturatedSubImageDispatch<2, PType::PType_GrayINT32>(i_img1, i_img2, o_img);
     } break;
@@ -236,6 +263,12 @@ void ArithSaturatedSubImage(const IInterface &i_img1, const IInterface &i_img2,
     case PType::PType_GrayUINT8: {
       ArithSaturatedSubImageDispatch<3, PType::PType_GrayUINT8>(i_img1, i_img2, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSaturatedSubImageDispatch<3, PType::PType_GrayUINT16>(i_img1, i_img2, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSaturatedSubImageDispatch<3, PType::PType_GrayINT16>(i_img1, i_img2, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSaturatedSubImageDispatch<3, PType::PType_GrayINT32>(i_img1, i_img2, o_img);
     } break;
@@ -271,6 +304,10 @@ void ArithSupImage(const IInterface &i_img1, const IInterface &i_img2, IInterfac
 
   POUTRE_CHECK(i_img1.GetCType() == CompoundType::CompoundType_Scalar, "ArithSupImage must be scalar");
 
+  const ScopedAccessAdvice advice_i_img1(i_img1, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_img2(i_img2, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img1.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("ArithSupImage Unsupported number of dims:0");
@@ -283,6 +320,12 @@ void ArithSupImage(const IInterface &i_img1, const IInterface &i_img2, IInterfac
     case PType::PType_GrayUINT8: {
       ArithSupImageDispatch<2, PType::PType_GrayUINT8>(i_img1, i_img2, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSupImageDispatch<2, PType::PType_GrayUINT16>(i_img1, i_img2, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSupImageDispatch<2, PType::PType_GrayINT16>(i_img1, i_img2, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSupImageDispatch<2, PType::PType_GrayINT32>(i_img1, i_img2, o_img);
     } break;
@@ -305,6 +348,12 @@ void ArithSupImage(const IInterface &i_img1, const IInterface &i_img2, IInterfac
     case PType::PType_GrayUINT8: {
       ArithSupImageDispatch<3, PType::PType_GrayUINT8>(i_img1, i_img2, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSupImageDispatch<3, PType::PType_GrayUINT16>(i_img1, i_img2, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSupImageDispatch<3, PType::PType_GrayINT16>(i_img1, i_img2, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSupImageDispatch<3, PType::PType_GrayINT32>(i_img1, i_img2, o_img);
     } break;
@@ -341,6 +390,10 @@ void ArithInfImage(const IInterface &i_img1, const IInterface &i_img2, IInterfac
 
   POUTRE_CHECK(i_img1.GetCType() == CompoundType::CompoundType_Scalar, "ArithInfImage must be scalar");
 
+  const ScopedAccessAdvice advice_i_img1(i_img1, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_img2(i_img2, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img1.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("ArithInfImage Unsupported number of dims:0");
@@ -353,6 +406,12 @@ void ArithInfImage(const IInterface &i_img1, const IInterface &i_img2, IInterfac
     case PType::PType_GrayUINT8: {
       ArithInfImageDispatch<2, PType::PType_GrayUINT8>(i_img1, i_img2, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithInfImageDispatch<2, PType::PType_GrayUINT16>(i_img1, i_img2, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithInfImageDispatch<2, PType::PType_GrayINT16>(i_img1, i_img2, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithInfImageDispatch<2, PType::PType_GrayINT32>(i_img1, i_img2, o_img);
     } break;
@@ -375,6 +434,12 @@ void ArithInfImage(const IInterface &i_img1, const IInterface &i_img2, IInterfac
     case PType::PType_GrayUINT8: {
       ArithInfImageDispatch<3, PType::PType_GrayUINT8>(i_img1, i_img2, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithInfImageDispatch<3, PType::PType_GrayUINT16>(i_img1, i_img2, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithInfImageDispatch<3, PType::PType_GrayINT16>(i_img1, i_img2, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithInfImageDispatch<3, PType::PType_GrayINT32>(i_img1, i_img2, o_img);
     } break;
@@ -408,6 +473,9 @@ void ArithSaturatedAddConstant(const IInterface &i_img, const ScalarTypeVariant
   AssertAsTypesCompatible(i_img, o_img, "ArithSaturatedAddConstant images must have compatible types");
   POUTRE_CHECK(i_img.GetCType() == CompoundType::CompoundType_Scalar, "ArithSaturatedAddConstant must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("ArithSaturatedAddConstant Unsupported number of dims:0");
@@ -420,6 +488,12 @@ void ArithSaturatedAddConstant(const IInterface &i_img, const ScalarTypeVariant
     case PType::PType_GrayUINT8: {
       ArithSaturatedAddConstantDispatch<2, PType::PType_GrayUINT8>(i_img, pvalue, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSaturatedAddConstantDispatch<2, PType::PType_GrayUINT16>(i_img, pvalue, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSaturatedAddConstantDispatch<2, PType::PType_GrayINT16>(i_img, pvalue, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSaturatedAddConstantDispatch<2, PType::PType_GrayINT32>(i_img, pvalue, o_img);
     } break;
@@ -442,6 +516,12 @@ void ArithSaturatedAddConstant(const IInterface &i_img, const ScalarTypeVariant
     case PType::PType_GrayUINT8: {
       ArithSaturatedAddConstantDispatch<3, PType::PType_GrayUINT8>(i_img, pvalue, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSaturatedAddConstantDispatch<3, PType::PType_GrayUINT16>(i_img, pvalue, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSaturatedAddConstantDispatch<3, PType::PType_GrayINT16>(i_img, pvalue, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSaturatedAddConstantDispatch<3, PType::PType_GrayINT32>(i_img, pvalue, o_img);
     } break;
@@ -475,6 +555,9 @@ void ArithSaturatedSubConstant(const IInterface &i_img, const ScalarTypeVariant
   AssertAsTypesCompatible(i_img, o_img, "ArithSaturatedSubConstant images must have compatible types");
   POUTRE_CHECK(i_img.GetCType() == CompoundType::CompoundType_Scalar, "ArithSaturatedSubConstant must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("ArithSaturatedSubConstant Unsupported number of dims:0");
@@ -487,6 +570,12 @@ void ArithSaturatedSubConstant(const IInterface &i_img, const ScalarTypeVariant
     case PType::PType_GrayUINT8: {
       ArithSaturatedSubConstantDispatch<2, PType::PType_GrayUINT8>(i_img, pvalue, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSaturatedSubConstantDispatch<2, PType::PType_GrayUINT16>(i_img, pvalue, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSaturatedSubConstantDispatch<2, PType::PType_GrayINT16>(i_img, pvalue, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSaturatedSubConstantDispatch<2, PType::PType_GrayINT32>(i_img, pvalue, o_img);
     } break;
@@ -509,6 +598,12 @@ void ArithSaturatedSubConstant(const IInterface &i_img, const ScalarTypeVariant
     case PType::PType_GrayUINT8: {
       ArithSaturatedSubConstantDispatch<3, PType::PType_GrayUINT8>(i_img, pvalue, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithSaturatedSubConstantDispatch<3, PType::PType_GrayUINT16>(i_img, pvalue, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithSaturatedSubConstantDispatch<3, PType::PType_GrayINT16>(i_img, pvalue, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithSaturatedSubConstantDispatch<3, PType::PType_GrayINT32>(i_img, pvalue, o_img);
     } break;
@@ -542,6 +637,9 @@ void ArithInvertImage(const IInterface &i_img, IInterface &o_img)
   AssertAsTypesCompatible(i_img, o_img, "ArithInvertImage images must have compatible types");
   POUTRE_CHECK(i_img.GetCType() == CompoundType::CompoundType_Scalar, "ArithInvertImage must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("ArithInvertImage Unsupported number of dims:0");
@@ -554,6 +652,12 @@ void ArithInvertImage(const IInterface &i_img, IInterface &o_img)
     case PType::PType_GrayUINT8: {
       ArithInvertImageDispatch<2, PType::PType_GrayUINT8>(i_img, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithInvertImageDispatch<2, PType::PType_GrayUINT16>(i_img, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithInvertImageDispatch<2, PType::PType_GrayINT16>(i_img, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithInvertImageDispatch<2, PType::PType_GrayINT32>(i_img, o_img);
     } break;
@@ -576,6 +680,12 @@ void ArithInvertImage(const IInterface &i_img, IInterface &o_img)
     case PType::PType_GrayUINT8: {
       ArithInvertImageDispatch<3, PType::PType_GrayUINT8>(i_img, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ArithInvertImageDispatch<3, PType::PType_GrayUINT16>(i_img, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ArithInvertImageDispatch<3, PType::PType_GrayINT16>(i_img, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ArithInvertImageDispatch<3, PType::PType_GrayINT32>(i_img, o_img);
     } break;
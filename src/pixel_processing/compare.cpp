@@ -15,6 +15,7 @@
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
 #include <poutre/base/image_interface.hpp>
+#include <poutre/base/mapped_file.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
@@ -78,6 +79,14 @@ void CompareImage_sss_Pin_Dispatch(const IInterface &i_img,
     CompareImage_sss_Dispatch<NumDims, Pin, PType::PType_GrayUINT8>(
       i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
   } break;
+  case PType::PType_GrayUINT16: {
+    CompareImage_sss_Dispatch<NumDims, Pin, PType::PType_GrayUINT16>(
+      i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CompareImage_sss_Dispatch<NumDims, Pin, PType::PType_GrayINT16>(
+      i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
+  } break;
   case PType::PType_GrayINT32: {
     CompareImage_sss_Dispatch<NumDims, Pin, PType::PType_GrayINT32>(
       i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
@@ -143,6 +152,14 @@ void CompareImage_iii_Pin_Dispatch(const IInterface &i_img,
     CompareImage_iii_Dispatch<NumDims, Pin, PType::PType_GrayUINT8>(
       i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
   } break;
+  case PType::PType_GrayUINT16: {
+    CompareImage_iii_Dispatch<NumDims, Pin, PType::PType_GrayUINT16>(
+      i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CompareImage_iii_Dispatch<NumDims, Pin, PType::PType_GrayINT16>(
+      i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
+  } break;
   case PType::PType_GrayINT32: {
     CompareImage_iii_Dispatch<NumDims, Pin, PType::PType_GrayINT32>(
       i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
@@ -214,6 +231,14 @@ void CompareImage_sii_Pin_Dispatch(const IInterface &i_img,
     CompareImage_sii_Dispatch<NumDims, Pin, PType::PType_GrayUINT8>(
       i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
   } break;
+  case PType::PType_GrayUINT16: {
+    CompareImage_sii_Dispatch<NumDims, Pin, PType::PType_GrayUINT16>(
+      i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CompareImage_sii_Dispatch<NumDims, Pin, PType::PType_GrayINT16>(
+      i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
+  } break;
   case PType::PType_GrayINT32: {
     CompareImage_sii_Dispatch<NumDims, Pin, PType::PType_GrayINT32>(
       i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
@@ -287,6 +312,14 @@ void CompareImage_sis_Pin_Dispatch(const IInterface &i_img,
     CompareImage_sis_Dispatch<NumDims, Pin, PType::PType_GrayUINT8>(
       i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
   } break;
+  case PType::PType_GrayUINT16: {
+    CompareImage_sis_Dispatch<NumDims, Pin, PType::PType_GrayUINT16>(
+      i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CompareImage_sis_Dispatch<NumDims, Pin, PType::PType_GrayINT16>(
+      i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
+  } break;
   case PType::PType_GrayINT32: {
     CompareImage_sis_Dispatch<NumDims, Pin, PType::PType_GrayINT32>(
       i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
@@ -355,6 +388,14 @@ void CompareImage_isi_Pin_Dispatch(const IInterface &i_img,
     CompareImage_isi_Dispatch<NumDims, Pin, PType::PType_GrayUINT8>(
       i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
   } break;
+  case PType::PType_GrayUINT16: {
+    CompareImage_isi_Dispatch<NumDims, Pin, PType::PType_GrayUINT16>(
+      i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CompareImage_isi_Dispatch<NumDims, Pin, PType::PType_GrayINT16>(
+      i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
+  } break;
   case PType::PType_GrayINT32: {
     CompareImage_isi_Dispatch<NumDims, Pin, PType::PType_GrayINT32>(
       i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
@@ -429,6 +470,14 @@ void CompareImage_iss_Pin_Dispatch(const IInterface &i_img,
     CompareImage_iss_Dispatch<NumDims, Pin, PType::PType_GrayUINT8>(
       i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
   } break;
+  case PType::PType_GrayUINT16: {
+    CompareImage_iss_Dispatch<NumDims, Pin, PType::PType_GrayUINT16>(
+      i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CompareImage_iss_Dispatch<NumDims, Pin, PType::PType_GrayINT16>(
+      i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
+  } break;
   case PType::PType_GrayINT32: {
     CompareImage_iss_Dispatch<NumDims, Pin, PType::PType_GrayINT32>(
       i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
@@ -504,6 +553,14 @@ void CompareImage_ssi_Pin_Dispatch(const IInterface &i_img,
     CompareImage_ssi_Dispatch<NumDims, Pin, PType::PType_GrayUINT8>(
       i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
   } break;
+  case PType::PType_GrayUINT16: {
+    CompareImage_ssi_Dispatch<NumDims, Pin, PType::PType_GrayUINT16>(
+      i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CompareImage_ssi_Dispatch<NumDims, Pin, PType::PType_GrayINT16>(
+      i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
+  } break;
   case PType::PType_GrayINT32: {
     CompareImage_ssi_Dispatch<NumDims, Pin, PType::PType_GrayINT32>(
       i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
@@ -572,6 +629,14 @@ void CompareImage_iis_Pin_Dispatch(const IInterface &i_img,
     CompareImage_iis_Dispatch<NumDims, Pin, PType::PType_GrayUINT8>(
       i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
   } break;
+  case PType::PType_GrayUINT16: {
+    CompareImage_iis_Dispatch<NumDims, Pin, PType::PType_GrayUINT16>(
+      i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CompareImage_iis_Dispatch<NumDims, Pin, PType::PType_GrayINT16>(
+      i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
+  } break;
   case PType::PType_GrayINT32: {
     CompareImage_iis_Dispatch<NumDims, Pin, PType::PType_GrayINT32>(
       i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
@@ -610,6 +675,9 @@ void CompareImage(const IInterface &i_img,
   POUTRE_CHECK(i_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
   POUTRE_CHECK(o_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("CompareImage Unsupported number of dims:0");
@@ -622,6 +690,13 @@ void CompareImage(const IInterface &i_img,
     case PType::PType_GrayUINT8: {
       CompareImage_sss_Pin_Dispatch<2, PType::PType_GrayUINT8>(i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_sss_Pin_Dispatch<2, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_sss_Pin_Dispatch<2, PType::PType_GrayINT16>(i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_sss_Pin_Dispatch<2, PType::PType_GrayINT32>(i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
     } break;
@@ -644,6 +719,13 @@ void CompareImage(const IInterface &i_img,
     case PType::PType_GrayUINT8: {
       CompareImage_sss_Pin_Dispatch<3, PType::PType_GrayUINT8>(i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_sss_Pin_Dispatch<3, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_sss_Pin_Dispatch<3, PType::PType_GrayINT16>(i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_sss_Pin_Dispatch<3, PType::PType_GrayINT32>(i_img, compOpType, i_comp, i_valtrue, i_valfalse, o_img);
     } break;
@@ -690,6 +772,12 @@ void CompareImage(const IInterface &i_img,
   POUTRE_CHECK(i_imgfalse.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
   POUTRE_CHECK(o_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgcomp(i_imgcomp, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgtrue(i_imgtrue, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgfalse(i_imgfalse, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("CompareImage Unsupported number of dims:0");
@@ -703,6 +791,14 @@ void CompareImage(const IInterface &i_img,
       CompareImage_iii_Pin_Dispatch<2, PType::PType_GrayUINT8>(
         i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_iii_Pin_Dispatch<2, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_iii_Pin_Dispatch<2, PType::PType_GrayINT16>(
+        i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_iii_Pin_Dispatch<2, PType::PType_GrayINT32>(
         i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
@@ -728,6 +824,14 @@ void CompareImage(const IInterface &i_img,
       CompareImage_iii_Pin_Dispatch<3, PType::PType_GrayUINT8>(
         i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_iii_Pin_Dispatch<3, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_iii_Pin_Dispatch<3, PType::PType_GrayINT16>(
+        i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_iii_Pin_Dispatch<3, PType::PType_GrayINT32>(
         i_img, compOpType, i_imgcomp, i_imgtrue, i_imgfalse, o_img);
@@ -774,6 +878,11 @@ void CompareImage(const IInterface &i_img,
   POUTRE_CHECK(i_imgfalse.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
   POUTRE_CHECK(o_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgtrue(i_imgtrue, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgfalse(i_imgfalse, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("CompareImage Unsupported number of dims:0");
@@ -786,6 +895,13 @@ void CompareImage(const IInterface &i_img,
     case PType::PType_GrayUINT8: {
       CompareImage_sii_Pin_Dispatch<2, PType::PType_GrayUINT8>(i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_sii_Pin_Dispatch<2, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_sii_Pin_Dispatch<2, PType::PType_GrayINT16>(i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_sii_Pin_Dispatch<2, PType::PType_GrayINT32>(i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
     } break;
@@ -808,6 +924,13 @@ void CompareImage(const IInterface &i_img,
     case PType::PType_GrayUINT8: {
       CompareImage_sii_Pin_Dispatch<3, PType::PType_GrayUINT8>(i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_sii_Pin_Dispatch<3, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_sii_Pin_Dispatch<3, PType::PType_GrayINT16>(i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_sii_Pin_Dispatch<3, PType::PType_GrayINT32>(i_img, compOpType, i_comp, i_imgtrue, i_imgfalse, o_img);
     } break;
@@ -850,6 +973,10 @@ void CompareImage(const IInterface &i_img,
   POUTRE_CHECK(i_imgtrue.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
   POUTRE_CHECK(o_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgtrue(i_imgtrue, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("CompareImage Unsupported number of dims:0");
@@ -862,6 +989,13 @@ void CompareImage(const IInterface &i_img,
     case PType::PType_GrayUINT8: {
       CompareImage_sis_Pin_Dispatch<2, PType::PType_GrayUINT8>(i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_sis_Pin_Dispatch<2, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_sis_Pin_Dispatch<2, PType::PType_GrayINT16>(i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_sis_Pin_Dispatch<2, PType::PType_GrayINT32>(i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
     } break;
@@ -884,6 +1018,13 @@ void CompareImage(const IInterface &i_img,
     case PType::PType_GrayUINT8: {
       CompareImage_sis_Pin_Dispatch<3, PType::PType_GrayUINT8>(i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_sis_Pin_Dispatch<3, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_sis_Pin_Dispatch<3, PType::PType_GrayINT16>(i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_sis_Pin_Dispatch<3, PType::PType_GrayINT32>(i_img, compOpType, i_comp, i_imgtrue, i_valfalse, o_img);
     } break;
@@ -926,6 +1067,11 @@ void CompareImage(const IInterface &i_img,
   POUTRE_CHECK(i_imgfalse.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
   POUTRE_CHECK(o_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgcomp(i_imgcomp, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgfalse(i_imgfalse, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("CompareImage Unsupported number of dims:0");
@@ -939,6 +1085,14 @@ void CompareImage(const IInterface &i_img,
       CompareImage_isi_Pin_Dispatch<2, PType::PType_GrayUINT8>(
         i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_isi_Pin_Dispatch<2, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_isi_Pin_Dispatch<2, PType::PType_GrayINT16>(
+        i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_isi_Pin_Dispatch<2, PType::PType_GrayINT32>(
         i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
@@ -964,6 +1118,14 @@ void CompareImage(const IInterface &i_img,
       CompareImage_isi_Pin_Dispatch<3, PType::PType_GrayUINT8>(
         i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_isi_Pin_Dispatch<3, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_isi_Pin_Dispatch<3, PType::PType_GrayINT16>(
+        i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_isi_Pin_Dispatch<3, PType::PType_GrayINT32>(
         i_img, compOpType, i_imgcomp, i_valtrue, i_imgfalse, o_img);
@@ -1007,6 +1169,10 @@ void CompareImage(const IInterface &i_img,
   POUTRE_CHECK(i_imgcomp.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
   POUTRE_CHECK(o_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgcomp(i_imgcomp, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("CompareImage Unsupported number of dims:0");
@@ -1020,6 +1186,14 @@ void CompareImage(const IInterface &i_img,
       CompareImage_iss_Pin_Dispatch<2, PType::PType_GrayUINT8>(
         i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_iss_Pin_Dispatch<2, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_iss_Pin_Dispatch<2, PType::PType_GrayINT16>(
+        i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_iss_Pin_Dispatch<2, PType::PType_GrayINT32>(
         i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
@@ -1045,6 +1219,14 @@ void CompareImage(const IInterface &i_img,
       CompareImage_iss_Pin_Dispatch<3, PType::PType_GrayUINT8>(
         i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_iss_Pin_Dispatch<3, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_iss_Pin_Dispatch<3, PType::PType_GrayINT16>(
+        i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_iss_Pin_Dispatch<3, PType::PType_GrayINT32>(
         i_img, compOpType, i_imgcomp, i_valtrue, i_valfalse, o_img);
@@ -1089,6 +1271,10 @@ void CompareImage(const IInterface &i_img,
   POUTRE_CHECK(i_imgfalse.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
   POUTRE_CHECK(o_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgfalse(i_imgfalse, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("CompareImage Unsupported number of dims:0");
@@ -1101,6 +1287,13 @@ void CompareImage(const IInterface &i_img,
     case PType::PType_GrayUINT8: {
       CompareImage_ssi_Pin_Dispatch<2, PType::PType_GrayUINT8>(i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_ssi_Pin_Dispatch<2, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_ssi_Pin_Dispatch<2, PType::PType_GrayINT16>(i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_ssi_Pin_Dispatch<2, PType::PType_GrayINT32>(i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
     } break;
@@ -1123,6 +1316,13 @@ void CompareImage(const IInterface &i_img,
     case PType::PType_GrayUINT8: {
       CompareImage_ssi_Pin_Dispatch<3, PType::PType_GrayUINT8>(i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_ssi_Pin_Dispatch<3, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_ssi_Pin_Dispatch<3, PType::PType_GrayINT16>(i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_ssi_Pin_Dispatch<3, PType::PType_GrayINT32>(i_img, compOpType, i_comp, i_valtrue, i_imgfalse, o_img);
     } break;
@@ -1165,6 +1365,11 @@ void CompareImage(const IInterface &i_img,
   POUTRE_CHECK(i_imgtrue.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
   POUTRE_CHECK(o_img.GetCType() == CompoundType::CompoundType_Scalar, "CompareImage images must be scalar");
 
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgcomp(i_imgcomp, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_i_imgtrue(i_imgtrue, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
   switch (i_img.GetRank()) {
   case 0: {
     POUTRE_RUNTIME_ERROR("CompareImage Unsupported number of dims:0");
@@ -1178,6 +1383,14 @@ void CompareImage(const IInterface &i_img,
       CompareImage_iis_Pin_Dispatch<2, PType::PType_GrayUINT8>(
         i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_iis_Pin_Dispatch<2, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_iis_Pin_Dispatch<2, PType::PType_GrayINT16>(
+        i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_iis_Pin_Dispatch<2, PType::PType_GrayINT32>(
         i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
@@ -1203,6 +1416,14 @@ void CompareImage(const IInterface &i_img,
       CompareImage_iis_Pin_Dispatch<3, PType::PType_GrayUINT8>(
         i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      CompareImage_iis_Pin_Dispatch<3, PType::PType_GrayUINT16>(
+        i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      CompareImage_iis_Pin_Dispatch<3, PType::PType_GrayINT16>(
+        i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       CompareImage_iis_Pin_Dispatch<3, PType::PType_GrayINT32>(
         i_img, compOpType, i_imgcomp, i_imgtrue, i_valfalse, o_img);
@@ -14,7 +14,9 @@
 #include <memory>
 #include <poutre/base/config.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/data_structures/image_tiled_t.hpp>
 #include <poutre/base/image_interface.hpp>
+#include <poutre/base/mapped_file.hpp>
 #include <poutre/base/trace.hpp>
 #include <poutre/base/types.hpp>
 #include <poutre/base/types_traits.hpp>
@@ -25,35 +27,39 @@ namespace poutre {
 std::unique_ptr<IInterface> Clone(const IInterface &i_img1)
 {
   POUTRE_ENTERING("Clone");
-  auto o_img = CloneGeometry(i_img1);
+  auto o_img = CloneGeometry(i_img1, AllocationMode::Uninitialized);
   CopyInto(i_img1, *o_img);
   return o_img;
 }
 
-std::unique_ptr<IInterface> CloneGeometry(const IInterface &i_img1)
+std::unique_ptr<IInterface> CloneGeometry(const IInterface &i_img1, AllocationMode mode)
 {
   POUTRE_ENTERING("CloneGeometry");
-  return Create(i_img1.GetShape(), i_img1.GetCType(), i_img1.GetPType());
+  if (i_img1.GetTileEdge() != 0) {
+    return CreateTiled(i_img1.GetShape(), i_img1.GetCType(), i_img1.GetPType(), i_img1.GetTileEdge(), mode);
+  }
+  return Create(i_img1.GetShape(), i_img1.GetCType(), i_img1.GetPType(), mode);
 }
 
 std::unique_ptr<IInterface> Convert(const IInterface &i_img1, CompoundType ctype, PType ptype)
 {
   POUTRE_ENTERING("Convert");
-  auto o_img = ConvertGeometry(i_img1, ctype, ptype);
+  auto o_img = ConvertGeometry(i_img1, ctype, ptype, AllocationMode::Uninitialized);
   ConvertInto(i_img1, *o_img);
   return o_img;
 }
 
-std::unique_ptr<IInterface> ConvertGeometry(const IInterface &i_img1, CompoundType ctype, PType ptype)
+std::unique_ptr<IInterface>
+  ConvertGeometry(const IInterface &i_img1, CompoundType ctype, PType ptype, AllocationMode mode)
 {
   POUTRE_ENTERING("ConvertGeometry");
-  return Create(i_img1.GetShape(), ctype, ptype);
+  return Create(i_img1.GetShape(), ctype, ptype, mode);
 }
 
-std::unique_ptr<IInterface> ConvertGeometry(const IInterface &i_img1, PType ptype)
+std::unique_ptr<IInterface> ConvertGeometry(const IInterface &i_img1, PType ptype, AllocationMode mode)
 {
   POUTRE_ENTERING("ConvertGeometry");
-  return ConvertGeometry(i_img1, i_img1.GetCType(), ptype);
+  return ConvertGeometry(i_img1, i_img1.GetCType(), ptype, mode);
 }
 
 void CopyInto(const IInterface &i_img, IInterface &o_img)
@@ -73,6 +79,12 @@ void ConvertIntoDispatchScalarP(const IInterface &i_img1, IInterface &o_img2)
   if (!img1_t) { POUTRE_RUNTIME_ERROR("ConvertIntoDispatchP i_img1 downcast fail"); }
   switch (o_img2.GetPType())// allow type promotion
   {
+  case PType::PType_BinPack: {
+    using ImgType2 = details::image_t<pBinPack, NumDims>;
+    auto *img2_t = dynamic_cast<ImgType2 *>(&o_img2);
+    if (!img2_t) { POUTRE_RUNTIME_ERROR("ConvertIntoDispatchP o_img2 downcast fail"); }
+    details::t_PackBinary(*img1_t, *img2_t);
+  } break;
   case PType::PType_GrayUINT8: {
     using ImgType2 =
       details::image_t<typename enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_GrayUINT8>::type, NumDims>;
@@ -80,6 +92,21 @@ void ConvertIntoDispatchScalarP(const IInterface &i_img1, IInterface &o_img2)
     if (!img2_t) { POUTRE_RUNTIME_ERROR("ConvertIntoDispatchP o_img2 downcast fail"); }
     details::t_Copy(*img1_t, *img2_t);
   } break;
+  case PType::PType_GrayUINT16: {
+    using ImgType2 =
+      details::image_t<typename enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_GrayUINT16>::type,
+        NumDims>;
+    auto *img2_t = dynamic_cast<ImgType2 *>(&o_img2);
+    if (!img2_t) { POUTRE_RUNTIME_ERROR("ConvertIntoDispatchP o_img2 downcast fail"); }
+    details::t_Copy(*img1_t, *img2_t);
+  } break;
+  case PType::PType_GrayINT16: {
+    using ImgType2 =
+      details::image_t<typename enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_GrayINT16>::type, NumDims>;
+    auto *img2_t = dynamic_cast<ImgType2 *>(&o_img2);
+    if (!img2_t) { POUTRE_RUNTIME_ERROR("ConvertIntoDispatchP o_img2 downcast fail"); }
+    details::t_Copy(*img1_t, *img2_t);
+  } break;
   case PType::PType_GrayINT32: {
     using ImgType2 =
       details::image_t<typename enum_to_type<CompoundType::CompoundType_Scalar, PType::PType_GrayINT32>::type, NumDims>;
@@ -114,6 +141,54 @@ void ConvertIntoDispatchScalarP(const IInterface &i_img1, IInterface &o_img2)
   }
 }
 
+template<typename T, std::ptrdiff_t NumDims>
+void UnpackBinaryInto(const details::image_t<pBinPack, NumDims> &i_img1, IInterface &o_img2)
+{
+  auto *img2_t = dynamic_cast<details::image_t<T, NumDims> *>(&o_img2);
+  if (!img2_t) { POUTRE_RUNTIME_ERROR("ConvertIntoDispatchBinPack o_img2 downcast fail"); }
+  details::t_UnpackBinary(i_img1, *img2_t);
+}
+
+//! unpack to {0,1} scalar images
+template<std::ptrdiff_t NumDims> void ConvertIntoDispatchBinPack(const IInterface &i_img1, IInterface &o_img2)
+{
+  using ImgType1 = details::image_t<pBinPack, NumDims>;
+  const auto *img1_t = dynamic_cast<const ImgType1 *>(&i_img1);
+  if (!img1_t) { POUTRE_RUNTIME_ERROR("ConvertIntoDispatchBinPack i_img1 downcast fail"); }
+  POUTRE_CHECK(o_img2.GetCType() == CompoundType::CompoundType_Scalar, "ConvertIntoDispatchBinPack must be scalar");
+  switch (o_img2.GetPType()) {
+  case PType::PType_BinPack: {
+    auto *img2_t = dynamic_cast<ImgType1 *>(&o_img2);
+    if (!img2_t) { POUTRE_RUNTIME_ERROR("ConvertIntoDispatchBinPack o_img2 downcast fail"); }
+    details::t_Copy(*img1_t, *img2_t);
+  } break;
+  case PType::PType_GrayUINT8: {
+    UnpackBinaryInto<pUINT8>(*img1_t, o_img2);
+  } break;
+  case PType::PType_GrayUINT16: {
+    UnpackBinaryInto<pUINT16>(*img1_t, o_img2);
+  } break;
+  case PType::PType_GrayINT16: {
+    UnpackBinaryInto<pINT16>(*img1_t, o_img2);
+  } break;
+  case PType::PType_GrayINT32: {
+    UnpackBinaryInto<pINT32>(*img1_t, o_img2);
+  } break;
+  case PType::PType_GrayINT64: {
+    UnpackBinaryInto<pINT64>(*img1_t, o_img2);
+  } break;
+  case PType::PType_F32: {
+    UnpackBinaryInto<pFLOAT>(*img1_t, o_img2);
+  } break;
+  case PType::PType_D64: {
+    UnpackBinaryInto<pDOUBLE>(*img1_t, o_img2);
+  } break;
+  default: {
+    POUTRE_RUNTIME_ERROR("ConvertIntoDispatchBinPack o_img2 PType not supported");
+  }
+  }
+}
+
 template<std::ptrdiff_t NumDims, PType Pin>
 void ConvertIntoDispatch3PLanesP(const IInterface &i_img1, IInterface &o_img2)
 {
@@ -224,9 +299,18 @@ template<std::ptrdiff_t numDims> void ConvertIntoDispatch(const IInterface &i_im
   switch (i_img1.GetCType()) {
   case CompoundType::CompoundType_Scalar: {
     switch (i_img1.GetPType()) {
+    case PType::PType_BinPack: {
+      ConvertIntoDispatchBinPack<numDims>(i_img1, o_img2);
+    } break;
     case PType::PType_GrayUINT8: {
       ConvertIntoDispatchScalarP<numDims, PType::PType_GrayUINT8>(i_img1, o_img2);
     } break;
+    case PType::PType_GrayUINT16: {
+      ConvertIntoDispatchScalarP<numDims, PType::PType_GrayUINT16>(i_img1, o_img2);
+    } break;
+    case PType::PType_GrayINT16: {
+      ConvertIntoDispatchScalarP<numDims, PType::PType_GrayINT16>(i_img1, o_img2);
+    } break;
     case PType::PType_GrayINT32: {
       ConvertIntoDispatchScalarP<numDims, PType::PType_GrayINT32>(i_img1, o_img2);
     } break;
@@ -298,11 +382,85 @@ template<std::ptrdiff_t numDims> void ConvertIntoDispatch(const IInterface &i_im
 }
 
 
+//! row major <-> tiled, or tiled -> tiled with the same tile edge, same pixel types
+template<std::ptrdiff_t NumDims, PType P> void CopyTiledDispatchP(const IInterface &i_img, IInterface &o_img)
+{
+  using ValueType = typename enum_to_type<CompoundType::CompoundType_Scalar, P>::type;
+  using ImgType = details::image_t<ValueType, NumDims>;
+  using TiledType = details::image_tiled_t<ValueType, NumDims>;
+  if (const auto *in_tiled = dynamic_cast<const TiledType *>(&i_img)) {
+    if (auto *out = dynamic_cast<ImgType *>(&o_img)) {
+      in_tiled->CopyTo(*out);
+      return;
+    }
+    auto *out_tiled = dynamic_cast<TiledType *>(&o_img);
+    if (!out_tiled) { POUTRE_RUNTIME_ERROR("CopyTiledDispatchP o_img downcast fail"); }
+    POUTRE_CHECK(out_tiled->tile_edge() == in_tiled->tile_edge(), "ConvertInto tiled images must have same tile edge");
+    *out_tiled = *in_tiled;
+    return;
+  }
+  const auto *in = dynamic_cast<const ImgType *>(&i_img);
+  if (!in) { POUTRE_RUNTIME_ERROR("CopyTiledDispatchP i_img downcast fail"); }
+  auto *out_tiled = dynamic_cast<TiledType *>(&o_img);
+  if (!out_tiled) { POUTRE_RUNTIME_ERROR("CopyTiledDispatchP o_img downcast fail"); }
+  out_tiled->CopyFrom(*in);
+}
+
+template<std::ptrdiff_t NumDims> void CopyTiledDispatch(const IInterface &i_img, IInterface &o_img)
+{
+  switch (i_img.GetPType()) {
+  case PType::PType_GrayUINT8: {
+    CopyTiledDispatchP<NumDims, PType::PType_GrayUINT8>(i_img, o_img);
+  } break;
+  case PType::PType_GrayUINT16: {
+    CopyTiledDispatchP<NumDims, PType::PType_GrayUINT16>(i_img, o_img);
+  } break;
+  case PType::PType_GrayINT16: {
+    CopyTiledDispatchP<NumDims, PType::PType_GrayINT16>(i_img, o_img);
+  } break;
+  case PType::PType_GrayINT32: {
+    CopyTiledDispatchP<NumDims, PType::PType_GrayINT32>(i_img, o_img);
+  } break;
+  case PType::PType_GrayINT64: {
+    CopyTiledDispatchP<NumDims, PType::PType_GrayINT64>(i_img, o_img);
+  } break;
+  case PType::PType_F32: {
+    CopyTiledDispatchP<NumDims, PType::PType_F32>(i_img, o_img);
+  } break;
+  case PType::PType_D64: {
+    CopyTiledDispatchP<NumDims, PType::PType_D64>(i_img, o_img);
+  } break;
+  default: {
+    POUTRE_RUNTIME_ERROR("CopyTiledDispatch unsupported PTYPE");
+  }
+  }
+}
+
 void ConvertInto(const IInterface &i_img, IInterface &o_img)
 {
   POUTRE_ENTERING("ConvertInto");
   AssertSizesCompatible(i_img, o_img, "ConvertInto images have not compatible sizes");
   AssertImagesAreDifferent(i_img, o_img, "ConvertInto images must be differents");
+  // row major scan, helps read ahead when the images are file backed
+  const ScopedAccessAdvice advice_i_img(i_img, AccessAdvice::Sequential);
+  const ScopedAccessAdvice advice_o_img(o_img, AccessAdvice::Sequential);
+
+  // tiled storage only changes layout, no pixel type conversion
+  if (i_img.GetTileEdge() != 0 || o_img.GetTileEdge() != 0) {
+    AssertAsTypesCompatible(i_img, o_img, "ConvertInto tiled images must have same types");
+    switch (i_img.GetRank()) {
+    case 2: {
+      CopyTiledDispatch<2>(i_img, o_img);
+    } break;
+    case 3: {
+      CopyTiledDispatch<3>(i_img, o_img);
+    } break;
+    default: {
+      POUTRE_RUNTIME_ERROR("ConvertInto tiled images unsupported number of dims");
+    }
+    }
+    return;
+  }
 
   switch (i_img.GetRank()) {
   case 0: {
@@ -318,9 +476,18 @@ void ConvertInto(const IInterface &i_img, IInterface &o_img)
     POUTRE_CHECK(i_img.GetCType() == o_img.GetCType(), "ConvertInto must have same CType");
     POUTRE_CHECK(i_img.GetCType() == CompoundType::CompoundType_Scalar, "ConvertInto must be scalar");
     switch (i_img.GetPType()) {
+    case PType::PType_BinPack: {
+      ConvertIntoDispatchBinPack<3>(i_img, o_img);
+    } break;
     case PType::PType_GrayUINT8: {
       ConvertIntoDispatchScalarP<3, PType::PType_GrayUINT8>(i_img, o_img);
     } break;
+    case PType::PType_GrayUINT16: {
+      ConvertIntoDispatchScalarP<3, PType::PType_GrayUINT16>(i_img, o_img);
+    } break;
+    case PType::PType_GrayINT16: {
+      ConvertIntoDispatchScalarP<3, PType::PType_GrayINT16>(i_img, o_img);
+    } break;
     case PType::PType_GrayINT32: {
       ConvertIntoDispatchScalarP<3, PType::PType_GrayINT32>(i_img, o_img);
     } break;
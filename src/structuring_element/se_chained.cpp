@@ -26,6 +26,17 @@ void ChainedStructuringElement::append(
   m_vect_se.push_back(std::move(strel));
 }
 
+std::size_t ChainedStructuringElement::GetChainSize() const noexcept
+{
+  return m_vect_se.size();
+}
+
+const IStructuringElement &ChainedStructuringElement::GetElement(std::size_t pos) const
+{
+  if (pos >= m_vect_se.size()) { POUTRE_RUNTIME_ERROR("GetElement position out of range"); }
+  return *m_vect_se[pos];
+}
+
 std::unique_ptr<IStructuringElement> ChainedStructuringElement::Transpose() const
 {
   std::unique_ptr<ChainedStructuringElement> output_se = std::make_unique<ChainedStructuringElement>();
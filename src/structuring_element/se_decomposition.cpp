@@ -0,0 +1,151 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <poutre/base/config.hpp>
+#include <poutre/structuring_element/se_decomposition.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace {
+using Point = std::array<ptrdiff_t, 2>;// {y,x}
+using Interval = std::pair<ptrdiff_t, ptrdiff_t>;// [first,last]
+
+//! operations per pixel of one van Herk pass
+constexpr std::size_t van_herck_cost = 3;
+//! maximum number of cached plans
+constexpr std::size_t max_cached_plans = 64;
+
+// odd length intervals covering [first,last]
+std::vector<Interval> OddCover(const Interval &interval)
+{
+  if ((interval.second - interval.first) % 2 == 0) { return { interval }; }
+  return { { interval.first, interval.second - 1 }, { interval.first + 1, interval.second } };
+}
+
+std::vector<Point> SortedPoints(const poutre::se::details::neighbor_list_t<2> &nl)
+{
+  std::vector<Point> points;
+  points.reserve(nl.size());
+  for (const auto &coord : nl) { points.push_back({ coord[0], coord[1] }); }
+  std::sort(points.begin(), points.end());
+  points.erase(std::unique(points.begin(), points.end()), points.end());
+  return points;
+}
+}// namespace
+
+namespace poutre::se {
+std::size_t DecompositionPlan2D::Cost() const noexcept
+{
+  std::size_t cost = 2;// padding and crop
+  for (const auto &group : groups) {
+    if (group.size_half_x > 0) { cost += van_herck_cost; }
+    if (group.size_half_y > 0) { cost += van_herck_cost; }
+    cost += group.shifts.size();
+  }
+  return cost;
+}
+
+DecompositionPlan2D DecomposeNeighborList(const details::neighbor_list_t<2> &nl)
+{
+  DecompositionPlan2D plan;
+  const auto points = SortedPoints(nl);
+  plan.nb_points = points.size();
+  if (points.empty()) { return plan; }
+  plan.extent_min = points.front();
+  plan.extent_max = points.front();
+  for (const auto &point : points) {
+    for (std::size_t dim = 0; dim < 2; ++dim) {
+      plan.extent_min[dim] = std::min(plan.extent_min[dim], point[dim]);
+      plan.extent_max[dim] = std::max(plan.extent_max[dim], point[dim]);
+    }
+  }
+
+  // stack identical horizontal runs of consecutive lines: run -> [first line, last line]
+  std::vector<std::pair<Interval, Interval>> rectangles;// {x run, y lines}
+  std::map<Interval, Interval> open;
+  auto close_before = [&](ptrdiff_t line) {
+    for (auto it = open.begin(); it != open.end();) {
+      if (it->second.second < line) {
+        rectangles.emplace_back(it->first, it->second);
+        it = open.erase(it);
+      } else {
+        ++it;
+      }
+    }
+  };
+  for (std::size_t i = 0; i < points.size();) {
+    const auto line = points[i][0];
+    while (i < points.size() && points[i][0] == line) {
+      Interval run{ points[i][1], points[i][1] };
+      ++i;
+      while (i < points.size() && points[i][0] == line && points[i][1] == run.second + 1) {
+        run.second = points[i][1];
+        ++i;
+      }
+      // runs not extended on the previous line with points are already closed, the ones ending before a gap of
+      // empty lines are closed here
+      auto it = open.find(run);
+      if (it != open.end() && it->second.second == line - 1) {
+        it->second.second = line;
+      } else {
+        if (it != open.end()) {
+          rectangles.emplace_back(it->first, it->second);
+          open.erase(it);
+        }
+        open.emplace(run, Interval{ line, line });
+      }
+    }
+    close_before(line);
+  }
+  close_before(plan.extent_max[0] + 1);
+
+  // centered odd rectangles grouped by size
+  std::map<std::pair<ptrdiff_t, ptrdiff_t>, std::size_t> group_index;
+  for (const auto &[xrun, ylines] : rectangles) {
+    for (const auto &xinterval : OddCover(xrun)) {
+      for (const auto &yinterval : OddCover(ylines)) {
+        const auto size_half_x = (xinterval.second - xinterval.first) / 2;
+        const auto size_half_y = (yinterval.second - yinterval.first) / 2;
+        const Point shift{ (yinterval.first + yinterval.second) / 2, (xinterval.first + xinterval.second) / 2 };
+        auto [it, inserted] = group_index.try_emplace({ size_half_x, size_half_y }, plan.groups.size());
+        if (inserted) { plan.groups.push_back(RectangleGroup{ size_half_x, size_half_y, {} }); }
+        plan.groups[it->second].shifts.push_back(shift);
+      }
+    }
+  }
+  return plan;
+}
+
+std::shared_ptr<const DecompositionPlan2D> GetDecompositionPlan(const details::neighbor_list_t<2> &nl)
+{
+  static std::mutex mutex;
+  static std::map<std::vector<Point>, std::shared_ptr<const DecompositionPlan2D>> cache;
+  auto points = SortedPoints(nl);
+  {
+    const std::scoped_lock lock(mutex);
+    const auto it = cache.find(points);
+    if (it != cache.end()) { return it->second; }
+  }
+  auto plan = std::make_shared<const DecompositionPlan2D>(DecomposeNeighborList(nl));
+  const std::scoped_lock lock(mutex);
+  if (cache.size() >= max_cached_plans) { cache.clear(); }
+  cache.emplace(std::move(points), plan);
+  return plan;
+}
+}// namespace poutre::se
@@ -0,0 +1,149 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <poutre/base/buffer_pool.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/image_interface.hpp>
+#include <poutre/base/types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+TEST_CASE("recycle same geometry", "[buffer_pool]")
+{
+  auto &pool = poutre::BufferPool::get();
+  pool.Trim();
+  pool.ResetStats();
+  const std::vector<std::size_t> shape{ 17, 33 };
+
+  const void *first = nullptr;
+  {
+    poutre::details::image_t<poutre::pINT32, 2> img(shape, poutre::AllocationMode::Pooled);
+    REQUIRE(img.IsOwner());
+    REQUIRE(reinterpret_cast<std::uintptr_t>(img.data()) % SIMD_IDEAL_MAX_ALIGN_BYTES == 0);// NOLINT
+    img.fill(7);// NOLINT
+    first = img.data();
+  }
+  REQUIRE(pool.GetStats().misses == 1);
+  REQUIRE(pool.GetStats().cached_buffers == 1);
+  REQUIRE(pool.GetStats().cached_bytes == 17 * 33 * sizeof(poutre::pINT32));
+
+  // same key reuses the buffer, other types or shapes don't
+  {
+    poutre::details::image_t<poutre::pINT32, 2> img(shape, poutre::AllocationMode::Pooled);
+    REQUIRE(img.data() == first);
+    const poutre::details::image_t<poutre::pFLOAT, 2> other_type(shape, poutre::AllocationMode::Pooled);
+    const poutre::details::image_t<poutre::pINT32, 2> other_shape({ 33, 17 }, poutre::AllocationMode::Pooled);
+    REQUIRE(pool.GetStats().local_hits == 1);
+    REQUIRE(pool.GetStats().misses == 3);
+
+    // deep copy owns a fresh storage, move keeps the pooled one
+    const auto copy(img);
+    REQUIRE(copy.data() != first);
+    REQUIRE(std::all_of(copy.cbegin(), copy.cend(), [](auto val) { return val == 7; }));
+    auto moved(std::move(img));
+    REQUIRE(moved.data() == first);
+    REQUIRE(moved.IsOwner());
+  }
+  REQUIRE(pool.GetStats().cached_buffers == 3);
+  REQUIRE(pool.GetStats().releases == 4);
+
+  pool.Trim();
+  REQUIRE(pool.GetStats().cached_buffers == 0);
+  REQUIRE(pool.GetStats().cached_bytes == 0);
+  REQUIRE(pool.GetStats().evictions == 3);
+}
+
+TEST_CASE("capacities and thread fallback", "[buffer_pool]")
+{
+  auto &pool = poutre::BufferPool::get();
+  const auto thread_capacity = pool.GetThreadCapacity();
+  const auto global_capacity = pool.GetGlobalCapacity();
+  pool.Trim();
+  pool.ResetStats();
+  const auto factory = [] {
+    return poutre::Create({ 64, 64 },// NOLINT
+      poutre::CompoundType::CompoundType_Scalar,
+      poutre::PType::PType_GrayUINT8,
+      poutre::AllocationMode::Pooled);
+  };
+
+  // buffers released by an exiting thread land in the shared cache
+  std::thread([&] { auto img = factory(); }).join();
+  REQUIRE(pool.GetStats().cached_buffers == 1);
+  {
+    auto img = factory();
+    REQUIRE(pool.GetStats().global_hits == 1);
+  }
+
+  // no room anywhere, buffers are freed on release
+  pool.Trim();
+  pool.SetThreadCapacity(0);
+  pool.SetGlobalCapacity(0);
+  REQUIRE(pool.GetThreadCapacity() == 0);
+  { auto img = factory(); }
+  REQUIRE(pool.GetStats().cached_buffers == 0);
+  REQUIRE(pool.GetStats().evictions == 2);
+
+  pool.SetThreadCapacity(thread_capacity);
+  pool.SetGlobalCapacity(global_capacity);
+}
+
+TEST_CASE("trim reaches caches of live threads", "[buffer_pool]")
+{
+  auto &pool = poutre::BufferPool::get();
+  pool.Trim();
+  pool.ResetStats();
+  std::promise<void> released;
+  std::promise<void> trimmed;
+  // stands for an idle pool worker: it keeps its thread cache while the caller trims
+  std::thread worker([&] {
+    {
+      const poutre::details::image_t<poutre::pINT32, 2> img({ 31, 7 }, poutre::AllocationMode::Pooled);// NOLINT
+    }
+    released.set_value();
+    trimmed.get_future().wait();
+  });
+  released.get_future().wait();
+  REQUIRE(pool.GetStats().cached_buffers == 1);
+  pool.Trim();
+  const auto stats = pool.GetStats();
+  trimmed.set_value();
+  worker.join();
+  REQUIRE(stats.cached_buffers == 0);
+  REQUIRE(stats.cached_bytes == 0);
+  REQUIRE(stats.evictions == 1);
+  REQUIRE(pool.GetStats().cached_buffers == 0);
+}
+
+TEST_CASE("pooled binpack", "[buffer_pool]")
+{
+  auto &pool = poutre::BufferPool::get();
+  pool.Trim();
+  const std::vector<std::size_t> shape{ 5, 70 };
+  {
+    poutre::details::image_t<poutre::pBinPack, 2> dirty(shape, poutre::AllocationMode::Pooled);
+    std::fill(dirty.data(), dirty.data() + dirty.nb_words(), ~poutre::pUINT64(0));
+  }
+  // recycled words are dirty, padding bits must be cleared anyway
+  const poutre::details::image_t<poutre::pBinPack, 2> packed(shape, poutre::AllocationMode::Pooled);
+  for (std::ptrdiff_t line = 0; line < packed.nb_lines(); ++line) {
+    REQUIRE((packed.GetLineWords(line)[packed.words_per_line() - 1] & ~packed.tail_mask()) == 0);
+  }
+  pool.Trim();
+}
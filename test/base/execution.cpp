@@ -0,0 +1,91 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include "test_helpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <poutre/base/details/simd/simd_algorithm.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/types.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("configure", "[execution]")
+{
+  const poutre::test::ScopedExecutionContext guard;
+  auto &ctx = poutre::ExecutionContext::get();
+  REQUIRE(ctx.GetNumThreads() >= 1);
+  REQUIRE(ctx.GetGrainSize() > 0);
+
+  ctx.SetNumThreads(4);
+  REQUIRE(ctx.GetNumThreads() == 4);
+  ctx.SetGrainSize(128);// NOLINT
+  REQUIRE(ctx.GetGrainSize() == 128);
+  REQUIRE_THROWS(ctx.SetGrainSize(0));
+
+  // small range -> serial path
+  REQUIRE(ctx.ComputeBlockSize(200) == 200);
+  // block size is a multiple of step
+  const auto block_size = ctx.ComputeBlockSize(100000, 32);// NOLINT
+  REQUIRE(block_size >= 128);
+  REQUIRE(block_size % 32 == 0);
+
+  ctx.SetNumThreads(1);
+  REQUIRE(ctx.ComputeBlockSize(100000) == 100000);// NOLINT
+}
+
+TEST_CASE("parallel for blocks", "[execution]")
+{
+  poutre::test::ScopedExecutionContext ctx;
+  ctx.Set(4, poutre::test::small_grain);
+
+  const std::size_t length = 10007;
+  std::vector<int> visited(length, 0);
+  std::atomic<std::size_t> nbblocks = 0;
+  std::atomic<bool> misaligned = false;
+  // Catch2 assertions are not thread safe, only check results from main thread
+  poutre::ParallelForBlocks(length, 16, [&](std::size_t begin, std::size_t end) {
+    ++nbblocks;
+    if (begin % 16 != 0) { misaligned = true; }
+    for (std::size_t i = begin; i < end; ++i) { visited[i]++; }
+  });
+  REQUIRE(nbblocks > 1);
+  REQUIRE(!misaligned);
+  REQUIRE(std::accumulate(visited.begin(), visited.end(), std::size_t{ 0 }) == length);
+  for (const auto &val : visited) { REQUIRE(val == 1); }
+
+  REQUIRE_THROWS_AS(poutre::ParallelForBlocks(length,
+                      1,
+                      [&](std::size_t begin, std::size_t /*end*/) {
+                        if (begin == 0) { throw std::runtime_error("first block"); }
+                      }),
+    std::runtime_error);
+}
+
+TEST_CASE("simd transform parallel", "[execution]")
+{
+  poutre::test::ScopedExecutionContext ctx;
+  ctx.Set(4, 256);// NOLINT
+
+  const std::size_t length = 100003;
+  std::vector<poutre::pINT32, xs::aligned_allocator<poutre::pINT32, SIMD_IDEAL_MAX_ALIGN_BYTES>> vin(length);
+  std::vector<poutre::pINT32, xs::aligned_allocator<poutre::pINT32, SIMD_IDEAL_MAX_ALIGN_BYTES>> vout(length);
+  std::iota(vin.begin(), vin.end(), 0);
+  poutre::simd::transform(vin.data(), vin.data() + length, vin.data(), vout.data(), [](auto lhs, auto rhs) {
+    return lhs + rhs;
+  });
+  for (std::size_t i = 0; i < length; ++i) { REQUIRE(vout[i] == 2 * static_cast<poutre::pINT32>(i)); }
+}
@@ -0,0 +1,55 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <cstddef>
+#include <poutre/base/details/data_structures/fifo.hpp>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("push pop", "[fifo]")
+{
+  poutre::details::RingFifo<std::ptrdiff_t> fifo;
+  REQUIRE(fifo.empty());
+  for (std::ptrdiff_t i = 0; i < 5; ++i) { fifo.push(i); }// NOLINT
+  REQUIRE(fifo.size() == 5);
+  std::vector<std::ptrdiff_t> results;
+  while (!fifo.empty()) {
+    results.push_back(fifo.front());
+    fifo.pop();
+  }
+  const std::vector<std::ptrdiff_t> expected = { 0, 1, 2, 3, 4 };
+  REQUIRE(results == expected);
+}
+
+TEST_CASE("grow when wrapped", "[fifo]")
+{
+  poutre::details::RingFifo<std::ptrdiff_t> fifo(3);
+  REQUIRE(fifo.capacity() == 16);
+  // move head forward so that storage wraps before growing
+  for (std::ptrdiff_t i = 0; i < 10; ++i) { fifo.push(-1); }// NOLINT
+  for (std::ptrdiff_t i = 0; i < 10; ++i) { fifo.pop(); }// NOLINT
+  for (std::ptrdiff_t i = 0; i < 40; ++i) { fifo.push(i); }// NOLINT
+  REQUIRE(fifo.size() == 40);
+  REQUIRE(fifo.capacity() == 64);
+  for (std::ptrdiff_t i = 0; i < 40; ++i) {// NOLINT
+    REQUIRE(fifo.front() == i);
+    fifo.pop();
+  }
+  REQUIRE(fifo.empty());
+
+  fifo.reserve(100);// NOLINT
+  REQUIRE(fifo.capacity() == 128);
+  fifo.push(7);// NOLINT
+  fifo.clear();
+  REQUIRE(fifo.empty());
+}
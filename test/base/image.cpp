@@ -14,12 +14,14 @@
 #include <catch2/matchers/catch_matchers.hpp>
 // #include <catch2/matchers/catch_matchers_container_properties.hpp>
 #include <catch2/matchers/catch_matchers_vector.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/types.hpp>
 #include <stdexcept>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -170,6 +172,28 @@ TEST_CASE("move", "[image]")
   REQUIRE_THAT(coordsmove, Catch::Matchers::Equals(expectedcoordsmove));
 }
 
+TEST_CASE("copy assignment", "[image]")
+{
+  poutre::details::image_t<poutre::pINT32> img({ 3, 4 });//-V112
+  for (std::size_t i = 0; i < img.size(); ++i) { img[i] = static_cast<poutre::pINT32>(i); }
+
+  // same number of pixels, the storage is reused and raw pointers stay valid
+  poutre::details::image_t<poutre::pINT32> img2({ 4, 3 });//-V112
+  const auto *ptr = img2.data();
+  img2 = img;
+  REQUIRE(img2.data() == ptr);
+  REQUIRE(img2.IsOwner());
+  REQUIRE(img2.GetShape() == img.GetShape());
+  REQUIRE(std::equal(img.begin(), img.end(), img2.begin()));
+  REQUIRE(img.data() != img2.data());
+
+  // different size, reallocated
+  poutre::details::image_t<poutre::pINT32> img3({ 2, 2 });
+  img3 = img;
+  REQUIRE(img3.GetShape() == img.GetShape());
+  REQUIRE(std::equal(img.begin(), img.end(), img3.begin()));
+}
+
 TEST_CASE("default arry view", "[image]")
 {
   poutre::details::image_t<poutre::pUINT8> img1({ 3, 4 });//-V112
@@ -231,3 +255,167 @@ TEST_CASE("2D GetLineBuffer", "[image]")
   REQUIRE((*img).GetXSize() == 6);
   REQUIRE((*img).GetYSize() == 5);
 }
+
+TEST_CASE("external buffer", "[image]")
+{
+  using ImageType = poutre::details::image_t<poutre::pINT32>;
+  std::vector<poutre::pINT32> buffer(12, 1);//-V112
+  ImageType img(buffer.data(), { 3, 4 });//-V112
+  REQUIRE(!img.IsOwner());
+  REQUIRE(img.data() == buffer.data());
+  REQUIRE(img.GetVoidPtr() == buffer.data());
+  REQUIRE(img.size() == 12);
+  img.SetPixel(2, 1, 5);// x then y
+  REQUIRE(buffer[6] == 5);
+  img.fill(3);
+  REQUIRE(buffer[0] == 3);
+  REQUIRE(buffer[11] == 3);
+
+  // copy is deep and owns its storage
+  ImageType copy(img);
+  REQUIRE(copy.IsOwner());
+  REQUIRE(copy.data() != buffer.data());
+  copy[0] = 7;
+  REQUIRE(buffer[0] == 3);
+
+  // assignment of the same size writes in the external buffer
+  copy.fill(9);// NOLINT
+  img = copy;
+  REQUIRE(!img.IsOwner());
+  REQUIRE(img.data() == buffer.data());
+  REQUIRE(buffer[11] == 9);
+  img.fill(3);
+
+  // move keeps pointing on external buffer
+  ImageType moved(std::move(img));
+  REQUIRE(moved.data() == buffer.data());
+
+  // rank mismatch
+  REQUIRE_THROWS(ImageType(buffer.data(), { 12 }));
+  REQUIRE_THROWS(ImageType(nullptr, { 3, 4 }));//-V112
+}
+
+TEST_CASE("factory view", "[image]")
+{
+  std::vector<poutre::pFLOAT> buffer(2 * 3 * 4, 0.F);//-V112
+  const auto img = poutre::CreateView(
+    buffer.data(), { 2, 3, 4 }, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_F32);//-V112
+  REQUIRE(img != nullptr);
+  REQUIRE(img->GetRank() == 3);
+  REQUIRE(img->GetPType() == poutre::PType::PType_F32);
+  REQUIRE(img->GetVoidPtr() == buffer.data());
+  auto *img_t = dynamic_cast<poutre::details::image_t<poutre::pFLOAT, 3> *>(img.get());
+  REQUIRE(img_t);
+  REQUIRE(!img_t->IsOwner());//-V522
+
+  const auto owned =
+    poutre::Create({ 2, 3 }, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8);
+  const auto *owned_t = dynamic_cast<const poutre::details::image_t<poutre::pUINT8> *>(owned.get());
+  REQUIRE(owned_t);
+  REQUIRE(owned_t->IsOwner());//-V522
+
+  REQUIRE_THROWS(poutre::CreateView(
+    nullptr, { 2, 3 }, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8));
+}
+
+TEST_CASE("binpack pack unpack", "[image]")
+{
+  for (const std::size_t xsize : { 1, 63, 64, 65, 130 }) {// NOLINT odd widths around word boundaries
+    const std::vector<std::size_t> shape = { 3, xsize };
+    poutre::details::image_t<poutre::pUINT8> img(shape);
+    for (std::size_t i = 0; i < img.size(); ++i) { img[i] = static_cast<poutre::pUINT8>((i * 7) % 3 == 0 ? 5 : 0); }
+
+    poutre::details::image_t<poutre::pBinPack> packed(shape);
+    REQUIRE(packed.GetPType() == poutre::PType::PType_BinPack);
+    REQUIRE(packed.words_per_line() == static_cast<std::ptrdiff_t>((xsize + 63) / 64));
+    poutre::details::t_PackBinary(img, packed);
+    std::size_t nb_true = 0;
+    for (std::size_t i = 0; i < img.size(); ++i) { nb_true += img[i] != 0 ? 1 : 0; }
+    REQUIRE(packed.count() == nb_true);
+    for (std::ptrdiff_t y = 0; y < 3; ++y) {
+      // padding bits of the last word stay cleared
+      REQUIRE((packed.GetLineWords(y)[packed.words_per_line() - 1] & ~packed.tail_mask()) == 0);
+    }
+
+    poutre::details::image_t<poutre::pUINT8> unpacked(shape);
+    poutre::details::t_UnpackBinary(packed, unpacked, poutre::pUINT8(5));// NOLINT
+    REQUIRE(std::equal(img.begin(), img.end(), unpacked.begin()));
+
+    packed.fill(true);
+    REQUIRE(packed.count() == img.size());
+    packed.SetPixel(0, 1, false);
+    REQUIRE(!packed.GetPixel(0, 1));
+    REQUIRE(packed.count() == img.size() - 1);
+  }
+}
+
+TEST_CASE("binpack factory", "[image]")
+{
+  const auto img = poutre::Create({ 4, 70 }, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_BinPack);
+  REQUIRE(img->GetPType() == poutre::PType::PType_BinPack);
+  const auto *img_t = dynamic_cast<const poutre::details::image_t<poutre::pBinPack> *>(img.get());
+  REQUIRE(img_t);
+  REQUIRE(img_t->count() == 0);//-V522
+  REQUIRE(img_t->nb_words() == 8);
+
+  // external buffer of words
+  std::vector<poutre::pUINT64> words(4 * 2, 0);
+  words[2] = 1;
+  const auto view = poutre::CreateView(
+    words.data(), { 4, 70 }, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_BinPack);
+  const auto *view_t = dynamic_cast<const poutre::details::image_t<poutre::pBinPack> *>(view.get());
+  REQUIRE(view_t);
+  REQUIRE(!view_t->IsOwner());//-V522
+  REQUIRE(view_t->GetPixel(0, 1));
+
+  // assignment of the same shape writes in the external words
+  poutre::details::image_t<poutre::pBinPack> ones({ 4, 70 });
+  ones.fill(true);
+  poutre::details::image_t<poutre::pBinPack> wrapped(words.data(), { 4, 70 });
+  wrapped = ones;
+  REQUIRE(wrapped.data() == words.data());
+  REQUIRE(words[1] == ones.tail_mask());
+}
+
+TEST_CASE("16 bits factory and string", "[image]")
+{
+  const auto img = poutre::Create({ 2, 3 }, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT16);
+  REQUIRE(img->GetPType() == poutre::PType::PType_GrayUINT16);
+  REQUIRE(dynamic_cast<const poutre::details::image_t<poutre::pUINT16> *>(img.get()));
+
+  const std::string str = "Scalar GINT16 2 2 3 -32768 -1 0 1 255 32767";
+  const auto simg = poutre::ImageFromString(str);
+  REQUIRE(simg->GetPType() == poutre::PType::PType_GrayINT16);
+  const auto *simg_t = dynamic_cast<const poutre::details::image_t<poutre::pINT16> *>(simg.get());
+  REQUIRE(simg_t);
+  REQUIRE(simg_t->GetPixel(0, 0) == -32768);//-V522
+  REQUIRE(simg_t->GetPixel(2, 1) == 32767);
+  REQUIRE(poutre::ImageToString(*simg) == str);
+}
+
+TEST_CASE("allocation mode", "[image]")
+{
+  const std::vector<std::size_t> shape{ 5, 70 };
+  const auto zeroed = poutre::Create(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayINT32);
+  const auto *zeroed_t = dynamic_cast<const poutre::details::image_t<poutre::pINT32> *>(zeroed.get());
+  REQUIRE(zeroed_t);
+  REQUIRE(std::all_of(zeroed_t->cbegin(), zeroed_t->cend(), [](auto val) { return val == 0; }));//-V522
+
+  const auto uninit = poutre::Create(shape,
+    poutre::CompoundType::CompoundType_Scalar,
+    poutre::PType::PType_GrayINT32,
+    poutre::AllocationMode::Uninitialized);
+  REQUIRE(uninit->GetShape() == shape);
+  REQUIRE(uninit->GetPType() == poutre::PType::PType_GrayINT32);
+  auto *uninit_t = dynamic_cast<poutre::details::image_t<poutre::pINT32> *>(uninit.get());
+  REQUIRE(uninit_t);
+  REQUIRE(uninit_t->IsOwner());//-V522
+  uninit_t->fill(3);
+  REQUIRE(std::all_of(uninit_t->cbegin(), uninit_t->cend(), [](auto val) { return val == 3; }));
+
+  // padding bits of packed lines are cleared even without zero fill
+  const poutre::details::image_t<poutre::pBinPack, 2> packed(shape, poutre::AllocationMode::Uninitialized);
+  for (std::ptrdiff_t line = 0; line < packed.nb_lines(); ++line) {
+    REQUIRE((packed.GetLineWords(line)[packed.words_per_line() - 1] & ~packed.tail_mask()) == 0);
+  }
+}
@@ -0,0 +1,173 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/image_interface.hpp>
+#include <poutre/base/mapped_file.hpp>
+#include <poutre/base/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+//! removes the file on scope exit
+struct TempFile
+{
+  explicit TempFile(const std::string &name)
+    : path((std::filesystem::temp_directory_path() / ("poutre_" + name)).string())
+  {}
+  TempFile(const TempFile &) = delete;
+  TempFile &operator=(const TempFile &) = delete;
+  TempFile(TempFile &&) = delete;
+  TempFile &operator=(TempFile &&) = delete;
+  ~TempFile()
+  {
+    std::error_code err;
+    std::filesystem::remove(path, err);
+  }
+  std::string path;
+};
+
+using img_t = poutre::details::image_t<poutre::pINT32, 2>;
+}// namespace
+
+TEST_CASE("image bytes", "[mapped_file]")
+{
+  using poutre::CompoundType;
+  using poutre::PType;
+  REQUIRE(poutre::ImageBytes({ 3, 5 }, CompoundType::CompoundType_Scalar, PType::PType_GrayUINT8) == 15);
+  REQUIRE(poutre::ImageBytes({ 3, 5 }, CompoundType::CompoundType_Scalar, PType::PType_D64) == 120);
+  REQUIRE(poutre::ImageBytes({ 3, 5 }, CompoundType::CompoundType_3Planes, PType::PType_GrayINT16) == 90);
+  REQUIRE(poutre::ImageBytes({ 3, 70 }, CompoundType::CompoundType_Scalar, PType::PType_BinPack) == 48);
+}
+
+TEST_CASE("create and reopen mapped image", "[mapped_file]")
+{
+  const TempFile file("mapped_image.bin");
+  const std::vector<std::size_t> shape{ 31, 17 };
+  {
+    auto img = poutre::CreateMappedImage(file.path, shape, poutre::CompoundType::CompoundType_Scalar,
+      poutre::PType::PType_GrayINT32);
+    auto *typed = dynamic_cast<img_t *>(img.get());
+    REQUIRE(typed != nullptr);
+    REQUIRE(!typed->IsOwner());
+    REQUIRE(reinterpret_cast<std::uintptr_t>(typed->data()) % SIMD_IDEAL_MAX_ALIGN_BYTES == 0);// NOLINT
+    REQUIRE(typed->data()[0] == 0);
+    const poutre::ScopedAccessAdvice advice(*img, poutre::AccessAdvice::Sequential);
+    for (std::size_t i = 0; i < typed->size(); ++i) { typed->data()[i] = static_cast<poutre::pINT32>(i); }
+  }
+  {
+    // private mapping, the file is left untouched
+    auto img = poutre::MapImage(file.path, poutre::MapAccess::CopyOnWrite);
+    REQUIRE(img->GetShape() == shape);
+    REQUIRE(img->GetPType() == poutre::PType::PType_GrayINT32);
+    auto *typed = dynamic_cast<img_t *>(img.get());
+    REQUIRE(typed != nullptr);
+    REQUIRE(typed->data()[40] == 40);// NOLINT
+    typed->data()[40] = -1;// NOLINT
+    REQUIRE(typed->data()[40] == -1);// NOLINT
+    // pages of a private mapping are not dropped, modifications are kept
+    poutre::AdviseAccess(*img, poutre::AccessAdvice::DontNeed);
+    REQUIRE(typed->data()[40] == -1);// NOLINT
+  }
+  auto img = poutre::MapImage(file.path, poutre::MapAccess::ReadWrite);
+  auto *typed = dynamic_cast<img_t *>(img.get());
+  REQUIRE(typed != nullptr);
+  REQUIRE(typed->data()[40] == 40);// NOLINT
+  REQUIRE(typed->data()[shape[0] * shape[1] - 1] == static_cast<poutre::pINT32>(shape[0] * shape[1] - 1));
+
+  // deep copy is owned and independent of the mapping
+  const img_t copy(*typed);
+  REQUIRE(copy.IsOwner());
+  REQUIRE(copy.data()[40] == 40);// NOLINT
+}
+
+TEST_CASE("map raw image", "[mapped_file]")
+{
+  const TempFile file("mapped_raw.bin");
+  const std::vector<std::size_t> shape{ 4, 8 };
+  constexpr std::size_t offset = SIMD_IDEAL_MAX_ALIGN_BYTES;
+  {
+    std::ofstream out(file.path, std::ios::binary);
+    const std::vector<char> header(offset, 'h');
+    out.write(header.data(), static_cast<std::streamsize>(header.size()));
+    for (std::uint8_t i = 0; i < 32; ++i) { out.put(static_cast<char>(i)); }// NOLINT
+  }
+  auto img = poutre::MapRawImage(file.path, shape, poutre::CompoundType::CompoundType_Scalar,
+    poutre::PType::PType_GrayUINT8, poutre::MapAccess::ReadOnly, offset);
+  const auto *pixels = static_cast<const poutre::pUINT8 *>(std::as_const(*img).GetVoidPtr());
+  REQUIRE(pixels[0] == 0);
+  REQUIRE(pixels[31] == 31);// NOLINT
+
+  REQUIRE_THROWS(poutre::MapRawImage(file.path, shape, poutre::CompoundType::CompoundType_Scalar,
+    poutre::PType::PType_GrayUINT8, poutre::MapAccess::ReadOnly, 1));
+  REQUIRE_THROWS(poutre::MapRawImage(file.path, { 40, 8 }, poutre::CompoundType::CompoundType_Scalar,
+    poutre::PType::PType_GrayUINT8, poutre::MapAccess::ReadOnly, offset));
+  // not a header + payload file
+  REQUIRE_THROWS(poutre::MapImage(file.path, poutre::MapAccess::ReadOnly));
+  REQUIRE_THROWS(poutre::MapImage(file.path + ".missing", poutre::MapAccess::ReadOnly));
+}
+
+TEST_CASE("mapped file", "[mapped_file]")
+{
+  const TempFile file("mapped_file.bin");
+  constexpr std::size_t bytes = 10000;
+  {
+    auto mapped = poutre::MappedFile::Create(file.path, bytes);
+    REQUIRE(mapped.size() == bytes);
+    REQUIRE(mapped.access() == poutre::MapAccess::ReadWrite);
+    mapped.data()[bytes - 1] = std::byte{ 42 };// NOLINT
+    mapped.Advise(0, 2 * bytes, poutre::AccessAdvice::WillNeed);
+    mapped.Flush();
+    poutre::MappedFile moved(std::move(mapped));
+    REQUIRE(moved.data()[bytes - 1] == std::byte{ 42 });// NOLINT
+  }
+  REQUIRE(std::filesystem::file_size(file.path) == bytes);
+  const poutre::MappedFile mapped(file.path, poutre::MapAccess::ReadOnly);
+  REQUIRE(mapped.data()[bytes - 1] == std::byte{ 42 });// NOLINT
+
+  mapped.Advise(0, bytes, poutre::AccessAdvice::DontNeed);
+  REQUIRE(mapped.data()[bytes - 1] == std::byte{ 42 });// NOLINT
+
+  // no-op outside mappings
+  const img_t img({ 3, 3 });
+  poutre::AdviseAccess(img, poutre::AccessAdvice::DontNeed);
+  poutre::AdviseAccess(nullptr, 10, poutre::AccessAdvice::Random);// NOLINT
+}
+
+TEST_CASE("map file larger than memory", "[mapped_file]")
+{
+  // sparse file, several times the memory of a test machine: read only mappings are never commit charged
+  const TempFile file("mapped_huge.bin");
+  constexpr std::uintmax_t bytes = std::uintmax_t{ 16 } << 30U;
+  { std::ofstream out(file.path, std::ios::binary); }
+  std::filesystem::resize_file(file.path, bytes);
+  {
+    const poutre::MappedFile mapped(file.path, poutre::MapAccess::ReadOnly);
+    REQUIRE(mapped.size() == bytes);
+    REQUIRE(mapped.data()[bytes - 1] == std::byte{ 0 });// NOLINT
+  }
+#if !defined(_WIN32)
+  // copy on write reserves nothing either, only the written pages are committed
+  const poutre::MappedFile mapped(file.path, poutre::MapAccess::CopyOnWrite);
+  mapped.data()[bytes / 2] = std::byte{ 7 };// NOLINT
+  REQUIRE(mapped.data()[bytes / 2] == std::byte{ 7 });// NOLINT
+#endif
+}
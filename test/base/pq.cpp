@@ -13,6 +13,7 @@
 #include <cstdint>
 #include <poutre/base/details/data_structures/pq.hpp>
 #include <poutre/base/types.hpp>
+#include <random>
 #include <utility>
 #include <vector>
 
@@ -127,4 +128,129 @@ TEST_CASE("decrease stable", "[pqueue]")
   auto iterres = results.cbegin();
   auto iterexpected = expected.cbegin();
   for (; iterres != results.cend(); ++iterres, ++iterexpected) { REQUIRE(*iterexpected == *iterres); }
-}
\ No newline at end of file
+}
+TEST_CASE("increase hierarchical", "[pqueue]")
+{
+  poutre::details::poutre_hpq<poutre::pUINT8, uint64_t> pqueue;
+  // NOLINTBEGIN
+  pqueue.emplace(0, 1);//-V525
+  pqueue.emplace(50, 1);
+  pqueue.emplace(0, 2);
+  pqueue.emplace(50, 2);
+  pqueue.emplace(80, 1);
+  pqueue.emplace(80, 2);
+  pqueue.emplace(80, 3);
+  pqueue.emplace(0, 3);
+
+  const std::vector<std::pair<poutre::pUINT8, uint64_t>> expected = {
+    { 80, 1 }, { 80, 2 }, { 80, 3 }, { 50, 1 }, { 50, 2 }, { 0, 1 }, { 0, 2 }, { 0, 3 }
+  };
+  // NOLINTEND
+  REQUIRE(pqueue.size() == expected.size());
+  std::vector<std::pair<poutre::pUINT8, uint64_t>> results;
+  while (!pqueue.empty()) {
+    results.push_back(pqueue.top());
+    pqueue.pop();
+  }
+  REQUIRE(results == expected);
+}
+
+TEST_CASE("decrease hierarchical", "[pqueue]")
+{
+  poutre::details::poutre_rhpq<poutre::pUINT8, uint64_t> pqueue;
+  // NOLINTBEGIN
+  pqueue.emplace(0, 1);//-V525
+  pqueue.emplace(50, 1);
+  pqueue.emplace(0, 2);
+  pqueue.emplace(50, 2);
+  pqueue.emplace(80, 1);
+  pqueue.emplace(80, 2);
+  pqueue.emplace(80, 3);
+  pqueue.emplace(0, 3);
+  const std::vector<std::pair<poutre::pUINT8, uint64_t>> expected = {
+    { 0, 1 }, { 0, 2 }, { 0, 3 }, { 50, 1 }, { 50, 2 }, { 80, 1 }, { 80, 2 }, { 80, 3 }
+  };
+  // NOLINTEND
+  std::vector<std::pair<poutre::pUINT8, uint64_t>> results;
+  while (!pqueue.empty()) {
+    results.push_back(pqueue.top());
+    pqueue.pop();
+  }
+  REQUIRE(results == expected);
+}
+
+TEST_CASE("hierarchical push while popping", "[pqueue]")
+{
+  // flooding pattern: pop current level then push on current or lower levels
+  poutre::details::poutre_hpq<std::int16_t, int> pqueue;
+  // NOLINTBEGIN
+  pqueue.emplace(-5, 1);
+  pqueue.emplace(10, 2);
+  REQUIRE(pqueue.top() == std::pair<std::int16_t, int>{ 10, 2 });
+  pqueue.pop();
+  pqueue.emplace(10, 3);
+  pqueue.emplace(-300, 4);
+  pqueue.emplace(10, 5);
+  const std::vector<std::pair<std::int16_t, int>> expected = { { 10, 3 }, { 10, 5 }, { -5, 1 }, { -300, 4 } };
+  // NOLINTEND
+  std::vector<std::pair<std::int16_t, int>> results;
+  while (!pqueue.empty()) {
+    results.push_back(pqueue.top());
+    pqueue.pop();
+  }
+  REQUIRE(results == expected);
+}
+
+namespace {
+//! hierarchical queue must serve the same sequence as the stable heap, interleaving pushes and pops
+template<class HQueue, class RefQueue> void CheckSparseLevels(std::uint32_t seed)
+{
+  using key = poutre::pUINT16;
+  HQueue hqueue;
+  RefQueue ref;
+  std::mt19937 gen(seed);
+  // few distant levels, spread over the whole 16 bits range
+  std::uniform_int_distribution<int> keys(0, 65535);// NOLINT
+  int counter = 0;
+  for (int round = 0; round < 200; ++round) {// NOLINT
+    for (int i = 0; i < 5; ++i) {// NOLINT
+      const auto k = static_cast<key>(keys(gen));
+      hqueue.emplace(k, counter);
+      ref.emplace(k, counter);
+      ++counter;
+    }
+    for (int i = 0; i < 3 && !ref.empty(); ++i) {
+      REQUIRE(hqueue.top() == ref.top());
+      hqueue.pop();
+      ref.pop();
+    }
+  }
+  REQUIRE(hqueue.size() == ref.size());
+  while (!ref.empty()) {
+    REQUIRE(hqueue.top() == ref.top());
+    hqueue.pop();
+    ref.pop();
+  }
+  REQUIRE(hqueue.empty());
+}
+}// namespace
+
+TEST_CASE("hierarchical 16 bits sparse levels", "[pqueue]")
+{
+  using key = poutre::pUINT16;
+  CheckSparseLevels<poutre::details::HierarchicalQueue<key, int, true>, poutre::details::poutre_pq_stable<key, int>>(1);
+  CheckSparseLevels<poutre::details::HierarchicalQueue<key, int, false>, poutre::details::poutre_rpq_stable<key, int>>(
+    2);
+  // extreme levels of a signed key
+  poutre::details::poutre_rhpq<poutre::pINT16, int> pqueue;
+  pqueue.emplace(32767, 1);// NOLINT
+  pqueue.emplace(-32768, 2);// NOLINT
+  pqueue.emplace(0, 3);
+  REQUIRE(pqueue.top() == std::pair<poutre::pINT16, int>{ -32768, 2 });
+  pqueue.pop();
+  REQUIRE(pqueue.top() == std::pair<poutre::pINT16, int>{ 0, 3 });
+  pqueue.pop();
+  REQUIRE(pqueue.top() == std::pair<poutre::pINT16, int>{ 32767, 1 });
+  pqueue.pop();
+  REQUIRE(pqueue.empty());
+}
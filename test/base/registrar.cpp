@@ -12,7 +12,10 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <poutre/base/registrar.hpp>
+#include <cstddef>
 #include <string>
+#include <thread>
+#include <vector>
 
 class Base
 {
@@ -52,3 +55,19 @@ TEST_CASE("default", "[registrar]")
   poutre::Registrar<Base>::getInstance().Register("Base", Base::Create);
   poutre::Registrar<Base>::getInstance().Register("Derived", Derived::Create);
 }
+
+TEST_CASE("concurrent register", "[registrar]")
+{
+  constexpr std::size_t nbthreads = 8;
+  std::vector<std::thread> threads;
+  threads.reserve(nbthreads);
+  for (std::size_t i = 0; i < nbthreads; ++i) {
+    threads.emplace_back(
+      [i]() { poutre::Registrar<Base>::getInstance().Register("Concurrent" + std::to_string(i), Derived::Create); });
+  }
+  for (auto &thread : threads) { thread.join(); }
+  // all keys registered exactly once
+  for (std::size_t i = 0; i < nbthreads; ++i) {
+    REQUIRE_THROWS(poutre::Registrar<Base>::getInstance().Register("Concurrent" + std::to_string(i), Base::Create));
+  }
+}
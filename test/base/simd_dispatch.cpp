@@ -0,0 +1,297 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <poutre/base/details/simd/simd_dispatch.hpp>
+#include <poutre/base/types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+template<typename T> T Reference(poutre::simd::DispatchedBinaryKernel kernel, T lhs, T rhs)
+{
+  using kernel_t = poutre::simd::DispatchedBinaryKernel;
+  const auto wide_lhs = static_cast<long double>(lhs);
+  const auto wide_rhs = static_cast<long double>(rhs);
+  switch (kernel) {
+  case kernel_t::Inf: return std::min(lhs, rhs);
+  case kernel_t::Sup: return std::max(lhs, rhs);
+  case kernel_t::SaturatedAdd:
+    return static_cast<T>(std::clamp(wide_lhs + wide_rhs,
+      static_cast<long double>(std::numeric_limits<T>::lowest()),
+      static_cast<long double>(std::numeric_limits<T>::max())));
+  case kernel_t::SaturatedSub:
+    return static_cast<T>(std::clamp(wide_lhs - wide_rhs,
+      static_cast<long double>(std::numeric_limits<T>::lowest()),
+      static_cast<long double>(std::numeric_limits<T>::max())));
+  }
+  return lhs;
+}
+
+//! dispatched kernels must match the scalar definition, odd sizes and offsets exercise the scalar tail
+template<typename T> void CheckDispatched()
+{
+  using kernel_t = poutre::simd::DispatchedBinaryKernel;
+  std::mt19937 gen(7);// NOLINT
+  std::uniform_int_distribution<long long> dist(static_cast<long long>(std::numeric_limits<T>::lowest() / 2),
+    static_cast<long long>(std::numeric_limits<T>::max() / 2));
+  for (const std::size_t size : { 0, 1, 15, 64, 131 }) {// NOLINT
+    std::vector<T> in1(size + 1);
+    std::vector<T> in2(size + 1);
+    // values around the half range, so that additions and subtractions do saturate
+    for (auto &val : in1) { val = static_cast<T>(dist(gen) * 2); }
+    for (auto &val : in2) { val = static_cast<T>(dist(gen)); }
+    for (const auto kernel : { kernel_t::Inf, kernel_t::Sup, kernel_t::SaturatedAdd, kernel_t::SaturatedSub }) {
+      std::vector<T> out(size + 1, 0);
+      poutre::simd::DispatchedTransform(kernel, in1.data() + 1, in2.data() + 1, out.data() + 1, size);
+      REQUIRE(out[0] == 0);
+      for (std::size_t i = 1; i <= size; ++i) { REQUIRE(out[i] == Reference(kernel, in1[i], in2[i])); }
+    }
+  }
+}
+}// namespace
+
+TEST_CASE("dispatched kernels", "[simd]")
+{
+  CheckDispatched<poutre::pUINT8>();
+  CheckDispatched<poutre::pUINT16>();
+  CheckDispatched<poutre::pINT16>();
+  CheckDispatched<poutre::pINT32>();
+  CheckDispatched<poutre::pINT64>();
+}
+
+TEST_CASE("dispatched compare select", "[simd]")
+{
+  using compare_t = poutre::simd::DispatchedCompare;
+  std::mt19937 gen(3);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 9);// NOLINT
+  // odd size and offset exercise the scalar tail
+  constexpr std::size_t size = 203;
+  constexpr std::size_t begin = 5;
+  std::vector<poutre::pINT32> in(size);
+  std::vector<poutre::pINT32> comp(size);
+  std::vector<poutre::pUINT8> vtrue(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    in[i] = dist(gen);
+    comp[i] = dist(gen);
+    vtrue[i] = static_cast<poutre::pUINT8>(100 + i % 50);// NOLINT
+  }
+  for (const auto compare :
+    { compare_t::Equal, compare_t::Diff, compare_t::Sup, compare_t::SupEqual, compare_t::Inf, compare_t::InfEqual }) {
+    auto reference = [&](poutre::pINT32 lhs, poutre::pINT32 rhs) {
+      switch (compare) {
+      case compare_t::Equal: return lhs == rhs;
+      case compare_t::Diff: return lhs != rhs;
+      case compare_t::Sup: return lhs > rhs;
+      case compare_t::SupEqual: return lhs >= rhs;
+      case compare_t::Inf: return lhs < rhs;
+      case compare_t::InfEqual: return lhs <= rhs;
+      }
+      return false;
+    };
+    // buffer compared, buffer true, value false
+    std::vector<poutre::pUINT8> out(size, 0);
+    poutre::simd::DispatchedCompareSelect<poutre::pINT32, poutre::pUINT8>(
+      compare, in.data(), { comp.data(), 0 }, { vtrue.data(), 0 }, { nullptr, 7 }, out.data(), begin, size);
+    REQUIRE(out[begin - 1] == 0);
+    for (std::size_t i = begin; i < size; ++i) { REQUIRE(out[i] == (reference(in[i], comp[i]) ? vtrue[i] : 7)); }
+    // value compared, value true, buffer false
+    std::vector<double> dout(size, 0.);
+    std::vector<double> dfalse(size, -1.);
+    poutre::simd::DispatchedCompareSelect<poutre::pINT32, double>(
+      compare, in.data(), { nullptr, 4 }, { nullptr, 2. }, { dfalse.data(), 0. }, dout.data(), 0, size);
+    for (std::size_t i = 0; i < size; ++i) { REQUIRE(dout[i] == (reference(in[i], 4) ? 2. : -1.)); }
+  }
+}
+
+TEST_CASE("dispatched van herck strip", "[simd]")
+{
+  constexpr std::ptrdiff_t ysize = 23;
+  constexpr std::ptrdiff_t xsize = 37;
+  constexpr std::ptrdiff_t x_begin = 3;
+  constexpr std::ptrdiff_t x_end = 34;
+  constexpr std::ptrdiff_t width = x_end - x_begin;
+  std::mt19937 gen(5);// NOLINT
+  std::vector<poutre::pUINT16> in(static_cast<std::size_t>(ysize * xsize));
+  for (auto &val : in) { val = static_cast<poutre::pUINT16>(gen()); }
+  for (const std::ptrdiff_t half : { 1, 4, 30 }) {// NOLINT
+    const auto chunk = static_cast<std::size_t>(std::min(2 * half + 1, ysize + 2 * half) * width);
+    std::vector<poutre::pUINT16> g(chunk);
+    std::vector<poutre::pUINT16> h_current(chunk);
+    std::vector<poutre::pUINT16> h_previous(chunk);
+    const std::vector<poutre::pUINT16> neutral(static_cast<std::size_t>(width), 0);
+    std::vector<poutre::pUINT16> out(in.size(), 1);
+    poutre::simd::DispatchedVanHerckStrip(poutre::simd::DispatchedBinaryKernel::Sup,
+      in.data(),
+      out.data(),
+      xsize,
+      ysize,
+      x_begin,
+      x_end,
+      half,
+      neutral.data(),
+      g.data(),
+      h_current.data(),
+      h_previous.data());
+    for (std::ptrdiff_t y = 0; y < ysize; ++y) {
+      for (std::ptrdiff_t x = 0; x < xsize; ++x) {
+        poutre::pUINT16 expected = 1;// outside the strip untouched
+        if (x >= x_begin && x < x_end) {
+          expected = 0;
+          for (auto yy = std::max<std::ptrdiff_t>(0, y - half); yy <= std::min(ysize - 1, y + half); ++yy) {
+            expected = std::max(expected, in[static_cast<std::size_t>(yy * xsize + x)]);
+          }
+        }
+        REQUIRE(out[static_cast<std::size_t>(y * xsize + x)] == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("dispatched unary transform", "[simd]")
+{
+  using kernel_t = poutre::simd::DispatchedUnaryKernel;
+  std::mt19937 gen(11);// NOLINT
+  for (const std::size_t size : { 0, 1, 15, 64, 131 }) {// NOLINT
+    std::vector<poutre::pINT16> in(size + 1);
+    for (auto &val : in) { val = static_cast<poutre::pINT16>(gen()); }
+    for (const auto kernel : { kernel_t::Invert, kernel_t::SaturatedAddConstant, kernel_t::SaturatedSubConstant }) {
+      constexpr poutre::pINT16 value = 20000;
+      std::vector<poutre::pINT16> out(size + 1, 0);
+      poutre::simd::DispatchedUnaryTransform(kernel, in.data() + 1, value, out.data() + 1, size);
+      REQUIRE(out[0] == 0);
+      for (std::size_t i = 1; i <= size; ++i) {
+        switch (kernel) {
+        case kernel_t::Invert: REQUIRE(out[i] == static_cast<poutre::pINT16>(-in[i])); break;
+        case kernel_t::SaturatedAddConstant:
+          REQUIRE(out[i] == Reference(poutre::simd::DispatchedBinaryKernel::SaturatedAdd, in[i], value));
+          break;
+        case kernel_t::SaturatedSubConstant:
+          REQUIRE(out[i] == Reference(poutre::simd::DispatchedBinaryKernel::SaturatedSub, in[i], value));
+          break;
+        }
+      }
+    }
+  }
+}
+
+TEST_CASE("dispatched compare select same type", "[simd]")
+{
+  constexpr std::size_t size = 203;
+  std::mt19937 gen(13);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 9);// NOLINT
+  std::vector<poutre::pUINT8> in(size);
+  std::vector<poutre::pUINT8> vfalse(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    in[i] = static_cast<poutre::pUINT8>(dist(gen));
+    vfalse[i] = static_cast<poutre::pUINT8>(i % 50);// NOLINT
+  }
+  std::vector<poutre::pUINT8> out(size, 0);
+  poutre::simd::DispatchedCompareSelect<poutre::pUINT8, poutre::pUINT8>(poutre::simd::DispatchedCompare::SupEqual,
+    in.data(),
+    { nullptr, 5 },
+    { nullptr, 255 },
+    { vfalse.data(), 0 },
+    out.data(),
+    0,
+    size);
+  for (std::size_t i = 0; i < size; ++i) { REQUIRE(out[i] == (in[i] >= 5 ? 255 : vfalse[i])); }
+}
+
+TEST_CASE("dispatched neighbor line", "[simd]")
+{
+  // 3 rows of 40 pixels, the middle one is processed with a 3x3 square, odd width exercises the scalar tail
+  constexpr std::ptrdiff_t pitch = 40;
+  constexpr std::ptrdiff_t xsize = pitch - 2;
+  std::mt19937 gen(17);// NOLINT
+  std::vector<poutre::pINT32> in(static_cast<std::size_t>(3 * pitch));
+  for (auto &val : in) { val = static_cast<poutre::pINT32>(gen() % 1000); }// NOLINT
+  std::vector<std::ptrdiff_t> offsets;
+  for (std::ptrdiff_t dy = -1; dy <= 1; ++dy) {
+    for (std::ptrdiff_t dx = -1; dx <= 1; ++dx) { offsets.push_back(dy * pitch + dx); }
+  }
+  const poutre::pINT32 *linein = in.data() + pitch + 1;
+  for (const auto kernel : { poutre::simd::DispatchedBinaryKernel::Inf, poutre::simd::DispatchedBinaryKernel::Sup }) {
+    std::vector<poutre::pINT32> out(static_cast<std::size_t>(xsize), 0);
+    poutre::simd::DispatchedNeighborLine(
+      kernel, linein, out.data(), xsize, offsets.data(), static_cast<std::ptrdiff_t>(offsets.size()));
+    for (std::ptrdiff_t x = 0; x < xsize; ++x) {
+      poutre::pINT32 expected = linein[x + offsets[0]];
+      for (const auto offset : offsets) { expected = Reference(kernel, expected, linein[x + offset]); }
+      REQUIRE(out[static_cast<std::size_t>(x)] == expected);
+    }
+  }
+}
+
+TEST_CASE("dispatched binpack shift line", "[simd]")
+{
+  constexpr std::ptrdiff_t words = 23;
+  std::mt19937_64 gen(19);// NOLINT
+  std::vector<poutre::pUINT64> in(static_cast<std::size_t>(words + 2));
+  std::vector<poutre::pUINT64> init(static_cast<std::size_t>(words));
+  for (auto &val : in) { val = gen(); }
+  for (auto &val : init) { val = gen(); }
+  for (const int shift_bits : { 0, 1, 37, 63 }) {// NOLINT
+    for (const auto kernel : { poutre::simd::DispatchedBinaryKernel::Inf, poutre::simd::DispatchedBinaryKernel::Sup }) {
+      auto out = init;
+      constexpr std::ptrdiff_t begin = 2;
+      poutre::simd::DispatchedBinPackShiftLine(kernel, in.data(), 1, shift_bits, out.data(), begin, words);
+      for (std::ptrdiff_t i = 0; i < words; ++i) {
+        const auto idx = static_cast<std::size_t>(i);
+        if (i < begin) {
+          REQUIRE(out[idx] == init[idx]);
+          continue;
+        }
+        const auto src = static_cast<std::size_t>(i + 1);
+        const poutre::pUINT64 shifted =
+          shift_bits == 0 ? in[src] : (in[src] >> shift_bits) | (in[src + 1] << (64 - shift_bits));// NOLINT
+        const auto expected = kernel == poutre::simd::DispatchedBinaryKernel::Inf ? init[idx] & shifted
+                                                                                  : init[idx] | shifted;
+        REQUIRE(out[idx] == expected);
+      }
+    }
+  }
+}
+
+TEST_CASE("dispatched transpose", "[simd]")
+{
+  std::mt19937 gen(23);// NOLINT
+  for (const auto &[rows, cols] : { std::pair<std::ptrdiff_t, std::ptrdiff_t>{ 1, 1 }, { 67, 130 }, { 259, 33 } }) {
+    std::vector<poutre::pUINT8> src(static_cast<std::size_t>(rows * cols));
+    for (auto &val : src) { val = static_cast<poutre::pUINT8>(gen()); }
+    std::vector<poutre::pUINT8> dst(src.size(), 0);
+    // two row blocks, as done by the parallel dispatcher
+    const auto half = rows / 2;
+    poutre::simd::DispatchedTransposeBlocked(src.data(), rows, cols, dst.data(), 0, half);
+    poutre::simd::DispatchedTransposeBlocked(src.data(), rows, cols, dst.data(), half, rows);
+    for (std::ptrdiff_t r = 0; r < rows; ++r) {
+      for (std::ptrdiff_t c = 0; c < cols; ++c) {
+        REQUIRE(dst[static_cast<std::size_t>(c * rows + r)] == src[static_cast<std::size_t>(r * cols + c)]);
+      }
+    }
+  }
+}
+
+TEST_CASE("dispatched arch", "[simd]")
+{
+  const std::string name = poutre::simd::DispatchedArchName();
+  REQUIRE(!name.empty());
+  REQUIRE(name != "none");
+  // allocations cover the widest arch that may be selected
+  REQUIRE(SIMD_IDEAL_MAX_ALIGN_BYTES >= poutre::simd::dispatch_arch_list::alignment());
+}
@@ -79,6 +79,39 @@ TEST_CASE("high_leveling 2D SESquare2D", "[geodesy]")
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
 }
 
+TEST_CASE("low high leveling 2D UINT8", "[geodesy]")
+{
+  const auto img_ref = poutre::ImageFromString(
+    "Scalar GUINT8 2 3 4 \
+2 2 2 7 \
+5 5 5 0 \
+1 1 1 9");
+  const auto img_marker = poutre::ImageFromString(
+    "Scalar GUINT8 2 3 4 \
+1 1 1 1 \
+3 3 3 3 \
+4 4 4 4");
+
+  auto img_out = poutre::CloneGeometry(*img_marker); // NOLINT
+  REQUIRE(img_out.get() != nullptr);
+
+  poutre::geo::low_leveling(*img_ref, *img_marker ,poutre::se::Common_NL_SE::SESquare2D,*img_out);
+  const std::string expected_low =
+    "Scalar GUINT8 2 3 4 \
+2 2 2 4 \
+4 4 4 0 \
+1 1 1 4";
+  REQUIRE_THAT(poutre::ImageToString(*img_out), Catch::Matchers::Equals(expected_low));
+
+  poutre::geo::high_leveling(*img_ref, *img_marker ,poutre::se::Common_NL_SE::SESquare2D,*img_out);
+  const std::string expected_high =
+    "Scalar GUINT8 2 3 4 \
+2 2 2 7 \
+5 5 5 1 \
+1 1 1 9";
+  REQUIRE_THAT(poutre::ImageToString(*img_out), Catch::Matchers::Equals(expected_high));
+}
+
 TEST_CASE("leveling 1D", "[geodesy]")
 {
   {
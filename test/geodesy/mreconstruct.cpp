@@ -10,17 +10,24 @@
 //                     http://www.boost.org/LICENSE_1_0.txt                   //
 //==============================================================================
 
+#include "test_helpers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <poutre/base/execution.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/pixel_processing/copy_convert.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 #include <poutre/geodesy/mreconstruct.hpp>
+#include <poutre/geodesy/details/mreconstruct_t.hpp>
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 TEST_CASE("reconstruct dilate 2D SESquare2D", "[geodesy]")
 {
@@ -171,3 +178,127 @@ TEST_CASE("reconstruct erode 2D SECross2D", "[geodesy]")
   const auto img_str = poutre::ImageToString(*img_out);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
 }
+
+namespace {
+// reference: naive geodesic dilate/erode iterated until stability
+template<poutre::se::Common_NL_SE nl_static, class Op>
+void NaiveReconstruct(const poutre::details::image_t<poutre::pUINT8, 3> &i_mask,
+  poutre::details::image_t<poutre::pUINT8, 3> &io_img,
+  Op sup)
+{
+  auto vout = poutre::details::view(io_img);
+  auto vmask = poutre::details::view(i_mask);
+  auto bnd = vout.bound();
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (auto iter = begin(bnd); iter != end(bnd); ++iter) {
+      auto val = vout[*iter];
+      for (const auto &coord : poutre::se::details::static_se_traits<nl_static>::coordinates_no_center) {
+        const auto idx_nl = *iter + coord;
+        if (!bnd.contains(idx_nl)) { continue; }
+        val = sup(val, vout[idx_nl]);
+      }
+      // clip by mask, inf for dilate / sup for erode
+      val = (sup(val, vmask[*iter]) == val) ? vmask[*iter] : val;
+      if (val != vout[*iter]) {
+        vout[*iter] = val;
+        changed = true;
+      }
+    }
+  }
+}
+
+template<poutre::se::Common_NL_SE nl_static> void CheckReconstruct3D()
+{
+  // border and interior pixels, long propagation paths
+  const std::vector<std::size_t> shape = { 7, 9, 11 };
+  poutre::details::image_t<poutre::pUINT8, 3> img_marker(shape);
+  poutre::details::image_t<poutre::pUINT8, 3> img_mask(shape);
+  poutre::details::image_t<poutre::pUINT8, 3> img_out(shape);
+  poutre::details::image_t<poutre::pUINT8, 3> img_ref(shape);
+  poutre::pINT32 seed = 3;
+  for (auto &val : img_mask) {
+    seed = (seed * 1103 + 12345) % 251;// NOLINT
+    val = static_cast<poutre::pUINT8>(seed);
+  }
+  const auto max_op = [](poutre::pUINT8 lhs, poutre::pUINT8 rhs) { return std::max(lhs, rhs); };
+  const auto min_op = [](poutre::pUINT8 lhs, poutre::pUINT8 rhs) { return std::min(lhs, rhs); };
+
+  std::fill(img_marker.begin(), img_marker.end(), poutre::pUINT8{ 0 });
+  img_marker.data()[0] = 255;// NOLINT
+  img_marker.data()[img_marker.size() / 2] = 200;// NOLINT
+  poutre::geo::details::t_Reconstruct(poutre::geo::reconstruction_type::dilate, img_marker, img_mask, nl_static, img_out);
+  poutre::details::t_ArithInf(img_marker, img_mask, img_ref);
+  NaiveReconstruct<nl_static>(img_mask, img_ref, max_op);
+  REQUIRE(std::equal(img_out.begin(), img_out.end(), img_ref.begin()));
+
+  std::fill(img_marker.begin(), img_marker.end(), poutre::pUINT8{ 255 });// NOLINT
+  img_marker.data()[img_marker.size() - 1] = 0;
+  poutre::geo::details::t_Reconstruct(poutre::geo::reconstruction_type::erode, img_marker, img_mask, nl_static, img_out);
+  poutre::details::t_ArithSup(img_marker, img_mask, img_ref);
+  NaiveReconstruct<nl_static>(img_mask, img_ref, min_op);
+  REQUIRE(std::equal(img_out.begin(), img_out.end(), img_ref.begin()));
+}
+}// namespace
+
+TEST_CASE("reconstruct 3D against naive geodesic dilate/erode", "[geodesy]")
+{
+  CheckReconstruct3D<poutre::se::Common_NL_SE::SESquare3D>();
+  CheckReconstruct3D<poutre::se::Common_NL_SE::SECross3D>();
+}
+
+TEST_CASE("reconstruct tiled against row major", "[geodesy]")
+{
+  using poutre::geo::reconstruction_type;
+  const auto check = [](const std::vector<std::size_t> &shape, poutre::se::Common_NL_SE nl, std::ptrdiff_t edge) {
+    auto img_marker = poutre::Create(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8);
+    auto img_mask = poutre::Create(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8);
+    auto img_ref = poutre::CloneGeometry(*img_marker);
+    auto img_back = poutre::CloneGeometry(*img_marker);
+    auto *marker = static_cast<poutre::pUINT8 *>(img_marker->GetVoidPtr());
+    auto *mask = static_cast<poutre::pUINT8 *>(img_mask->GetVoidPtr());
+    std::size_t size = 1;
+    for (const auto dim : shape) { size *= dim; }
+    poutre::pINT32 seed = 7;
+    for (std::size_t i = 0; i < size; ++i) {
+      seed = (seed * 1103 + 12345) % 251;// NOLINT
+      mask[i] = static_cast<poutre::pUINT8>(seed);
+      // few seeds, long propagation paths across tiles
+      marker[i] = (i % 97 == 0) ? poutre::pUINT8{ 255 } : poutre::pUINT8{ 0 };// NOLINT
+    }
+
+    auto tiled_marker = poutre::CreateTiled(
+      shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8, edge);
+    auto tiled_mask = poutre::CreateTiled(
+      shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8, edge);
+    auto tiled_out = poutre::CloneGeometry(*tiled_marker);
+    REQUIRE(tiled_out->GetTileEdge() == edge);
+    poutre::ConvertInto(*img_marker, *tiled_marker);
+    poutre::ConvertInto(*img_mask, *tiled_mask);
+
+    poutre::test::ScopedExecutionContext ctx;
+    for (const std::size_t threads : { 1, 4 }) {
+      ctx.Set(threads);
+      for (const auto rect_type : { reconstruction_type::dilate, reconstruction_type::erode }) {
+        poutre::geo::Reconstruction(rect_type, *img_marker, *img_mask, nl, *img_ref);
+        poutre::geo::Reconstruction(rect_type, *tiled_marker, *tiled_mask, nl, *tiled_out);
+        poutre::ConvertInto(*tiled_out, *img_back);
+        REQUIRE(poutre::ImageToString(*img_back) == poutre::ImageToString(*img_ref));
+      }
+    }
+  };
+  check({ 37, 53 }, poutre::se::Common_NL_SE::SESquare2D, 8);// NOLINT
+  check({ 37, 53 }, poutre::se::Common_NL_SE::SECross2D, 5);// NOLINT
+  check({ 9, 13, 17 }, poutre::se::Common_NL_SE::SESquare3D, 4);// NOLINT
+  check({ 9, 13, 17 }, poutre::se::Common_NL_SE::SECross3D, 5);// NOLINT
+
+  // mixing tiled and row major images is refused
+  const std::vector<std::size_t> shape{ 8, 8 };
+  auto img = poutre::Create(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8);
+  auto tiled =
+    poutre::CreateTiled(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8, 4);
+  REQUIRE_THROWS_WITH(
+    poutre::geo::Reconstruction(reconstruction_type::dilate, *img, *img, poutre::se::Common_NL_SE::SESquare2D, *tiled),
+    Catch::Matchers::ContainsSubstring("tiled alike"));
+}
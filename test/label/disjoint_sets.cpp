@@ -0,0 +1,60 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <cstddef>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/label/details/label_t.hpp>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE("union by min and flatten", "[disjoint_sets]")
+{
+  poutre::label::details::disjoint_min_sets sets(100);// NOLINT
+  for (std::size_t i = 0; i < 8; ++i) { REQUIRE(sets.get_new_label() == i); }// NOLINT
+  REQUIRE(sets.union_sets(5, 2) == 2);
+  REQUIRE(sets.union_sets(7, 5) == 2);
+  REQUIRE(sets.union_sets(4, 6) == 4);
+  REQUIRE(sets.union_sets(6, 1) == 1);
+  REQUIRE(sets.find_root(7) == 2);
+  REQUIRE(sets.find_root(6) == 1);
+
+  // sets {0} {1,4,6} {2,5,7} {3}
+  REQUIRE(sets.flatten() == 4);
+  const std::vector<std::size_t> expected = { 1, 2, 3, 4, 2, 3, 2, 3 };
+  for (std::size_t i = 0; i < expected.size(); ++i) { REQUIRE(sets.label(i) == expected[i]); }
+}
+
+TEST_CASE("long chains", "[disjoint_sets]")
+{
+  // deep chain, find must not recurse
+  const std::size_t size = 1'000'000;
+  poutre::label::details::disjoint_min_sets sets(size);
+  for (std::size_t i = 0; i < size; ++i) { sets.get_new_label(i + 1); }
+  // link each root to the next one, parents[i] = i - 1 without compression
+  for (std::size_t i = size - 1; i > 0; --i) { sets.parents[i] = i - 1; }
+  REQUIRE(sets.find_root(size - 1) == 0);
+  REQUIRE(sets.flatten() == 1);
+  REQUIRE(sets.label(size - 1) == 1);
+}
+
+TEST_CASE("concurrent union by min and flatten", "[disjoint_sets]")
+{
+  poutre::label::details::concurrent_disjoint_min_sets sets(8);// NOLINT
+  REQUIRE(sets.union_sets(5, 2) == 2);
+  REQUIRE(sets.union_sets(7, 5) == 2);
+  REQUIRE(sets.union_sets(4, 6) == 4);
+  REQUIRE(sets.union_sets(6, 1) == 1);
+  REQUIRE(sets.flatten() == 4);
+  const std::vector<std::size_t> expected = { 1, 2, 3, 4, 2, 3, 2, 3 };
+  for (std::size_t i = 0; i < expected.size(); ++i) { REQUIRE(sets.label(i) == expected[i]); }
+}
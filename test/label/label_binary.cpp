@@ -11,18 +11,110 @@
 //==============================================================================
 
 #include "poutre/label/label_binary.hpp"
+#include "test_helpers.hpp"
 
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/image_interface.hpp>
+#include <poutre/label/label_statistics.hpp>
 #include <poutre/pixel_processing/copy_convert.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <memory>
+#include <random>
 #include <string>
+#include <vector>
+
+namespace {
+template<ptrdiff_t Rank>
+void CheckParallelLabelBinary(const std::vector<std::size_t> &shape,
+  poutre::se::Common_NL_SE nl_static,
+  std::size_t density_percent = 40)// NOLINT
+{
+  poutre::details::image_t<poutre::pUINT8, Rank> img(shape);
+  poutre::details::image_t<poutre::pINT32, Rank> img32(shape);
+  std::mt19937 gen(42);// NOLINT
+  for (std::size_t i = 0; i < img.size(); ++i) {
+    // pseudo random foreground, components crossing blocks borders
+    img[i] = static_cast<poutre::pUINT8>(gen() % 100U < density_percent ? 1 : 0);// NOLINT
+    img32[i] = img[i];
+  }
+  poutre::details::image_t<poutre::pINT64, Rank> serial_out(shape);
+  poutre::details::image_t<poutre::pINT64, Rank> parallel_out(shape);
+  poutre::details::image_t<poutre::pINT64, Rank> generic_out(shape);
+
+  poutre::test::ScopedExecutionContext ctx;
+  ctx.Set(1);
+  const auto serial_nb = poutre::label::label_binary(img, nl_static, serial_out);
+  // pINT32 never goes through the 2D run based kernel
+  const auto generic_nb = poutre::label::label_binary(img32, nl_static, generic_out);
+  ctx.Set(4, poutre::test::small_grain);// force split in many slabs
+  const auto parallel_nb = poutre::label::label_binary(img, nl_static, parallel_out);
+
+  REQUIRE(serial_nb > 0);
+  REQUIRE(parallel_nb == serial_nb);
+  REQUIRE(generic_nb == serial_nb);
+  std::size_t nb_diff = 0;
+  for (std::size_t i = 0; i < img.size(); ++i) {
+    if (serial_out[i] != parallel_out[i] || serial_out[i] != generic_out[i]) { ++nb_diff; }
+  }
+  REQUIRE(nb_diff == 0);
+}
+//! compare statistics gathered while labelling with a naive pass over labels
+template<typename Tin, ptrdiff_t Rank>
+void CheckLabelStatistics(const std::vector<std::size_t> &shape,
+  poutre::se::Common_NL_SE nl_static,
+  std::size_t nbthreads_labelling)
+{
+  poutre::details::image_t<Tin, Rank> img(shape);
+  std::mt19937 gen(7);// NOLINT
+  for (std::size_t i = 0; i < img.size(); ++i) {
+    img[i] = static_cast<Tin>(gen() % 100U < 30U ? 1 + gen() % 200U : 0);// NOLINT
+  }
+  poutre::details::image_t<poutre::pINT64, Rank> out(shape);
+
+  poutre::test::ScopedExecutionContext ctx;
+  ctx.Set(nbthreads_labelling, poutre::test::small_grain);// force split in many slabs
+  poutre::label::LabelStatistics stats;
+  const auto nb_labels = poutre::label::label_binary(img, nl_static, out, stats);
+
+  REQUIRE(nb_labels > 0);
+  REQUIRE(stats.size() == nb_labels);
+  REQUIRE(stats.rank == Rank);
+
+  poutre::label::LabelStatistics expected;
+  expected.reset(Rank, nb_labels);
+  auto vout = view(out);
+  auto vin = view(img);
+  const auto bound = vout.bound();
+  for (auto it = begin(bound); it != end(bound); ++it) {
+    const auto label = static_cast<std::size_t>(vout[*it]);
+    if (label != 0) { expected.add_pixel(label, *it, static_cast<double>(vin[*it])); }
+  }
+  expected.finalize();
+
+  REQUIRE(stats.area == expected.area);
+  REQUIRE(stats.bbox_min == expected.bbox_min);
+  REQUIRE(stats.bbox_max == expected.bbox_max);
+  REQUIRE(stats.first_pixel == expected.first_pixel);
+  REQUIRE(stats.sum == expected.sum);
+  REQUIRE(stats.min == expected.min);
+  REQUIRE(stats.max == expected.max);
+  std::size_t nb_diff = 0;
+  for (std::size_t i = 0; i < stats.centroid.size(); ++i) {
+    if (std::abs(stats.centroid[i] - expected.centroid[i]) > 1E-9) { ++nb_diff; }// NOLINT
+  }
+  REQUIRE(nb_diff == 0);
+}
+}// namespace
 
 TEST_CASE("label_binary 2D SESquare2D", "[label]")
 {
@@ -147,3 +239,58 @@ TEST_CASE("label_binary 2D SESquare2D labels blobs", "[label]")
   const auto img_str = poutre::ImageToString(*img_out);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
 }
+
+TEST_CASE("label_binary parallel blocks same labels as serial", "[label]")
+{
+  CheckParallelLabelBinary<2>({ 67, 53 }, poutre::se::Common_NL_SE::SESquare2D);// NOLINT
+  CheckParallelLabelBinary<2>({ 67, 53 }, poutre::se::Common_NL_SE::SECross2D);// NOLINT
+  CheckParallelLabelBinary<2>({ 67, 53 }, poutre::se::Common_NL_SE::SESegmentY2D);// NOLINT
+  // sparse masks, long background runs
+  CheckParallelLabelBinary<2>({ 71, 259 }, poutre::se::Common_NL_SE::SESquare2D, 3);// NOLINT
+  CheckParallelLabelBinary<2>({ 71, 259 }, poutre::se::Common_NL_SE::SECross2D, 3);// NOLINT
+  // dense masks, long foreground runs
+  CheckParallelLabelBinary<2>({ 71, 259 }, poutre::se::Common_NL_SE::SESquare2D, 85);// NOLINT
+  CheckParallelLabelBinary<3>({ 13, 11, 9 }, poutre::se::Common_NL_SE::SESquare3D);// NOLINT
+  CheckParallelLabelBinary<3>({ 13, 11, 9 }, poutre::se::Common_NL_SE::SECross3D);// NOLINT
+}
+
+TEST_CASE("label_binary statistics", "[label]")
+{
+  // run based kernel
+  CheckLabelStatistics<poutre::pUINT8, 2>({ 67, 53 }, poutre::se::Common_NL_SE::SESquare2D, 1);// NOLINT
+  CheckLabelStatistics<poutre::pUINT8, 2>({ 67, 53 }, poutre::se::Common_NL_SE::SECross2D, 4);// NOLINT
+  // generic kernel
+  CheckLabelStatistics<poutre::pINT32, 2>({ 67, 53 }, poutre::se::Common_NL_SE::SESquare2D, 1);// NOLINT
+  CheckLabelStatistics<poutre::pINT32, 2>({ 67, 53 }, poutre::se::Common_NL_SE::SESquare2D, 4);// NOLINT
+  CheckLabelStatistics<poutre::pUINT8, 3>({ 13, 11, 9 }, poutre::se::Common_NL_SE::SECross3D, 4);// NOLINT
+}
+
+TEST_CASE("label_binary binpack", "[label]")
+{
+  const auto check = [](const std::vector<std::size_t> &shape, poutre::se::Common_NL_SE nl_static) {
+    poutre::details::image_t<poutre::pUINT8> img(shape);
+    std::mt19937 gen(5);// NOLINT
+    for (auto &val : img) { val = static_cast<poutre::pUINT8>(gen() % 100U < 45U ? 1 : 0); }// NOLINT
+    poutre::details::image_t<poutre::pBinPack> packed(shape);
+    poutre::details::t_PackBinary(img, packed);
+
+    poutre::details::image_t<poutre::pINT64> ref(shape);
+    poutre::details::image_t<poutre::pINT64> out(shape);
+    poutre::label::LabelStatistics ref_stats;
+    poutre::label::LabelStatistics stats;
+    const auto ref_nb = poutre::label::label_binary(img, nl_static, ref, ref_stats);
+    const auto nb = poutre::label::label_binary(packed, nl_static, out, stats);
+    REQUIRE(nb == ref_nb);
+    REQUIRE(std::equal(ref.begin(), ref.end(), out.begin()));
+    REQUIRE(stats.area == ref_stats.area);
+    REQUIRE(stats.bbox_min == ref_stats.bbox_min);
+    REQUIRE(stats.bbox_max == ref_stats.bbox_max);
+    REQUIRE(stats.sum == ref_stats.sum);
+  };
+  for (const std::size_t xsize : { 1, 63, 64, 65, 259 }) {// NOLINT
+    check({ 31, xsize }, poutre::se::Common_NL_SE::SESquare2D);// NOLINT
+    check({ 31, xsize }, poutre::se::Common_NL_SE::SECross2D);// NOLINT
+    // not run based, unpacked
+    check({ 31, xsize }, poutre::se::Common_NL_SE::SESegmentY2D);// NOLINT
+  }
+}
@@ -11,17 +11,23 @@
 //==============================================================================
 
 #include "poutre/label/label_flat_zones.hpp"
+#include "test_helpers.hpp"
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/pixel_processing/copy_convert.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <random>
 #include <string>
+#include <vector>
 
 TEST_CASE("label_flat_zones 2D SESquare2D", "[label]")
 {
@@ -84,3 +90,26 @@ TEST_CASE("label_flat_zones 2D SESquare2D empty image", "[label]")
   const auto img_str = poutre::ImageToString(*img_out);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
 }
+
+TEST_CASE("label_flat_zones parallel blocks same labels as serial", "[label]")
+{
+  const std::vector<std::size_t> shape = { 15, 12, 10 };
+  poutre::details::image_t<poutre::pINT32, 3> img(shape);
+  std::mt19937 gen(42);// NOLINT
+  for (std::size_t i = 0; i < img.size(); ++i) { img[i] = static_cast<poutre::pINT32>(gen() % 3U); }
+  poutre::details::image_t<poutre::pINT64, 3> serial_out(shape);
+  poutre::details::image_t<poutre::pINT64, 3> parallel_out(shape);
+
+  poutre::test::ScopedExecutionContext ctx;
+  ctx.Set(1);
+  const auto serial_nb = poutre::label::label_flat_zones(img, poutre::se::Common_NL_SE::SESquare3D, serial_out);
+  ctx.Set(4, poutre::test::small_grain);// force split in many slabs
+  const auto parallel_nb = poutre::label::label_flat_zones(img, poutre::se::Common_NL_SE::SESquare3D, parallel_out);
+
+  REQUIRE(parallel_nb == serial_nb);
+  std::size_t nb_diff = 0;
+  for (std::size_t i = 0; i < img.size(); ++i) {
+    if (serial_out[i] != parallel_out[i]) { ++nb_diff; }
+  }
+  REQUIRE(nb_diff == 0);
+}
@@ -0,0 +1,87 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include "test_helpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/image_interface.hpp>
+#include <poutre/base/types.hpp>
+#include <poutre/low_level_morpho/ero_dil.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+//! packed erosion/dilation must match the pUINT8 one, pixel per pixel
+template<std::ptrdiff_t Rank>
+void CheckBinPack(const std::vector<std::size_t> &shape, poutre::se::Common_NL_SE nl_static, int iter = 1)
+{
+  poutre::details::image_t<poutre::pUINT8, Rank> img(shape);
+  poutre::details::image_t<poutre::pBinPack, Rank> packed(shape);
+  poutre::details::image_t<poutre::pUINT8, Rank> ref(shape);
+  poutre::details::image_t<poutre::pBinPack, Rank> packed_out(shape);
+  poutre::details::image_t<poutre::pUINT8, Rank> unpacked(shape);
+  std::mt19937 gen(3);// NOLINT
+
+  // sparse and dense masks, large SEs would saturate a balanced one
+  for (const unsigned density_percent : { 10U, 60U, 90U }) {// NOLINT
+    for (auto &val : img) { val = static_cast<poutre::pUINT8>(gen() % 100U < density_percent ? 1 : 0); }// NOLINT
+    poutre::details::t_PackBinary(img, packed);
+    poutre::test::ForEachThreading([&] {
+      poutre::Erode(img, nl_static, iter, ref);
+      poutre::Erode(packed, nl_static, iter, packed_out);
+      poutre::details::t_UnpackBinary(packed_out, unpacked);
+      REQUIRE(poutre::test::SameImages(ref, unpacked));
+
+      poutre::Dilate(img, nl_static, iter, ref);
+      poutre::Dilate(packed, nl_static, iter, packed_out);
+      poutre::details::t_UnpackBinary(packed_out, unpacked);
+      REQUIRE(poutre::test::SameImages(ref, unpacked));
+      // padding bits stay cleared after the word shifts
+      for (std::ptrdiff_t line = 0; line < packed_out.nb_lines(); ++line) {
+        REQUIRE((packed_out.GetLineWords(line)[packed_out.words_per_line() - 1] & ~packed_out.tail_mask()) == 0);
+      }
+    });
+  }
+}
+}// namespace
+
+TEST_CASE("erode dilate binpack 1D", "[low_level_morpho]")
+{
+  for (const std::size_t xsize : { 1, 63, 64, 65, 130, 1000 }) {// NOLINT
+    CheckBinPack<1>({ xsize }, poutre::se::Common_NL_SE::SESegmentX1D);
+  }
+}
+
+TEST_CASE("erode dilate binpack 2D", "[low_level_morpho]")
+{
+  for (const std::size_t xsize : { 1, 63, 64, 65, 130 }) {// NOLINT
+    CheckBinPack<2>({ 37, xsize }, poutre::se::Common_NL_SE::SESquare2D);// NOLINT
+    CheckBinPack<2>({ 37, xsize }, poutre::se::Common_NL_SE::SECross2D);// NOLINT
+    CheckBinPack<2>({ 37, xsize }, poutre::se::Common_NL_SE::SESegmentX2D);// NOLINT
+    CheckBinPack<2>({ 37, xsize }, poutre::se::Common_NL_SE::SESegmentY2D);// NOLINT
+  }
+  // iterated square stays on the packed path
+  CheckBinPack<2>({ 41, 200 }, poutre::se::Common_NL_SE::SESquare2D, 5);// NOLINT
+  CheckBinPack<2>({ 41, 200 }, poutre::se::Common_NL_SE::SECross2D, 3);// NOLINT
+}
+
+TEST_CASE("erode dilate binpack 3D", "[low_level_morpho]")
+{
+  CheckBinPack<3>({ 7, 9, 65 }, poutre::se::Common_NL_SE::SECross3D);// NOLINT
+  CheckBinPack<3>({ 7, 9, 65 }, poutre::se::Common_NL_SE::SESquare3D);// NOLINT
+  CheckBinPack<3>({ 7, 9, 65 }, poutre::se::Common_NL_SE::SESegmentZ3D);// NOLINT
+}
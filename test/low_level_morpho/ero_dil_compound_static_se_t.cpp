@@ -0,0 +1,185 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <poutre/base/buffer_pool.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/mapped_file.hpp>
+#include <poutre/base/types.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_compound_static_se_t.hpp>
+#include <poutre/low_level_morpho/ero_dil.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+poutre::details::image_t<poutre::pINT32> RandomImage(std::size_t ysize, std::size_t xsize)
+{
+  poutre::details::image_t<poutre::pINT32> img({ ysize, xsize });
+  std::mt19937 gen(3);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 100);
+  for (std::size_t i = 0; i < img.size(); ++i) { img[i] = dist(gen); }
+  return img;
+}
+
+// octagon as size-nb_square crosses then nb_square squares
+template<bool IsErosion>
+void IteratedOctagon(const poutre::details::image_t<poutre::pINT32> &imgin,
+  int size,
+  poutre::details::image_t<poutre::pINT32> &imgout)
+{
+  const double nb_square_dbl = static_cast<double>(size) / (1 + std::sqrt(2.));
+  const int nb_square = static_cast<int>(std::lround(nb_square_dbl));
+  poutre::details::image_t<poutre::pINT32> tmp(imgin.GetShape());
+  std::copy(imgin.cbegin(), imgin.cend(), imgout.begin());
+  for (int i = 0; i < size; ++i) {
+    const auto nl = i < size - nb_square ? poutre::se::Common_NL_SE::SECross2D : poutre::se::Common_NL_SE::SESquare2D;
+    if constexpr (IsErosion) {
+      poutre::llm::details::t_Erode(imgout, nl, tmp);
+    } else {
+      poutre::llm::details::t_Dilate(imgout, nl, tmp);
+    }
+    imgout.swap(tmp);
+  }
+}
+
+// rhombicuboctahedron as size-nb_square 3D crosses then nb_square 3D squares
+template<bool IsErosion>
+void IteratedRhombicuboctahedron(const poutre::details::image_t<poutre::pINT32, 3> &imgin,
+  int size,
+  poutre::details::image_t<poutre::pINT32, 3> &imgout)
+{
+  const int nb_square = static_cast<int>(std::lround(static_cast<double>(size) / (1 + std::sqrt(2.))));
+  poutre::details::image_t<poutre::pINT32, 3> tmp(imgin.GetShape());
+  std::copy(imgin.cbegin(), imgin.cend(), imgout.begin());
+  for (int i = 0; i < size; ++i) {
+    const auto nl = i < size - nb_square ? poutre::se::Common_NL_SE::SECross3D : poutre::se::Common_NL_SE::SESquare3D;
+    if constexpr (IsErosion) {
+      poutre::llm::details::t_Erode(imgout, nl, tmp);
+    } else {
+      poutre::llm::details::t_Dilate(imgout, nl, tmp);
+    }
+    imgout.swap(tmp);
+  }
+}
+}// namespace
+
+TEST_CASE("octagon through periodic lines", "[low_level_morpho]")
+{
+  const auto imgin = RandomImage(23, 31);
+  poutre::details::image_t<poutre::pINT32> imgout(imgin.GetShape());
+  poutre::details::image_t<poutre::pINT32> imgref(imgin.GetShape());
+  for (int size = 1; size <= 9; ++size) {
+    poutre::llm::details::t_Erode(imgin, poutre::se::Compound_NL_SE::Octagon, size, imgout);
+    IteratedOctagon<true>(imgin, size, imgref);
+    REQUIRE(std::equal(imgout.begin(), imgout.end(), imgref.begin()));
+    poutre::llm::details::t_Dilate(imgin, poutre::se::Compound_NL_SE::Octagon, size, imgout);
+    IteratedOctagon<false>(imgin, size, imgref);
+    REQUIRE(std::equal(imgout.begin(), imgout.end(), imgref.begin()));
+  }
+}
+
+TEST_CASE("disk", "[low_level_morpho]")
+{
+  // dilation of a single point draws the SE
+  const std::ptrdiff_t size = 81;
+  const std::ptrdiff_t center = size / 2;
+  poutre::details::image_t<poutre::pUINT8> imgin({ static_cast<std::size_t>(size), static_cast<std::size_t>(size) });
+  std::fill(imgin.begin(), imgin.end(), poutre::pUINT8{ 0 });
+  imgin[static_cast<std::size_t>(center * size + center)] = 1;
+  poutre::details::image_t<poutre::pUINT8> imgout(imgin.GetShape());
+  poutre::details::image_t<poutre::pUINT8> imgero(imgin.GetShape());
+
+  for (const int radius : { 3, 10, 30 }) {
+    poutre::llm::details::t_Dilate(imgin, poutre::se::Compound_NL_SE::Disk, radius, imgout);
+    // small radius are exact, large ones within a pixel or two of the euclidean disk
+    const double tolerance = radius <= 4 ? 0. : 0.08 * radius;
+    bool inside_ok = true;
+    bool outside_ok = true;
+    for (std::ptrdiff_t y = 0; y < size; ++y) {
+      for (std::ptrdiff_t x = 0; x < size; ++x) {
+        const double dist = std::hypot(static_cast<double>(x - center), static_cast<double>(y - center));
+        const auto val = imgout[static_cast<std::size_t>(y * size + x)];
+        if (dist <= radius - tolerance && val != 1) { inside_ok = false; }
+        if (dist > radius + tolerance && val != 0) { outside_ok = false; }
+      }
+    }
+    REQUIRE(inside_ok);
+    REQUIRE(outside_ok);
+    // disk is symmetric, eroding the drawn disk by itself gives back the point
+    poutre::llm::details::t_Erode(imgout, poutre::se::Compound_NL_SE::Disk, radius, imgero);
+    REQUIRE(std::equal(imgero.begin(), imgero.end(), imgin.begin()));
+  }
+}
+
+TEST_CASE("rhombicuboctahedron writes into the output buffer", "[low_level_morpho]")
+{
+  poutre::details::image_t<poutre::pINT32, 3> imgin({ 9, 11, 13 });
+  std::mt19937 gen(7);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 100);
+  for (std::size_t i = 0; i < imgin.size(); ++i) { imgin[i] = dist(gen); }
+  poutre::details::image_t<poutre::pINT32, 3> imgout(imgin.GetShape());
+  poutre::details::image_t<poutre::pINT32, 3> imgref(imgin.GetShape());
+  const auto *out_data = imgout.data();
+
+  auto &pool = poutre::BufferPool::get();
+  pool.Trim();
+  pool.ResetStats();
+  // odd and even number of passes
+  for (int size = 2; size <= 5; ++size) {
+    poutre::llm::details::t_Erode(imgin, poutre::se::Compound_NL_SE::Rhombicuboctahedron, size, imgout);
+    IteratedRhombicuboctahedron<true>(imgin, size, imgref);
+    REQUIRE(std::equal(imgout.begin(), imgout.end(), imgref.begin()));
+    poutre::llm::details::t_Dilate(imgin, poutre::se::Compound_NL_SE::Rhombicuboctahedron, size, imgout);
+    IteratedRhombicuboctahedron<false>(imgin, size, imgref);
+    REQUIRE(std::equal(imgout.begin(), imgout.end(), imgref.begin()));
+    // caller storage kept, pooled temporaries all given back
+    REQUIRE(imgout.data() == out_data);
+    REQUIRE(imgout.IsOwner());
+    const auto stats = pool.GetStats();
+    REQUIRE(stats.releases == stats.local_hits + stats.global_hits + stats.misses);
+  }
+}
+
+TEST_CASE("rhombicuboctahedron into a mapped output", "[low_level_morpho]")
+{
+  const std::vector<std::size_t> shape{ 7, 9, 11 };
+  poutre::details::image_t<poutre::pINT32, 3> imgin(shape);
+  std::mt19937 gen(11);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 100);
+  for (std::size_t i = 0; i < imgin.size(); ++i) { imgin[i] = dist(gen); }
+  poutre::details::image_t<poutre::pINT32, 3> imgref(shape);
+
+  const auto path = (std::filesystem::temp_directory_path() / "poutre_mapped_rhombicuboctahedron.bin").string();
+  // odd and even number of passes
+  for (int size = 2; size <= 3; ++size) {
+    {
+      auto mapped = poutre::CreateMappedImage(
+        path, shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayINT32);
+      poutre::Dilate(imgin, poutre::se::Compound_NL_SE::Rhombicuboctahedron, size, *mapped);
+    }
+    poutre::llm::details::t_Dilate(imgin, poutre::se::Compound_NL_SE::Rhombicuboctahedron, size, imgref);
+    // results went to the file
+    auto reopened = poutre::MapImage(path, poutre::MapAccess::ReadOnly);
+    const auto *typed = dynamic_cast<const poutre::details::image_t<poutre::pINT32, 3> *>(reopened.get());
+    REQUIRE(typed != nullptr);
+    REQUIRE(std::equal(imgref.begin(), imgref.end(), typed->data()));
+  }
+  std::error_code err;
+  std::filesystem::remove(path, err);
+}
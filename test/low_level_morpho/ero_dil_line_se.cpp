@@ -10,15 +10,26 @@
 //                     http://www.boost.org/LICENSE_1_0.txt                   //
 //==============================================================================
 
+#include "test_helpers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/types.hpp>
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <poutre/low_level_morpho/details/ero_dil_line_se_t.hpp>
+#include <poutre/low_level_morpho/ero_dil.hpp>
+#include <poutre/low_level_morpho/ero_dil_line.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+#include <numbers>
+#include <random>
+#include <utility>
 #include <string>
 #include <vector>
 
@@ -167,4 +178,232 @@ TEST_CASE("erodeY 2D", "[low_level_morpho]")
  0 0 0 0 0";
   const auto img_str = poutre::ImageToString(img_out);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
-}
\ No newline at end of file
+}
+
+namespace {
+// brute force erosion/dilation along dim (0:y, 1:x) at (y,x)
+template<typename T>
+std::pair<T, T> RefLine(const poutre::details::image_t<T> &img,
+  std::ptrdiff_t ysize,
+  std::ptrdiff_t xsize,
+  std::ptrdiff_t y,
+  std::ptrdiff_t x,
+  std::ptrdiff_t k,
+  int dim)
+{
+  T vmin = img[static_cast<std::size_t>(y * xsize + x)];
+  T vmax = vmin;
+  const std::ptrdiff_t pos = dim == 0 ? y : x;
+  const std::ptrdiff_t size = dim == 0 ? ysize : xsize;
+  for (std::ptrdiff_t p = std::max<std::ptrdiff_t>(pos - k, 0); p <= std::min(pos + k, size - 1); ++p) {
+    const auto offset = dim == 0 ? p * xsize + x : y * xsize + p;
+    const auto val = img[static_cast<std::size_t>(offset)];
+    vmin = std::min(vmin, val);
+    vmax = std::max(vmax, val);
+  }
+  return { vmin, vmax };
+}
+
+// erosion/dilation along x and y against brute force on non square images, several row blocks/column strips and
+// segments longer than image
+template<typename T> void CheckLines(std::ptrdiff_t ysize, std::ptrdiff_t xsize)
+{
+  const std::vector<std::size_t> shape = { static_cast<std::size_t>(ysize), static_cast<std::size_t>(xsize) };
+  std::mt19937 gen(42);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 100);
+  poutre::details::image_t<T> imgin(shape);
+  for (std::size_t i = 0; i < imgin.size(); ++i) { imgin[i] = static_cast<T>(dist(gen)); }
+  poutre::details::image_t<T> imgero(shape);
+  poutre::details::image_t<T> imgdil(shape);
+  for (const int dim : { 0, 1 }) {
+    for (const std::ptrdiff_t k : { 1, 3, 20, 40, 100 }) {
+      if (dim == 0) {
+        poutre::llm::details::t_ErodeY(imgin, k, imgero);
+        poutre::llm::details::t_DilateY(imgin, k, imgdil);
+      } else {
+        poutre::llm::details::t_ErodeX(imgin, k, imgero);
+        poutre::llm::details::t_DilateX(imgin, k, imgdil);
+      }
+      bool ok = true;
+      for (std::ptrdiff_t y = 0; y < ysize && ok; ++y) {
+        for (std::ptrdiff_t x = 0; x < xsize; ++x) {
+          const auto [vmin, vmax] = RefLine(imgin, ysize, xsize, y, x, k, dim);
+          if (imgero[static_cast<std::size_t>(y * xsize + x)] != vmin
+              || imgdil[static_cast<std::size_t>(y * xsize + x)] != vmax) {
+            ok = false;
+            break;
+          }
+        }
+      }
+      REQUIRE(ok);
+    }
+  }
+}
+}// namespace
+
+TEST_CASE("erode dilate lines non square", "[low_level_morpho]")
+{
+  poutre::test::ForEachThreading([] {
+    CheckLines<poutre::pUINT8>(67, 1030);
+    CheckLines<poutre::pINT32>(67, 1030);
+    CheckLines<poutre::pFLOAT>(1030, 67);
+    CheckLines<poutre::pINT64>(67, 1030);
+    CheckLines<poutre::pDOUBLE>(5, 211);
+  });
+}
+
+TEST_CASE("erode dilate rectangle", "[low_level_morpho]")
+{
+  const std::ptrdiff_t ysize = 41;
+  const std::ptrdiff_t xsize = 57;
+  const std::vector<std::size_t> shape = { static_cast<std::size_t>(ysize), static_cast<std::size_t>(xsize) };
+  std::mt19937 gen(7);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 100);
+  poutre::details::image_t<poutre::pINT32> imgin(shape);
+  for (std::size_t i = 0; i < imgin.size(); ++i) { imgin[i] = dist(gen); }
+  poutre::details::image_t<poutre::pINT32> imgero(shape);
+  poutre::details::image_t<poutre::pINT32> imgdil(shape);
+
+  const std::ptrdiff_t half_x = 6;
+  const std::ptrdiff_t half_y = 2;
+  poutre::ErodeRect(imgin, half_x, half_y, imgero);
+  poutre::DilateRect(imgin, half_x, half_y, imgdil);
+  bool ok = true;
+  for (std::ptrdiff_t y = 0; y < ysize; ++y) {
+    for (std::ptrdiff_t x = 0; x < xsize; ++x) {
+      auto vmin = imgin[static_cast<std::size_t>(y * xsize + x)];
+      auto vmax = vmin;
+      for (std::ptrdiff_t yy = std::max<std::ptrdiff_t>(y - half_y, 0); yy <= std::min(y + half_y, ysize - 1); ++yy) {
+        for (std::ptrdiff_t xx = std::max<std::ptrdiff_t>(x - half_x, 0); xx <= std::min(x + half_x, xsize - 1);
+             ++xx) {
+          vmin = std::min(vmin, imgin[static_cast<std::size_t>(yy * xsize + xx)]);
+          vmax = std::max(vmax, imgin[static_cast<std::size_t>(yy * xsize + xx)]);
+        }
+      }
+      ok = ok && imgero[static_cast<std::size_t>(y * xsize + x)] == vmin
+           && imgdil[static_cast<std::size_t>(y * xsize + x)] == vmax;
+    }
+  }
+  REQUIRE(ok);
+
+  // large square iterations go through the rectangle decomposition, must match iterated 3x3
+  const int iter = 7;
+  poutre::details::image_t<poutre::pINT32> imgiter(shape);
+  poutre::details::image_t<poutre::pINT32> imgtmp(shape);
+  poutre::Erode(imgin, poutre::se::Common_NL_SE::SESquare2D, iter, imgero);
+  poutre::Erode(imgin, poutre::se::Common_NL_SE::SESquare2D, 1, imgiter);
+  for (int i = 1; i < iter; ++i) {
+    poutre::Erode(imgiter, poutre::se::Common_NL_SE::SESquare2D, 1, imgtmp);
+    imgiter.swap(imgtmp);
+  }
+  REQUIRE(std::equal(imgero.begin(), imgero.end(), imgiter.begin()));
+  poutre::Dilate(imgin, poutre::se::Common_NL_SE::SESquare2D, iter, imgdil);
+  poutre::Dilate(imgin, poutre::se::Common_NL_SE::SESquare2D, 1, imgiter);
+  for (int i = 1; i < iter; ++i) {
+    poutre::Dilate(imgiter, poutre::se::Common_NL_SE::SESquare2D, 1, imgtmp);
+    imgiter.swap(imgtmp);
+  }
+  REQUIRE(std::equal(imgdil.begin(), imgdil.end(), imgiter.begin()));
+}
+
+namespace {
+// random ysize x xsize image
+template<typename T> poutre::details::image_t<T> RandomImage(std::ptrdiff_t ysize, std::ptrdiff_t xsize)
+{
+  poutre::details::image_t<T> img({ static_cast<std::size_t>(ysize), static_cast<std::size_t>(xsize) });
+  std::mt19937 gen(11);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 100);
+  for (std::size_t i = 0; i < img.size(); ++i) { img[i] = static_cast<T>(dist(gen)); }
+  return img;
+}
+
+// brute force erosion/dilation, se(x,y) fills (dx,dy) offsets of the SE at pixel (x,y), outside pixels are ignored
+template<typename T, class SE>
+bool CheckAgainstBruteForce(const poutre::details::image_t<T> &imgin,
+  const poutre::details::image_t<T> &imgero,
+  const poutre::details::image_t<T> &imgdil,
+  SE se)
+{
+  const auto shape = imgin.shape();
+  const std::ptrdiff_t ysize = shape[0];
+  const std::ptrdiff_t xsize = shape[1];
+  std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> points;
+  for (std::ptrdiff_t y = 0; y < ysize; ++y) {
+    for (std::ptrdiff_t x = 0; x < xsize; ++x) {
+      points.clear();
+      se(x, y, points);
+      auto vmin = imgin[static_cast<std::size_t>(y * xsize + x)];
+      auto vmax = vmin;
+      for (const auto &[px, py] : points) {
+        if (px < 0 || px >= xsize || py < 0 || py >= ysize) continue;
+        vmin = std::min(vmin, imgin[static_cast<std::size_t>(py * xsize + px)]);
+        vmax = std::max(vmax, imgin[static_cast<std::size_t>(py * xsize + px)]);
+      }
+      if (imgero[static_cast<std::size_t>(y * xsize + x)] != vmin) { return false; }
+      if (imgdil[static_cast<std::size_t>(y * xsize + x)] != vmax) { return false; }
+    }
+  }
+  return true;
+}
+}// namespace
+
+TEST_CASE("erode dilate periodic lines", "[low_level_morpho]")
+{
+  const auto imgin = RandomImage<poutre::pINT32>(37, 53);
+  poutre::details::image_t<poutre::pINT32> imgero(imgin.GetShape());
+  poutre::details::image_t<poutre::pINT32> imgdil(imgin.GetShape());
+  const std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> steps = {
+    { 1, 0 }, { 0, 1 }, { 1, 1 }, { 1, -1 }, { 2, 1 }, { -1, 2 }, { 3, 0 }, { 0, -2 }
+  };
+  poutre::test::ForEachThreading([&] {
+    for (const auto &[dx, dy] : steps) {
+      for (const std::ptrdiff_t h : { 1, 4, 40 }) {
+        poutre::llm::details::t_ErodePeriodicLine(imgin, dx, dy, h, imgero);
+        poutre::llm::details::t_DilatePeriodicLine(imgin, dx, dy, h, imgdil);
+        REQUIRE(CheckAgainstBruteForce(imgin, imgero, imgdil, [&](auto x, auto y, auto &points) {
+          for (std::ptrdiff_t i = -h; i <= h; ++i) { points.emplace_back(x + i * dx, y + i * dy); }
+        }));
+      }
+    }
+  });
+}
+
+TEST_CASE("erode dilate bresenham lines", "[low_level_morpho]")
+{
+  const auto imgin = RandomImage<poutre::pUINT8>(37, 53);
+  poutre::details::image_t<poutre::pUINT8> imgero(imgin.GetShape());
+  poutre::details::image_t<poutre::pUINT8> imgdil(imgin.GetShape());
+  poutre::details::image_t<poutre::pUINT8> imgref(imgin.GetShape());
+  const std::ptrdiff_t h = 5;
+
+  // axis aligned angles are plain X/Y segments
+  poutre::llm::details::t_ErodeLine(imgin, 0., h, imgero);
+  poutre::llm::details::t_ErodeX(imgin, h, imgref);
+  REQUIRE(std::equal(imgero.begin(), imgero.end(), imgref.begin()));
+  poutre::llm::details::t_DilateLine(imgin, 90., h, imgdil);
+  poutre::llm::details::t_DilateY(imgin, h, imgref);
+  REQUIRE(std::equal(imgdil.begin(), imgdil.end(), imgref.begin()));
+
+  for (const double angle : { 30., 45., -20., 70., 135., 160. }) {
+    poutre::llm::details::t_ErodeLine(imgin, angle, h, imgero);
+    poutre::llm::details::t_DilateLine(imgin, angle, h, imgdil);
+    const double radian = angle * std::numbers::pi / 180.;
+    const bool shallow = std::abs(std::cos(radian)) >= std::abs(std::sin(radian));
+    const double slope = shallow ? std::tan(radian) : 1. / std::tan(radian);
+    auto offset = [&](std::ptrdiff_t i) {
+      return static_cast<std::ptrdiff_t>(std::lround(static_cast<double>(i) * slope));
+    };
+    REQUIRE(CheckAgainstBruteForce(imgin, imgero, imgdil, [&](auto x, auto y, auto &points) {
+      // pixel lies on line "line" of the family, SE is h pixels before and after along that line
+      const auto major = shallow ? x : y;
+      const auto line = (shallow ? y : x) - offset(major);
+      for (std::ptrdiff_t i = major - h; i <= major + h; ++i) {
+        if (shallow) {
+          points.emplace_back(i, line + offset(i));
+        } else {
+          points.emplace_back(line + offset(i), i);
+        }
+      }
+    }));
+  }
+}
@@ -0,0 +1,124 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include "test_helpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <poutre/base/details/data_structures/image_pitched_t.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/simd/simd_helpers.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/types.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_pitched_t.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
+#include <poutre/structuring_element/predefined_nl_se.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+//! pitched erosion/dilation must match the brute force one, borders included
+template<typename T, std::ptrdiff_t Rank>
+void CheckPitched(const std::vector<std::size_t> &shape,
+  const poutre::se::details::neighbor_list_t<Rank> &nl,
+  std::ptrdiff_t halo)
+{
+  poutre::details::image_t<T, Rank> img(shape);
+  poutre::details::image_t<T, Rank> ref(shape);
+  poutre::details::image_t<T, Rank> out(shape);
+  poutre::details::image_pitched_t<T, Rank> pitched(shape, halo);
+  poutre::test::FillRandom(img, 7);// NOLINT
+  pitched.CopyFrom(img);
+
+  poutre::test::ForEachThreading([&] {
+    poutre::test::NaiveErodeDilate(img, nl, true, ref);
+    poutre::llm::details::t_Erode(pitched, nl, out);
+    REQUIRE(poutre::test::SameImages(ref, out));
+
+    poutre::test::NaiveErodeDilate(img, nl, false, ref);
+    poutre::llm::details::t_Dilate(pitched, nl, out);
+    REQUIRE(poutre::test::SameImages(ref, out));
+  });
+
+  // valid region left untouched
+  pitched.CopyTo(out);
+  REQUIRE(poutre::test::SameImages(img, out));
+}
+}// namespace
+
+TEST_CASE("pitched layout", "[low_level_morpho]")
+{
+  poutre::details::image_pitched_t<poutre::pUINT8, 2> pitched({ 5, 13 }, 2);// NOLINT
+  REQUIRE(pitched.halo() == 2);
+  REQUIRE(pitched.lead() >= pitched.halo());
+  REQUIRE(pitched.pitch() >= pitched.lead() + 13 + 2);
+  REQUIRE(pitched.stride()[0] == pitched.pitch());
+  REQUIRE(pitched.stride()[1] == 1);
+  REQUIRE(pitched.nb_rows() == 5);
+  for (std::ptrdiff_t row = 0; row < pitched.nb_rows(); ++row) {
+    REQUIRE(reinterpret_cast<std::uintptr_t>(pitched.GetRow(row)) % SIMD_IDEAL_MAX_ALIGN_BYTES == 0);// NOLINT
+  }
+
+  poutre::details::image_t<poutre::pUINT8, 2> img({ 5, 13 });// NOLINT
+  for (std::size_t i = 0; i < img.size(); ++i) { img.data()[i] = static_cast<poutre::pUINT8>(i); }
+  pitched.CopyFrom(img);
+  pitched.FillHalo(255);// NOLINT
+  const auto valid = view(pitched);
+  REQUIRE(valid.size() == img.size());
+  REQUIRE(valid[{ 2, 3 }] == 2 * 13 + 3);// NOLINT
+  // neighbors within the halo read the fill value
+  REQUIRE(*(pitched.GetRow(0) - pitched.stride()[0]) == 255);// NOLINT
+  REQUIRE(*(pitched.GetRow(4) + 13 + 1) == 255);// NOLINT
+  REQUIRE(*(pitched.GetRow(2) - 2) == 255);// NOLINT
+}
+
+TEST_CASE("erode dilate pitched 2D", "[low_level_morpho]")
+{
+  for (const std::size_t xsize : { 1, 7, 31, 32, 33, 100 }) {// NOLINT
+    CheckPitched<poutre::pUINT8, 2>({ 23, xsize }, poutre::se::SESquare2D, 1);// NOLINT
+    CheckPitched<poutre::pUINT8, 2>({ 23, xsize }, poutre::se::SECross2D, 3);// NOLINT
+    CheckPitched<poutre::pINT32, 2>({ 23, xsize }, poutre::se::SESegmentY2D, 1);// NOLINT
+    CheckPitched<poutre::pFLOAT, 2>({ 23, xsize }, poutre::se::SESegmentX2D, 2);// NOLINT
+  }
+  poutre::details::image_pitched_t<poutre::pUINT8, 2> pitched({ 4, 4 }, 0);// NOLINT
+  poutre::details::image_t<poutre::pUINT8, 2> out({ 4, 4 });// NOLINT
+  REQUIRE_THROWS(poutre::llm::details::t_Erode(pitched, poutre::se::SESquare2D, out));
+}
+
+TEST_CASE("erode dilate pitched static se", "[low_level_morpho]")
+{
+  const std::vector<std::size_t> shape{ 9, 70 };
+  poutre::details::image_t<poutre::pINT16, 2> img(shape);
+  poutre::details::image_t<poutre::pINT16, 2> ref(shape);
+  poutre::details::image_t<poutre::pINT16, 2> out(shape);
+  poutre::details::image_pitched_t<poutre::pINT16, 2> pitched(shape, 1);
+  std::mt19937 gen(11);// NOLINT
+  for (auto &val : img) { val = static_cast<poutre::pINT16>(static_cast<int>(gen() % 2000U) - 1000); }// NOLINT
+  pitched.CopyFrom(img);
+
+  poutre::llm::details::t_Erode(img, poutre::se::SESquare2D, ref);
+  poutre::llm::details::t_Erode<poutre::se::Common_NL_SE::SESquare2D>(pitched, out);
+  REQUIRE(poutre::test::SameImages(ref, out));
+  poutre::llm::details::t_Dilate(img, poutre::se::SECross2D, ref);
+  poutre::llm::details::t_Dilate<poutre::se::Common_NL_SE::SECross2D>(pitched, out);
+  REQUIRE(poutre::test::SameImages(ref, out));
+}
+
+TEST_CASE("erode dilate pitched 1D 3D", "[low_level_morpho]")
+{
+  CheckPitched<poutre::pUINT8, 1>({ 77 }, poutre::se::SESegmentX1D, 1);// NOLINT
+  CheckPitched<poutre::pUINT8, 3>({ 5, 6, 40 }, poutre::se::SECross3D, 1);// NOLINT
+  CheckPitched<poutre::pDOUBLE, 3>({ 5, 6, 17 }, poutre::se::SESquare3D, 2);// NOLINT
+}
@@ -10,6 +10,8 @@
 //                     http://www.boost.org/LICENSE_1_0.txt                   //
 //==============================================================================
 
+#include "test_helpers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
@@ -21,6 +23,11 @@
 //#include <poutre/structuring_element/details/neighbor_list_static_se_t.hpp>
 #include <poutre/structuring_element/predefined_nl_se.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
+#include <poutre/low_level_morpho/ero_dil.hpp>
+#include <poutre/structuring_element/se_chained.hpp>
+#include <poutre/structuring_element/se_decomposition.hpp>
+#include <poutre/base/execution.hpp>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -641,4 +648,101 @@ TEST_CASE("erode cross3D runtime", "[low_level_morpho]")
  0 0 5";
   const auto img_str = poutre::ImageToString(img_out);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
-}
\ No newline at end of file
+}
+namespace {
+template<typename T, std::ptrdiff_t Rank>
+void CheckRuntime(const std::vector<std::size_t> &shape, const poutre::se::details::neighbor_list_t<Rank> &nl)
+{
+  poutre::details::image_t<T, Rank> imgin(shape);
+  poutre::test::FillRandom(imgin, 11);// NOLINT
+  poutre::details::image_t<T, Rank> imgout(shape);
+  poutre::details::image_t<T, Rank> imgref(shape);
+
+  poutre::test::ForEachThreading([&] {
+    poutre::llm::details::t_Erode(imgin, nl, imgout);
+    poutre::test::NaiveErodeDilate(imgin, nl, true, imgref);
+    REQUIRE(poutre::test::SameImages(imgout, imgref));
+    poutre::llm::details::t_Dilate(imgin, nl, imgout);
+    poutre::test::NaiveErodeDilate(imgin, nl, false, imgref);
+    REQUIRE(poutre::test::SameImages(imgout, imgref));
+  });
+}
+}// namespace
+
+TEST_CASE("erode dilate asymmetric runtime", "[low_level_morpho]")
+{
+  // no center, duplicate point, uneven extents on each axis
+  const poutre::se::details::neighbor_list_t<2> nl2d({ { -2, 1 }, { 1, 3 }, { 0, -1 }, { 3, -5 }, { 1, 3 } });
+  CheckRuntime<poutre::pUINT8, 2>({ 37, 53 }, nl2d);
+  CheckRuntime<poutre::pINT32, 2>({ 37, 53 }, nl2d);
+  CheckRuntime<poutre::pDOUBLE, 2>({ 4, 70 }, nl2d);
+  CheckRuntime<poutre::pUINT8, 2>({ 37, 53 }, poutre::se::SESquare2D);
+
+  const poutre::se::details::neighbor_list_t<3> nl3d({ { 0, 0, 0 }, { -1, 2, 0 }, { 2, 0, -3 }, { 0, -1, 1 } });
+  CheckRuntime<poutre::pUINT8, 3>({ 7, 11, 45 }, nl3d);
+  CheckRuntime<poutre::pINT64, 3>({ 7, 11, 45 }, nl3d);
+}
+
+TEST_CASE("erode dilate decomposed runtime", "[low_level_morpho]")
+{
+  // large SE: off centered even rectangle, disk with a hole, cross
+  std::vector<std::vector<poutre::details::av::idx2d>> all_coords(3);
+  for (std::ptrdiff_t y = -1; y <= 4; ++y) {
+    for (std::ptrdiff_t x = -3; x <= 6; ++x) { all_coords[0].push_back({ y, x }); }
+  }
+  for (std::ptrdiff_t y = -7; y <= 7; ++y) {
+    for (std::ptrdiff_t x = -7; x <= 7; ++x) {
+      if (x * x + y * y <= 49 && (x != 3 || y != 1)) { all_coords[1].push_back({ y, x }); }
+    }
+  }
+  for (std::ptrdiff_t i = -9; i <= 9; ++i) {
+    all_coords[2].push_back({ i, 0 });
+    all_coords[2].push_back({ 0, i });
+  }
+  for (const auto &coords : all_coords) {
+    const poutre::se::details::neighbor_list_t<2> nl(coords);
+    REQUIRE(poutre::se::GetDecompositionPlan(nl)->IsWorthIt());
+    poutre::details::image_t<poutre::pUINT8, 2> imgin({ 29, 41 });
+    std::mt19937 gen(5);// NOLINT
+    std::uniform_int_distribution<int> dist(0, 255);// NOLINT
+    for (auto &val : imgin) { val = static_cast<poutre::pUINT8>(dist(gen)); }
+    poutre::details::image_t<poutre::pUINT8, 2> imgout({ 29, 41 });
+    poutre::details::image_t<poutre::pUINT8, 2> imgref({ 29, 41 });
+
+    poutre::Erode(imgin, nl, imgout);
+    poutre::test::NaiveErodeDilate(imgin, nl, true, imgref);
+    REQUIRE(poutre::test::SameImages(imgout, imgref));
+    poutre::Dilate(imgin, nl, imgout);
+    poutre::test::NaiveErodeDilate(imgin, nl, false, imgref);
+    REQUIRE(poutre::test::SameImages(imgout, imgref));
+  }
+}
+
+TEST_CASE("erode dilate chained", "[low_level_morpho]")
+{
+  auto clone = [](const poutre::se::IStructuringElement &strel) { return strel.Clone(); };
+  poutre::se::ChainedStructuringElement chain;
+  chain.append(clone(poutre::se::SESegmentX2D));
+  chain.append(clone(poutre::se::SESegmentY2D));
+  chain.append(clone(poutre::se::SESegmentX2D));
+  REQUIRE(chain.GetChainSize() == 3);
+  // segment x (x) segment y (x) segment x is a 3x5 rectangle
+  std::vector<poutre::details::av::idx2d> coords;
+  for (std::ptrdiff_t y = -1; y <= 1; ++y) {
+    for (std::ptrdiff_t x = -2; x <= 2; ++x) { coords.push_back({ y, x }); }
+  }
+  const poutre::se::details::neighbor_list_t<2> rect(coords);
+
+  poutre::details::image_t<poutre::pINT32, 2> imgin({ 17, 23 });
+  std::mt19937 gen(7);// NOLINT
+  std::uniform_int_distribution<int> dist(-100, 100);// NOLINT
+  for (auto &val : imgin) { val = dist(gen); }
+  poutre::details::image_t<poutre::pINT32, 2> imgout({ 17, 23 });
+  poutre::details::image_t<poutre::pINT32, 2> imgref({ 17, 23 });
+  poutre::Erode(imgin, chain, imgout);
+  poutre::test::NaiveErodeDilate(imgin, rect, true, imgref);
+  REQUIRE(poutre::test::SameImages(imgout, imgref));
+  poutre::Dilate(imgin, chain, imgout);
+  poutre::test::NaiveErodeDilate(imgin, rect, false, imgref);
+  REQUIRE(poutre::test::SameImages(imgout, imgref));
+}
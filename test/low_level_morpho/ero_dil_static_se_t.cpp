@@ -10,17 +10,23 @@
 //                     http://www.boost.org/LICENSE_1_0.txt                   //
 //==============================================================================
 
+#include "test_helpers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 //#include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/types.hpp>
 #include <cstddef>
 //#include <poutre/structuring_element/details/neighbor_list_static_se_t.hpp>
+#include <poutre/structuring_element/predefined_nl_se.hpp>
 #include <poutre/structuring_element/se_types_and_tags.hpp>
 #include <poutre/low_level_morpho/details/ero_dil_static_se_t.hpp>
+#include <poutre/low_level_morpho/ero_dil.hpp>
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -641,4 +647,85 @@ TEST_CASE("erode cross3D", "[low_level_morpho]")
  0 0 5";
   const auto img_str = poutre::ImageToString(img_out);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
-}
\ No newline at end of file
+}
+TEST_CASE("erode dilate 2D row strips", "[low_level_morpho]")
+{
+  poutre::test::ScopedExecutionContext ctx;
+
+  const std::vector<std::size_t> shape = { 53, 37 };
+  poutre::details::image_t<poutre::pINT32> img_in(shape);
+  poutre::details::image_t<poutre::pINT32> img_serial(shape);
+  poutre::details::image_t<poutre::pINT32> img_strips(shape);
+  poutre::pINT32 seed = 17;
+  for (auto &val : img_in) {
+    seed = (seed * 1103 + 12345) % 251;// NOLINT
+    val = seed;
+  }
+
+  const std::vector<poutre::se::Common_NL_SE> nl_list = { poutre::se::Common_NL_SE::SESquare2D,
+    poutre::se::Common_NL_SE::SECross2D,
+    poutre::se::Common_NL_SE::SESegmentX2D,
+    poutre::se::Common_NL_SE::SESegmentY2D };
+  for (const auto nl_static : nl_list) {
+    ctx.Set(1);
+    poutre::llm::details::t_Dilate(img_in, nl_static, img_serial);
+    ctx.Set(4, 37 * 3);// NOLINT several strips of few lines
+    poutre::llm::details::t_Dilate(img_in, nl_static, img_strips);
+    REQUIRE(poutre::test::SameImages(img_serial, img_strips));
+
+    ctx.Set(1);
+    poutre::llm::details::t_Erode(img_in, nl_static, img_serial);
+    ctx.Set(4);
+    poutre::llm::details::t_Erode(img_in, nl_static, img_strips);
+    REQUIRE(poutre::test::SameImages(img_serial, img_strips));
+  }
+}
+
+TEST_CASE("erode dilate 16 bits", "[low_level_morpho]")
+{
+  // values beyond the 8 bits range, wide lines reach the simd body
+  const std::vector<std::size_t> shape = { 3, 40 };
+  const auto img_in = poutre::Create(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT16);
+  auto *img = dynamic_cast<poutre::details::image_t<poutre::pUINT16> *>(img_in.get());
+  REQUIRE(img);
+  img->fill(1000);// NOLINT //-V522
+  img->SetPixel(20, 1, 60000);// NOLINT
+  const auto img_out =
+    poutre::Create(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT16);
+  auto *out = dynamic_cast<poutre::details::image_t<poutre::pUINT16> *>(img_out.get());
+  REQUIRE(out);
+
+  poutre::Dilate(*img_in, poutre::se::Common_NL_SE::SECross2D, 1, *img_out);
+  REQUIRE(std::count(out->begin(), out->end(), 60000) == 5);//-V522
+  REQUIRE(out->GetPixel(19, 1) == 60000);
+  REQUIRE(out->GetPixel(20, 0) == 60000);
+  poutre::Erode(*img_in, poutre::se::Common_NL_SE::SESquare2D, 1, *img_out);
+  REQUIRE(std::all_of(out->begin(), out->end(), [](poutre::pUINT16 val) { return val == 1000; }));
+}
+
+TEST_CASE("erode dilate square3D cross3D non cubic", "[low_level_morpho]")
+{
+  // every axis a different size, single slice volume included
+  const std::vector<std::vector<std::size_t>> shapes = { { 4, 6, 9 }, { 7, 3, 5 }, { 1, 5, 8 }, { 2, 9, 3 } };
+  for (const auto &shape : shapes) {
+    poutre::details::image_t<poutre::pINT32, 3> img_in(shape);
+    poutre::details::image_t<poutre::pINT32, 3> img_out(shape);
+    poutre::details::image_t<poutre::pINT32, 3> img_ref(shape);
+    poutre::pINT32 seed = 11;
+    for (auto &val : img_in) {
+      seed = (seed * 1103 + 12345) % 251;// NOLINT
+      val = seed;
+    }
+    for (const bool cross : { false, true }) {
+      const auto nl_static = cross ? poutre::se::Common_NL_SE::SECross3D : poutre::se::Common_NL_SE::SESquare3D;
+      const auto &nl = cross ? poutre::se::SECross3D : poutre::se::SESquare3D;
+      poutre::llm::details::t_Dilate(img_in, nl_static, img_out);
+      poutre::test::NaiveErodeDilate(img_in, nl, false, img_ref);
+      REQUIRE(poutre::test::SameImages(img_ref, img_out));
+
+      poutre::llm::details::t_Erode(img_in, nl_static, img_out);
+      poutre::test::NaiveErodeDilate(img_in, nl, true, img_ref);
+      REQUIRE(poutre::test::SameImages(img_ref, img_out));
+    }
+  }
+}
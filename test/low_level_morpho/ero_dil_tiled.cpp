@@ -0,0 +1,192 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include "test_helpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_string.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/details/data_structures/image_tiled_t.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/image_interface.hpp>
+#include <poutre/base/types.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_tiled_t.hpp>
+#include <poutre/low_level_morpho/ero_dil.hpp>
+#include <poutre/pixel_processing/copy_convert.hpp>
+#include <poutre/structuring_element/predefined_nl_se.hpp>
+#include <poutre/structuring_element/se_types_and_tags.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace {
+//! tiled erosion/dilation must match the brute force one
+template<typename T, std::ptrdiff_t Rank>
+void CheckTiled(const std::vector<std::size_t> &shape,
+  const poutre::se::details::neighbor_list_t<Rank> &nl,
+  std::ptrdiff_t tile_edge)
+{
+  poutre::details::image_t<T, Rank> img(shape);
+  poutre::details::image_t<T, Rank> ref(shape);
+  poutre::details::image_t<T, Rank> out(shape);
+  poutre::details::image_tiled_t<T, Rank> tiled(shape, tile_edge);
+  poutre::details::image_tiled_t<T, Rank> tiled_out(shape, tile_edge, poutre::AllocationMode::Uninitialized);
+  poutre::test::FillRandom(img, 5);// NOLINT
+  tiled.CopyFrom(img);
+
+  poutre::test::ForEachThreading([&] {
+    poutre::test::NaiveErodeDilate(img, nl, true, ref);
+    poutre::llm::details::t_Erode(tiled, nl, tiled_out);
+    tiled_out.CopyTo(out);
+    REQUIRE(poutre::test::SameImages(ref, out));
+
+    poutre::test::NaiveErodeDilate(img, nl, false, ref);
+    poutre::llm::details::t_Dilate(tiled, nl, tiled_out);
+    tiled_out.CopyTo(out);
+    REQUIRE(poutre::test::SameImages(ref, out));
+  });
+}
+}// namespace
+
+TEST_CASE("tiled layout", "[low_level_morpho]")
+{
+  const std::vector<std::size_t> shape{ 19, 37 };
+  poutre::details::image_tiled_t<poutre::pINT32, 2> tiled(shape, 8);// NOLINT
+  REQUIRE(tiled.tile_size() == 64);
+  REQUIRE(tiled.grid()[0] == 3);
+  REQUIRE(tiled.grid()[1] == 5);
+  REQUIRE(tiled.nb_tiles() == 15);
+  REQUIRE(tiled.TileBound({ 2, 4 })[0] == 3);// NOLINT
+  REQUIRE(tiled.TileBound({ 2, 4 })[1] == 5);// NOLINT
+
+  poutre::details::image_t<poutre::pINT32, 2> img(shape);
+  for (std::size_t i = 0; i < img.size(); ++i) { img.data()[i] = static_cast<poutre::pINT32>(i); }
+  tiled.CopyFrom(img);
+  REQUIRE(tiled[{ 10, 20 }] == 10 * 37 + 20);// NOLINT
+
+  // every valid pixel visited once through the tile views
+  std::size_t visited = 0;
+  for (const auto &tile : tiled.grid()) {
+    const auto origin = tiled.TileOrigin(tile);
+    const auto tileview = view(tiled, tile);
+    for (const auto &idx : tileview.bound()) {
+      REQUIRE(tileview[idx] == (origin[0] + idx[0]) * 37 + origin[1] + idx[1]);// NOLINT
+      ++visited;
+    }
+  }
+  REQUIRE(visited == img.size());
+
+  poutre::details::image_t<poutre::pINT32, 2> back(shape);
+  tiled.CopyTo(back);
+  REQUIRE(poutre::test::SameImages(img, back));
+
+  std::vector<poutre::pINT32> row(12);// NOLINT
+  tiled.ReadRow({ 18, 30 }, 12, row.data(), -1);// NOLINT
+  REQUIRE(row[0] == 18 * 37 + 30);
+  REQUIRE(row[6] == 18 * 37 + 36);
+  REQUIRE(row[7] == -1);
+  tiled.ReadRow({ 19, 0 }, 12, row.data(), -1);// NOLINT
+  REQUIRE(std::all_of(row.begin(), row.end(), [](auto val) { return val == -1; }));
+}
+
+TEST_CASE("erode dilate tiled 2D", "[low_level_morpho]")
+{
+  for (const std::ptrdiff_t edge : { 4, 16, 64 }) {// NOLINT
+    CheckTiled<poutre::pUINT8, 2>({ 45, 70 }, poutre::se::SESquare2D, edge);// NOLINT
+    CheckTiled<poutre::pUINT8, 2>({ 45, 70 }, poutre::se::SECross2D, edge);// NOLINT
+    CheckTiled<poutre::pINT32, 2>({ 45, 70 }, poutre::se::SESegmentY2D, edge);// NOLINT
+    CheckTiled<poutre::pFLOAT, 2>({ 3, 5 }, poutre::se::SESegmentX2D, edge);// NOLINT
+  }
+}
+
+TEST_CASE("erode dilate tiled 3D", "[low_level_morpho]")
+{
+  for (const std::ptrdiff_t edge : { 4, 32 }) {// NOLINT
+    CheckTiled<poutre::pUINT8, 3>({ 9, 13, 40 }, poutre::se::SESquare3D, edge);// NOLINT
+    CheckTiled<poutre::pUINT8, 3>({ 9, 13, 40 }, poutre::se::SECross3D, edge);// NOLINT
+    CheckTiled<poutre::pINT16, 3>({ 9, 13, 40 }, poutre::se::SESegmentZ3D, edge);// NOLINT
+  }
+
+  const std::vector<std::size_t> shape{ 6, 7, 8 };
+  poutre::details::image_t<poutre::pUINT8, 3> img(shape);
+  poutre::details::image_t<poutre::pUINT8, 3> ref(shape);
+  poutre::details::image_t<poutre::pUINT8, 3> out(shape);
+  poutre::details::image_tiled_t<poutre::pUINT8, 3> tiled(shape, 4);
+  poutre::details::image_tiled_t<poutre::pUINT8, 3> tiled_out(shape, 4);
+  std::mt19937 gen(9);// NOLINT
+  for (auto &val : img) { val = static_cast<poutre::pUINT8>(gen()); }
+  tiled.CopyFrom(img);
+  poutre::llm::details::t_Erode(img, poutre::se::SESquare3D, ref);
+  poutre::llm::details::t_Erode<poutre::se::Common_NL_SE::SESquare3D>(tiled, tiled_out);
+  tiled_out.CopyTo(out);
+  REQUIRE(poutre::test::SameImages(ref, out));
+}
+
+TEST_CASE("erode dilate tiled through the interface", "[low_level_morpho]")
+{
+  const auto check = [](const std::vector<std::size_t> &shape, poutre::se::Common_NL_SE nl, int iter) {
+    auto img = poutre::Create(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayINT16);
+    auto *pixels = static_cast<poutre::pINT16 *>(img->GetVoidPtr());
+    std::size_t size = 1;
+    for (const auto dim : shape) { size *= dim; }
+    std::mt19937 gen(13);// NOLINT
+    for (std::size_t i = 0; i < size; ++i) { pixels[i] = static_cast<poutre::pINT16>(gen() % 1000U); }// NOLINT
+    auto ref = poutre::CloneGeometry(*img);
+    auto back = poutre::CloneGeometry(*img);
+
+    auto tiled =
+      poutre::CreateTiled(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayINT16, 8);
+    poutre::ConvertInto(*img, *tiled);
+    auto tiled_out = poutre::CloneGeometry(*tiled);
+    REQUIRE(tiled_out->GetTileEdge() == 8);
+
+    poutre::Erode(*img, nl, iter, *ref);
+    poutre::Erode(*tiled, nl, iter, *tiled_out);
+    poutre::ConvertInto(*tiled_out, *back);
+    REQUIRE(poutre::ImageToString(*back) == poutre::ImageToString(*ref));
+
+    poutre::Dilate(*img, nl, iter, *ref);
+    poutre::Dilate(*tiled, nl, iter, *tiled_out);
+    poutre::ConvertInto(*tiled_out, *back);
+    REQUIRE(poutre::ImageToString(*back) == poutre::ImageToString(*ref));
+  };
+  for (const int iter : { 1, 2, 5 }) {// NOLINT
+    check({ 29, 41 }, poutre::se::Common_NL_SE::SESquare2D, iter);// NOLINT
+    check({ 29, 41 }, poutre::se::Common_NL_SE::SECross2D, iter);// NOLINT
+    check({ 29, 41 }, poutre::se::Common_NL_SE::SESegmentY2D, iter);// NOLINT
+    check({ 7, 11, 19 }, poutre::se::Common_NL_SE::SESquare3D, iter);// NOLINT
+    check({ 7, 11, 19 }, poutre::se::Common_NL_SE::SESegmentZ3D, iter);// NOLINT
+  }
+
+  const std::vector<std::size_t> shape{ 8, 8 };
+  auto tiled = poutre::CreateTiled(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8);
+  REQUIRE(tiled->GetTileEdge() == poutre::details::image_tiled_t<poutre::pUINT8, 2>::default_tile_edge);
+  REQUIRE(tiled->GetShape() == shape);
+  auto img = poutre::Create(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8);
+  REQUIRE(img->GetTileEdge() == 0);
+  // mixing tiled and row major images is refused
+  REQUIRE_THROWS(poutre::Erode(*img, poutre::se::Common_NL_SE::SESquare2D, 1, *tiled));
+  // also on the line pass shortcut of large squares, whichever image is tiled
+  const auto layout_error = Catch::Matchers::ContainsSubstring("tiled alike");
+  REQUIRE_THROWS_WITH(poutre::Erode(*img, poutre::se::Common_NL_SE::SESquare2D, 5, *tiled), layout_error);// NOLINT
+  REQUIRE_THROWS_WITH(poutre::Dilate(*img, poutre::se::Common_NL_SE::SESquare2D, 5, *tiled), layout_error);// NOLINT
+  REQUIRE_THROWS_WITH(poutre::Dilate(*tiled, poutre::se::Common_NL_SE::SESquare2D, 5, *img), layout_error);// NOLINT
+  auto other_tiles =
+    poutre::CreateTiled(shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8, 4);
+  REQUIRE_THROWS_WITH(poutre::Dilate(*other_tiles, poutre::se::Common_NL_SE::SECross2D, 2, *tiled), layout_error);
+  REQUIRE_THROWS(poutre::CreateTiled({ 8 }, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayUINT8));
+  REQUIRE_THROWS(
+    poutre::CreateTiled(shape, poutre::CompoundType::CompoundType_3Planes, poutre::PType::PType_GrayUINT8));
+}
@@ -10,14 +10,18 @@
 //                     http://www.boost.org/LICENSE_1_0.txt                   //
 //==============================================================================
 
+#include "test_helpers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include <poutre/base/details/data_structures/array_view.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/types.hpp>
 // #include <poutre/base/types_traits.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <poutre/pixel_processing/details/arith_op_t.hpp>
 #include <string>
@@ -732,4 +736,52 @@ TEST_CASE("ssub same ptr type compatible offset", "[arith]")
 0 0 0 0 0 0";
   const auto img_str = poutre::ImageToString(img3);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
-}
\ No newline at end of file
+}
+TEST_CASE("sadd block parallel same and diff ptr type", "[arith]")
+{
+  poutre::test::ScopedExecutionContext ctx;
+  ctx.Set(4, poutre::test::small_grain);// force split in many blocks
+
+  const std::vector<std::size_t> shape = { 61, 67 };
+  poutre::details::image_t<poutre::pINT32> img1(shape);
+  poutre::details::image_t<poutre::pINT32> img2(shape);
+  for (std::size_t i = 0; i < img1.size(); ++i) {
+    img1[i] = static_cast<poutre::pINT32>(i);
+    img2[i] = static_cast<poutre::pINT32>(2 * i);
+  }
+  // simd path
+  poutre::details::image_t<poutre::pINT32> imgout(shape);
+  poutre::details::t_ArithSaturatedAdd(img1, img2, imgout);
+  // std::transform path
+  poutre::details::image_t<poutre::pINT64> imgout64(shape);
+  poutre::details::t_ArithInvert(img1, imgout64);
+  for (std::size_t i = 0; i < img1.size(); ++i) {
+    REQUIRE(imgout[i] == static_cast<poutre::pINT32>(3 * i));
+    REQUIRE(imgout64[i] == -static_cast<poutre::pINT64>(i));
+  }
+}
+
+TEST_CASE("sadd ssub 16 bits", "[arith]")
+{
+  // wide enough lines to go through the simd body and the scalar tail
+  const std::vector<std::size_t> shape = { 3, 37 };
+  poutre::details::image_t<poutre::pUINT16> img1(shape);
+  img1.fill(65000);// NOLINT
+  poutre::details::image_t<poutre::pUINT16> img2(shape);
+  img2.fill(1000);// NOLINT
+  poutre::details::image_t<poutre::pUINT16> img3(shape);
+  poutre::details::t_ArithSaturatedAdd(img1, img2, img3);
+  REQUIRE(std::all_of(img3.begin(), img3.end(), [](poutre::pUINT16 val) { return val == 65535; }));
+  poutre::details::t_ArithSaturatedSub(img2, img1, img3);
+  REQUIRE(std::all_of(img3.begin(), img3.end(), [](poutre::pUINT16 val) { return val == 0; }));
+
+  poutre::details::image_t<poutre::pINT16> simg1(shape);
+  simg1.fill(-32000);// NOLINT
+  poutre::details::image_t<poutre::pINT16> simg2(shape);
+  simg2.fill(1000);// NOLINT
+  poutre::details::image_t<poutre::pINT16> simg3(shape);
+  poutre::details::t_ArithSaturatedSub(simg1, simg2, simg3);
+  REQUIRE(std::all_of(simg3.begin(), simg3.end(), [](poutre::pINT16 val) { return val == -32768; }));
+  poutre::details::t_ArithSaturatedAddConstant(simg2, static_cast<poutre::pINT16>(32000), simg3);// NOLINT
+  REQUIRE(std::all_of(simg3.begin(), simg3.end(), [](poutre::pINT16 val) { return val == 32767; }));
+}
@@ -10,6 +10,8 @@
 //                     http://www.boost.org/LICENSE_1_0.txt                   //Z
 //==============================================================================
 
+#include "test_helpers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
@@ -19,8 +21,14 @@
 #include <poutre/base/types.hpp>
 // #include <poutre/base/types_traits.hpp>
 #include <cstddef>
+#include <filesystem>
+#include <poutre/base/execution.hpp>
+#include <poutre/base/mapped_file.hpp>
+#include <poutre/pixel_processing/compare.hpp>
 #include <poutre/pixel_processing/details/compare_op_t.hpp>
+#include <random>
 #include <string>
+#include <system_error>
 #include <vector>
 
 
@@ -2760,3 +2768,131 @@ TEST_CASE("isi whole image inf equal", "[compare]")
   const auto img_str = poutre::ImageToString(imgout);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
 }
+
+namespace {
+template<typename T> bool RefCompare(poutre::CompOpType op, T lhs, T rhs)
+{
+  switch (op) {
+  case poutre::CompOpType::CompOpEqual:
+    return lhs == rhs;
+  case poutre::CompOpType::CompOpDiff:
+    return lhs != rhs;
+  case poutre::CompOpType::CompOpSup:
+    return lhs > rhs;
+  case poutre::CompOpType::CompOpSupEqual:
+    return lhs >= rhs;
+  case poutre::CompOpType::CompOpInf:
+    return lhs < rhs;
+  case poutre::CompOpType::CompOpInfEqual:
+    return lhs <= rhs;
+  default:
+    return false;
+  }
+}
+
+// compare/select with Tin != Tout (mixed types simd kernel) against a scalar reference, for all variants
+template<typename Tin, typename Tout> void CheckMixedCompare()
+{
+  // not a multiple of simd lanes to exercise epilogue
+  const std::vector<std::size_t> shape = { 37, 53 };
+  std::mt19937 gen(42);// NOLINT
+  std::uniform_int_distribution<int> dist(0, 4);
+  poutre::details::image_t<Tin> imgin(shape);
+  poutre::details::image_t<Tin> imgcomp(shape);
+  poutre::details::image_t<Tout> imgtrue(shape);
+  poutre::details::image_t<Tout> imgfalse(shape);
+  for (std::size_t i = 0; i < imgin.size(); ++i) {
+    imgin[i] = static_cast<Tin>(dist(gen));
+    imgcomp[i] = static_cast<Tin>(dist(gen));
+    imgtrue[i] = static_cast<Tout>(dist(gen) + 10);
+    imgfalse[i] = static_cast<Tout>(dist(gen) + 20);
+  }
+  const Tin compval = 2;
+  const Tout valtrue = 1;
+  const Tout valfalse = 0;
+  poutre::details::image_t<Tout> imgout(shape);
+
+  const std::vector<poutre::CompOpType> ops = { poutre::CompOpType::CompOpEqual,
+    poutre::CompOpType::CompOpDiff,
+    poutre::CompOpType::CompOpSup,
+    poutre::CompOpType::CompOpSupEqual,
+    poutre::CompOpType::CompOpInf,
+    poutre::CompOpType::CompOpInfEqual };
+  for (const auto op : ops) {
+    // true if every pixel matches ref(i)
+    auto check = [&](auto ref) {
+      for (std::size_t i = 0; i < imgout.size(); ++i) {
+        if (imgout[i] != ref(i)) { return false; }
+      }
+      return true;
+    };
+    poutre::details::t_CompareImage_sss(imgin, op, compval, valtrue, valfalse, imgout);
+    REQUIRE(check([&](std::size_t i) { return RefCompare(op, imgin[i], compval) ? valtrue : valfalse; }));
+    poutre::details::t_CompareImage_iss(imgin, op, imgcomp, valtrue, valfalse, imgout);
+    REQUIRE(check([&](std::size_t i) { return RefCompare(op, imgin[i], imgcomp[i]) ? valtrue : valfalse; }));
+    poutre::details::t_CompareImage_sis(imgin, op, compval, imgtrue, valfalse, imgout);
+    REQUIRE(check([&](std::size_t i) { return RefCompare(op, imgin[i], compval) ? imgtrue[i] : valfalse; }));
+    poutre::details::t_CompareImage_ssi(imgin, op, compval, valtrue, imgfalse, imgout);
+    REQUIRE(check([&](std::size_t i) { return RefCompare(op, imgin[i], compval) ? valtrue : imgfalse[i]; }));
+    poutre::details::t_CompareImage_sii(imgin, op, compval, imgtrue, imgfalse, imgout);
+    REQUIRE(check([&](std::size_t i) { return RefCompare(op, imgin[i], compval) ? imgtrue[i] : imgfalse[i]; }));
+    poutre::details::t_CompareImage_isi(imgin, op, imgcomp, valtrue, imgfalse, imgout);
+    REQUIRE(check([&](std::size_t i) { return RefCompare(op, imgin[i], imgcomp[i]) ? valtrue : imgfalse[i]; }));
+    poutre::details::t_CompareImage_iis(imgin, op, imgcomp, imgtrue, valfalse, imgout);
+    REQUIRE(check([&](std::size_t i) { return RefCompare(op, imgin[i], imgcomp[i]) ? imgtrue[i] : valfalse; }));
+    poutre::details::t_CompareImage_iii(imgin, op, imgcomp, imgtrue, imgfalse, imgout);
+    REQUIRE(check([&](std::size_t i) { return RefCompare(op, imgin[i], imgcomp[i]) ? imgtrue[i] : imgfalse[i]; }));
+  }
+}
+}// namespace
+
+TEST_CASE("mixed types compare", "[compare]")
+{
+  poutre::test::ForEachThreading([] {
+    CheckMixedCompare<poutre::pFLOAT, poutre::pUINT8>();
+    CheckMixedCompare<poutre::pUINT8, poutre::pINT32>();
+    CheckMixedCompare<poutre::pINT32, poutre::pDOUBLE>();
+    CheckMixedCompare<poutre::pINT64, poutre::pUINT8>();
+    CheckMixedCompare<poutre::pDOUBLE, poutre::pINT64>();
+  });
+}
+
+
+TEST_CASE("compare mapped images", "[compare]")
+{
+  const auto dir = std::filesystem::temp_directory_path();
+  const auto in_path = (dir / "poutre_compare_in.bin").string();
+  const auto out_path = (dir / "poutre_compare_out.bin").string();
+  const std::vector<std::size_t> shape = { 37, 53 };
+  using img_t = poutre::details::image_t<poutre::pINT32, 2>;
+  {
+    auto img = poutre::CreateMappedImage(
+      in_path, shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayINT32);
+    auto *typed = dynamic_cast<img_t *>(img.get());
+    REQUIRE(typed != nullptr);
+    for (std::size_t i = 0; i < typed->size(); ++i) { typed->data()[i] = static_cast<poutre::pINT32>(i % 7); }
+  }
+  {
+    // read only input, hinted sequential for the duration of the call
+    const auto imgin = poutre::MapImage(in_path, poutre::MapAccess::ReadOnly);
+    auto imgout = poutre::CreateMappedImage(
+      out_path, shape, poutre::CompoundType::CompoundType_Scalar, poutre::PType::PType_GrayINT32);
+    poutre::CompareImage(*imgin,
+      poutre::CompOpType::CompOpSup,
+      poutre::pINT32{ 3 },
+      poutre::pINT32{ 255 },
+      poutre::pINT32{ 0 },
+      *imgout);
+  }
+  {
+    const auto imgout = poutre::MapImage(out_path, poutre::MapAccess::ReadOnly);
+    const auto *typed = dynamic_cast<const img_t *>(imgout.get());
+    REQUIRE(typed != nullptr);
+    bool same = true;
+    for (std::size_t i = 0; i < typed->size(); ++i) { same = same && typed->data()[i] == (i % 7 > 3 ? 255 : 0); }
+    REQUIRE(same);
+  }
+  std::error_code err;
+  std::filesystem::remove(in_path, err);
+  std::filesystem::remove(out_path, err);
+}
@@ -10,10 +10,13 @@
 //                     http://www.boost.org/LICENSE_1_0.txt                   //Z
 //==============================================================================
 
+#include "test_helpers.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 #include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
 #include <poutre/base/image_interface.hpp>
 #include <poutre/base/types.hpp>
 #include <cstddef>
@@ -46,4 +49,41 @@ TEST_CASE("2D along x", "[isometry]")
 
   const auto img_str = poutre::ImageToString(img2);
   REQUIRE_THAT(img_str, Catch::Matchers::Equals(expected));
-}
\ No newline at end of file
+}
+
+namespace {
+// sizes not multiple of micro/cache tiles to exercise borders
+template<typename T> void CheckTranspose(std::ptrdiff_t rows, std::ptrdiff_t cols)
+{
+  const std::vector<std::size_t> shape_in = { static_cast<std::size_t>(cols), static_cast<std::size_t>(rows) };
+  const std::vector<std::size_t> shape_out = { static_cast<std::size_t>(rows), static_cast<std::size_t>(cols) };
+  poutre::details::image_t<T> imgin(shape_in);
+  poutre::details::image_t<T> imgout(shape_out);
+  for (std::size_t i = 0; i < imgin.size(); ++i) { imgin[i] = static_cast<T>(i % 127); }
+  poutre::details::t_transpose(imgin, imgout);
+  bool ok = true;
+  for (std::ptrdiff_t r = 0; r < rows; ++r) {
+    for (std::ptrdiff_t c = 0; c < cols; ++c) {
+      ok = ok && imgout[static_cast<std::size_t>(c * rows + r)] == imgin[static_cast<std::size_t>(r * cols + c)];
+    }
+  }
+  REQUIRE(ok);
+}
+}// namespace
+
+TEST_CASE("2D blocked", "[isometry]")
+{
+  poutre::test::ForEachThreading([] {
+    CheckTranspose<poutre::pUINT8>(131, 77);
+    CheckTranspose<poutre::pINT32>(77, 131);
+    CheckTranspose<poutre::pFLOAT>(64, 64);
+    CheckTranspose<poutre::pINT64>(3, 200);
+    CheckTranspose<poutre::pDOUBLE>(97, 41);
+    // several simd register blocks per micro tile and several cache tiles per block
+    CheckTranspose<poutre::pUINT8>(300, 259);
+    CheckTranspose<poutre::pUINT16>(259, 300);
+    CheckTranspose<poutre::pINT16>(128, 96);
+    CheckTranspose<poutre::pINT32>(300, 259);
+    CheckTranspose<poutre::pDOUBLE>(259, 300);
+  });
+}
@@ -0,0 +1,138 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#include <catch2/catch_test_macros.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/types.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_decomposed_se_t.hpp>
+#include <poutre/low_level_morpho/details/ero_dil_runtime_nl_se_t.hpp>
+#include <poutre/structuring_element/predefined_nl_se.hpp>
+#include <poutre/structuring_element/se_decomposition.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+using Point = std::array<std::ptrdiff_t, 2>;
+
+poutre::se::details::neighbor_list_t<2>
+  Rectangle(std::ptrdiff_t y0, std::ptrdiff_t y1, std::ptrdiff_t x0, std::ptrdiff_t x1)
+{
+  std::vector<poutre::details::av::idx2d> points;
+  for (auto y = y0; y <= y1; ++y) {
+    for (auto x = x0; x <= x1; ++x) { points.push_back({ y, x }); }
+  }
+  return poutre::se::details::neighbor_list_t<2>(points);
+}
+
+// points covered by the plan
+std::set<Point> Cover(const poutre::se::DecompositionPlan2D &plan)
+{
+  std::set<Point> points;
+  for (const auto &group : plan.groups) {
+    for (const auto &shift : group.shifts) {
+      for (auto y = -group.size_half_y; y <= group.size_half_y; ++y) {
+        for (auto x = -group.size_half_x; x <= group.size_half_x; ++x) {
+          points.insert({ shift[0] + y, shift[1] + x });
+        }
+      }
+    }
+  }
+  return points;
+}
+}// namespace
+
+TEST_CASE("decompose rectangle", "[se_decomposition]")
+{
+  const auto odd_plan = poutre::se::DecomposeNeighborList(Rectangle(-2, 2, -3, 3));
+  REQUIRE(odd_plan.groups.size() == 1);
+  REQUIRE(odd_plan.groups[0].size_half_x == 3);
+  REQUIRE(odd_plan.groups[0].size_half_y == 2);
+  REQUIRE(odd_plan.groups[0].shifts == std::vector<Point>{ { 0, 0 } });
+  REQUIRE(odd_plan.IsWorthIt());
+
+  // off centered even sides, two overlapping odd sides on each axis
+  const auto even_plan = poutre::se::DecomposeNeighborList(Rectangle(1, 4, -1, 4));
+  REQUIRE(even_plan.groups.size() == 1);
+  REQUIRE(even_plan.groups[0].shifts.size() == 4);
+  REQUIRE(even_plan.extent_min == Point{ 1, -1 });
+  REQUIRE(even_plan.extent_max == Point{ 4, 4 });
+  std::set<Point> expected;
+  for (std::ptrdiff_t y = 1; y <= 4; ++y) {
+    for (std::ptrdiff_t x = -1; x <= 4; ++x) { expected.insert({ y, x }); }
+  }
+  REQUIRE(Cover(even_plan) == expected);
+
+  // small SE are cheaper as neighbor list
+  REQUIRE_FALSE(poutre::se::DecomposeNeighborList(poutre::se::SESquare2D).IsWorthIt());
+}
+
+TEST_CASE("decompose arbitrary", "[se_decomposition]")
+{
+  // disk radius 6 with a hole and an isolated point
+  std::vector<poutre::details::av::idx2d> coords;
+  std::set<Point> expected;
+  for (std::ptrdiff_t y = -6; y <= 6; ++y) {
+    for (std::ptrdiff_t x = -6; x <= 6; ++x) {
+      if (x * x + y * y > 36 || (x == 2 && y == -1)) { continue; }
+      coords.push_back({ y, x });
+      expected.insert({ y, x });
+    }
+  }
+  coords.push_back({ 9, -8 });
+  expected.insert({ 9, -8 });
+  coords.push_back({ 0, 0 });// duplicate
+  const poutre::se::details::neighbor_list_t<2> nl(coords);
+  const auto plan = poutre::se::DecomposeNeighborList(nl);
+  REQUIRE(plan.nb_points == expected.size());
+  REQUIRE(Cover(plan) == expected);
+  REQUIRE(plan.IsWorthIt());
+
+  // cached by content
+  const auto cached = poutre::se::GetDecompositionPlan(nl);
+  REQUIRE(cached == poutre::se::GetDecompositionPlan(poutre::se::details::neighbor_list_t<2>(coords)));
+  REQUIRE(Cover(*cached) == expected);
+}
+
+TEST_CASE("decompose with empty lines", "[se_decomposition]")
+{
+  // same run above and below an empty line, must not be stacked across it
+  std::vector<poutre::details::av::idx2d> coords;
+  std::set<Point> expected;
+  for (std::ptrdiff_t y = -9; y <= 9; ++y) {
+    if (y == 0) { continue; }
+    for (std::ptrdiff_t x = -4; x <= 4; ++x) {
+      coords.push_back({ y, x });
+      expected.insert({ y, x });
+    }
+  }
+  const poutre::se::details::neighbor_list_t<2> nl(coords);
+  const auto plan = poutre::se::DecomposeNeighborList(nl);
+  REQUIRE(Cover(plan) == expected);
+  REQUIRE(plan.IsWorthIt());
+
+  poutre::details::image_t<poutre::pUINT8, 2> imgin({ 31, 27 });
+  std::mt19937 gen(11);// NOLINT
+  for (auto &val : imgin) { val = static_cast<poutre::pUINT8>(gen()); }
+  poutre::details::image_t<poutre::pUINT8, 2> imgout({ 31, 27 });
+  poutre::details::image_t<poutre::pUINT8, 2> imgref({ 31, 27 });
+  poutre::llm::details::t_Erode(imgin, plan, imgout);
+  poutre::llm::details::t_Erode(imgin, nl, imgref);
+  REQUIRE(std::equal(imgout.begin(), imgout.end(), imgref.begin()));
+  poutre::llm::details::t_Dilate(imgin, plan, imgout);
+  poutre::llm::details::t_Dilate(imgin, nl, imgref);
+  REQUIRE(std::equal(imgout.begin(), imgout.end(), imgref.begin()));
+}
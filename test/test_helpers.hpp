@@ -0,0 +1,123 @@
+//==============================================================================
+//                  Copyright (c) 2015 - Thomas Retornaz                      //
+//                     thomas.retornaz@mines-paris.org                        //
+//          Distributed under the Boost Software License, Version 1.0.        //
+//                 See accompanying file LICENSE.txt or copy at               //
+//                     http://www.boost.org/LICENSE_1_0.txt                   //
+//==============================================================================
+
+#pragma once
+
+/**
+ * @file   test_helpers.hpp
+ * @author Thomas Retornaz
+ * @brief  Helpers shared by the unit tests: execution context guard, random fill and brute force references
+ *
+ *
+ */
+
+#include <poutre/base/details/data_structures/array_view.hpp>
+#include <poutre/base/details/data_structures/image_t.hpp>
+#include <poutre/base/execution.hpp>
+#include <poutre/structuring_element/details/neighbor_list_se_t.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <random>
+
+namespace poutre::test {
+
+/**
+ * @brief Restore the number of threads and the grain size of the execution context on scope exit
+ *
+ * Tests change both to force parallel splits, the destructor puts them back even when a REQUIRE throws.
+ * Non copyable, non movable.
+ */
+class ScopedExecutionContext
+{
+public:
+  ScopedExecutionContext()
+    : m_ctx(ExecutionContext::get()), m_nbthreads(m_ctx.GetNumThreads()), m_grain(m_ctx.GetGrainSize())
+  {}
+  ScopedExecutionContext(const ScopedExecutionContext &) = delete;
+  ScopedExecutionContext &operator=(const ScopedExecutionContext &) = delete;
+  ScopedExecutionContext(ScopedExecutionContext &&) = delete;
+  ScopedExecutionContext &operator=(ScopedExecutionContext &&) = delete;
+  ~ScopedExecutionContext()
+  {
+    m_ctx.SetNumThreads(m_nbthreads);
+    m_ctx.SetGrainSize(m_grain);
+  }
+
+  //! set the number of threads, the grain size is left unchanged
+  void Set(std::size_t nbthreads) { m_ctx.SetNumThreads(nbthreads); }
+
+  void Set(std::size_t nbthreads, std::size_t grain)
+  {
+    m_ctx.SetNumThreads(nbthreads);
+    m_ctx.SetGrainSize(grain);
+  }
+
+private:
+  ExecutionContext &m_ctx;
+  std::size_t m_nbthreads;
+  std::size_t m_grain;
+};
+
+//! grain size small enough to split test images in many blocks
+inline constexpr std::size_t small_grain = 64;
+
+//! Run check serially then with 4 threads and a small grain, the execution context is restored afterwards
+template<class Check> void ForEachThreading(Check &&check)
+{
+  ScopedExecutionContext ctx;
+  for (const std::size_t nbthreads : { std::size_t{ 1 }, std::size_t{ 4 } }) {
+    ctx.Set(nbthreads, small_grain);
+    check();
+  }
+}
+
+//! Fill img with uniform values in [0, maxval], reproducible from seed
+template<typename T, ptrdiff_t Rank>
+void FillRandom(poutre::details::image_t<T, Rank> &img, unsigned seed, int maxval = 200)// NOLINT
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<int> dist(0, maxval);
+  for (auto &val : img) { val = static_cast<T>(dist(gen)); }
+}
+
+//! Same shape and same pixels
+template<typename T1, typename T2, ptrdiff_t Rank>
+bool SameImages(const poutre::details::image_t<T1, Rank> &img1, const poutre::details::image_t<T2, Rank> &img2)
+{
+  return img1.GetShape() == img2.GetShape() && std::equal(img1.cbegin(), img1.cend(), img2.cbegin());
+}
+
+/**
+ * @brief Brute force erosion (erode) or dilation of img regarding nl, neighbors outside the image are ignored
+ *
+ * Reference for every erode/dilate kernel, whatever their layout or algorithm.
+ */
+template<typename T, ptrdiff_t Rank>
+void NaiveErodeDilate(const poutre::details::image_t<T, Rank> &img,
+  const poutre::se::details::neighbor_list_t<Rank> &nl,
+  bool erode,
+  poutre::details::image_t<T, Rank> &out)
+{
+  auto vin = poutre::details::view(img);
+  auto vout = poutre::details::view(out);
+  auto bnd = vin.bound();
+  for (auto it = begin(bnd); it != end(bnd); ++it) {
+    T val = erode ? std::numeric_limits<T>::max() : std::numeric_limits<T>::lowest();
+    for (const auto &nb : nl) {
+      auto idx = *it + nb;
+      if (!bnd.contains(idx)) { continue; }
+      val = erode ? std::min(val, vin[idx]) : std::max(val, vin[idx]);
+    }
+    vout[*it] = val;
+  }
+}
+
+}// namespace poutre::test